@@ -0,0 +1,157 @@
+#include <benchmark/benchmark.h>
+#include <QJsonDocument>
+#include "benchmarkdataset.h"
+
+// Element access, container conversion and toJsonObject() against the same operations on the raw QJsonDocument
+
+namespace {
+    void elementArguments(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->ArgName("elements")->RangeMultiplier(100)->Range(100, 1000000)->Unit(benchmark::kMicrosecond);
+    }
+
+    void recordArguments(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->ArgName("records")->RangeMultiplier(10)->Range(10, 100000)->Unit(benchmark::kMicrosecond);
+    }
+}
+
+// Baseline: indexed access on the parsed QJsonArray
+static void BM_AccessBaselineQJsonArray(benchmark::State& state)
+{
+    const QJsonArray integers = QJsonDocument::fromJson(BenchmarkData::makeNumbers(static_cast<int>(state.range(0)))).object()["integers"].toArray();
+    for (auto _ : state) {
+        qint64 sum = 0;
+        for (qsizetype i = 0; i < integers.size(); ++i)
+            sum += integers.at(i).toInt();
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AccessBaselineQJsonArray)->Apply(elementArguments);
+
+// Indexed access on the primitive TaggedJSONArray, every element is converted on access
+static void BM_AccessPrimitiveAt(benchmark::State& state)
+{
+    const BenchNumbers numbers = BenchNumbers::fromJson(BenchmarkData::makeNumbers(static_cast<int>(state.range(0))));
+    const qsizetype count = numbers.integers->size();
+    for (auto _ : state) {
+        qint64 sum = 0;
+        for (qsizetype i = 0; i < count; ++i)
+            sum += numbers.integers.at(i);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AccessPrimitiveAt)->Apply(elementArguments);
+
+// Conversion of the whole primitive array, then access on the std::vector
+static void BM_AccessPrimitiveToStdVector(benchmark::State& state)
+{
+    const BenchNumbers numbers = BenchNumbers::fromJson(BenchmarkData::makeNumbers(static_cast<int>(state.range(0))));
+    for (auto _ : state) {
+        const std::vector<double> doubles = numbers.doubles.toStdVector();
+        double sum = 0;
+        for (const double value : doubles)
+            sum += value;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AccessPrimitiveToStdVector)->Apply(elementArguments);
+
+// Conversion of the whole primitive array into a QVector
+static void BM_AccessPrimitiveToQVector(benchmark::State& state)
+{
+    const BenchNumbers numbers = BenchNumbers::fromJson(BenchmarkData::makeNumbers(static_cast<int>(state.range(0))));
+    for (auto _ : state) {
+        QVector<double> doubles = numbers.doubles.toQVector();
+        benchmark::DoNotOptimize(doubles);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AccessPrimitiveToQVector)->Apply(elementArguments);
+
+// Baseline: member access through the QJsonObject of each record
+static void BM_AccessBaselineRecords(benchmark::State& state)
+{
+    const QJsonArray records = QJsonDocument::fromJson(BenchmarkData::makeDataset(static_cast<int>(state.range(0)))).object()["records"].toArray();
+    for (auto _ : state) {
+        double sum = 0;
+        for (const QJsonValue& record : records)
+            sum += record.toObject()["score"].toDouble() + record.toObject()["location"].toObject()["latitude"].toDouble();
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AccessBaselineRecords)->Apply(recordArguments);
+
+// Member access on the tagged array elements, the members are already converted
+static void BM_AccessTaggedRecords(benchmark::State& state)
+{
+    const BenchDataset dataset = BenchDataset::fromJson(BenchmarkData::makeDataset(static_cast<int>(state.range(0))));
+    for (auto _ : state) {
+        double sum = 0;
+        for (qsizetype i = 0; i < static_cast<qsizetype>(dataset.records->size()); ++i)
+            sum += *dataset.records.at(i).score + *dataset.records.at(i).location.latitude;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AccessTaggedRecords)->Apply(recordArguments);
+
+// Baseline: copy of the parsed QJsonObject, the cheapest way to get the same object
+static void BM_ToJsonObjectBaselineCopy(benchmark::State& state)
+{
+    const QJsonObject obj = QJsonDocument::fromJson(BenchmarkData::makeDataset(static_cast<int>(state.range(0)))).object();
+    for (auto _ : state) {
+        QJsonObject copy = obj;
+        copy.insert(QStringLiteral("source"), QStringLiteral("copy"));
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK(BM_ToJsonObjectBaselineCopy)->Apply(recordArguments);
+
+// toJsonObject() on a freshly parsed object, every member is serialized
+static void BM_ToJsonObjectCold(benchmark::State& state)
+{
+    const QByteArray json = BenchmarkData::makeDataset(static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        state.PauseTiming();
+        const BenchDataset dataset = BenchDataset::fromJson(json);
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(dataset.toJsonObject());
+    }
+}
+BENCHMARK(BM_ToJsonObjectCold)->Apply(recordArguments);
+
+// toJsonObject() of the wide and deep objects
+template<typename T, int MemberCount>
+static void BM_ToJsonObjectWide(benchmark::State& state)
+{
+    const QJsonObject obj = BenchmarkData::makeWideObject(MemberCount);
+    for (auto _ : state) {
+        state.PauseTiming();
+        const T bound{obj};
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(bound.toJsonObject());
+    }
+}
+BENCHMARK_TEMPLATE(BM_ToJsonObjectWide, Wide5, 5);
+BENCHMARK_TEMPLATE(BM_ToJsonObjectWide, Wide25, 25);
+BENCHMARK_TEMPLATE(BM_ToJsonObjectWide, Wide100, 100);
+
+template<typename T, int Depth>
+static void BM_ToJsonObjectDeep(benchmark::State& state)
+{
+    const QByteArray json = BenchmarkData::makeDeepDocument(Depth);
+    for (auto _ : state) {
+        state.PauseTiming();
+        const T bound = T::fromJson(json);
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(bound.toJsonObject());
+    }
+}
+BENCHMARK_TEMPLATE(BM_ToJsonObjectDeep, BenchDepth2, 2);
+BENCHMARK_TEMPLATE(BM_ToJsonObjectDeep, BenchDepth4, 4);
+BENCHMARK_TEMPLATE(BM_ToJsonObjectDeep, BenchDepth8, 8);
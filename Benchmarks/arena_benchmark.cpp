@@ -0,0 +1,85 @@
+#include <memory_resource>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "taggedjsonobject.h"
+#include "taggedjsonpmrarray.h"
+#include "taggedjsonobjectmacros.h"
+
+TJO_DEFINE_JSON_TAGGED_OBJECT(ArenaLine,
+                              (TaggedJSONInt, sku),
+                              (TaggedJSONInt, quantity),
+                              (TaggedJSONDouble, price))
+
+TJO_DEFINE_JSON_TAGGED_OBJECT(HeapOrder,
+                              (TaggedJSONInt, id),
+                              (TaggedJSONArray<ArenaLine>, lines))
+
+TJO_DEFINE_JSON_TAGGED_OBJECT(HeapRequest,
+                              (TaggedJSONInt, customer),
+                              (TaggedJSONArray<HeapOrder>, orders))
+
+TJO_DEFINE_JSON_TAGGED_OBJECT(PmrOrder,
+                              (TaggedJSONInt, id),
+                              (TaggedJSONPmrArray<ArenaLine>, lines))
+
+TJO_DEFINE_JSON_TAGGED_OBJECT(PmrRequest,
+                              (TaggedJSONInt, customer),
+                              (TaggedJSONPmrArray<PmrOrder>, orders))
+
+namespace {
+    constexpr int LINES_PER_ORDER = 8;
+    constexpr std::size_t ARENA_BUFFER_SIZE = 1 << 22;
+
+    //Request with the given number of orders, each of them with a few order lines
+    QByteArray makeRequest(const int orderCount)
+    {
+        QByteArray json = R"({"customer": 7, "orders": [)";
+        for (int i = 0; i < orderCount; ++i) {
+            json += (i ? ", " : "") + QByteArray(R"({"id": )") + QByteArray::number(i) + R"(, "lines": [)";
+            for (int j = 0; j < LINES_PER_ORDER; ++j)
+                json += (j ? ", " : "") + QByteArray(R"({"sku": )") + QByteArray::number(i * LINES_PER_ORDER + j) + R"(, "quantity": 2, "price": 9.5})";
+            json += "]}";
+        }
+        json += "]}";
+        return json;
+    }
+}
+
+// Per-request parse and teardown on the global heap
+static void BM_RequestHeap(benchmark::State& state)
+{
+    const QByteArray json = makeRequest(static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        HeapRequest request = HeapRequest::fromJson(json);
+        benchmark::DoNotOptimize(request);
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_RequestHeap)->RangeMultiplier(10)->Range(10, 10000)->Unit(benchmark::kMicrosecond);
+
+// Allocator-aware arrays without a scope, the overhead of the polymorphic allocator alone
+static void BM_RequestPmrDefault(benchmark::State& state)
+{
+    const QByteArray json = makeRequest(static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        PmrRequest request = PmrRequest::fromJson(json);
+        benchmark::DoNotOptimize(request);
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_RequestPmrDefault)->RangeMultiplier(10)->Range(10, 10000)->Unit(benchmark::kMicrosecond);
+
+// The whole request tree in a monotonic arena over a reused buffer, released in one shot
+static void BM_RequestArena(benchmark::State& state)
+{
+    const QByteArray json = makeRequest(static_cast<int>(state.range(0)));
+    std::vector<std::byte> buffer(ARENA_BUFFER_SIZE);
+    for (auto _ : state) {
+        std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size());
+        TaggedObject::MemoryResourceScope scope(&arena);
+        PmrRequest request = PmrRequest::fromJson(json);
+        benchmark::DoNotOptimize(request);
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_RequestArena)->RangeMultiplier(10)->Range(10, 10000)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,70 @@
+#include <QBuffer>
+#include <QJsonDocument>
+#include <benchmark/benchmark.h>
+#include "taggedjsonarrayreader.h"
+#include "benchmarkdataset.h"
+
+// A top-level array of records read element by element from a device (see taggedjsonarrayreader.h) against parsing the whole document first
+
+namespace {
+    QByteArray makeRecordArray(const int recordCount)
+    {
+        const QJsonArray records = QJsonDocument::fromJson(BenchmarkData::makeDataset(recordCount)).object()["records"].toArray();
+        return QJsonDocument(records).toJson(QJsonDocument::Compact);
+    }
+}
+
+// Baseline: the whole array is read from the device and parsed into a QJsonDocument before the records are built
+static void BM_ArrayReaderDocument(benchmark::State& state)
+{
+    const QByteArray json = makeRecordArray(static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        QBuffer device;
+        device.setData(json);
+        device.open(QIODevice::ReadOnly);
+        const TaggedJSONArray<BenchRecord> records(QJsonDocument::fromJson(device.readAll()).array());
+        qint64 sum = 0;
+        for (const BenchRecord& record : *records)
+            sum += *record.id;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_ArrayReaderDocument)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMicrosecond);
+
+static void BM_ArrayReaderStream(benchmark::State& state)
+{
+    const QByteArray json = makeRecordArray(static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        QBuffer device;
+        device.setData(json);
+        device.open(QIODevice::ReadOnly);
+        TaggedObject::JsonArrayReader<BenchRecord> reader(device);
+        qint64 sum = 0;
+        for (const BenchRecord& record : reader)
+            sum += *record.id;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_ArrayReaderStream)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMicrosecond);
+
+// Block size sweep of the streaming reader
+static void BM_ArrayReaderBlockSize(benchmark::State& state)
+{
+    const QByteArray json = makeRecordArray(10000);
+    TaggedObject::JsonArrayReaderOptions options;
+    options.blockSize = state.range(0);
+    for (auto _ : state) {
+        QBuffer device;
+        device.setData(json);
+        device.open(QIODevice::ReadOnly);
+        TaggedObject::JsonArrayReader<BenchRecord> reader(device, options);
+        qint64 count = 0;
+        for (const BenchRecord& record : reader)
+            count += *record.active;
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_ArrayReaderBlockSize)->RangeMultiplier(16)->Range(256, 1 << 20)->Unit(benchmark::kMicrosecond);
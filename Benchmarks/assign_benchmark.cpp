@@ -0,0 +1,105 @@
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <QJsonDocument>
+#include "benchmarkdataset.h"
+
+// Streams of records parsed into a newly constructed object each time against assign() and parseInto() on a reused scratch object
+
+namespace {
+    constexpr int RECORD_COUNT = 10000;
+
+    //Compact JSON text of each record of the benchmark dataset
+    std::vector<QByteArray> makeRecordTexts()
+    {
+        std::vector<QByteArray> ret;
+        const QJsonArray records = QJsonDocument::fromJson(BenchmarkData::makeDataset(RECORD_COUNT)).object()["records"].toArray();
+        for (const QJsonValue& record : records)
+            ret.push_back(QJsonDocument(record.toObject()).toJson(QJsonDocument::Compact));
+        return ret;
+    }
+
+    void datasetArguments(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->ArgName("records")->RangeMultiplier(10)->Range(100, 10000)->Unit(benchmark::kMicrosecond);
+    }
+}
+
+// Baseline: fromJson() into a new object for every record
+static void BM_AssignRecordsFromJson(benchmark::State& state)
+{
+    const std::vector<QByteArray> texts = makeRecordTexts();
+    for (auto _ : state) {
+        for (const QByteArray& text : texts) {
+            BenchRecord record = BenchRecord::fromJson(text);
+            benchmark::DoNotOptimize(record);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<qint64>(texts.size()));
+}
+BENCHMARK(BM_AssignRecordsFromJson)->Unit(benchmark::kMicrosecond);
+
+static void BM_AssignRecordsParseInto(benchmark::State& state)
+{
+    const std::vector<QByteArray> texts = makeRecordTexts();
+    BenchRecord scratch;
+    for (auto _ : state) {
+        for (const QByteArray& text : texts) {
+            scratch.parseInto(text);
+            benchmark::DoNotOptimize(scratch);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<qint64>(texts.size()));
+}
+BENCHMARK(BM_AssignRecordsParseInto)->Unit(benchmark::kMicrosecond);
+
+// Baseline: QJsonObject constructor for every record
+static void BM_AssignRecordsConstruct(benchmark::State& state)
+{
+    const QJsonArray records = QJsonDocument::fromJson(BenchmarkData::makeDataset(RECORD_COUNT)).object()["records"].toArray();
+    for (auto _ : state) {
+        for (const QJsonValue& value : records) {
+            BenchRecord record(value.toObject());
+            benchmark::DoNotOptimize(record);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * records.size());
+}
+BENCHMARK(BM_AssignRecordsConstruct)->Unit(benchmark::kMicrosecond);
+
+static void BM_AssignRecordsAssign(benchmark::State& state)
+{
+    const QJsonArray records = QJsonDocument::fromJson(BenchmarkData::makeDataset(RECORD_COUNT)).object()["records"].toArray();
+    BenchRecord scratch;
+    for (auto _ : state) {
+        for (const QJsonValue& value : records) {
+            scratch.assign(value.toObject());
+            benchmark::DoNotOptimize(scratch);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * records.size());
+}
+BENCHMARK(BM_AssignRecordsAssign)->Unit(benchmark::kMicrosecond);
+
+// A whole dataset parsed over and over, the reused array keeps its elements and their strings
+static void BM_AssignDatasetFromJson(benchmark::State& state)
+{
+    const QByteArray json = BenchmarkData::makeDataset(static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        BenchDataset dataset = BenchDataset::fromJson(json);
+        benchmark::DoNotOptimize(dataset);
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_AssignDatasetFromJson)->Apply(datasetArguments);
+
+static void BM_AssignDatasetParseInto(benchmark::State& state)
+{
+    const QByteArray json = BenchmarkData::makeDataset(static_cast<int>(state.range(0)));
+    BenchDataset scratch;
+    for (auto _ : state) {
+        scratch.parseInto(json);
+        benchmark::DoNotOptimize(scratch);
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_AssignDatasetParseInto)->Apply(datasetArguments);
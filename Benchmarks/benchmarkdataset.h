@@ -0,0 +1,257 @@
+#ifndef BENCHMARKDATASET_H
+#define BENCHMARKDATASET_H
+#include "taggedjsonobject.h"
+#include "taggedjsonarray.h"
+#include "taggedjsonobjectmacros.h"
+
+TJO_DEFINE_JSON_TAGGED_OBJECT(BenchLocation,
+                              (TaggedJSONDouble, latitude),
+                              (TaggedJSONDouble, longitude))
+
+TJO_DEFINE_JSON_TAGGED_OBJECT(BenchRecord,
+                              (TaggedJSONInt, id),
+                              (TaggedJSONString, name),
+                              (TaggedJSONBool, active),
+                              (TaggedJSONDouble, score),
+                              (TaggedJSONStringArray, tags),
+                              (BenchLocation, location))
+
+TJO_DEFINE_JSON_TAGGED_OBJECT(BenchDataset,
+                              (TaggedJSONString, source),
+                              (TaggedJSONArray<BenchRecord>, records))
+
+TJO_DEFINE_JSON_TAGGED_OBJECT(Wide5,
+                              (TaggedJSONInt, field_0),
+                              (TaggedJSONInt, field_1),
+                              (TaggedJSONInt, field_2),
+                              (TaggedJSONInt, field_3),
+                              (TaggedJSONInt, field_4))
+
+TJO_DEFINE_JSON_TAGGED_OBJECT(Wide25,
+                              (TaggedJSONInt, field_0),
+                              (TaggedJSONInt, field_1),
+                              (TaggedJSONInt, field_2),
+                              (TaggedJSONInt, field_3),
+                              (TaggedJSONInt, field_4),
+                              (TaggedJSONInt, field_5),
+                              (TaggedJSONInt, field_6),
+                              (TaggedJSONInt, field_7),
+                              (TaggedJSONInt, field_8),
+                              (TaggedJSONInt, field_9),
+                              (TaggedJSONInt, field_10),
+                              (TaggedJSONInt, field_11),
+                              (TaggedJSONInt, field_12),
+                              (TaggedJSONInt, field_13),
+                              (TaggedJSONInt, field_14),
+                              (TaggedJSONInt, field_15),
+                              (TaggedJSONInt, field_16),
+                              (TaggedJSONInt, field_17),
+                              (TaggedJSONInt, field_18),
+                              (TaggedJSONInt, field_19),
+                              (TaggedJSONInt, field_20),
+                              (TaggedJSONInt, field_21),
+                              (TaggedJSONInt, field_22),
+                              (TaggedJSONInt, field_23),
+                              (TaggedJSONInt, field_24))
+
+TJO_DEFINE_JSON_TAGGED_OBJECT(Wide100,
+                              (TaggedJSONInt, field_0),
+                              (TaggedJSONInt, field_1),
+                              (TaggedJSONInt, field_2),
+                              (TaggedJSONInt, field_3),
+                              (TaggedJSONInt, field_4),
+                              (TaggedJSONInt, field_5),
+                              (TaggedJSONInt, field_6),
+                              (TaggedJSONInt, field_7),
+                              (TaggedJSONInt, field_8),
+                              (TaggedJSONInt, field_9),
+                              (TaggedJSONInt, field_10),
+                              (TaggedJSONInt, field_11),
+                              (TaggedJSONInt, field_12),
+                              (TaggedJSONInt, field_13),
+                              (TaggedJSONInt, field_14),
+                              (TaggedJSONInt, field_15),
+                              (TaggedJSONInt, field_16),
+                              (TaggedJSONInt, field_17),
+                              (TaggedJSONInt, field_18),
+                              (TaggedJSONInt, field_19),
+                              (TaggedJSONInt, field_20),
+                              (TaggedJSONInt, field_21),
+                              (TaggedJSONInt, field_22),
+                              (TaggedJSONInt, field_23),
+                              (TaggedJSONInt, field_24),
+                              (TaggedJSONInt, field_25),
+                              (TaggedJSONInt, field_26),
+                              (TaggedJSONInt, field_27),
+                              (TaggedJSONInt, field_28),
+                              (TaggedJSONInt, field_29),
+                              (TaggedJSONInt, field_30),
+                              (TaggedJSONInt, field_31),
+                              (TaggedJSONInt, field_32),
+                              (TaggedJSONInt, field_33),
+                              (TaggedJSONInt, field_34),
+                              (TaggedJSONInt, field_35),
+                              (TaggedJSONInt, field_36),
+                              (TaggedJSONInt, field_37),
+                              (TaggedJSONInt, field_38),
+                              (TaggedJSONInt, field_39),
+                              (TaggedJSONInt, field_40),
+                              (TaggedJSONInt, field_41),
+                              (TaggedJSONInt, field_42),
+                              (TaggedJSONInt, field_43),
+                              (TaggedJSONInt, field_44),
+                              (TaggedJSONInt, field_45),
+                              (TaggedJSONInt, field_46),
+                              (TaggedJSONInt, field_47),
+                              (TaggedJSONInt, field_48),
+                              (TaggedJSONInt, field_49),
+                              (TaggedJSONInt, field_50),
+                              (TaggedJSONInt, field_51),
+                              (TaggedJSONInt, field_52),
+                              (TaggedJSONInt, field_53),
+                              (TaggedJSONInt, field_54),
+                              (TaggedJSONInt, field_55),
+                              (TaggedJSONInt, field_56),
+                              (TaggedJSONInt, field_57),
+                              (TaggedJSONInt, field_58),
+                              (TaggedJSONInt, field_59),
+                              (TaggedJSONInt, field_60),
+                              (TaggedJSONInt, field_61),
+                              (TaggedJSONInt, field_62),
+                              (TaggedJSONInt, field_63),
+                              (TaggedJSONInt, field_64),
+                              (TaggedJSONInt, field_65),
+                              (TaggedJSONInt, field_66),
+                              (TaggedJSONInt, field_67),
+                              (TaggedJSONInt, field_68),
+                              (TaggedJSONInt, field_69),
+                              (TaggedJSONInt, field_70),
+                              (TaggedJSONInt, field_71),
+                              (TaggedJSONInt, field_72),
+                              (TaggedJSONInt, field_73),
+                              (TaggedJSONInt, field_74),
+                              (TaggedJSONInt, field_75),
+                              (TaggedJSONInt, field_76),
+                              (TaggedJSONInt, field_77),
+                              (TaggedJSONInt, field_78),
+                              (TaggedJSONInt, field_79),
+                              (TaggedJSONInt, field_80),
+                              (TaggedJSONInt, field_81),
+                              (TaggedJSONInt, field_82),
+                              (TaggedJSONInt, field_83),
+                              (TaggedJSONInt, field_84),
+                              (TaggedJSONInt, field_85),
+                              (TaggedJSONInt, field_86),
+                              (TaggedJSONInt, field_87),
+                              (TaggedJSONInt, field_88),
+                              (TaggedJSONInt, field_89),
+                              (TaggedJSONInt, field_90),
+                              (TaggedJSONInt, field_91),
+                              (TaggedJSONInt, field_92),
+                              (TaggedJSONInt, field_93),
+                              (TaggedJSONInt, field_94),
+                              (TaggedJSONInt, field_95),
+                              (TaggedJSONInt, field_96),
+                              (TaggedJSONInt, field_97),
+                              (TaggedJSONInt, field_98),
+                              (TaggedJSONInt, field_99))
+
+TJO_DEFINE_JSON_TAGGED_OBJECT(BenchDepth1,
+                              (TaggedJSONInt, level),
+                              (TaggedJSONString, name))
+
+TJO_DEFINE_JSON_TAGGED_OBJECT(BenchDepth2,
+                              (TaggedJSONInt, level),
+                              (TaggedJSONString, name),
+                              (BenchDepth1, child))
+
+TJO_DEFINE_JSON_TAGGED_OBJECT(BenchDepth3,
+                              (TaggedJSONInt, level),
+                              (TaggedJSONString, name),
+                              (BenchDepth2, child))
+
+TJO_DEFINE_JSON_TAGGED_OBJECT(BenchDepth4,
+                              (TaggedJSONInt, level),
+                              (TaggedJSONString, name),
+                              (BenchDepth3, child))
+
+TJO_DEFINE_JSON_TAGGED_OBJECT(BenchDepth5,
+                              (TaggedJSONInt, level),
+                              (TaggedJSONString, name),
+                              (BenchDepth4, child))
+
+TJO_DEFINE_JSON_TAGGED_OBJECT(BenchDepth6,
+                              (TaggedJSONInt, level),
+                              (TaggedJSONString, name),
+                              (BenchDepth5, child))
+
+TJO_DEFINE_JSON_TAGGED_OBJECT(BenchDepth7,
+                              (TaggedJSONInt, level),
+                              (TaggedJSONString, name),
+                              (BenchDepth6, child))
+
+TJO_DEFINE_JSON_TAGGED_OBJECT(BenchDepth8,
+                              (TaggedJSONInt, level),
+                              (TaggedJSONString, name),
+                              (BenchDepth7, child))
+
+TJO_DEFINE_JSON_TAGGED_OBJECT(BenchNumbers,
+                              (TaggedJSONIntArray, integers),
+                              (TaggedJSONDoubleArray, doubles))
+
+namespace BenchmarkData {
+    //Builds a dataset document with the given number of records, roughly 160 bytes per record
+    inline QByteArray makeDataset(const int recordCount)
+    {
+        QByteArray json = R"({"source": "benchmark", "records": [)";
+        for (int i = 0; i < recordCount; ++i) {
+            if (i != 0)
+                json += ',';
+            json += R"({"id": )" + QByteArray::number(i)
+                  + R"(, "name": "record number )" + QByteArray::number(i)
+                  + R"(", "active": )" + (i % 2 ? "true" : "false")
+                  + R"(, "score": )" + QByteArray::number(i * 0.25)
+                  + R"(, "tags": ["alpha", "beta", "gamma"], "location": {"latitude": 41.0082, "longitude": 28.9784}})";
+        }
+        json += "]}";
+        return json;
+    }
+
+    //Object that holds every member of the WideN classes along with the same amount of unrelated keys
+    inline QJsonObject makeWideObject(const int memberCount)
+    {
+        QJsonObject obj;
+        for (int i = 0; i < memberCount; ++i) {
+            obj.insert(QStringLiteral("field_%1").arg(i), i);
+            obj.insert(QStringLiteral("unrelated_%1").arg(i), i);
+        }
+        return obj;
+    }
+
+    //Builds the document of the BenchDepthN class with the given depth, each level holds the next one as its child
+    inline QByteArray makeDeepDocument(const int depth)
+    {
+        QByteArray json;
+        for (int level = depth; level > 0; --level) {
+            json += R"({"level": )" + QByteArray::number(level) + R"(, "name": "level )" + QByteArray::number(level) + R"(")";
+            if (level > 1)
+                json += R"(, "child": )";
+        }
+        json += QByteArray(depth, '}');
+        return json;
+    }
+
+    //Builds the document of the BenchNumbers class with the given number of elements in each array
+    inline QByteArray makeNumbers(const int elementCount)
+    {
+        QByteArray integers;
+        QByteArray doubles;
+        for (int i = 0; i < elementCount; ++i) {
+            integers += (i ? "," : "") + QByteArray::number(i);
+            doubles += (i ? "," : "") + QByteArray::number(i * 0.5);
+        }
+        return R"({"integers": [)" + integers + R"(], "doubles": [)" + doubles + "]}";
+    }
+}
+
+#endif // BENCHMARKDATASET_H
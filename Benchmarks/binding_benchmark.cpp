@@ -0,0 +1,30 @@
+#include <benchmark/benchmark.h>
+#include "benchmarkdataset.h"
+
+// Current path: one QJsonObject lookup per declared member
+template<typename T, int MemberCount>
+static void BM_BindPerMember(benchmark::State& state)
+{
+    const QJsonObject obj = BenchmarkData::makeWideObject(MemberCount);
+    for (auto _ : state) {
+        T bound{obj};
+        benchmark::DoNotOptimize(bound);
+    }
+}
+BENCHMARK_TEMPLATE(BM_BindPerMember, Wide5, 5);
+BENCHMARK_TEMPLATE(BM_BindPerMember, Wide25, 25);
+BENCHMARK_TEMPLATE(BM_BindPerMember, Wide100, 100);
+
+// Single-pass path: one walk over the keys, routed by the compile-time perfect hash
+template<typename T, int MemberCount>
+static void BM_BindSinglePass(benchmark::State& state)
+{
+    const QJsonObject obj = BenchmarkData::makeWideObject(MemberCount);
+    for (auto _ : state) {
+        T bound{TaggedObject::singlePassBinding, obj};
+        benchmark::DoNotOptimize(bound);
+    }
+}
+BENCHMARK_TEMPLATE(BM_BindSinglePass, Wide5, 5);
+BENCHMARK_TEMPLATE(BM_BindSinglePass, Wide25, 25);
+BENCHMARK_TEMPLATE(BM_BindSinglePass, Wide100, 100);
@@ -0,0 +1,137 @@
+#include <benchmark/benchmark.h>
+#include "taggedjsoncbor.h"
+#include "benchmarkdataset.h"
+
+TJO_DEFINE_JSON_TAGGED_OBJECT(FixturePerson,
+                              (TaggedJSONString, name),
+                              (TaggedJSONInt, age))
+
+TJO_DEFINE_JSON_TAGGED_OBJECT(FixtureSubClass,
+                              (TaggedJSONString, example_sub_str))
+
+TJO_DEFINE_JSON_TAGGED_OBJECT(FixtureRecord,
+                              (TaggedJSONInt, example_int),
+                              (TaggedJSONString, example_str),
+                              (TaggedJSONDouble, example_double),
+                              (FixtureSubClass, example_sub_class),
+                              (TaggedJSONValue, example_json_value1),
+                              (TaggedJSONValue, example_json_value2),
+                              (TaggedQJsonObject, example_json_object),
+                              (TaggedJSONStringArray, example_arr),
+                              (TaggedJSONVariantArray, example_mixed_arr),
+                              (TaggedJSONArray<FixturePerson>, example_tagged_object_array))
+
+namespace {
+    constexpr auto FIXTURE_FILE_PATH = "../Tests/test_file.json";
+
+    QByteArray fixtureJson()
+    {
+        QFile f{ FIXTURE_FILE_PATH };
+        f.open(QIODevice::ReadOnly);
+        return FixtureRecord::fromJson(f.readAll()).toJson(QJsonDocument::Compact);
+    }
+
+    //Encoded sizes are reported as counters so the size comparison ends up in the machine-readable output as well
+    void reportSize(benchmark::State& state, const QByteArray& encoded)
+    {
+        state.SetBytesProcessed(state.iterations() * encoded.size());
+        state.counters["encoded_bytes"] = static_cast<double>(encoded.size());
+    }
+}
+
+// Direct-binding JSON decoding, the baseline of the CBOR decoder
+static void BM_DecodeJson(benchmark::State& state)
+{
+    const QByteArray json = BenchDataset::fromJson(BenchmarkData::makeDataset(static_cast<int>(state.range(0)))).toJson(QJsonDocument::Compact);
+    for (auto _ : state) {
+        BenchDataset dataset = BenchDataset::fromJson(json);
+        benchmark::DoNotOptimize(dataset);
+    }
+    reportSize(state, json);
+}
+BENCHMARK(BM_DecodeJson)->RangeMultiplier(10)->Range(10, 10000)->Unit(benchmark::kMicrosecond);
+
+// CBOR decoding straight into the members
+static void BM_DecodeCbor(benchmark::State& state)
+{
+    const QByteArray cbor = BenchDataset::fromJson(BenchmarkData::makeDataset(static_cast<int>(state.range(0)))).toCbor();
+    for (auto _ : state) {
+        BenchDataset dataset = BenchDataset::fromCbor(cbor);
+        benchmark::DoNotOptimize(dataset);
+    }
+    reportSize(state, cbor);
+}
+BENCHMARK(BM_DecodeCbor)->RangeMultiplier(10)->Range(10, 10000)->Unit(benchmark::kMicrosecond);
+
+// Direct compact JSON serialization, the baseline of the CBOR encoder
+static void BM_EncodeJson(benchmark::State& state)
+{
+    const BenchDataset dataset = BenchDataset::fromJson(BenchmarkData::makeDataset(static_cast<int>(state.range(0))));
+    QByteArray json;
+    for (auto _ : state) {
+        json = dataset.toJson(QJsonDocument::Compact);
+        benchmark::DoNotOptimize(json.data());
+    }
+    reportSize(state, json);
+}
+BENCHMARK(BM_EncodeJson)->RangeMultiplier(10)->Range(10, 10000)->Unit(benchmark::kMicrosecond);
+
+// CBOR encoding straight from the members
+static void BM_EncodeCbor(benchmark::State& state)
+{
+    const BenchDataset dataset = BenchDataset::fromJson(BenchmarkData::makeDataset(static_cast<int>(state.range(0))));
+    QByteArray cbor;
+    for (auto _ : state) {
+        cbor = dataset.toCbor();
+        benchmark::DoNotOptimize(cbor.data());
+    }
+    reportSize(state, cbor);
+}
+BENCHMARK(BM_EncodeCbor)->RangeMultiplier(10)->Range(10, 10000)->Unit(benchmark::kMicrosecond);
+
+// The test fixture, which mixes the JSON value members with the typed ones
+static void BM_FixtureDecodeJson(benchmark::State& state)
+{
+    const QByteArray json = fixtureJson();
+    for (auto _ : state) {
+        FixtureRecord record = FixtureRecord::fromJson(json);
+        benchmark::DoNotOptimize(record);
+    }
+    reportSize(state, json);
+}
+BENCHMARK(BM_FixtureDecodeJson);
+
+static void BM_FixtureDecodeCbor(benchmark::State& state)
+{
+    const QByteArray cbor = FixtureRecord::fromJson(fixtureJson()).toCbor();
+    for (auto _ : state) {
+        FixtureRecord record = FixtureRecord::fromCbor(cbor);
+        benchmark::DoNotOptimize(record);
+    }
+    reportSize(state, cbor);
+}
+BENCHMARK(BM_FixtureDecodeCbor);
+
+static void BM_FixtureEncodeJson(benchmark::State& state)
+{
+    const FixtureRecord record = FixtureRecord::fromJson(fixtureJson());
+    QByteArray json;
+    for (auto _ : state) {
+        json = record.toJson(QJsonDocument::Compact);
+        benchmark::DoNotOptimize(json.data());
+    }
+    reportSize(state, json);
+}
+BENCHMARK(BM_FixtureEncodeJson);
+
+static void BM_FixtureEncodeCbor(benchmark::State& state)
+{
+    const FixtureRecord record = FixtureRecord::fromJson(fixtureJson());
+    QByteArray cbor;
+    for (auto _ : state) {
+        cbor = record.toCbor();
+        benchmark::DoNotOptimize(cbor.data());
+    }
+    reportSize(state, cbor);
+}
+BENCHMARK(BM_FixtureEncodeCbor);
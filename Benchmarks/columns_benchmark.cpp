@@ -0,0 +1,118 @@
+#include <numeric>
+#include <benchmark/benchmark.h>
+#include <QJsonDocument>
+#include "taggedjsoncolumns.h"
+#include "benchmarkdataset.h"
+
+// Scans of a single member over an array of tagged objects against the same scan over the columnar projection (see taggedjsoncolumns.h)
+
+namespace {
+    using ScoreColumns = TaggedJSONColumns<&BenchRecord::score, &BenchRecord::active>;
+
+    // Parse-time projection of the records array of the dataset, the other members of the dataset are skipped
+    ScoreColumns readScoreColumns(const QByteArray& json)
+    {
+        TaggedObject::JsonReader reader(json);
+        ScoreColumns columns;
+        reader.beginObject();
+        std::string_view key;
+        while (reader.nextKey(key)) {
+            if (key == "records")
+                columns.readJson(reader);
+            else
+                reader.skipValue();
+        }
+        return columns;
+    }
+}
+
+// Baseline: the member is read from every object of the array
+static void BM_ColumnsSumObjects(benchmark::State& state)
+{
+    const BenchDataset dataset = BenchDataset::fromJson(BenchmarkData::makeDataset(static_cast<int>(state.range(0))));
+    for (auto _ : state) {
+        double sum = 0;
+        for (const BenchRecord& record : *dataset.records)
+            sum += *record.score;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ColumnsSumObjects)->RangeMultiplier(10)->Range(10000, 100000)->Unit(benchmark::kMicrosecond);
+
+static void BM_ColumnsSumColumn(benchmark::State& state)
+{
+    const ScoreColumns columns = readScoreColumns(BenchmarkData::makeDataset(static_cast<int>(state.range(0))));
+    for (auto _ : state) {
+        const std::vector<double>& scores = columns.column<&BenchRecord::score>();
+        benchmark::DoNotOptimize(std::accumulate(scores.cbegin(), scores.cend(), 0.0));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ColumnsSumColumn)->RangeMultiplier(10)->Range(10000, 100000)->Unit(benchmark::kMicrosecond);
+
+// Baseline: a filtered aggregation over the objects
+static void BM_ColumnsFilteredSumObjects(benchmark::State& state)
+{
+    const BenchDataset dataset = BenchDataset::fromJson(BenchmarkData::makeDataset(static_cast<int>(state.range(0))));
+    for (auto _ : state) {
+        double sum = 0;
+        for (const BenchRecord& record : *dataset.records) {
+            if (*record.active)
+                sum += *record.score;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ColumnsFilteredSumObjects)->RangeMultiplier(10)->Range(10000, 100000)->Unit(benchmark::kMicrosecond);
+
+static void BM_ColumnsFilteredSumColumns(benchmark::State& state)
+{
+    const ScoreColumns columns = readScoreColumns(BenchmarkData::makeDataset(static_cast<int>(state.range(0))));
+    for (auto _ : state) {
+        const std::vector<double>& scores = columns.column<&BenchRecord::score>();
+        const std::vector<bool>& active = columns.column<&BenchRecord::active>();
+        double sum = 0;
+        for (std::size_t i = 0; i < scores.size(); ++i)
+            sum += active[i] ? scores[i] : 0.0;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ColumnsFilteredSumColumns)->RangeMultiplier(10)->Range(10000, 100000)->Unit(benchmark::kMicrosecond);
+
+// Baseline: the whole dataset is parsed into tagged objects
+static void BM_ColumnsParseObjects(benchmark::State& state)
+{
+    const QByteArray json = BenchmarkData::makeDataset(static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        BenchDataset dataset = BenchDataset::fromJson(json);
+        benchmark::DoNotOptimize(dataset);
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_ColumnsParseObjects)->Arg(10000)->Unit(benchmark::kMicrosecond);
+
+static void BM_ColumnsParseColumns(benchmark::State& state)
+{
+    const QByteArray json = BenchmarkData::makeDataset(static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        ScoreColumns columns = readScoreColumns(json);
+        benchmark::DoNotOptimize(columns);
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_ColumnsParseColumns)->Arg(10000)->Unit(benchmark::kMicrosecond);
+
+// On-demand projection of the parsed objects
+static void BM_ColumnsProjectObjects(benchmark::State& state)
+{
+    const BenchDataset dataset = BenchDataset::fromJson(BenchmarkData::makeDataset(static_cast<int>(state.range(0))));
+    for (auto _ : state) {
+        ScoreColumns columns(dataset.records);
+        benchmark::DoNotOptimize(columns);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ColumnsProjectObjects)->Arg(10000)->Unit(benchmark::kMicrosecond);
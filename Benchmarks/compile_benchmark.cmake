@@ -0,0 +1,117 @@
+# Compile-time benchmark of the tagged object generation.
+#
+# Generates translation units with tagged classes of 10, 50 and 200 members, compiles each of them a few times and reports the fastest time.
+# If TJO_BASELINE_INCLUDE_DIR is set, the same sources are compiled against it as well, so two versions of the headers can be compared, e.g.
+# a worktree of an older revision:
+#   git worktree add ../tjo-baseline <revision>
+#   cmake -DTJO_COMPILE_BENCHMARK_BASELINE=<absolute path of ../tjo-baseline/inc> <build dir>
+#   cmake --build <build dir> --target compile_benchmark
+#
+# The compile_benchmark target passes the variables below, the script can be run by hand with cmake -P as well:
+#   TJO_CXX                   The compiler
+#   TJO_CXX_FLAGS             Compiler flags, separated by '|'
+#   TJO_MSVC                  Set if the compiler has the MSVC command line
+#   TJO_INCLUDE_DIR           The include directory of the headers to measure
+#   TJO_QT_INCLUDE_DIRS       Include directories of Qt Core, separated by '|'
+#   TJO_OUTPUT_DIR            Where the sources and the objects are generated
+#   TJO_BASELINE_INCLUDE_DIR  Optional, the include directory of the headers to compare with
+#   TJO_CLASSES               Optional, the number of classes per translation unit, 5 by default
+#   TJO_REPETITIONS           Optional, the number of compilations per measurement, 3 by default
+
+if(CMAKE_VERSION VERSION_LESS 3.23)
+    message(FATAL_ERROR "The compile-time benchmark needs CMake 3.23 or newer for sub-second timestamps")
+endif()
+
+foreach(variable TJO_CXX TJO_INCLUDE_DIR TJO_OUTPUT_DIR)
+    if(NOT ${variable})
+        message(FATAL_ERROR "${variable} isn't set")
+    endif()
+endforeach()
+if(NOT TJO_CLASSES)
+    set(TJO_CLASSES 5)
+endif()
+if(NOT TJO_REPETITIONS)
+    set(TJO_REPETITIONS 3)
+endif()
+string(REPLACE "|" ";" TJO_CXX_FLAGS "${TJO_CXX_FLAGS}")
+string(REPLACE "|" ";" TJO_QT_INCLUDE_DIRS "${TJO_QT_INCLUDE_DIRS}")
+
+set(MEMBER_COUNTS 10 50 200)
+set(MEMBER_TYPES TaggedJSONInt TaggedJSONString TaggedJSONDouble TaggedJSONBool TaggedJSONIntArray)
+
+# A translation unit with TJO_CLASSES classes of the given number of members, each class is constructed, parsed and serialized so that the
+# generated methods are compiled and not only parsed
+function(generate_source memberCount path)
+    list(LENGTH MEMBER_TYPES typeCount)
+    set(source "#include \"taggedjsonobject.h\"\n#include \"taggedjsonarray.h\"\n#include \"taggedjsonobjectmacros.h\"\n\n")
+    math(EXPR lastClass "${TJO_CLASSES} - 1")
+    math(EXPR lastMember "${memberCount} - 1")
+    foreach(c RANGE ${lastClass})
+        string(APPEND source "TJO_DEFINE_JSON_TAGGED_OBJECT(Generated${memberCount}_${c}")
+        foreach(m RANGE ${lastMember})
+            math(EXPR typeIndex "(${m} + ${c}) % ${typeCount}")
+            list(GET MEMBER_TYPES ${typeIndex} type)
+            string(APPEND source ",\n    (${type}, member${m})")
+        endforeach()
+        string(APPEND source ")\n\n")
+    endforeach()
+    string(APPEND source "QByteArray roundTrip(const QByteArray& json)\n{\n    QByteArray ret;\n")
+    foreach(c RANGE ${lastClass})
+        string(APPEND source "    ret += Generated${memberCount}_${c}(Generated${memberCount}_${c}::fromJson(json, false).toJsonObject(), false).toJson();\n")
+    endforeach()
+    string(APPEND source "    return ret;\n}\n")
+    file(WRITE "${path}" "${source}")
+endfunction()
+
+# Fastest of TJO_REPETITIONS compilations of the source in seconds
+function(time_compilation source includeDir result)
+    set(includes "${includeDir}" ${TJO_QT_INCLUDE_DIRS})
+    set(includeFlags "")
+    foreach(dir IN LISTS includes)
+        list(APPEND includeFlags "-I${dir}")
+    endforeach()
+    get_filename_component(name "${source}" NAME_WE)
+    string(MD5 dirHash "${includeDir}")
+    set(object "${TJO_OUTPUT_DIR}/${name}_${dirHash}.o")
+    if(TJO_MSVC)
+        set(outputFlags /c "/Fo${object}")
+    else()
+        set(outputFlags -c -o "${object}")
+    endif()
+
+    set(best "")
+    foreach(repetition RANGE 1 ${TJO_REPETITIONS})
+        string(TIMESTAMP start "%s%f")
+        execute_process(COMMAND "${TJO_CXX}" ${TJO_CXX_FLAGS} ${includeFlags} ${outputFlags} "${source}"
+                        RESULT_VARIABLE exitCode OUTPUT_VARIABLE output ERROR_VARIABLE output)
+        string(TIMESTAMP end "%s%f")
+        if(NOT exitCode EQUAL 0)
+            message(FATAL_ERROR "Compiling ${source} against ${includeDir} has failed:\n${output}")
+        endif()
+        math(EXPR elapsed "${end} - ${start}")
+        if(best STREQUAL "" OR elapsed LESS best)
+            set(best ${elapsed})
+        endif()
+    endforeach()
+
+    # Microseconds to seconds with two decimals
+    math(EXPR whole "${best} / 1000000")
+    math(EXPR fraction "(${best} % 1000000) / 10000")
+    if(fraction LESS 10)
+        set(fraction "0${fraction}")
+    endif()
+    set(${result} "${whole}.${fraction}" PARENT_SCOPE)
+endfunction()
+
+file(MAKE_DIRECTORY "${TJO_OUTPUT_DIR}")
+foreach(memberCount IN LISTS MEMBER_COUNTS)
+    set(source "${TJO_OUTPUT_DIR}/generated_${memberCount}_members.cpp")
+    generate_source(${memberCount} "${source}")
+    time_compilation("${source}" "${TJO_INCLUDE_DIR}" seconds)
+    set(line "${memberCount} members, ${TJO_CLASSES} classes: ${seconds} s")
+    if(TJO_BASELINE_INCLUDE_DIR)
+        time_compilation("${source}" "${TJO_BASELINE_INCLUDE_DIR}" baselineSeconds)
+        string(APPEND line " (baseline ${baselineSeconds} s)")
+    endif()
+    message(STATUS "${line}")
+endforeach()
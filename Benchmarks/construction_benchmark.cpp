@@ -0,0 +1,250 @@
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <benchmark/benchmark.h>
+#include <QJsonDocument>
+#include "benchmarkdataset.h"
+
+// Every constructor overload of the generated classes against the raw QJsonDocument parse. The second argument selects checkValues.
+
+namespace {
+    //Qt version the results have been measured with, it is written into the context of the machine-readable output
+    const bool qtVersionContext = (benchmark::AddCustomContext("qt_version", QT_VERSION_STR), true);
+
+    //Temporary copy of a document for the file based constructors, removed at the end of the benchmark
+    class DocumentFile
+    {
+    public:
+        explicit DocumentFile(const QByteArray& json, const std::string& name)
+            : m_path((std::filesystem::temp_directory_path() / name).string())
+        {
+            std::ofstream(m_path, std::ios::binary).write(json.constData(), static_cast<std::streamsize>(json.size()));
+        }
+        DocumentFile(const DocumentFile&) = delete;
+        DocumentFile& operator=(const DocumentFile&) = delete;
+        ~DocumentFile() { std::remove(m_path.c_str()); }
+
+        QString path() const { return QString::fromStdString(m_path); }
+
+    private:
+        std::string m_path;
+    };
+
+    void datasetArguments(benchmark::internal::Benchmark* benchmark)
+    {
+        for (const int recordCount : {10, 1000, 100000})
+            for (const int checkValues : {0, 1})
+                benchmark->Args({recordCount, checkValues});
+        benchmark->ArgNames({"records", "check"})->Unit(benchmark::kMicrosecond);
+    }
+}
+
+// Baseline: the QJsonDocument parse alone, every QJsonObject based constructor pays it on top of the binding
+static void BM_ConstructBaselineQJsonDocument(benchmark::State& state)
+{
+    const QByteArray json = BenchmarkData::makeDataset(static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        QJsonObject obj = QJsonDocument::fromJson(json).object();
+        benchmark::DoNotOptimize(obj);
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_ConstructBaselineQJsonDocument)->Apply(datasetArguments);
+
+// QJsonObject overload, the parsed document is reused so only the binding is measured
+static void BM_ConstructFromQJsonObject(benchmark::State& state)
+{
+    const QJsonObject obj = QJsonDocument::fromJson(BenchmarkData::makeDataset(static_cast<int>(state.range(0)))).object();
+    for (auto _ : state) {
+        BenchDataset dataset(obj, state.range(1) != 0);
+        benchmark::DoNotOptimize(dataset);
+    }
+}
+BENCHMARK(BM_ConstructFromQJsonObject)->Apply(datasetArguments);
+
+// QJsonValue overload, the form the nested tagged objects are constructed with
+static void BM_ConstructFromQJsonValue(benchmark::State& state)
+{
+    const QJsonValue value = QJsonDocument::fromJson(BenchmarkData::makeDataset(static_cast<int>(state.range(0)))).object();
+    for (auto _ : state) {
+        BenchDataset dataset(value, state.range(1) != 0);
+        benchmark::DoNotOptimize(dataset);
+    }
+}
+BENCHMARK(BM_ConstructFromQJsonValue)->Apply(datasetArguments);
+
+// Single-pass binding of the QJsonObject
+static void BM_ConstructSinglePass(benchmark::State& state)
+{
+    const QJsonObject obj = QJsonDocument::fromJson(BenchmarkData::makeDataset(static_cast<int>(state.range(0)))).object();
+    for (auto _ : state) {
+        BenchDataset dataset(TaggedObject::singlePassBinding, obj, state.range(1) != 0);
+        benchmark::DoNotOptimize(dataset);
+    }
+}
+BENCHMARK(BM_ConstructSinglePass)->Apply(datasetArguments);
+
+// QByteArray overload, QJsonDocument parse and binding
+static void BM_ConstructFromQByteArray(benchmark::State& state)
+{
+    const QByteArray json = BenchmarkData::makeDataset(static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        BenchDataset dataset(json, state.range(1) != 0);
+        benchmark::DoNotOptimize(dataset);
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_ConstructFromQByteArray)->Apply(datasetArguments);
+
+// Direct-binding parse of the same text
+static void BM_ConstructFromJson(benchmark::State& state)
+{
+    const QByteArray json = BenchmarkData::makeDataset(static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        BenchDataset dataset = BenchDataset::fromJson(json, state.range(1) != 0);
+        benchmark::DoNotOptimize(dataset);
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_ConstructFromJson)->Apply(datasetArguments);
+
+// File path overload, the mapped file is parsed through QJsonDocument
+static void BM_ConstructFromFilePath(benchmark::State& state)
+{
+    const QByteArray json = BenchmarkData::makeDataset(static_cast<int>(state.range(0)));
+    const DocumentFile file(json, "tjo_construct_path.json");
+    const QString path = file.path();
+    for (auto _ : state) {
+        BenchDataset dataset(path, state.range(1) != 0);
+        benchmark::DoNotOptimize(dataset);
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_ConstructFromFilePath)->Apply(datasetArguments);
+
+// Direct-binding parse of the mapped file
+static void BM_ConstructFromFile(benchmark::State& state)
+{
+    const QByteArray json = BenchmarkData::makeDataset(static_cast<int>(state.range(0)));
+    const DocumentFile file(json, "tjo_construct_file.json");
+    const QString path = file.path();
+    for (auto _ : state) {
+        BenchDataset dataset = BenchDataset::fromFile(path, state.range(1) != 0);
+        benchmark::DoNotOptimize(dataset);
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_ConstructFromFile)->Apply(datasetArguments);
+
+// Member-wise constructor, the members are moved in
+static void BM_ConstructFromMembers(benchmark::State& state)
+{
+    const BenchDataset source = BenchDataset::fromJson(BenchmarkData::makeDataset(static_cast<int>(state.range(0))));
+    for (auto _ : state) {
+        TaggedJSONString name = source.source;
+        TaggedJSONArray<BenchRecord> records = source.records;
+        BenchDataset dataset(std::move(name), std::move(records));
+        benchmark::DoNotOptimize(dataset);
+    }
+}
+BENCHMARK(BM_ConstructFromMembers)->RangeMultiplier(100)->Range(10, 100000)->Unit(benchmark::kMicrosecond);
+
+// Wide objects, both parse paths against the QJsonDocument baseline
+template<typename T, int MemberCount>
+static void BM_ConstructWide(benchmark::State& state)
+{
+    const QByteArray json = QJsonDocument(BenchmarkData::makeWideObject(MemberCount)).toJson(QJsonDocument::Compact);
+    const bool checkValues = state.range(0) != 0;
+    for (auto _ : state) {
+        T bound(json, checkValues);
+        benchmark::DoNotOptimize(bound);
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK_TEMPLATE(BM_ConstructWide, Wide5, 5)->ArgName("check")->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_ConstructWide, Wide25, 25)->ArgName("check")->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_ConstructWide, Wide100, 100)->ArgName("check")->Arg(0)->Arg(1);
+
+template<typename T, int MemberCount>
+static void BM_ConstructWideFromJson(benchmark::State& state)
+{
+    const QByteArray json = QJsonDocument(BenchmarkData::makeWideObject(MemberCount)).toJson(QJsonDocument::Compact);
+    const bool checkValues = state.range(0) != 0;
+    for (auto _ : state) {
+        T bound = T::fromJson(json, checkValues);
+        benchmark::DoNotOptimize(bound);
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK_TEMPLATE(BM_ConstructWideFromJson, Wide5, 5)->ArgName("check")->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_ConstructWideFromJson, Wide25, 25)->ArgName("check")->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_ConstructWideFromJson, Wide100, 100)->ArgName("check")->Arg(0)->Arg(1);
+
+template<int MemberCount>
+static void BM_ConstructWideBaselineQJsonDocument(benchmark::State& state)
+{
+    const QByteArray json = QJsonDocument(BenchmarkData::makeWideObject(MemberCount)).toJson(QJsonDocument::Compact);
+    for (auto _ : state) {
+        QJsonObject obj = QJsonDocument::fromJson(json).object();
+        benchmark::DoNotOptimize(obj);
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK_TEMPLATE(BM_ConstructWideBaselineQJsonDocument, 5);
+BENCHMARK_TEMPLATE(BM_ConstructWideBaselineQJsonDocument, 25);
+BENCHMARK_TEMPLATE(BM_ConstructWideBaselineQJsonDocument, 100);
+
+// Deep nesting, one tagged object per level
+template<typename T, int Depth>
+static void BM_ConstructDeep(benchmark::State& state)
+{
+    const QByteArray json = BenchmarkData::makeDeepDocument(Depth);
+    const bool checkValues = state.range(0) != 0;
+    for (auto _ : state) {
+        T bound(json, checkValues);
+        benchmark::DoNotOptimize(bound);
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK_TEMPLATE(BM_ConstructDeep, BenchDepth2, 2)->ArgName("check")->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_ConstructDeep, BenchDepth4, 4)->ArgName("check")->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_ConstructDeep, BenchDepth8, 8)->ArgName("check")->Arg(0)->Arg(1);
+
+template<typename T, int Depth>
+static void BM_ConstructDeepFromJson(benchmark::State& state)
+{
+    const QByteArray json = BenchmarkData::makeDeepDocument(Depth);
+    const bool checkValues = state.range(0) != 0;
+    for (auto _ : state) {
+        T bound = T::fromJson(json, checkValues);
+        benchmark::DoNotOptimize(bound);
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK_TEMPLATE(BM_ConstructDeepFromJson, BenchDepth2, 2)->ArgName("check")->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_ConstructDeepFromJson, BenchDepth4, 4)->ArgName("check")->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_ConstructDeepFromJson, BenchDepth8, 8)->ArgName("check")->Arg(0)->Arg(1);
+
+// Large arrays of primitives
+static void BM_ConstructNumbers(benchmark::State& state)
+{
+    const QByteArray json = BenchmarkData::makeNumbers(static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        BenchNumbers numbers(json, state.range(1) != 0);
+        benchmark::DoNotOptimize(numbers);
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_ConstructNumbers)->ArgsProduct({{100, 10000, 1000000}, {0, 1}})->ArgNames({"elements", "check"})->Unit(benchmark::kMicrosecond);
+
+static void BM_ConstructNumbersFromJson(benchmark::State& state)
+{
+    const QByteArray json = BenchmarkData::makeNumbers(static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        BenchNumbers numbers = BenchNumbers::fromJson(json, state.range(1) != 0);
+        benchmark::DoNotOptimize(numbers);
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_ConstructNumbersFromJson)->ArgsProduct({{100, 10000, 1000000}, {0, 1}})->ArgNames({"elements", "check"})->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,119 @@
+#include <benchmark/benchmark.h>
+#include <QJsonDocument>
+#include "benchmarkdataset.h"
+
+// The member-by-member code of the generated classes against the shared, table-driven binder driven by the field descriptors (see taggedjsonfields.h).
+// The binary size is compared by building the project with and without TJO_TABLE_DRIVEN_BINDING and comparing the sizes of the executables.
+
+namespace {
+    constexpr int RECORD_COUNT = 10000;
+
+    QJsonArray makeRecords()
+    {
+        return QJsonDocument::fromJson(BenchmarkData::makeDataset(RECORD_COUNT)).object()["records"].toArray();
+    }
+}
+
+// Baseline: the QJsonObject constructor
+static void BM_FieldsConstructRecord(benchmark::State& state)
+{
+    const QJsonArray records = makeRecords();
+    for (auto _ : state) {
+        for (const QJsonValue& value : records) {
+            BenchRecord record(value.toObject());
+            benchmark::DoNotOptimize(record);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * records.size());
+}
+BENCHMARK(BM_FieldsConstructRecord)->Unit(benchmark::kMicrosecond);
+
+static void BM_FieldsBindRecord(benchmark::State& state)
+{
+    const QJsonArray records = makeRecords();
+    for (auto _ : state) {
+        for (const QJsonValue& value : records) {
+            BenchRecord record;
+            TaggedObject::bindFields(record, value.toObject());
+            benchmark::DoNotOptimize(record);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * records.size());
+}
+BENCHMARK(BM_FieldsBindRecord)->Unit(benchmark::kMicrosecond);
+
+// Baseline: the QJsonObject constructor of a class with 100 members
+static void BM_FieldsConstructWide100(benchmark::State& state)
+{
+    const QJsonObject obj = BenchmarkData::makeWideObject(100);
+    for (auto _ : state) {
+        Wide100 wide(obj);
+        benchmark::DoNotOptimize(wide);
+    }
+}
+BENCHMARK(BM_FieldsConstructWide100);
+
+static void BM_FieldsBindWide100(benchmark::State& state)
+{
+    const QJsonObject obj = BenchmarkData::makeWideObject(100);
+    for (auto _ : state) {
+        Wide100 wide;
+        TaggedObject::bindFields(wide, obj);
+        benchmark::DoNotOptimize(wide);
+    }
+}
+BENCHMARK(BM_FieldsBindWide100);
+
+// Baseline: the direct-binding parse through the binders of the generated class
+static void BM_FieldsFromJsonDataset(benchmark::State& state)
+{
+    const QByteArray json = BenchmarkData::makeDataset(RECORD_COUNT);
+    for (auto _ : state) {
+        BenchDataset dataset = BenchDataset::fromJson(json);
+        benchmark::DoNotOptimize(dataset);
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_FieldsFromJsonDataset)->Unit(benchmark::kMicrosecond);
+
+static void BM_FieldsReadDataset(benchmark::State& state)
+{
+    const QByteArray json = BenchmarkData::makeDataset(RECORD_COUNT);
+    for (auto _ : state) {
+        TaggedObject::JsonReader reader(json);
+        BenchDataset dataset;
+        TaggedObject::readFields(dataset, reader);
+        benchmark::DoNotOptimize(dataset);
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_FieldsReadDataset)->Unit(benchmark::kMicrosecond);
+
+// Baseline: toJsonObject() of a newly constructed object, the cache is empty
+static void BM_FieldsToJsonObjectRecord(benchmark::State& state)
+{
+    const QJsonArray records = makeRecords();
+    for (auto _ : state) {
+        for (const QJsonValue& value : records) {
+            const BenchRecord record(value.toObject());
+            QJsonObject obj = record.toJsonObject();
+            benchmark::DoNotOptimize(obj);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * records.size());
+}
+BENCHMARK(BM_FieldsToJsonObjectRecord)->Unit(benchmark::kMicrosecond);
+
+static void BM_FieldsTableToJsonObjectRecord(benchmark::State& state)
+{
+    const QJsonArray records = makeRecords();
+    for (auto _ : state) {
+        for (const QJsonValue& value : records) {
+            const BenchRecord record(value.toObject());
+            QJsonObject obj = TaggedObject::fieldsToJsonObject(record);
+            benchmark::DoNotOptimize(obj);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * records.size());
+}
+BENCHMARK(BM_FieldsTableToJsonObjectRecord)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,55 @@
+#include <filesystem>
+#include <fstream>
+#include <benchmark/benchmark.h>
+#include "taggedjsonfilecache.h"
+#include "benchmarkdataset.h"
+
+// Repeated loads of the same file: the file path constructor and fromFile() against the shared objects of JsonFileCache (see taggedjsonfilecache.h)
+
+namespace {
+    // Dataset file in the temporary directory, written once per record count
+    QString datasetFile(const int recordCount)
+    {
+        const std::filesystem::path path = std::filesystem::temp_directory_path() / ("tjo_filecache_benchmark_" + std::to_string(recordCount) + ".json");
+        const QByteArray json = BenchmarkData::makeDataset(recordCount);
+        std::ofstream(path, std::ios::binary).write(json.constData(), json.size());
+        return QString::fromStdString(path.string());
+    }
+}
+
+// Baseline: the file path constructor
+static void BM_FileCachePathConstructor(benchmark::State& state)
+{
+    const QString path = datasetFile(static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        BenchDataset dataset(path);
+        benchmark::DoNotOptimize(dataset);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FileCachePathConstructor)->RangeMultiplier(10)->Range(10, 1000)->Unit(benchmark::kMicrosecond);
+
+// Baseline: fromFile()
+static void BM_FileCacheFromFile(benchmark::State& state)
+{
+    const QString path = datasetFile(static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        BenchDataset dataset = BenchDataset::fromFile(path);
+        benchmark::DoNotOptimize(dataset);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FileCacheFromFile)->RangeMultiplier(10)->Range(10, 1000)->Unit(benchmark::kMicrosecond);
+
+// Every load after the first one is a stat of the file and a copy of the shared pointer
+static void BM_FileCacheLoad(benchmark::State& state)
+{
+    const QString path = datasetFile(static_cast<int>(state.range(0)));
+    TaggedObject::JsonFileCache cache;
+    for (auto _ : state) {
+        std::shared_ptr<const BenchDataset> dataset = cache.load<BenchDataset>(path);
+        benchmark::DoNotOptimize(dataset);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FileCacheLoad)->RangeMultiplier(10)->Range(10, 1000)->Unit(benchmark::kMicrosecond);
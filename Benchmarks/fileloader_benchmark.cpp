@@ -0,0 +1,74 @@
+#include <filesystem>
+#include <fstream>
+#include <benchmark/benchmark.h>
+#include "taggedjsonfileloader.h"
+#include "benchmarkdataset.h"
+
+// Startup-like loading of many small files: one at a time on the calling thread against the batched JsonFileLoader (see taggedjsonfileloader.h)
+
+namespace {
+    constexpr int FILE_COUNT = 2000;
+
+    // Small config-sized files in the temporary directory, written once
+    const QStringList& configFiles()
+    {
+        static const QStringList paths = [] {
+            const std::filesystem::path dir = std::filesystem::temp_directory_path() / "tjo_fileloader_benchmark";
+            std::filesystem::create_directories(dir);
+            const QByteArray json = BenchmarkData::makeDataset(20);
+            QStringList ret;
+            for (int i = 0; i < FILE_COUNT; ++i) {
+                const std::filesystem::path path = dir / ("config_" + std::to_string(i) + ".json");
+                std::ofstream(path, std::ios::binary).write(json.constData(), json.size());
+                ret.push_back(QString::fromStdString(path.string()));
+            }
+            return ret;
+        }();
+        return paths;
+    }
+}
+
+// Baseline: the file path constructor, one file after the other
+static void BM_FileLoaderPathConstructor(benchmark::State& state)
+{
+    const QStringList& paths = configFiles();
+    for (auto _ : state) {
+        std::vector<BenchDataset> datasets;
+        datasets.reserve(paths.size());
+        for (const QString& path : paths)
+            datasets.emplace_back(path);
+        benchmark::DoNotOptimize(datasets);
+    }
+    state.SetItemsProcessed(state.iterations() * FILE_COUNT);
+}
+BENCHMARK(BM_FileLoaderPathConstructor)->Unit(benchmark::kMillisecond);
+
+// Baseline: fromFile(), one file after the other
+static void BM_FileLoaderFromFile(benchmark::State& state)
+{
+    const QStringList& paths = configFiles();
+    for (auto _ : state) {
+        std::vector<BenchDataset> datasets;
+        datasets.reserve(paths.size());
+        for (const QString& path : paths)
+            datasets.push_back(BenchDataset::fromFile(path));
+        benchmark::DoNotOptimize(datasets);
+    }
+    state.SetItemsProcessed(state.iterations() * FILE_COUNT);
+}
+BENCHMARK(BM_FileLoaderFromFile)->Unit(benchmark::kMillisecond);
+
+// The argument is the concurrency limit, 0 uses every thread of the global pool
+static void BM_FileLoaderLoad(benchmark::State& state)
+{
+    const QStringList& paths = configFiles();
+    TaggedObject::JsonFileLoadOptions options;
+    options.maxConcurrentFiles = static_cast<int>(state.range(0));
+    TaggedObject::JsonFileLoader<BenchDataset> loader(options);
+    for (auto _ : state) {
+        TaggedObject::JsonFileResult<BenchDataset> result = loader.load(paths);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations() * FILE_COUNT);
+}
+BENCHMARK(BM_FileLoaderLoad)->Arg(1)->Arg(4)->Arg(0)->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -0,0 +1,168 @@
+#include <benchmark/benchmark.h>
+#include "taggedjsonobject.h"
+#include "taggedjsonarray.h"
+#include "taggedjsonlazyobjectmacros.h"
+
+TJO_DEFINE_JSON_TAGGED_OBJECT(EagerWide40,
+                              (TaggedJSONString, field_0),
+                              (TaggedJSONString, field_1),
+                              (TaggedJSONString, field_2),
+                              (TaggedJSONString, field_3),
+                              (TaggedJSONStringArray, field_4),
+                              (TaggedJSONString, field_5),
+                              (TaggedJSONString, field_6),
+                              (TaggedJSONString, field_7),
+                              (TaggedJSONString, field_8),
+                              (TaggedJSONStringArray, field_9),
+                              (TaggedJSONString, field_10),
+                              (TaggedJSONString, field_11),
+                              (TaggedJSONString, field_12),
+                              (TaggedJSONString, field_13),
+                              (TaggedJSONStringArray, field_14),
+                              (TaggedJSONString, field_15),
+                              (TaggedJSONString, field_16),
+                              (TaggedJSONString, field_17),
+                              (TaggedJSONString, field_18),
+                              (TaggedJSONStringArray, field_19),
+                              (TaggedJSONString, field_20),
+                              (TaggedJSONString, field_21),
+                              (TaggedJSONString, field_22),
+                              (TaggedJSONString, field_23),
+                              (TaggedJSONStringArray, field_24),
+                              (TaggedJSONString, field_25),
+                              (TaggedJSONString, field_26),
+                              (TaggedJSONString, field_27),
+                              (TaggedJSONString, field_28),
+                              (TaggedJSONStringArray, field_29),
+                              (TaggedJSONString, field_30),
+                              (TaggedJSONString, field_31),
+                              (TaggedJSONString, field_32),
+                              (TaggedJSONString, field_33),
+                              (TaggedJSONStringArray, field_34),
+                              (TaggedJSONString, field_35),
+                              (TaggedJSONString, field_36),
+                              (TaggedJSONString, field_37),
+                              (TaggedJSONString, field_38),
+                              (TaggedJSONStringArray, field_39))
+
+TJO_DEFINE_LAZY_JSON_TAGGED_OBJECT(LazyWide40,
+                                   (TaggedJSONString, field_0),
+                                   (TaggedJSONString, field_1),
+                                   (TaggedJSONString, field_2),
+                                   (TaggedJSONString, field_3),
+                                   (TaggedJSONStringArray, field_4),
+                                   (TaggedJSONString, field_5),
+                                   (TaggedJSONString, field_6),
+                                   (TaggedJSONString, field_7),
+                                   (TaggedJSONString, field_8),
+                                   (TaggedJSONStringArray, field_9),
+                                   (TaggedJSONString, field_10),
+                                   (TaggedJSONString, field_11),
+                                   (TaggedJSONString, field_12),
+                                   (TaggedJSONString, field_13),
+                                   (TaggedJSONStringArray, field_14),
+                                   (TaggedJSONString, field_15),
+                                   (TaggedJSONString, field_16),
+                                   (TaggedJSONString, field_17),
+                                   (TaggedJSONString, field_18),
+                                   (TaggedJSONStringArray, field_19),
+                                   (TaggedJSONString, field_20),
+                                   (TaggedJSONString, field_21),
+                                   (TaggedJSONString, field_22),
+                                   (TaggedJSONString, field_23),
+                                   (TaggedJSONStringArray, field_24),
+                                   (TaggedJSONString, field_25),
+                                   (TaggedJSONString, field_26),
+                                   (TaggedJSONString, field_27),
+                                   (TaggedJSONString, field_28),
+                                   (TaggedJSONStringArray, field_29),
+                                   (TaggedJSONString, field_30),
+                                   (TaggedJSONString, field_31),
+                                   (TaggedJSONString, field_32),
+                                   (TaggedJSONString, field_33),
+                                   (TaggedJSONStringArray, field_34),
+                                   (TaggedJSONString, field_35),
+                                   (TaggedJSONString, field_36),
+                                   (TaggedJSONString, field_37),
+                                   (TaggedJSONString, field_38),
+                                   (TaggedJSONStringArray, field_39))
+
+namespace {
+    constexpr int MEMBER_COUNT = 40;
+
+    //Every fifth member is an array of strings, the rest are strings
+    QByteArray makeWideDocument()
+    {
+        QByteArray json = "{";
+        for (int i = 0; i < MEMBER_COUNT; ++i) {
+            if (i != 0)
+                json += ", ";
+            json += "\"field_" + QByteArray::number(i) + "\": ";
+            if (i % 5 == 4)
+                json += R"(["alpha", "beta", "gamma", "delta"])";
+            else
+                json += "\"value of the member " + QByteArray::number(i) + "\"";
+        }
+        json += "}";
+        return json;
+    }
+}
+
+// Eager direct-binding parse, every member is converted whether it is used or not
+static void BM_EagerReadTwoMembers(benchmark::State& state)
+{
+    const QByteArray json = makeWideDocument();
+    for (auto _ : state) {
+        const EagerWide40 obj = EagerWide40::fromJson(json);
+        benchmark::DoNotOptimize(obj.field_3->size() + obj.field_9->size());
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_EagerReadTwoMembers);
+
+// Lazy parse, the text is only scanned and the two members that are used are converted
+static void BM_LazyReadTwoMembers(benchmark::State& state)
+{
+    const QByteArray json = makeWideDocument();
+    for (auto _ : state) {
+        const LazyWide40 obj = LazyWide40::fromJson(json);
+        benchmark::DoNotOptimize(obj.field_3()->size() + obj.field_9()->size());
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_LazyReadTwoMembers);
+
+// Lazy parse followed by validate(), the worst case where every member ends up being converted
+static void BM_LazyValidateAll(benchmark::State& state)
+{
+    const QByteArray json = makeWideDocument();
+    for (auto _ : state) {
+        const LazyWide40 obj = LazyWide40::fromJson(json);
+        obj.validate();
+        benchmark::DoNotOptimize(obj.field_3()->size());
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_LazyValidateAll);
+
+// Lazy object over an already parsed QJsonObject, two lookups instead of forty
+static void BM_LazyObjectReadTwoMembers(benchmark::State& state)
+{
+    const QJsonObject source = QJsonDocument::fromJson(makeWideDocument()).object();
+    for (auto _ : state) {
+        const LazyWide40 obj{source};
+        benchmark::DoNotOptimize(obj.field_3()->size() + obj.field_9()->size());
+    }
+}
+BENCHMARK(BM_LazyObjectReadTwoMembers);
+
+// Eager binding over the same QJsonObject
+static void BM_EagerObjectReadTwoMembers(benchmark::State& state)
+{
+    const QJsonObject source = QJsonDocument::fromJson(makeWideDocument()).object();
+    for (auto _ : state) {
+        const EagerWide40 obj{source};
+        benchmark::DoNotOptimize(obj.field_3->size() + obj.field_9->size());
+    }
+}
+BENCHMARK(BM_EagerObjectReadTwoMembers);
@@ -0,0 +1,48 @@
+#include <benchmark/benchmark.h>
+#include "benchmarkdataset.h"
+#include "taggedjsonlines.h"
+
+namespace {
+    //JSON Lines text with one benchmark record per line
+    QByteArray makeLines(const int lineCount)
+    {
+        const BenchDataset dataset = BenchDataset::fromJson(BenchmarkData::makeDataset(lineCount));
+        QByteArray lines;
+        for (const BenchRecord& record : *dataset.records) {
+            record.writeJson(lines, QJsonDocument::Compact);
+            lines += '\n';
+        }
+        return lines;
+    }
+}
+
+// Current path: one QByteArray constructor call per line on the calling thread
+static void BM_LinesSequential(benchmark::State& state)
+{
+    const QByteArray lines = makeLines(static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        std::vector<BenchRecord> records;
+        for (const QByteArray& line : lines.split('\n')) {
+            if (!line.isEmpty())
+                records.emplace_back(line);
+        }
+        benchmark::DoNotOptimize(records);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LinesSequential)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// Parallel reader, records per second against the line count and the thread count
+static void BM_LinesParallel(benchmark::State& state)
+{
+    const QByteArray lines = makeLines(static_cast<int>(state.range(0)));
+    TaggedObject::JsonLinesOptions options;
+    options.threadCount = static_cast<int>(state.range(1));
+    TaggedObject::JsonLinesReader<BenchRecord> reader(options);
+    for (auto _ : state) {
+        std::vector<BenchRecord> records = reader.readAll(lines);
+        benchmark::DoNotOptimize(records);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LinesParallel)->ArgsProduct({{10000, 100000}, {1, 2, 4, 8}})->ArgNames({"lines", "threads"})->Unit(benchmark::kMillisecond)->UseRealTime();
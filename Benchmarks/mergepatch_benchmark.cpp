@@ -0,0 +1,105 @@
+#include <benchmark/benchmark.h>
+#include <QJsonDocument>
+#include "taggedjsonobject.h"
+#include "taggedjsonarray.h"
+#include "taggedjsonobjectmacros.h"
+#include "benchmarkdataset.h"
+
+// The merge patches and updateJsonObject() need TJO_ENABLE_MODIFICATION_TRACKING, these benchmarks are built into trackingBenchmarks
+#ifndef TJO_ENABLE_MODIFICATION_TRACKING
+#error "The merge patch benchmarks need TJO_ENABLE_MODIFICATION_TRACKING"
+#endif
+
+TJO_DEFINE_JSON_TAGGED_OBJECT(TickChannel,
+                              (TaggedJSONString, label),
+                              (TaggedJSONDouble, value),
+                              (TaggedJSONBool, alarm))
+
+TJO_DEFINE_JSON_TAGGED_OBJECT(TickState,
+                              (TaggedJSONInt, tick),
+                              (TaggedJSONString, status),
+                              (TaggedJSONArray<TickChannel>, channels))
+
+namespace {
+    //State with the given number of channels
+    QByteArray makeState(const int channelCount)
+    {
+        QByteArray json = R"({"tick": 0, "status": "running", "channels": [)";
+        for (int i = 0; i < channelCount; ++i)
+            json += (i ? ", " : "") + QByteArray(R"({"label": "channel )") + QByteArray::number(i) + R"(", "value": 0.5, "alarm": false})";
+        json += "]}";
+        return json;
+    }
+}
+
+// Every tick builds the whole QJsonObject with toJsonObject()
+static void BM_RepublishRebuild(benchmark::State& state)
+{
+    const TickState base = TickState::fromJson(makeState(static_cast<int>(state.range(0))));
+    int tick = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        TickState current = TickState::fromJson(base.toJson());
+        state.ResumeTiming();
+        current.tick = ++tick;
+        benchmark::DoNotOptimize(current.updateJsonObject());
+    }
+}
+BENCHMARK(BM_RepublishRebuild)->RangeMultiplier(10)->Range(10, 10000)->Unit(benchmark::kMicrosecond);
+
+// A top level member changes every tick, updateJsonObject() keeps the channels from the previous tick
+static void BM_RepublishCached(benchmark::State& state)
+{
+    TickState current = TickState::fromJson(makeState(static_cast<int>(state.range(0))));
+    current.clearModified();
+    int tick = 0;
+    for (auto _ : state) {
+        current.tick = ++tick;
+        benchmark::DoNotOptimize(current.updateJsonObject());
+    }
+}
+BENCHMARK(BM_RepublishCached)->RangeMultiplier(10)->Range(10, 10000)->Unit(benchmark::kMicrosecond);
+
+// A single channel changes every tick, the channels are serialized again and compared with the previous tick
+static void BM_RepublishCachedElement(benchmark::State& state)
+{
+    TickState current = TickState::fromJson(makeState(static_cast<int>(state.range(0))));
+    current.clearModified();
+    int tick = 0;
+    for (auto _ : state) {
+        ++tick;
+        current.channels.at(tick % state.range(0)).value = tick;
+        benchmark::DoNotOptimize(current.updateJsonObject());
+    }
+}
+BENCHMARK(BM_RepublishCachedElement)->RangeMultiplier(10)->Range(10, 10000)->Unit(benchmark::kMicrosecond);
+
+// Delta of a top level member, the counters compare the patch with the full document
+static void BM_RepublishMergePatch(benchmark::State& state)
+{
+    TickState current = TickState::fromJson(makeState(static_cast<int>(state.range(0))));
+    current.clearModified();
+    int tick = 0;
+    QJsonObject patch;
+    for (auto _ : state) {
+        current.tick = ++tick;
+        patch = current.toMergePatch();
+        current.clearModified();
+        benchmark::DoNotOptimize(patch);
+    }
+    state.counters["patch_bytes"] = static_cast<double>(QJsonDocument(patch).toJson(QJsonDocument::Compact).size());
+    state.counters["document_bytes"] = static_cast<double>(current.toJson(QJsonDocument::Compact).size());
+}
+BENCHMARK(BM_RepublishMergePatch)->RangeMultiplier(10)->Range(10, 10000)->Unit(benchmark::kMicrosecond);
+
+// updateJsonObject() after a change of a top level member, the records are kept from the previous call. Counterpart of BM_ToJsonObjectCold.
+static void BM_ToJsonObjectCached(benchmark::State& state)
+{
+    BenchDataset dataset = BenchDataset::fromJson(BenchmarkData::makeDataset(static_cast<int>(state.range(0))));
+    dataset.clearModified();
+    for (auto _ : state) {
+        dataset.source = QStringLiteral("changed");
+        benchmark::DoNotOptimize(dataset.updateJsonObject());
+    }
+}
+BENCHMARK(BM_ToJsonObjectCached)->ArgName("records")->RangeMultiplier(10)->Range(10, 100000)->Unit(benchmark::kMicrosecond);
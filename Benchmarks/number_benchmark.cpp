@@ -0,0 +1,144 @@
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <QJsonDocument>
+#include "benchmarkdataset.h"
+#include "taggedjsonvector.h"
+#include "taggedjsonnumber.h"
+
+// The numeric kernel (std::from_chars/std::to_chars) against Qt's conversions, on single numbers and on numeric-heavy documents
+
+TJO_DEFINE_JSON_TAGGED_OBJECT(BenchCounters,
+                              (TaggedJSONInt64Vector, counters))
+
+namespace {
+    //Text of doubles with a varying number of significant digits and exponents
+    std::vector<QByteArray> makeDoubleTexts(const int count)
+    {
+        std::vector<QByteArray> ret;
+        ret.reserve(static_cast<std::size_t>(count));
+        for (int i = 0; i < count; ++i) {
+            QByteArray text;
+            TaggedObject::appendJsonDouble(text, (i + 0.1) * (i % 7 == 0 ? 1e-9 : 1.37) / 3.0);
+            ret.push_back(text);
+        }
+        return ret;
+    }
+
+    //Document of the BenchCounters class, the values need the whole 64-bit range
+    QByteArray makeCounters(const int count)
+    {
+        QByteArray json = R"({"counters": [)";
+        for (int i = 0; i < count; ++i)
+            json += (i ? "," : "") + QByteArray::number(qint64(9007199254740993LL) * (i % 1000) - i);
+        return json + "]}";
+    }
+
+    void elementArguments(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->ArgName("elements")->RangeMultiplier(100)->Range(100, 1000000)->Unit(benchmark::kMicrosecond);
+    }
+}
+
+// Baseline: QByteArray::toDouble() on each number text
+static void BM_NumberParseBaselineToDouble(benchmark::State& state)
+{
+    const std::vector<QByteArray> texts = makeDoubleTexts(10000);
+    for (auto _ : state) {
+        double sum = 0;
+        for (const QByteArray& text : texts)
+            sum += text.toDouble();
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<qint64>(texts.size()));
+}
+BENCHMARK(BM_NumberParseBaselineToDouble);
+
+static void BM_NumberParseKernel(benchmark::State& state)
+{
+    const std::vector<QByteArray> texts = makeDoubleTexts(10000);
+    for (auto _ : state) {
+        double sum = 0;
+        for (const QByteArray& text : texts)
+            sum += TaggedObject::parseJsonDouble(text.constData(), text.constData() + text.size());
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<qint64>(texts.size()));
+}
+BENCHMARK(BM_NumberParseKernel);
+
+// Baseline: QByteArray::number() with the shortest precision, the conversion QJsonDocument uses
+static void BM_NumberFormatBaselineQByteArray(benchmark::State& state)
+{
+    const std::vector<QByteArray> texts = makeDoubleTexts(10000);
+    std::vector<double> values;
+    for (const QByteArray& text : texts)
+        values.push_back(text.toDouble());
+    for (auto _ : state) {
+        QByteArray out;
+        for (const double value : values)
+            out += QByteArray::number(value, 'g', QLocale::FloatingPointShortest);
+        benchmark::DoNotOptimize(out);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<qint64>(values.size()));
+}
+BENCHMARK(BM_NumberFormatBaselineQByteArray);
+
+static void BM_NumberFormatKernel(benchmark::State& state)
+{
+    const std::vector<QByteArray> texts = makeDoubleTexts(10000);
+    std::vector<double> values;
+    for (const QByteArray& text : texts)
+        values.push_back(text.toDouble());
+    for (auto _ : state) {
+        QByteArray out;
+        for (const double value : values)
+            TaggedObject::appendJsonDouble(out, value);
+        benchmark::DoNotOptimize(out);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<qint64>(values.size()));
+}
+BENCHMARK(BM_NumberFormatKernel);
+
+// 64-bit integers, the QJsonDocument parse against the exact direct-binding parse
+static void BM_NumberInt64BaselineQJsonDocument(benchmark::State& state)
+{
+    const QByteArray json = makeCounters(static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        QJsonObject obj = QJsonDocument::fromJson(json).object();
+        benchmark::DoNotOptimize(obj);
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_NumberInt64BaselineQJsonDocument)->Apply(elementArguments);
+
+static void BM_NumberInt64FromJson(benchmark::State& state)
+{
+    const QByteArray json = makeCounters(static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        BenchCounters counters = BenchCounters::fromJson(json);
+        benchmark::DoNotOptimize(counters);
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_NumberInt64FromJson)->Apply(elementArguments);
+
+// Serialization of the numeric arrays, through QJsonDocument (the QJsonObject comes from the cache) and directly
+static void BM_NumberSerializeBaselineQJsonDocument(benchmark::State& state)
+{
+    const BenchNumbers numbers = BenchNumbers::fromJson(BenchmarkData::makeNumbers(static_cast<int>(state.range(0))));
+    for (auto _ : state) {
+        QByteArray json = QJsonDocument(numbers.toJsonObject()).toJson(QJsonDocument::Compact);
+        benchmark::DoNotOptimize(json);
+    }
+}
+BENCHMARK(BM_NumberSerializeBaselineQJsonDocument)->Apply(elementArguments);
+
+static void BM_NumberSerializeToJson(benchmark::State& state)
+{
+    const BenchNumbers numbers = BenchNumbers::fromJson(BenchmarkData::makeNumbers(static_cast<int>(state.range(0))));
+    for (auto _ : state) {
+        QByteArray json = numbers.toJson(QJsonDocument::Compact);
+        benchmark::DoNotOptimize(json);
+    }
+}
+BENCHMARK(BM_NumberSerializeToJson)->Apply(elementArguments);
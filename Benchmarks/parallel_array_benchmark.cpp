@@ -0,0 +1,42 @@
+#include <benchmark/benchmark.h>
+#include "benchmarkdataset.h"
+
+namespace {
+    constexpr qsizetype PARALLEL_THRESHOLD = 1000;
+
+    QJsonValue makeRecords(const int recordCount)
+    {
+        return QJsonDocument::fromJson(BenchmarkData::makeDataset(recordCount)).object()["records"];
+    }
+}
+
+// Construction of a tagged array from a QJsonArray, the second argument enables the parallel mode
+static void BM_ConstructTaggedArray(benchmark::State& state)
+{
+    const QJsonValue records = makeRecords(static_cast<int>(state.range(0)));
+    TaggedObject::setParallelArrayThreshold(state.range(1) ? PARALLEL_THRESHOLD : 0);
+    for (auto _ : state) {
+        TaggedJSONArray<BenchRecord> arr{records};
+        benchmark::DoNotOptimize(arr);
+    }
+    TaggedObject::setParallelArrayThreshold(0);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ConstructTaggedArray)->ArgsProduct({{100, 100000}, {0, 1}})->ArgNames({"records", "parallel"})->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+// Direct serialization of a tagged array
+static void BM_SerializeTaggedArray(benchmark::State& state)
+{
+    const TaggedJSONArray<BenchRecord> arr{makeRecords(static_cast<int>(state.range(0)))};
+    TaggedObject::setParallelArrayThreshold(state.range(1) ? PARALLEL_THRESHOLD : 0);
+    QByteArray json;
+    for (auto _ : state) {
+        json.resize(0);
+        TaggedObject::JsonWriter writer(json, QJsonDocument::Compact);
+        arr.writeJson(writer);
+        benchmark::DoNotOptimize(json);
+    }
+    TaggedObject::setParallelArrayThreshold(0);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SerializeTaggedArray)->ArgsProduct({{100, 100000}, {0, 1}})->ArgNames({"records", "parallel"})->Unit(benchmark::kMicrosecond)->UseRealTime();
@@ -0,0 +1,26 @@
+#include <benchmark/benchmark.h>
+#include "benchmarkdataset.h"
+
+// Current path: QJsonDocument DOM, then one lookup and conversion per member
+static void BM_ParseThroughQJsonDocument(benchmark::State& state)
+{
+    const QByteArray json = BenchmarkData::makeDataset(static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        BenchDataset dataset{json};
+        benchmark::DoNotOptimize(dataset);
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_ParseThroughQJsonDocument)->RangeMultiplier(10)->Range(10, 100000)->Unit(benchmark::kMicrosecond);
+
+// Direct-binding path: single tokenizer pass straight into the members
+static void BM_ParseDirect(benchmark::State& state)
+{
+    const QByteArray json = BenchmarkData::makeDataset(static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        BenchDataset dataset = BenchDataset::fromJson(json);
+        benchmark::DoNotOptimize(dataset);
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_ParseDirect)->RangeMultiplier(10)->Range(10, 100000)->Unit(benchmark::kMicrosecond);
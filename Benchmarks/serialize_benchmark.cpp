@@ -0,0 +1,32 @@
+#include <benchmark/benchmark.h>
+#include "benchmarkdataset.h"
+
+// Current path: QJsonObject built member by member, then QJsonDocument::toJson()
+static void BM_SerializeThroughQJsonDocument(benchmark::State& state)
+{
+    const BenchDataset dataset = BenchDataset::fromJson(BenchmarkData::makeDataset(static_cast<int>(state.range(0))));
+    qint64 bytes = 0;
+    for (auto _ : state) {
+        const QByteArray json = QJsonDocument(dataset.toJsonObject()).toJson(QJsonDocument::Compact);
+        bytes += json.size();
+        benchmark::DoNotOptimize(json);
+    }
+    state.SetBytesProcessed(bytes);
+}
+BENCHMARK(BM_SerializeThroughQJsonDocument)->RangeMultiplier(10)->Range(10, 100000)->Unit(benchmark::kMicrosecond);
+
+// Direct path: members write the text in one pass into a reused buffer
+static void BM_SerializeDirect(benchmark::State& state)
+{
+    const BenchDataset dataset = BenchDataset::fromJson(BenchmarkData::makeDataset(static_cast<int>(state.range(0))));
+    qint64 bytes = 0;
+    QByteArray json;
+    for (auto _ : state) {
+        json.resize(0);
+        dataset.writeJson(json, QJsonDocument::Compact);
+        bytes += json.size();
+        benchmark::DoNotOptimize(json);
+    }
+    state.SetBytesProcessed(bytes);
+}
+BENCHMARK(BM_SerializeDirect)->RangeMultiplier(10)->Range(10, 100000)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+#include "taggedjsonshared.h"
+#include "benchmarkdataset.h"
+
+// Snapshots of a large object: copies of the member-wise dataset against copies of the same dataset with implicitly shared records (see taggedjsonshared.h)
+
+namespace {
+    TJO_DEFINE_JSON_TAGGED_OBJECT(SharedBenchDataset,
+                                  (TaggedJSONString, source),
+                                  (TaggedJSONSharedArray<BenchRecord>, records))
+}
+
+// Baseline: every record is copied
+static void BM_SharedCopyObject(benchmark::State& state)
+{
+    const BenchDataset dataset = BenchDataset::fromJson(BenchmarkData::makeDataset(static_cast<int>(state.range(0))));
+    for (auto _ : state) {
+        BenchDataset snapshot = dataset;
+        benchmark::DoNotOptimize(snapshot);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SharedCopyObject)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMicrosecond);
+
+static void BM_SharedCopySharedMember(benchmark::State& state)
+{
+    const SharedBenchDataset dataset = SharedBenchDataset::fromJson(BenchmarkData::makeDataset(static_cast<int>(state.range(0))));
+    for (auto _ : state) {
+        SharedBenchDataset snapshot = dataset;
+        benchmark::DoNotOptimize(snapshot);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SharedCopySharedMember)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMicrosecond);
+
+static void BM_SharedCopyWholeObject(benchmark::State& state)
+{
+    const TaggedJSONShared<BenchDataset> dataset(BenchDataset::fromJson(BenchmarkData::makeDataset(static_cast<int>(state.range(0)))));
+    for (auto _ : state) {
+        TaggedJSONShared<BenchDataset> snapshot = dataset;
+        benchmark::DoNotOptimize(snapshot);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SharedCopyWholeObject)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMicrosecond);
+
+// The first write after a snapshot pays for the copy once, the following ones are detached already
+static void BM_SharedDetach(benchmark::State& state)
+{
+    SharedBenchDataset dataset = SharedBenchDataset::fromJson(BenchmarkData::makeDataset(static_cast<int>(state.range(0))));
+    for (auto _ : state) {
+        SharedBenchDataset snapshot = dataset;
+        (**dataset.records)[0].score = 1.0;
+        benchmark::DoNotOptimize(snapshot);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SharedDetach)->Arg(10000)->Unit(benchmark::kMicrosecond);
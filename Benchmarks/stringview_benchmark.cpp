@@ -0,0 +1,76 @@
+#include <benchmark/benchmark.h>
+#include "taggedjsonobject.h"
+#include "taggedjsonarray.h"
+#include "taggedjsonstringview.h"
+#include "taggedjsonobjectmacros.h"
+
+TJO_DEFINE_JSON_TAGGED_OBJECT(StringEvent,
+                              (TaggedJSONString, source),
+                              (TaggedJSONString, kind),
+                              (TaggedJSONString, user),
+                              (TaggedJSONString, message),
+                              (TaggedJSONString, path))
+
+TJO_DEFINE_JSON_TAGGED_OBJECT(StringEventLog,
+                              (TaggedJSONArray<StringEvent>, events))
+
+TJO_DEFINE_JSON_TAGGED_OBJECT(ViewEvent,
+                              (TaggedJSONStringView, source),
+                              (TaggedJSONStringView, kind),
+                              (TaggedJSONStringView, user),
+                              (TaggedJSONStringView, message),
+                              (TaggedJSONStringView, path))
+
+TJO_DEFINE_JSON_TAGGED_OBJECT(ViewEventLog,
+                              (TaggedJSONArray<ViewEvent>, events))
+
+namespace {
+    //String-heavy records, every fourth event is an error
+    QByteArray makeEventLog(const int eventCount)
+    {
+        QByteArray json = R"({"events": [)";
+        for (int i = 0; i < eventCount; ++i) {
+            json += (i ? ", " : "") + QByteArray(R"({"source": "service-)") + QByteArray::number(i % 16)
+                  + R"(", "kind": ")" + (i % 4 ? "info" : "error")
+                  + R"(", "user": "user)" + QByteArray::number(i)
+                  + R"(@example.com", "message": "request handled by the worker pool in the expected time frame", "path": "/api/v1/items/)"
+                  + QByteArray::number(i) + R"("})";
+        }
+        json += "]}";
+        return json;
+    }
+
+    bool isError(const StringEvent& event) { return *event.kind == QLatin1String("error"); }
+    bool isError(const ViewEvent& event) { return event.kind == "error"; }
+}
+
+// Parse and compare one field, the views compare the source bytes instead of decoding every string
+template<typename Log>
+static void BM_ParseAndFilter(benchmark::State& state)
+{
+    const QByteArray json = makeEventLog(static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        const Log log = Log::fromJson(json);
+        int errors = 0;
+        for (const auto& event : *log.events)
+            errors += isError(event);
+        benchmark::DoNotOptimize(errors);
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK_TEMPLATE(BM_ParseAndFilter, StringEventLog)->RangeMultiplier(10)->Range(10, 10000)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_ParseAndFilter, ViewEventLog)->RangeMultiplier(10)->Range(10, 10000)->Unit(benchmark::kMicrosecond);
+
+// Parse and forward, the views are written straight from the source bytes
+template<typename Log>
+static void BM_ParseAndForward(benchmark::State& state)
+{
+    const QByteArray json = makeEventLog(static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        const QByteArray out = Log::fromJson(json).toJson(QJsonDocument::Compact);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK_TEMPLATE(BM_ParseAndForward, StringEventLog)->RangeMultiplier(10)->Range(10, 10000)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_ParseAndForward, ViewEventLog)->RangeMultiplier(10)->Range(10, 10000)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,95 @@
+#include <stdexcept>
+#include <benchmark/benchmark.h>
+#include <QJsonDocument>
+#include "taggedjsonvalidation.h"
+#include "benchmarkdataset.h"
+
+// Bulk ingestion of records of which a given percentage is malformed: the strict constructor that throws, tryFrom() that collects the errors and the
+// lenient constructor that detects nothing
+
+namespace {
+    constexpr int RECORD_COUNT = 10000;
+
+    //Records of the benchmark dataset, the given percentage of them misses "score" and has a string as the latitude of the location
+    QJsonArray makeRecords(const int malformedPercent)
+    {
+        const QJsonArray source = QJsonDocument::fromJson(BenchmarkData::makeDataset(RECORD_COUNT)).object()["records"].toArray();
+        QJsonArray records;
+        for (qsizetype i = 0; i < source.size(); ++i) {
+            QJsonObject record = source.at(i).toObject();
+            if (i % 100 < malformedPercent) {
+                record.remove(QStringLiteral("score"));
+                QJsonObject location = record["location"].toObject();
+                location.insert(QStringLiteral("latitude"), QStringLiteral("north"));
+                record.insert(QStringLiteral("location"), location);
+            }
+            records.append(record);
+        }
+        return records;
+    }
+
+    void malformedArguments(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->ArgName("malformed_percent")->Arg(0)->Arg(1)->Arg(5)->Arg(10)->Arg(50)->Unit(benchmark::kMicrosecond);
+    }
+}
+
+// Strict construction, every malformed record unwinds an exception and reports only its first missing member
+static void BM_IngestStrict(benchmark::State& state)
+{
+    const QJsonArray records = makeRecords(static_cast<int>(state.range(0)));
+    qint64 rejected = 0;
+    for (auto _ : state) {
+        rejected = 0;
+        for (const QJsonValue& record : records) {
+            try {
+                BenchRecord bound(record.toObject());
+                benchmark::DoNotOptimize(bound);
+            }
+            catch (const std::runtime_error&) {
+                ++rejected;
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * records.size());
+    state.counters["rejected"] = static_cast<double>(rejected);
+}
+BENCHMARK(BM_IngestStrict)->Apply(malformedArguments);
+
+// Error-collecting construction, every malformed record reports all of its errors with their paths
+static void BM_IngestTryFrom(benchmark::State& state)
+{
+    const QJsonArray records = makeRecords(static_cast<int>(state.range(0)));
+    qint64 rejected = 0;
+    qint64 errors = 0;
+    for (auto _ : state) {
+        rejected = 0;
+        errors = 0;
+        for (const QJsonValue& record : records) {
+            const auto result = BenchRecord::tryFrom(record.toObject());
+            if (!result) {
+                ++rejected;
+                errors += static_cast<qint64>(result.errors().size());
+            }
+            benchmark::DoNotOptimize(result);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * records.size());
+    state.counters["rejected"] = static_cast<double>(rejected);
+    state.counters["errors"] = static_cast<double>(errors);
+}
+BENCHMARK(BM_IngestTryFrom)->Apply(malformedArguments);
+
+// Baseline: lenient construction, the malformed records are accepted with default values
+static void BM_IngestLenient(benchmark::State& state)
+{
+    const QJsonArray records = makeRecords(static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        for (const QJsonValue& record : records) {
+            BenchRecord bound(record.toObject(), false);
+            benchmark::DoNotOptimize(bound);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * records.size());
+}
+BENCHMARK(BM_IngestLenient)->Apply(malformedArguments);
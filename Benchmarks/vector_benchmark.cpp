@@ -0,0 +1,83 @@
+#include <numeric>
+#include <benchmark/benchmark.h>
+#include "taggedjsonarray.h"
+#include "taggedjsonvector.h"
+
+namespace {
+    //Sensor-like series of doubles
+    QJsonValue makeSeries(const int sampleCount)
+    {
+        QJsonArray arr;
+        for (int i = 0; i < sampleCount; ++i)
+            arr.append(i * 0.5 - 100.0);
+        return arr;
+    }
+}
+
+// QJsonArray storage: every element access goes through a QJsonValue
+static void BM_SumTaggedArray(benchmark::State& state)
+{
+    const TaggedJSONDoubleArray series{makeSeries(static_cast<int>(state.range(0)))};
+    for (auto _ : state) {
+        double sum = 0;
+        const qsizetype size = series->size();
+        for (qsizetype i = 0; i < size; ++i)
+            sum += series.at(i);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SumTaggedArray)->RangeMultiplier(10)->Range(100000, 1000000)->Unit(benchmark::kMicrosecond);
+
+// QJsonArray storage converted with toStdVector() before the math, as the callers do today
+static void BM_SumTaggedArrayToStdVector(benchmark::State& state)
+{
+    const TaggedJSONDoubleArray series{makeSeries(static_cast<int>(state.range(0)))};
+    for (auto _ : state) {
+        const std::vector<double> values = series.toStdVector();
+        benchmark::DoNotOptimize(std::accumulate(values.cbegin(), values.cend(), 0.0));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SumTaggedArrayToStdVector)->RangeMultiplier(10)->Range(100000, 1000000)->Unit(benchmark::kMicrosecond);
+
+// Contiguous storage: plain loop over the raw pointer
+static void BM_SumTaggedVector(benchmark::State& state)
+{
+    const TaggedJSONDoubleVector series{makeSeries(static_cast<int>(state.range(0)))};
+    for (auto _ : state) {
+        const double* data = series.data();
+        benchmark::DoNotOptimize(std::accumulate(data, data + series.size(), 0.0));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SumTaggedVector)->RangeMultiplier(10)->Range(100000, 1000000)->Unit(benchmark::kMicrosecond);
+
+// Prefix sum written back into the array
+static void BM_ScanTaggedArray(benchmark::State& state)
+{
+    TaggedJSONDoubleArray series{makeSeries(static_cast<int>(state.range(0)))};
+    for (auto _ : state) {
+        double running = 0;
+        const qsizetype size = series->size();
+        for (qsizetype i = 0; i < size; ++i) {
+            running += series[i].toDouble();
+            series[i] = running;
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ScanTaggedArray)->RangeMultiplier(10)->Range(100000, 1000000)->Unit(benchmark::kMicrosecond);
+
+static void BM_ScanTaggedVector(benchmark::State& state)
+{
+    TaggedJSONDoubleVector series{makeSeries(static_cast<int>(state.range(0)))};
+    for (auto _ : state) {
+        double* data = series.data();
+        std::partial_sum(data, data + series.size(), data);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ScanTaggedVector)->RangeMultiplier(10)->Range(100000, 1000000)->Unit(benchmark::kMicrosecond);
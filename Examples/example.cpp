@@ -30,7 +30,7 @@ TJO_DEFINE_JSON_TAGGED_OBJECT(OuterClass,
 
 
 
-int main(int argc, char *argv[])
+int main()
 {
     QString jsonLocation("../../Examples/example.json");
 
@@ -0,0 +1,26 @@
+#include "taggedjsonobject.h"
+#include "taggedjsonobjectmacros.h"
+#include "taggedjsonlazyobjectmacros.h"
+
+// A class with one member more than map.h supports. It must not compile, the mapLimit tests build it with TJO_MAP_LIMIT_MACRO set to
+// each of the class macros and expect the static_assert of map.h in the output, see CMakeLists.txt
+
+//Members m_<prefix><digit>, 10 per prefix and 100 per LIMIT_HUNDRED
+#define LIMIT_TEN(prefix) (TaggedJSONInt, m_##prefix##0), (TaggedJSONInt, m_##prefix##1), (TaggedJSONInt, m_##prefix##2), (TaggedJSONInt, m_##prefix##3),\
+                          (TaggedJSONInt, m_##prefix##4), (TaggedJSONInt, m_##prefix##5), (TaggedJSONInt, m_##prefix##6), (TaggedJSONInt, m_##prefix##7),\
+                          (TaggedJSONInt, m_##prefix##8), (TaggedJSONInt, m_##prefix##9)
+#define LIMIT_HUNDRED(prefix) LIMIT_TEN(prefix##0), LIMIT_TEN(prefix##1), LIMIT_TEN(prefix##2), LIMIT_TEN(prefix##3), LIMIT_TEN(prefix##4),\
+                              LIMIT_TEN(prefix##5), LIMIT_TEN(prefix##6), LIMIT_TEN(prefix##7), LIMIT_TEN(prefix##8), LIMIT_TEN(prefix##9)
+
+static_assert(MAP_MAX_ARGUMENTS == 1024, "The member list below has MAP_MAX_ARGUMENTS + 1 members");
+
+TJO_MAP_LIMIT_MACRO(OverLimitClass,
+                    LIMIT_HUNDRED(a), LIMIT_HUNDRED(b), LIMIT_HUNDRED(c), LIMIT_HUNDRED(d), LIMIT_HUNDRED(e),
+                    LIMIT_HUNDRED(f), LIMIT_HUNDRED(g), LIMIT_HUNDRED(h), LIMIT_HUNDRED(i), LIMIT_HUNDRED(j),
+                    LIMIT_TEN(k0), LIMIT_TEN(k1), (TaggedJSONInt, m_k20), (TaggedJSONInt, m_k21), (TaggedJSONInt, m_k22),
+                    (TaggedJSONInt, m_k23), (TaggedJSONInt, m_k24))
+
+int main()
+{
+    return 0;
+}
@@ -144,3 +144,67 @@ TEST_F(TaggedArrayFixture, TaggedObjectArraytoQJsonObject)
     ASSERT_EQ(EXPECTED_TOTAL_AGE, totalAge);
 }
 
+
+//Direct-binding parser fills the arrays of JSON values and the arrays of TaggedObjects
+TEST_F(TaggedArrayFixture, TaggedArraysFromDirectParser)
+{
+    const TestClass directObj = TestClass::fromJson(jsonFromFile().toJson());
+
+    ASSERT_EQ(*testObj.example_arr, *directObj.example_arr);
+    ASSERT_EQ(*testObj.example_mixed_arr, *directObj.example_mixed_arr);
+    ASSERT_EQ(testObj.example_tagged_object_array.toJsonValue(), directObj.example_tagged_object_array.toJsonValue());
+}
+
+namespace {
+    //Enables the parallel array mode for the lifetime of the instance
+    struct ParallelArrayScope
+    {
+        explicit ParallelArrayScope(const qsizetype threshold) { TaggedObject::setParallelArrayThreshold(threshold); }
+        ~ParallelArrayScope() { TaggedObject::setParallelArrayThreshold(0); }
+    };
+
+    QJsonArray makeIdentities(const int count)
+    {
+        QJsonArray arr;
+        for (int i = 0; i < count; ++i)
+            arr.append(QJsonObject{{"name", QString("identity %1").arg(i)}, {"age", i}});
+        return arr;
+    }
+}
+
+//Parallel mode builds, converts and serializes large arrays the same way as the sequential mode
+TEST(TaggedArrayParallelTests, ParallelModeMatchesSequential)
+{
+    constexpr int ELEMENT_COUNT = 5000;
+    const QJsonArray source = makeIdentities(ELEMENT_COUNT);
+    const TaggedJSONArray<Identity> sequential{QJsonValue(source)};
+
+    const ParallelArrayScope parallel{1000};
+    const TaggedJSONArray<Identity> parallelArr{QJsonValue(source)};
+    ASSERT_EQ(ELEMENT_COUNT, static_cast<int>(parallelArr->size()));
+    ASSERT_EQ(ELEMENT_COUNT - 1, *parallelArr.at(ELEMENT_COUNT - 1).age);
+    ASSERT_EQ(QJsonValue(source), parallelArr.toJsonValue());
+
+    QByteArray expected;
+    TaggedObject::JsonWriter expectedWriter(expected);
+    TaggedObject::setParallelArrayThreshold(0);
+    sequential.writeJson(expectedWriter);
+    TaggedObject::setParallelArrayThreshold(1000);
+
+    QByteArray actual;
+    TaggedObject::JsonWriter actualWriter(actual);
+    parallelArr.writeJson(actualWriter);
+    ASSERT_EQ(expected, actual);
+}
+
+//Invalid elements throw in the parallel mode as well, the lowest failing index decides the exception (see ThreadPoolTests)
+TEST(TaggedArrayParallelTests, ParallelModeStrictTestFail)
+{
+    QJsonArray source = makeIdentities(5000);
+    source[1234] = QJsonObject{{"name", "missing age"}};
+    source[4321] = QJsonObject{{"age", 1}};
+
+    const ParallelArrayScope parallel{1000};
+    ASSERT_THROW(TaggedJSONArray<Identity>{QJsonValue(source)}, std::runtime_error);
+    ASSERT_NO_THROW((TaggedJSONArray<Identity>{QJsonValue(source), false}));
+}
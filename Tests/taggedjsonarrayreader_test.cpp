@@ -0,0 +1,121 @@
+#include <QBuffer>
+#include <QJsonDocument>
+#include "gtest/gtest.h"
+#include "taggedjsonobject.h"
+#include "taggedjsonarray.h"
+#include "taggedjsonarrayreader.h"
+#include "taggedjsonobjectmacros.h"
+
+namespace {
+    TJO_DEFINE_JSON_TAGGED_OBJECT(StreamedRecord,
+                                  (TaggedJSONInt, id),
+                                  (TaggedJSONString, name),
+                                  (TaggedJSONIntArray, codes))
+
+    // The names hold brackets, separators and escaped quotes, which must not end the elements
+    constexpr auto RECORDS = R"( [ {"id": 1, "name": "a]b", "codes": [1, [2]]},
+                                   {"id": 2, "name": "c\"}{,d", "codes": []} ,{"codes": [3], "name": "", "id": 3}
+                                 ] )";
+
+    // Reads every element with the given options, the blocks are small so the elements span several of them
+    std::vector<StreamedRecord> readAll(const QByteArray& json, TaggedObject::JsonArrayReaderOptions options = TaggedObject::JsonArrayReaderOptions())
+    {
+        QBuffer device;
+        device.setData(json);
+        device.open(QIODevice::ReadOnly);
+        options.blockSize = 5;
+        TaggedObject::JsonArrayReader<StreamedRecord> reader(device, options);
+        std::vector<StreamedRecord> ret;
+        for (const StreamedRecord& record : reader)
+            ret.push_back(record);
+        return ret;
+    }
+}
+
+// The elements are the same as the ones of the whole document, whatever the block boundaries are
+TEST(TaggedArrayReaderTests, MatchesDocument)
+{
+    const QByteArray json = RECORDS;
+    const TaggedJSONArray<StreamedRecord> expected(QJsonDocument::fromJson(json).array());
+
+    for (const qint64 blockSize : {1, 3, 16, 1 << 16}) {
+        QBuffer device;
+        device.setData(json);
+        device.open(QIODevice::ReadOnly);
+        TaggedObject::JsonArrayReaderOptions options;
+        options.blockSize = blockSize;
+        TaggedObject::JsonArrayReader<StreamedRecord> reader(device, options);
+
+        StreamedRecord record;
+        for (qsizetype i = 0; i < static_cast<qsizetype>(expected->size()); ++i) {
+            ASSERT_TRUE(reader.next(record));
+            ASSERT_EQ(expected.at(i).toJsonObject(), record.toJsonObject());
+        }
+        ASSERT_FALSE(reader.next(record));
+        ASSERT_TRUE(reader.atEnd());
+        ASSERT_FALSE(reader.hasError());
+        ASSERT_EQ(3, reader.elementCount());
+    }
+
+    ASSERT_TRUE(readAll(" [ ] ").empty());
+}
+
+// Invalid elements throw by default and are skipped and reported on request, the reading goes on after them
+TEST(TaggedArrayReaderTests, InvalidElements)
+{
+    const QByteArray json = R"([{"id": 1, "name": "a", "codes": []}, {"id": 2}, {"id": tru, "name": "", "codes": []}, 7,
+                                {"id": 5, "name": "e", "codes": [5]}])";
+    ASSERT_THROW(readAll(json), std::runtime_error);
+
+    TaggedObject::JsonArrayReaderOptions options;
+    options.skipInvalid = true;
+    std::vector<qint64> skipped;
+    options.errorHandler = [&skipped](const TaggedObject::JsonArrayElementError& error) { skipped.push_back(error.index); };
+    const std::vector<StreamedRecord> records = readAll(json, options);
+    ASSERT_EQ(2u, records.size());
+    ASSERT_EQ(5, *records[1].id);
+    ASSERT_EQ((std::vector<qint64>{1, 2, 3}), skipped);
+
+    // Without checkValues only the malformed element is invalid, the others get the default values
+    options.checkValues = false;
+    skipped.clear();
+    ASSERT_EQ(4u, readAll(json, options).size());
+    ASSERT_EQ((std::vector<qint64>{2}), skipped);
+
+    // The reader is positioned after the element that has thrown
+    QBuffer device;
+    device.setData(json);
+    device.open(QIODevice::ReadOnly);
+    TaggedObject::JsonArrayReader<StreamedRecord> reader(device);
+    StreamedRecord record;
+    ASSERT_TRUE(reader.next(record));
+    ASSERT_THROW(reader.next(record), std::runtime_error);
+    ASSERT_THROW(reader.next(record), std::runtime_error);
+    ASSERT_THROW(reader.next(record), std::runtime_error);
+    ASSERT_TRUE(reader.next(record));
+    ASSERT_EQ(QString("e"), *record.name);
+}
+
+// A broken array ends the reading
+TEST(TaggedArrayReaderTests, BrokenArray)
+{
+    TaggedObject::JsonArrayReaderOptions options;
+    options.skipInvalid = true;
+    for (const char* json : {R"({"id": 1})", R"([{"id": 1, "name": "a", "codes": []})", R"([{"id": 1, "name": "a", "codes": []} {"id": 2}])", "[,]", ""}) {
+        ASSERT_THROW(readAll(json), std::runtime_error);
+
+        QBuffer device;
+        device.setData(json);
+        device.open(QIODevice::ReadOnly);
+        TaggedObject::JsonArrayReader<StreamedRecord> reader(device, options);
+        StreamedRecord record;
+        while (reader.next(record)) {}
+        ASSERT_TRUE(reader.hasError());
+        ASSERT_FALSE(reader.errorString().isEmpty());
+    }
+
+    QBuffer closed;
+    TaggedObject::JsonArrayReader<StreamedRecord> reader(closed);
+    StreamedRecord record;
+    ASSERT_THROW(reader.next(record), std::runtime_error);
+}
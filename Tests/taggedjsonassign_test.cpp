@@ -0,0 +1,144 @@
+#include "gtest/gtest.h"
+#include "taggedjsonobject.h"
+#include "taggedjsonarray.h"
+#include "taggedjsonvector.h"
+#include "taggedjsonobjectmacros.h"
+
+namespace {
+    TJO_DEFINE_JSON_TAGGED_OBJECT(AssignedPosition,
+                                  (TaggedJSONDouble, x),
+                                  (TaggedJSONDouble, y))
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(AssignedShip,
+                                  (TaggedJSONInt, id),
+                                  (TaggedJSONString, label),
+                                  (AssignedPosition, position))
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(AssignedFleet,
+                                  (TaggedJSONString, name),
+                                  (TaggedJSONVector<double>, weights),
+                                  (TaggedJSONArray<AssignedShip>, ships))
+
+    constexpr auto LARGE_FLEET = R"({"name": "the first fleet", "weights": [1, 2, 3, 4, 5, 6, 7, 8],
+                                     "ships": [{"id": 1, "label": "a long ship label", "position": {"x": 1, "y": 2}},
+                                               {"id": 2, "label": "another long label", "position": {"x": 3, "y": 4}},
+                                               {"id": 3, "label": "the third label", "position": {"x": 5, "y": 6}}]})";
+
+    constexpr auto SMALL_FLEET = R"({"name": "second", "weights": [0.5, 1.5],
+                                     "ships": [{"id": 7, "label": "short", "position": {"x": -1, "y": -2}},
+                                               {"id": 8, "label": "tiny", "position": {"x": -3, "y": -4}}]})";
+}
+
+// assign() and parseInto() give the same object as the constructors
+TEST(AssignTests, SameAsConstruction)
+{
+    const QJsonObject large = QJsonDocument::fromJson(LARGE_FLEET).object();
+    const QJsonObject small = QJsonDocument::fromJson(SMALL_FLEET).object();
+
+    AssignedFleet fleet(large);
+    fleet.assign(small);
+    ASSERT_EQ(AssignedFleet(small).toJsonObject(), fleet.toJsonObject());
+    fleet.assign(QJsonValue(large));
+    ASSERT_EQ(large, fleet.toJsonObject());
+
+    fleet.parseInto(SMALL_FLEET);
+    ASSERT_EQ(small, fleet.toJsonObject());
+    ASSERT_EQ(7, *fleet.ships.at(0).id);
+    ASSERT_EQ(-4.0, *fleet.ships.at(1).position.y);
+}
+
+// The storage of the vectors, the elements of the tagged arrays and the decoded strings is reused
+TEST(AssignTests, ReusesStorage)
+{
+    AssignedFleet fleet = AssignedFleet::fromJson(LARGE_FLEET);
+    const double* weights = fleet.weights.data();
+    const std::size_t weightCapacity = fleet.weights->capacity();
+    const AssignedShip* firstShip = &fleet.ships.at(0);
+    const QChar* label = fleet.ships.at(0).label->constData();
+    const QChar* name = fleet.name->constData();
+
+    fleet.parseInto(SMALL_FLEET);
+    ASSERT_EQ(2, fleet.weights.size());
+    ASSERT_EQ(weights, fleet.weights.data());
+    ASSERT_EQ(weightCapacity, fleet.weights->capacity());
+    ASSERT_EQ(2u, fleet.ships->size());
+    ASSERT_EQ(firstShip, &fleet.ships.at(0));
+    ASSERT_EQ(label, fleet.ships.at(0).label->constData());
+    ASSERT_EQ(name, fleet.name->constData());
+    ASSERT_EQ(QString("short"), *fleet.ships.at(0).label);
+
+    fleet.assign(QJsonDocument::fromJson(LARGE_FLEET).object());
+    ASSERT_EQ(weights, fleet.weights.data());
+    ASSERT_EQ(firstShip, &fleet.ships.at(0));
+    ASSERT_EQ(3u, fleet.ships->size());
+}
+
+// checkValues throws on missing members, nested ones included, otherwise the missing members are reset to their default values
+TEST(AssignTests, CheckValues)
+{
+    AssignedFleet fleet = AssignedFleet::fromJson(LARGE_FLEET);
+    const QByteArray missing = R"({"name": "fleet", "weights": [], "ships": [{"id": 4, "position": {"x": 1}}]})";
+    ASSERT_THROW(fleet.parseInto(missing), std::runtime_error);
+    ASSERT_THROW(fleet.assign(QJsonDocument::fromJson(missing).object()), std::runtime_error);
+
+    fleet = AssignedFleet::fromJson(LARGE_FLEET);
+    fleet.parseInto(missing, false);
+    ASSERT_EQ(1u, fleet.ships->size());
+    ASSERT_EQ(4, *fleet.ships.at(0).id);
+    ASSERT_TRUE(fleet.ships.at(0).label->isEmpty());
+    ASSERT_EQ(1.0, *fleet.ships.at(0).position.x);
+    ASSERT_EQ(0.0, *fleet.ships.at(0).position.y);
+    ASSERT_EQ(AssignedFleet::fromJson(missing, false).toJsonObject(), fleet.toJsonObject());
+
+    fleet = AssignedFleet::fromJson(LARGE_FLEET);
+    fleet.assign(QJsonDocument::fromJson(missing).object(), false);
+    ASSERT_EQ(AssignedFleet(QJsonDocument::fromJson(missing).object(), false).toJsonObject(), fleet.toJsonObject());
+}
+
+// Malformed text throws with checkValues, otherwise the object is reset the same way fromJson() returns a default object
+TEST(AssignTests, MalformedText)
+{
+    AssignedFleet fleet = AssignedFleet::fromJson(LARGE_FLEET);
+    ASSERT_THROW(fleet.parseInto(R"({"name": "fleet", "ships": [)"), std::runtime_error);
+
+    fleet.parseInto(R"({"name": "fleet", "ships": [)", false);
+    ASSERT_EQ(AssignedFleet().toJsonObject(), fleet.toJsonObject());
+}
+
+#ifdef TJO_ENABLE_MODIFICATION_TRACKING
+// The assigned members count as modified, the merge patches pick up the new values
+TEST(AssignTests, ModificationTracking)
+{
+    AssignedShip ship = AssignedShip::fromJson(R"({"id": 1, "label": "a", "position": {"x": 1, "y": 2}})");
+    ship.clearModified();
+    ASSERT_FALSE(ship.isModified());
+
+    const QByteArray json = R"({"id": 2, "label": "b", "position": {"x": 3, "y": 4}})";
+    ship.parseInto(json);
+    ASSERT_TRUE(ship.isModified());
+    ASSERT_EQ(QJsonDocument::fromJson(json).object(), ship.toJsonObject());
+
+    ship.assign(QJsonObject{{"id", 5}, {"label", "c"}, {"position", QJsonObject{{"x", 0}, {"y", 0}}}});
+    ASSERT_TRUE(ship.isModified());
+    ASSERT_EQ(5, ship.toMergePatch().value(QStringLiteral("id")).toInt());
+}
+#endif
+
+// readJson() keeps the members that aren't in the text, replaceJson() resets them
+TEST(AssignTests, ReadAndReplace)
+{
+    AssignedShip ship = AssignedShip::fromJson(R"({"id": 1, "label": "a", "position": {"x": 1, "y": 2}})");
+    const QByteArray partial = R"({"id": 2, "position": {"x": 3}})";
+
+    TaggedObject::JsonReader reader(partial);
+    ship.readJson(reader, false);
+    ASSERT_EQ(QString("a"), *ship.label);
+    ASSERT_EQ(2.0, *ship.position.y);
+
+    TaggedObject::JsonReader replaceReader(partial);
+    ship.replaceJson(replaceReader, false);
+    ASSERT_EQ(2, *ship.id);
+    ASSERT_TRUE(ship.label->isEmpty());
+    ASSERT_EQ(3.0, *ship.position.x);
+    ASSERT_EQ(0.0, *ship.position.y);
+}
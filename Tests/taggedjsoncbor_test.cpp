@@ -0,0 +1,137 @@
+#include "gtest/gtest.h"
+#include "taggedjsoncbor.h"
+#include "taggedjsonobject.h"
+#include "taggedjsonarray.h"
+#include "taggedjsonvector.h"
+#include "taggedjsonobjectmacros.h"
+#include "taggedjsonlazyobjectmacros.h"
+
+namespace {
+    constexpr auto EXAMPLE_FILE_PATH = "../Tests/test_file.json";
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(CborPerson,
+                                  (TaggedJSONString, name),
+                                  (TaggedJSONInt, age))
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(CborSubClass,
+                                  (TaggedJSONString, example_sub_str))
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(CborFixture,
+                                  (TaggedJSONInt, example_int),
+                                  (TaggedJSONString, example_str),
+                                  (TaggedJSONDouble, example_double),
+                                  (CborSubClass, example_sub_class),
+                                  (TaggedJSONValue, example_json_value1),
+                                  (TaggedJSONValue, example_json_value2),
+                                  (TaggedQJsonObject, example_json_object),
+                                  (TaggedJSONStringArray, example_arr),
+                                  (TaggedJSONVariantArray, example_mixed_arr),
+                                  (TaggedJSONArray<CborPerson>, example_tagged_object_array))
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(CborMissingValued,
+                                  (TaggedJSONInt, example_int),
+                                  (TaggedJSONInt, missing_member))
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(CborSeries,
+                                  (TaggedJSONDoubleVector, samples),
+                                  (TaggedJSONIntVector, counts),
+                                  (TaggedJSONBoolVector, flags))
+
+    TJO_DEFINE_LAZY_JSON_TAGGED_OBJECT(CborLazyFixture,
+                                       (TaggedJSONInt, example_int),
+                                       (CborSubClass, example_sub_class))
+
+    QByteArray jsonFromFile()
+    {
+        QFile f{ EXAMPLE_FILE_PATH };
+        f.open(QIODevice::ReadOnly);
+        return f.readAll();
+    }
+
+    //Encoding of the reference implementation
+    QByteArray viaCborValue(const QByteArray& json)
+    {
+        return QCborValue::fromJsonValue(QJsonDocument::fromJson(json).object()).toCbor();
+    }
+}
+
+// Decoding the output of toCbor() gives back the same members
+TEST(CborTests, RoundTrip)
+{
+    const CborFixture expected = CborFixture::fromJson(jsonFromFile());
+    const CborFixture decoded = CborFixture::fromCbor(expected.toCbor());
+
+    ASSERT_EQ(expected.toJson(), decoded.toJson());
+    ASSERT_EQ(3, decoded.example_tagged_object_array->size());
+    ASSERT_EQ(46, *decoded.example_tagged_object_array.at(1).age);
+}
+
+// Data encoded by QCborValue is decoded the same way as the JSON text
+TEST(CborTests, DecodesQCborValueOutput)
+{
+    const QByteArray json = jsonFromFile();
+    const CborFixture fromCbor = CborFixture::fromCbor(viaCborValue(json));
+
+    ASSERT_EQ(CborFixture::fromJson(json).toJson(), fromCbor.toJson());
+}
+
+// Data encoded by toCbor() can be decoded by QCborValue
+TEST(CborTests, EncodesForQCborValue)
+{
+    const CborFixture record = CborFixture::fromJson(jsonFromFile());
+    const QJsonObject decoded = QCborValue::fromCbor(record.toCbor()).toJsonValue().toObject();
+
+    ASSERT_EQ(record.toJsonObject(), decoded);
+}
+
+// Mismatching types end up with the same defaults as the JSON conversions
+TEST(CborTests, MismatchingTypes)
+{
+    const QByteArray json = R"({"name": 12, "age": 4.5})";
+    const CborPerson fromCbor = CborPerson::fromCbor(viaCborValue(json));
+    const CborPerson fromJson = CborPerson::fromJson(json);
+
+    ASSERT_EQ(*fromJson.name, *fromCbor.name);
+    ASSERT_EQ(*fromJson.age, *fromCbor.age);
+}
+
+// Missing members throw only if checkValues is set
+TEST(CborTests, MissingMembers)
+{
+    const QByteArray cbor = viaCborValue(jsonFromFile());
+
+    ASSERT_THROW(CborMissingValued::fromCbor(cbor, true), std::runtime_error);
+    ASSERT_NO_THROW(CborMissingValued::fromCbor(cbor, false));
+    ASSERT_EQ(42, *CborMissingValued::fromCbor(cbor, false).example_int);
+}
+
+// Truncated data throws if checkValues is set, otherwise a default object is returned
+TEST(CborTests, TruncatedData)
+{
+    QByteArray cbor = CborFixture::fromJson(jsonFromFile()).toCbor();
+    cbor.chop(5);
+
+    ASSERT_THROW(CborFixture::fromCbor(cbor, true), std::runtime_error);
+    ASSERT_EQ(0, *CborFixture::fromCbor(cbor, false).example_int);
+}
+
+// Contiguous arrays are written element by element and read back without a QJsonArray
+TEST(CborTests, Vectors)
+{
+    const CborSeries series = CborSeries::fromJson(R"({"samples": [1.5, -2, 1e21], "counts": [1, 2, 3], "flags": [true, false]})");
+    const CborSeries decoded = CborSeries::fromCbor(series.toCbor());
+
+    ASSERT_EQ(*series.samples, *decoded.samples);
+    ASSERT_EQ(*series.counts, *decoded.counts);
+    ASSERT_EQ(*series.flags, *decoded.flags);
+}
+
+// Lazy objects read and write CBOR as well
+TEST(CborTests, LazyObject)
+{
+    const CborLazyFixture lazy = CborLazyFixture::fromCbor(viaCborValue(jsonFromFile()));
+
+    ASSERT_EQ(42, *lazy.example_int());
+    ASSERT_EQ("Hello from an object!", *lazy.example_sub_class().example_sub_str);
+    ASSERT_EQ(lazy.toJsonObject(), QCborValue::fromCbor(lazy.toCbor()).toJsonValue().toObject());
+}
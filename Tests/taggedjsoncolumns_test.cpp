@@ -0,0 +1,95 @@
+#include <numeric>
+#include "gtest/gtest.h"
+#include <QJsonDocument>
+#include "taggedjsonobject.h"
+#include "taggedjsoncolumns.h"
+#include "taggedjsonarray.h"
+#include "taggedjsonobjectmacros.h"
+
+namespace {
+    TJO_DEFINE_JSON_TAGGED_OBJECT(ColumnPoint,
+                                  (TaggedJSONDouble, x),
+                                  (TaggedJSONDouble, y))
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(ColumnTrade,
+                                  (TaggedJSONInt, id),
+                                  (TaggedJSONString, symbol),
+                                  (TaggedJSONDouble, price),
+                                  (TaggedJSONBool, settled),
+                                  (ColumnPoint, position))
+
+    constexpr auto TRADES = R"([{"id": 1, "symbol": "abc", "price": 1.5, "settled": true, "position": {"x": 1, "y": 2}, "note": "skipped"},
+                                {"id": 2, "symbol": "def", "price": 2.5, "settled": false, "position": {"x": 3, "y": 4}},
+                                {"id": 3, "symbol": "ghi", "price": -1, "settled": true, "position": {"x": 5, "y": 6}}])";
+
+    using TradeColumns = TaggedJSONColumns<&ColumnTrade::price, &ColumnTrade::symbol, &ColumnTrade::settled, &ColumnTrade::position>;
+}
+
+// Each member is stored in its own contiguous column of the stored value type
+TEST(TaggedColumnsTests, ParseTimeProjection)
+{
+    static_assert(std::is_same_v<TradeColumns::ValueType<&ColumnTrade::price>, double>);
+    static_assert(std::is_same_v<TradeColumns::ValueType<&ColumnTrade::position>, ColumnPoint>);
+    static_assert(TradeColumns::columnNames[1] == "symbol");
+
+    const TradeColumns columns = TradeColumns::fromJson(TRADES);
+    ASSERT_EQ(3, columns.size());
+    const std::vector<double>& prices = columns.column<&ColumnTrade::price>();
+    ASSERT_EQ(3.0, std::accumulate(prices.data(), prices.data() + prices.size(), 0.0));
+    ASSERT_EQ((std::vector<QString>{"abc", "def", "ghi"}), columns.column<&ColumnTrade::symbol>());
+    ASSERT_EQ((std::vector<bool>{true, false, true}), columns.column<&ColumnTrade::settled>());
+    ASSERT_EQ(4.0, *columns.column<&ColumnTrade::position>()[1].y);
+}
+
+// The on-demand projection of the parsed objects and the QJsonValue constructor give the same columns as the parse-time projection
+TEST(TaggedColumnsTests, ProjectionsMatch)
+{
+    const QByteArray json = TRADES;
+    const TradeColumns parsed = TradeColumns::fromJson(json);
+    const TaggedJSONArray<ColumnTrade> trades(QJsonDocument::fromJson(json).array());
+    const TradeColumns projected(trades);
+    const TradeColumns fromValue(QJsonValue(QJsonDocument::fromJson(json).array()));
+
+    for (const TradeColumns* columns : {&projected, &fromValue}) {
+        ASSERT_EQ(parsed.column<&ColumnTrade::price>(), columns->column<&ColumnTrade::price>());
+        ASSERT_EQ(parsed.column<&ColumnTrade::symbol>(), columns->column<&ColumnTrade::symbol>());
+        ASSERT_EQ(parsed.column<&ColumnTrade::settled>(), columns->column<&ColumnTrade::settled>());
+        ASSERT_EQ(parsed.column<&ColumnTrade::position>()[2].toJsonObject(), columns->column<&ColumnTrade::position>()[2].toJsonObject());
+    }
+}
+
+// A repeated key keeps the columns aligned, missing members throw or get the default value
+TEST(TaggedColumnsTests, MissingAndRepeatedMembers)
+{
+    using PriceColumns = TaggedJSONColumns<&ColumnTrade::price, &ColumnTrade::id>;
+    const QByteArray json = R"([{"price": 1, "id": 1, "price": 2}, {"id": 2}])";
+
+    ASSERT_THROW(PriceColumns::fromJson(json), std::runtime_error);
+    const PriceColumns columns = PriceColumns::fromJson(json, false);
+    ASSERT_EQ((std::vector<double>{2, 0}), columns.column<&ColumnTrade::price>());
+    ASSERT_EQ((std::vector<int>{1, 2}), columns.column<&ColumnTrade::id>());
+
+    ASSERT_THROW(PriceColumns::fromJson("[{\"price\": 1, \"id\": 1}"), std::runtime_error);
+    ASSERT_TRUE(PriceColumns::fromJson("[{\"price\": 1, \"id\": 1}", false).empty());
+}
+
+// readJson() projects an array inside a larger document and reuses the columns
+TEST(TaggedColumnsTests, ReadNestedArray)
+{
+    const QByteArray json = QByteArray(R"({"source": "feed", "trades": )") + TRADES + "}";
+    TaggedJSONColumns<&ColumnTrade::id> ids;
+    ids.append(ColumnTrade::fromJson(R"({"id": 9, "symbol": "", "price": 0, "settled": false, "position": {"x": 0, "y": 0}})"));
+    ASSERT_EQ(1, ids.size());
+
+    TaggedObject::JsonReader reader(json);
+    ASSERT_TRUE(reader.beginObject());
+    std::string_view key;
+    while (reader.nextKey(key)) {
+        if (key == "trades")
+            ids.readJson(reader);
+        else
+            reader.skipValue();
+    }
+    ASSERT_TRUE(reader.finish());
+    ASSERT_EQ((std::vector<int>{1, 2, 3}), ids.column<&ColumnTrade::id>());
+}
@@ -0,0 +1,33 @@
+#include "gtest/gtest.h"
+#include "taggedjsonfieldindex.h"
+
+namespace {
+    constexpr auto WIDE_INDEX = TaggedObject::makeFieldIndex("field_0", "field_1", "field_2", "field_3", "field_4", "field_5", "field_6", "field_7", "field_8", "field_9",
+                                                   "field_10", "field_11", "field_12", "field_13", "field_14", "field_15", "field_16", "field_17", "field_18", "field_19",
+                                                   "field_20", "field_21", "field_22", "field_23", "field_24", "field_25", "field_26", "field_27", "field_28", "field_29",
+                                                   "field_30", "field_31", "field_32", "field_33", "field_34", "field_35", "field_36", "field_37", "field_38", "field_39",
+                                                   "field_40", "field_41", "field_42", "field_43", "field_44", "field_45", "field_46", "field_47", "field_48", "field_49",
+                                                   "field_50", "field_51", "field_52", "field_53", "field_54", "field_55", "field_56", "field_57", "field_58", "field_59",
+                                                   "field_60", "field_61", "field_62", "field_63", "field_64", "field_65", "field_66", "field_67", "field_68", "field_69",
+                                                   "field_70", "field_71", "field_72", "field_73", "field_74", "field_75", "field_76", "field_77", "field_78", "field_79",
+                                                   "field_80", "field_81", "field_82", "field_83", "field_84", "field_85", "field_86", "field_87", "field_88", "field_89",
+                                                   "field_90", "field_91", "field_92", "field_93", "field_94", "field_95", "field_96", "field_97", "field_98", "field_99");
+}
+
+// Every member name is routed to its own declaration index
+TEST(FieldIndexTests, AllNamesAreFound)
+{
+    for (std::size_t i = 0; i < WIDE_INDEX.size(); ++i) {
+        const std::string name = "field_" + std::to_string(i);
+        ASSERT_EQ(static_cast<int>(i), WIDE_INDEX.indexOf(std::string_view(name)));
+        ASSERT_EQ(static_cast<int>(i), WIDE_INDEX.indexOf(QString::fromStdString(name)));
+    }
+}
+
+// Keys that don't belong to any of the members aren't matched
+TEST(FieldIndexTests, UnknownNamesAreRejected)
+{
+    ASSERT_EQ(-1, WIDE_INDEX.indexOf(std::string_view("field_100")));
+    ASSERT_EQ(-1, WIDE_INDEX.indexOf(std::string_view("")));
+    ASSERT_EQ(-1, WIDE_INDEX.indexOf(QString("field_")));
+}
@@ -0,0 +1,123 @@
+#include <vector>
+#include "gtest/gtest.h"
+#include "taggedjsonobject.h"
+#include "taggedjsonarray.h"
+#include "taggedjsonvector.h"
+#include "taggedjsonobjectmacros.h"
+
+namespace {
+    TJO_DEFINE_JSON_TAGGED_OBJECT(FieldPosition,
+                                  (TaggedJSONDouble, x),
+                                  (TaggedJSONDouble, y))
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(FieldShip,
+                                  (TaggedJSONInt, id),
+                                  (TaggedJSONString, label),
+                                  (TaggedJSONBool, active),
+                                  (FieldPosition, position),
+                                  (TaggedJSONIntArray, codes),
+                                  (TaggedJSONVector<double>, weights),
+                                  (TaggedJSONArray<FieldPosition>, route))
+
+    constexpr auto SHIP = R"({"id": 3, "label": "ship", "active": true, "position": {"x": 1, "y": 2}, "codes": [4, 5],
+                              "weights": [0.5], "route": [{"x": 1, "y": 1}, {"x": 2, "y": 3}]})";
+}
+
+// The descriptors are usable at compile time and follow the declaration order
+TEST(FieldTests, Descriptors)
+{
+    constexpr auto descriptors = FieldShip::fieldDescriptors();
+    static_assert(std::tuple_size_v<decltype(descriptors)> == 7);
+    static_assert(TaggedObject::fieldAt<0>(descriptors).name == "id");
+    static_assert(TaggedObject::fieldAt<0>(descriptors).kind == TaggedObject::FieldKind::Integer);
+    static_assert(TaggedObject::fieldAt<1>(descriptors).kind == TaggedObject::FieldKind::String);
+    static_assert(TaggedObject::fieldAt<2>(descriptors).kind == TaggedObject::FieldKind::Bool);
+    static_assert(TaggedObject::fieldAt<3>(descriptors).kind == TaggedObject::FieldKind::Object);
+    static_assert(TaggedObject::fieldAt<4>(descriptors).kind == TaggedObject::FieldKind::Array);
+    static_assert(TaggedObject::fieldAt<5>(descriptors).kind == TaggedObject::FieldKind::Array);
+    static_assert(TaggedObject::fieldAt<6>(descriptors).kind == TaggedObject::FieldKind::Array);
+    static_assert(std::is_same_v<std::tuple_element_t<3, std::remove_const_t<decltype(descriptors)>>::Type, FieldPosition>);
+
+    FieldShip ship = FieldShip::fromJson(SHIP);
+    ASSERT_EQ(3, *(ship.*(TaggedObject::fieldAt<0>(descriptors).member)));
+}
+
+// forEachField visits every member in declaration order, mutably if the object isn't const
+TEST(FieldTests, ForEachField)
+{
+    FieldShip ship = FieldShip::fromJson(SHIP);
+    std::vector<std::string_view> names;
+    QJsonObject rebuilt;
+    TaggedObject::forEachField(static_cast<const FieldShip&>(ship), [&](const std::string_view name, const auto& member) {
+        names.push_back(name);
+        rebuilt.insert(QString::fromLatin1(name.data(), static_cast<qsizetype>(name.size())), member.toJsonValue());
+    });
+    ASSERT_EQ((std::vector<std::string_view>{"id", "label", "active", "position", "codes", "weights", "route"}), names);
+    ASSERT_EQ(ship.toJsonObject(), rebuilt);
+
+    TaggedObject::forEachField(ship, [](const std::string_view name, auto& member) {
+        if constexpr (std::is_same_v<std::decay_t<decltype(member)>, TaggedJSONString>)
+            member = QString::fromLatin1(name.data(), static_cast<qsizetype>(name.size()));
+    });
+    ASSERT_EQ(QString("label"), *ship.label);
+}
+
+// The table-driven binder and serializer give the same results as the generated members
+TEST(FieldTests, TableDrivenBinding)
+{
+    const QJsonObject obj = QJsonDocument::fromJson(SHIP).object();
+    const FieldShip expected(obj);
+
+    FieldShip bound;
+    TaggedObject::bindFields(bound, obj);
+    ASSERT_EQ(expected.toJsonObject(), TaggedObject::fieldsToJsonObject(bound));
+    ASSERT_EQ(expected.toJsonObject(), bound.toJsonObject());
+
+    const QByteArray json(SHIP);
+    TaggedObject::JsonReader reader(json);
+    FieldShip read;
+    TaggedObject::readFields(read, reader);
+    ASSERT_EQ(expected.toJsonObject(), read.toJsonObject());
+
+    QByteArray written;
+    TaggedObject::JsonWriter writer(written, QJsonDocument::Compact);
+    TaggedObject::writeFields(read, writer);
+    ASSERT_EQ(expected.toJson(QJsonDocument::Compact), written);
+}
+
+#ifdef TJO_ENABLE_MODIFICATION_TRACKING
+// The members are bound in place, the ones of a newly constructed object don't count as modified and the ones of a bound object do
+TEST(FieldTests, TableDrivenBindingModificationFlags)
+{
+    const QJsonObject obj = QJsonDocument::fromJson(SHIP).object();
+    const FieldShip constructed(obj);
+    ASSERT_FALSE(constructed.label.isModified());
+    ASSERT_FALSE(constructed.position.x.isModified());
+    ASSERT_FALSE(constructed.route.isModified());
+
+    FieldShip bound;
+    TaggedObject::bindFields(bound, obj);
+    ASSERT_TRUE(bound.label.isModified());
+    ASSERT_TRUE(bound.position.x.isModified());
+    ASSERT_TRUE(bound.route.isModified());
+    ASSERT_EQ(constructed.toJsonObject(), bound.toJsonObject());
+}
+#endif
+
+// checkValues behaves the same way as in the generated members
+TEST(FieldTests, TableDrivenCheckValues)
+{
+    const QJsonObject obj{{"id", 1}, {"label", "a"}};
+    FieldShip ship;
+    ASSERT_THROW(TaggedObject::bindFields(ship, obj), std::runtime_error);
+    TaggedObject::bindFields(ship, obj, false);
+    ASSERT_EQ(FieldShip(obj, false).toJsonObject(), ship.toJsonObject());
+
+    const QByteArray missing = R"({"id": 1, "label": "a"})";
+    TaggedObject::JsonReader reader(missing);
+    ASSERT_THROW(TaggedObject::readFields(ship, reader), std::runtime_error);
+
+    const QByteArray malformed = R"({"id": 1, "label": )";
+    TaggedObject::JsonReader malformedReader(malformed);
+    ASSERT_THROW(TaggedObject::readFields(ship, malformedReader), std::runtime_error);
+}
@@ -0,0 +1,96 @@
+#include "gtest/gtest.h"
+#include "taggedjsonfile.h"
+#include "taggedjsonobject.h"
+#include "taggedjsonarray.h"
+#include "taggedjsonstringview.h"
+#include "taggedjsonobjectmacros.h"
+
+namespace {
+    constexpr auto EXAMPLE_FILE_PATH = "../Tests/test_file.json";
+    constexpr auto MISSING_FILE_PATH = "../Tests/missing_file.json";
+    constexpr int EXPECTED_INT_RESULT = 42;
+    constexpr auto EXPECTED_SUBSTRING_RESULT = "Hello from an object!";
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(FileInnerClass,
+                                  (TaggedJSONString, example_sub_str))
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(FileOuterClass,
+                                  (TaggedJSONInt, example_int),
+                                  (FileInnerClass, example_sub_class),
+                                  (TaggedJSONStringArray, example_arr))
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(FileViewInnerClass,
+                                  (TaggedJSONStringView, example_sub_str))
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(FileViewClass,
+                                  (TaggedJSONStringView, example_str),
+                                  (FileViewInnerClass, example_sub_class))
+}
+
+// Regular files are served from a memory mapping
+TEST(JsonFileTests, RegularFileIsMapped)
+{
+    const TaggedObject::JsonFileData file(EXAMPLE_FILE_PATH);
+    QFile f{ EXAMPLE_FILE_PATH };
+    f.open(QIODevice::ReadOnly);
+
+    ASSERT_TRUE(file.isValid());
+    ASSERT_TRUE(file.isMapped());
+    ASSERT_EQ(f.readAll(), file.bytes());
+}
+
+// Open failures are reported instead of being ignored
+TEST(JsonFileTests, MissingFileIsReported)
+{
+    const TaggedObject::JsonFileData file(MISSING_FILE_PATH);
+
+    ASSERT_FALSE(file.isValid());
+    ASSERT_FALSE(file.errorString().isEmpty());
+}
+
+// fromFile() parses straight from the mapping
+TEST(JsonFileTests, ConstructFromMappedFile)
+{
+    const FileOuterClass obj = FileOuterClass::fromFile(EXAMPLE_FILE_PATH);
+
+    ASSERT_EQ(EXPECTED_INT_RESULT, *obj.example_int);
+    ASSERT_EQ(EXPECTED_SUBSTRING_RESULT, *obj.example_sub_class.example_sub_str);
+    ASSERT_EQ(2, obj.example_arr->size());
+}
+
+// String views refer to the mapped file instead of copying their strings, the mapping outlives fromFile()
+TEST(JsonFileTests, StringViewsReferToMappedFile)
+{
+    QFile f{ EXAMPLE_FILE_PATH };
+    f.open(QIODevice::ReadOnly);
+    const QByteArray text = f.readAll();
+    const FileViewClass obj = FileViewClass::fromFile(EXAMPLE_FILE_PATH);
+
+    ASSERT_TRUE(obj.example_str.isView());
+    ASSERT_TRUE(obj.example_sub_class.example_sub_str.isView());
+    ASSERT_EQ(QString("Hello world!"), obj.example_str.toString());
+    ASSERT_EQ(QString(EXPECTED_SUBSTRING_RESULT), obj.example_sub_class.example_sub_str.toString());
+
+    //Copies would be separate allocations, the views are as far apart as the strings in the file
+    const std::string_view first = obj.example_str.rawUtf8();
+    const std::string_view second = obj.example_sub_class.example_sub_str.rawUtf8();
+    ASSERT_EQ(text.indexOf(EXPECTED_SUBSTRING_RESULT) - text.indexOf("Hello world!"), second.data() - first.data());
+}
+
+// A missing file throws if the values are checked, both for fromFile() and for the file path constructor
+TEST(JsonFileTests, MissingFileStrictTestFail)
+{
+    const QString missingPath(MISSING_FILE_PATH);
+
+    ASSERT_THROW(FileOuterClass::fromFile(missingPath), std::runtime_error);
+    ASSERT_THROW(FileOuterClass(missingPath, true), std::runtime_error);
+}
+
+// A missing file leaves the members default initialized if the values aren't checked
+TEST(JsonFileTests, MissingFileNonStrictTestPass)
+{
+    const QString missingPath(MISSING_FILE_PATH);
+
+    ASSERT_NO_THROW(FileOuterClass::fromFile(missingPath, false));
+    ASSERT_NO_THROW(FileOuterClass(missingPath, false));
+}
@@ -0,0 +1,179 @@
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+#include "taggedjsonfilecache.h"
+#include "taggedjsonobject.h"
+#include "taggedjsonarray.h"
+#include "taggedjsonobjectmacros.h"
+
+namespace {
+    constexpr auto EXAMPLE_FILE_PATH = "../Tests/test_file.json";
+    constexpr auto MISSING_FILE_PATH = "../Tests/missing_file.json";
+    constexpr int EXPECTED_INT_RESULT = 42;
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(CachedInnerClass,
+                                  (TaggedJSONString, example_sub_str))
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(CachedOuterClass,
+                                  (TaggedJSONInt, example_int),
+                                  (CachedInnerClass, example_sub_class),
+                                  (TaggedJSONStringArray, example_arr))
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(CachedIntClass,
+                                  (TaggedJSONInt, example_int))
+
+    // Writes a file into the temporary directory and returns its path
+    QString writeTempFile(const char* name, const char* content)
+    {
+        const std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+        std::ofstream(path) << content;
+        return QString::fromStdString(path.string());
+    }
+}
+
+// The repeated loads share the object, a changed or invalidated file is parsed again
+TEST(JsonFileCacheTests, SharedUntilChanged)
+{
+    TaggedObject::JsonFileCache cache;
+    const std::shared_ptr<const CachedOuterClass> first = cache.load<CachedOuterClass>(EXAMPLE_FILE_PATH);
+    ASSERT_EQ(EXPECTED_INT_RESULT, *first->example_int);
+    ASSERT_EQ(first, cache.load<CachedOuterClass>(EXAMPLE_FILE_PATH));
+    ASSERT_EQ(first, cache.load<CachedOuterClass>(QFileInfo(EXAMPLE_FILE_PATH).canonicalFilePath()));
+    ASSERT_EQ(2, cache.hitCount());
+    ASSERT_EQ(1, cache.missCount());
+
+    // Each type has its own object
+    ASSERT_EQ(EXPECTED_INT_RESULT, *cache.load<CachedIntClass>(EXAMPLE_FILE_PATH)->example_int);
+    ASSERT_EQ(2, cache.size());
+    ASSERT_EQ(2 * QFileInfo(EXAMPLE_FILE_PATH).size(), cache.usedBytes());
+
+    const QString path = writeTempFile("tjo_cache_changed.json", R"({"example_int": 1})");
+    const std::shared_ptr<const CachedIntClass> original = cache.load<CachedIntClass>(path);
+    writeTempFile("tjo_cache_changed.json", R"({"example_int": 22})");
+    const std::shared_ptr<const CachedIntClass> changed = cache.load<CachedIntClass>(path);
+    ASSERT_NE(original, changed);
+    ASSERT_EQ(1, *original->example_int);
+    ASSERT_EQ(22, *changed->example_int);
+
+    cache.invalidate(path);
+    ASSERT_NE(changed, cache.load<CachedIntClass>(path));
+
+    cache.clear();
+    ASSERT_EQ(0, cache.size());
+    ASSERT_EQ(0, cache.usedBytes());
+    ASSERT_NE(first, cache.load<CachedOuterClass>(EXAMPLE_FILE_PATH));
+}
+
+// The paths of the same file share the object, a path is resolved again once its object is out of date
+TEST(JsonFileCacheTests, SymbolicLinks)
+{
+    const QString a = writeTempFile("tjo_cache_link_a.json", R"({"example_int": 1})");
+    const QString b = writeTempFile("tjo_cache_link_b.json", R"({"example_int": 22})");
+    const std::filesystem::path link = std::filesystem::temp_directory_path() / "tjo_cache_link.json";
+    std::filesystem::remove(link);
+    std::filesystem::create_symlink(a.toStdString(), link);
+    const QString linkPath = QString::fromStdString(link.string());
+
+    TaggedObject::JsonFileCache cache;
+    const std::shared_ptr<const CachedIntClass> object = cache.load<CachedIntClass>(a);
+    ASSERT_EQ(object, cache.load<CachedIntClass>(linkPath));
+    ASSERT_EQ(object, cache.load<CachedIntClass>(linkPath));
+    ASSERT_EQ(2, cache.hitCount());
+    ASSERT_EQ(1, cache.size());
+
+    // The link points to a file of another size now
+    std::filesystem::remove(link);
+    std::filesystem::create_symlink(b.toStdString(), link);
+    ASSERT_EQ(22, *cache.load<CachedIntClass>(linkPath)->example_int);
+    ASSERT_EQ(object, cache.load<CachedIntClass>(a));
+    ASSERT_EQ(2, cache.size());
+}
+
+// The least recently used objects are dropped above the memory bound
+TEST(JsonFileCacheTests, MemoryBound)
+{
+    const QString a = writeTempFile("tjo_cache_a.json", R"({"example_int": 1})");
+    const QString b = writeTempFile("tjo_cache_b.json", R"({"example_int": 2})");
+    const QString c = writeTempFile("tjo_cache_c.json", R"({"example_int": 3})");
+    const qint64 fileSize = QFileInfo(a).size();
+
+    TaggedObject::JsonFileCache cache(2 * fileSize);
+    const std::shared_ptr<const CachedIntClass> objectA = cache.load<CachedIntClass>(a);
+    const std::shared_ptr<const CachedIntClass> objectB = cache.load<CachedIntClass>(b);
+    ASSERT_EQ(objectA, cache.load<CachedIntClass>(a));
+    cache.load<CachedIntClass>(c);
+    ASSERT_EQ(2, cache.size());
+    ASSERT_EQ(objectA, cache.load<CachedIntClass>(a));
+    ASSERT_NE(objectB, cache.load<CachedIntClass>(b));
+    // The dropped object stays valid for its holders
+    ASSERT_EQ(2, *objectB->example_int);
+
+    cache.setMaxBytes(fileSize - 1);
+    ASSERT_EQ(0, cache.size());
+    ASSERT_EQ(3, *cache.load<CachedIntClass>(c)->example_int);
+    ASSERT_EQ(0, cache.size());
+}
+
+// Failing files aren't cached, an object parsed without checkValues isn't returned for a load with checkValues
+TEST(JsonFileCacheTests, CheckValues)
+{
+    TaggedObject::JsonFileCache cache;
+    ASSERT_THROW(cache.load<CachedOuterClass>(MISSING_FILE_PATH), std::runtime_error);
+    ASSERT_EQ(0, *cache.load<CachedOuterClass>(MISSING_FILE_PATH, false)->example_int);
+    ASSERT_EQ(0, cache.size());
+
+    const QString partial = writeTempFile("tjo_cache_partial.json", R"({"example_int": 7})");
+    const std::shared_ptr<const CachedOuterClass> unchecked = cache.load<CachedOuterClass>(partial, false);
+    ASSERT_EQ(7, *unchecked->example_int);
+    ASSERT_EQ(unchecked, cache.load<CachedOuterClass>(partial, false));
+    ASSERT_THROW(cache.load<CachedOuterClass>(partial), std::runtime_error);
+
+    const std::shared_ptr<const CachedOuterClass> checked = cache.load<CachedOuterClass>(EXAMPLE_FILE_PATH);
+    ASSERT_EQ(checked, cache.load<CachedOuterClass>(EXAMPLE_FILE_PATH, false));
+}
+
+// Malformed files aren't cached without checkValues either, every load parses them again
+TEST(JsonFileCacheTests, MalformedFile)
+{
+    const QString path = writeTempFile("tjo_cache_malformed.json", R"({"example_int": 5, "example_sub_class": )");
+    TaggedObject::JsonFileCache cache;
+    const std::shared_ptr<const CachedIntClass> first = cache.load<CachedIntClass>(path, false);
+    ASSERT_EQ(0, *first->example_int);
+    ASSERT_EQ(0, cache.size());
+    ASSERT_EQ(0, cache.usedBytes());
+    ASSERT_NE(first, cache.load<CachedIntClass>(path, false));
+    ASSERT_EQ(2, cache.missCount());
+    ASSERT_THROW(cache.load<CachedIntClass>(path), std::runtime_error);
+
+    writeTempFile("tjo_cache_malformed.json", R"({"example_int": 5})");
+    ASSERT_EQ(5, *cache.load<CachedIntClass>(path, false)->example_int);
+    ASSERT_EQ(1, cache.size());
+}
+
+// The shared objects are only used through their const methods, which don't write to them, so every thread can serialize the same object
+TEST(JsonFileCacheTests, ConcurrentSerialization)
+{
+    TaggedObject::JsonFileCache cache;
+    const QJsonObject expected = cache.load<CachedOuterClass>(EXAMPLE_FILE_PATH)->toJsonObject();
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&cache, &expected] {
+            for (int j = 0; j < 50; ++j) {
+                const std::shared_ptr<const CachedOuterClass> object = cache.load<CachedOuterClass>(EXAMPLE_FILE_PATH);
+                EXPECT_EQ(expected, object->toJsonObject());
+#ifdef TJO_ENABLE_MODIFICATION_TRACKING
+                EXPECT_EQ(expected, object->toMergePatch());
+#endif
+                EXPECT_EQ(expected, QJsonDocument::fromJson(object->toJson()).object());
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+
+    ASSERT_EQ(1, cache.missCount());
+    ASSERT_EQ(200, cache.hitCount());
+}
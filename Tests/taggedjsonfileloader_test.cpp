@@ -0,0 +1,91 @@
+#include <filesystem>
+#include <fstream>
+#include "gtest/gtest.h"
+#include "taggedjsonfileloader.h"
+#include "taggedjsonobject.h"
+#include "taggedjsonarray.h"
+#include "taggedjsonobjectmacros.h"
+
+namespace {
+    constexpr auto EXAMPLE_FILE_PATH = "../Tests/test_file.json";
+    constexpr auto MISSING_FILE_PATH = "../Tests/missing_file.json";
+    constexpr int EXPECTED_INT_RESULT = 42;
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(LoadedInnerClass,
+                                  (TaggedJSONString, example_sub_str))
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(LoadedOuterClass,
+                                  (TaggedJSONInt, example_int),
+                                  (LoadedInnerClass, example_sub_class),
+                                  (TaggedJSONStringArray, example_arr))
+
+    // Writes a file into the temporary directory and returns its path
+    QString writeTempFile(const char* name, const char* content)
+    {
+        const std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+        std::ofstream(path) << content;
+        return QString::fromStdString(path.string());
+    }
+}
+
+// The objects and the errors are in the order of the paths, a failing file doesn't stop the others
+TEST(JsonFileLoaderTests, LoadInPathOrder)
+{
+    QStringList paths;
+    for (int i = 0; i < 40; ++i)
+        paths.push_back(i % 3 == 2 ? MISSING_FILE_PATH : EXAMPLE_FILE_PATH);
+
+    TaggedObject::JsonFileLoadOptions options;
+    options.threadCount = 3;
+    options.maxConcurrentFiles = 2;
+    TaggedObject::JsonFileLoader<LoadedOuterClass> loader(options);
+    ASSERT_EQ(2, loader.concurrency());
+
+    const TaggedObject::JsonFileResult<LoadedOuterClass> result = loader.load(paths);
+    ASSERT_EQ(paths.size(), result.objects.size());
+    ASSERT_EQ(13, result.failedCount());
+    for (std::size_t i = 0; i < result.objects.size(); ++i) {
+        ASSERT_EQ(i % 3 == 2, !result.errors[i].isEmpty());
+        ASSERT_EQ(i % 3 == 2 ? 0 : EXPECTED_INT_RESULT, *result.objects[i].example_int);
+    }
+
+    ASSERT_TRUE(loader.load(QStringList()).objects.empty());
+}
+
+// Malformed files are always errors, the files with missing members only if checkValues is set
+TEST(JsonFileLoaderTests, InvalidFiles)
+{
+    const QStringList paths{ writeTempFile("tjo_loader_malformed.json", R"({"example_int": 1,)"),
+                             writeTempFile("tjo_loader_partial.json", R"({"example_int": 7})"),
+                             EXAMPLE_FILE_PATH };
+
+    TaggedObject::JsonFileLoader<LoadedOuterClass> loader;
+    const TaggedObject::JsonFileResult<LoadedOuterClass> checked = loader.load(paths);
+    ASSERT_FALSE(checked.isComplete());
+    ASSERT_FALSE(checked.errors[0].isEmpty());
+    ASSERT_FALSE(checked.errors[1].isEmpty());
+    ASSERT_TRUE(checked.errors[2].isEmpty());
+    ASSERT_EQ(0, *checked.objects[1].example_int);
+
+    TaggedObject::JsonFileLoadOptions options;
+    options.checkValues = false;
+    const TaggedObject::JsonFileResult<LoadedOuterClass> unchecked = TaggedObject::JsonFileLoader<LoadedOuterClass>(options).load(paths);
+    ASSERT_EQ(1, unchecked.failedCount());
+    ASSERT_EQ(7, *unchecked.objects[1].example_int);
+}
+
+// loadAsync() delivers the same result through a future or a completion handler
+TEST(JsonFileLoaderTests, LoadAsync)
+{
+    const QStringList paths{ EXAMPLE_FILE_PATH, MISSING_FILE_PATH, EXAMPLE_FILE_PATH };
+    TaggedObject::JsonFileLoader<LoadedOuterClass> loader;
+
+    std::future<TaggedObject::JsonFileResult<LoadedOuterClass>> future = loader.loadAsync(paths);
+    const TaggedObject::JsonFileResult<LoadedOuterClass> result = future.get();
+    ASSERT_EQ(1, result.failedCount());
+    ASSERT_EQ(EXPECTED_INT_RESULT, *result.objects[2].example_int);
+
+    std::promise<qsizetype> failed;
+    loader.loadAsync(paths, [&failed](TaggedObject::JsonFileResult<LoadedOuterClass>& batch) { failed.set_value(batch.failedCount()); });
+    ASSERT_EQ(1, failed.get_future().get());
+}
@@ -0,0 +1,163 @@
+#include <mutex>
+#include <vector>
+#include "gtest/gtest.h"
+#include "taggedjsonobject.h"
+#include "taggedjsonarray.h"
+#include "taggedjsonobjectmacros.h"
+
+// These tests have a runner of their own that is built with TJO_ENABLE_INSTRUMENTATION, see CMakeLists.txt
+#ifndef TJO_ENABLE_INSTRUMENTATION
+#error "The instrumentation tests need TJO_ENABLE_INSTRUMENTATION"
+#endif
+
+namespace {
+    constexpr auto FLEET_JSON = R"({"name": "fleet", "size": 2, "ships": [{"id": 1, "label": "a"}, {"id": 2, "label": "b"}]})";
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(InstrumentedShip,
+                                  (TaggedJSONInt, id),
+                                  (TaggedJSONString, label))
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(InstrumentedFleet,
+                                  (TaggedJSONString, name),
+                                  (TaggedJSONInt, size),
+                                  (TaggedJSONArray<InstrumentedShip>, ships))
+
+    using TaggedObject::InstrumentationEvent;
+
+    //Keeps every record, the names refer to static strings
+    class RecordingSink : public TaggedObject::InstrumentationSink
+    {
+    public:
+        std::vector<TaggedObject::InstrumentationRecord> records;
+
+        void record(const TaggedObject::InstrumentationRecord& record) override
+        {
+            const std::lock_guard<std::mutex> lock(m_mutex);
+            records.push_back(record);
+        }
+
+        std::vector<TaggedObject::InstrumentationRecord> find(const InstrumentationEvent event, const std::string_view className) const
+        {
+            std::vector<TaggedObject::InstrumentationRecord> ret;
+            for (const auto& record : records) {
+                if (record.event == event && record.className == className)
+                    ret.push_back(record);
+            }
+            return ret;
+        }
+
+    private:
+        std::mutex m_mutex;
+    };
+
+    //Installs a sink for the duration of a test
+    struct SinkScope
+    {
+        explicit SinkScope(TaggedObject::InstrumentationSink* sink) { TaggedObject::setInstrumentationSink(sink); }
+        ~SinkScope() { TaggedObject::setInstrumentationSink(nullptr); }
+    };
+}
+
+// Constructors report the document parse, the binding of every class and the tagged arrays
+TEST(InstrumentationTests, Construction)
+{
+    RecordingSink sink;
+    const SinkScope scope(&sink);
+    const InstrumentedFleet fleet{QByteArray(FLEET_JSON)};
+
+    const auto parse = sink.find(InstrumentationEvent::DocumentParse, "InstrumentedFleet");
+    ASSERT_EQ(1u, parse.size());
+    ASSERT_EQ(QByteArray(FLEET_JSON).size(), parse[0].bytes);
+
+    const auto construct = sink.find(InstrumentationEvent::Construct, "InstrumentedFleet");
+    ASSERT_EQ(1u, construct.size());
+    ASSERT_EQ(3, construct[0].count);
+    ASSERT_LE(0, construct[0].elapsedNanoseconds);
+    ASSERT_EQ(2u, sink.find(InstrumentationEvent::Construct, "InstrumentedShip").size());
+
+    const auto array = sink.find(InstrumentationEvent::ArrayConstruct, "InstrumentedShip");
+    ASSERT_EQ(1u, array.size());
+    ASSERT_EQ(2, array[0].count);
+}
+
+// Missing members are reported with their names, even if the construction throws
+TEST(InstrumentationTests, MissingFields)
+{
+    RecordingSink sink;
+    const SinkScope scope(&sink);
+    const QJsonObject incomplete{{"name", "fleet"}};
+
+    const InstrumentedFleet lenient(incomplete, false);
+    ASSERT_THROW(InstrumentedFleet strict(incomplete), std::runtime_error);
+
+    const auto missing = sink.find(InstrumentationEvent::MissingField, "InstrumentedFleet");
+    ASSERT_EQ(4u, missing.size());
+    ASSERT_EQ("size", missing[0].memberName);
+    ASSERT_EQ("ships", missing[1].memberName);
+    //The failed construction isn't reported as a construction
+    ASSERT_EQ(1u, sink.find(InstrumentationEvent::Construct, "InstrumentedFleet").size());
+}
+
+// Values of another type are reported by the member type
+TEST(InstrumentationTests, TypeMismatch)
+{
+    RecordingSink sink;
+    const SinkScope scope(&sink);
+    const InstrumentedShip ship(QJsonObject{{"id", "seven"}, {"label", "a"}});
+
+    const auto mismatches = sink.find(InstrumentationEvent::TypeMismatch, "TaggedJSONInt");
+    ASSERT_EQ(1u, mismatches.size());
+    ASSERT_EQ(0, *ship.id);
+}
+
+// The direct-binding parse and the serialization report their sizes
+TEST(InstrumentationTests, ParseAndSerialize)
+{
+    RecordingSink sink;
+    const SinkScope scope(&sink);
+    const InstrumentedFleet fleet = InstrumentedFleet::fromJson(FLEET_JSON);
+    const QByteArray text = fleet.toJson(QJsonDocument::Compact);
+    fleet.toJsonObject();
+
+    const auto parse = sink.find(InstrumentationEvent::Parse, "InstrumentedFleet");
+    ASSERT_EQ(1u, parse.size());
+    ASSERT_EQ(QByteArray(FLEET_JSON).size(), parse[0].bytes);
+
+    const auto serializeText = sink.find(InstrumentationEvent::SerializeText, "InstrumentedFleet");
+    ASSERT_EQ(1u, serializeText.size());
+    ASSERT_EQ(text.size(), serializeText[0].bytes);
+
+    ASSERT_EQ(1u, sink.find(InstrumentationEvent::Serialize, "InstrumentedFleet").size());
+    ASSERT_EQ(2u, sink.find(InstrumentationEvent::Serialize, "InstrumentedShip").size());
+}
+
+// Nothing is reported without a sink
+TEST(InstrumentationTests, NoSink)
+{
+    RecordingSink sink;
+    {
+        const SinkScope scope(&sink);
+    }
+    const InstrumentedFleet fleet{QByteArray(FLEET_JSON)};
+    fleet.toJsonObject();
+
+    ASSERT_TRUE(sink.records.empty());
+}
+
+// The counter sink sums the reports per class and event
+TEST(InstrumentationTests, Counters)
+{
+    TaggedObject::InstrumentationCounters counters;
+    const SinkScope scope(&counters);
+    for (int i = 0; i < 3; ++i)
+        InstrumentedFleet::fromJson(FLEET_JSON);
+    InstrumentedShip(QJsonObject{{"id", 1}}, false);
+
+    const auto parse = counters.totals("InstrumentedFleet", InstrumentationEvent::Parse);
+    ASSERT_EQ(3, parse.operations);
+    ASSERT_EQ(3 * QByteArray(FLEET_JSON).size(), parse.bytes);
+    ASSERT_EQ(1, counters.totals("InstrumentedShip.label", InstrumentationEvent::MissingField).operations);
+
+    counters.reset();
+    ASSERT_TRUE(counters.snapshot().empty());
+}
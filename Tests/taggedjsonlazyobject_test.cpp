@@ -0,0 +1,146 @@
+#include "gtest/gtest.h"
+#include "taggedjsonobject.h"
+#include "taggedjsonlazyobjectmacros.h"
+
+namespace {
+    constexpr auto EXAMPLE_FILE_PATH = "../Tests/test_file.json";
+    constexpr int EXPECTED_INT_RESULT = 42;
+    constexpr auto EXPECTED_STRING_RESULT = "Hello world!";
+    constexpr auto EXPECTED_SUBSTRING_RESULT = "Hello from an object!";
+    constexpr auto MISTYPED_JSON = R"({"example_int": "not a number", "example_str": "Hello world!"})";
+
+    QByteArray jsonFromFile()
+    {
+        QFile f{ EXAMPLE_FILE_PATH };
+        f.open(QIODevice::ReadOnly);
+        return f.readAll();
+    }
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(EagerInnerClass,
+                                  (TaggedJSONString, example_sub_str))
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(EagerOuterClass,
+                                  (TaggedJSONInt, example_int),
+                                  (TaggedJSONString, example_str),
+                                  (TaggedJSONDouble, example_double),
+                                  (EagerInnerClass, example_sub_class),
+                                  (TaggedQJsonObject, example_json_object),
+                                  (TaggedJSONValue, example_json_value1),
+                                  (TaggedJSONValue, example_json_value2))
+
+    TJO_DEFINE_LAZY_JSON_TAGGED_OBJECT(LazyInnerClass,
+                                       (TaggedJSONString, example_sub_str))
+
+    TJO_DEFINE_LAZY_JSON_TAGGED_OBJECT(LazyOuterClass,
+                                       (TaggedJSONInt, example_int),
+                                       (TaggedJSONString, example_str),
+                                       (TaggedJSONDouble, example_double),
+                                       (LazyInnerClass, example_sub_class),
+                                       (TaggedQJsonObject, example_json_object),
+                                       (TaggedJSONValue, example_json_value1),
+                                       (TaggedJSONValue, example_json_value2))
+
+    TJO_DEFINE_LAZY_JSON_TAGGED_OBJECT(LazyMissingValuedClass,
+                                       (TaggedJSONInt, example_int),
+                                       (TaggedJSONString, example_str),
+                                       (TaggedJSONInt, missing_member))
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(EagerHolderClass,
+                                  (LazyInnerClass, example_sub_class),
+                                  (TaggedJSONInt, example_int))
+}
+
+// Lazy objects can be built from every source the eager ones accept
+TEST(LazyObjectTests, ConstructFromSources)
+{
+    const QByteArray json = jsonFromFile();
+    const LazyOuterClass fromText{json};
+    const LazyOuterClass fromObject{QJsonDocument::fromJson(json).object()};
+    const LazyOuterClass fromFile{QString(EXAMPLE_FILE_PATH)};
+    const LazyOuterClass direct = LazyOuterClass::fromJson(json);
+
+    ASSERT_EQ(EXPECTED_INT_RESULT, *fromText.example_int());
+    ASSERT_EQ(EXPECTED_INT_RESULT, *fromObject.example_int());
+    ASSERT_EQ(EXPECTED_STRING_RESULT, *fromFile.example_str());
+    ASSERT_EQ(EXPECTED_SUBSTRING_RESULT, *direct.example_sub_class().example_sub_str());
+}
+
+// Lazy objects convert to the same JSON as the eager objects
+TEST(LazyObjectTests, MatchesEagerObject)
+{
+    const QByteArray json = jsonFromFile();
+    const EagerOuterClass eager{json};
+    const LazyOuterClass fromText{json};
+    const LazyOuterClass fromObject{QJsonDocument::fromJson(json).object()};
+
+    ASSERT_EQ(eager.toJsonObject(), fromText.toJsonObject());
+    ASSERT_EQ(eager.toJsonObject(), fromObject.toJsonObject());
+    ASSERT_EQ(eager.toJson(QJsonDocument::Compact), fromText.toJson(QJsonDocument::Compact));
+}
+
+// Missing members don't fail the construction, the strict check happens on their first access
+TEST(LazyObjectTests, StrictCheckOnAccess)
+{
+    const QByteArray json = jsonFromFile();
+    const LazyMissingValuedClass fromText{json, true};
+    const LazyMissingValuedClass fromObject{QJsonDocument::fromJson(json).object(), true};
+
+    ASSERT_EQ(EXPECTED_INT_RESULT, *fromText.example_int());
+    ASSERT_THROW(fromText.missing_member(), std::runtime_error);
+    ASSERT_THROW(fromObject.missing_member(), std::runtime_error);
+}
+
+// Non-strict lazy objects give default members for the missing ones
+TEST(LazyObjectTests, NonStrictAccess)
+{
+    const LazyMissingValuedClass obj{jsonFromFile(), false};
+
+    ASSERT_NO_THROW(obj.missing_member());
+    ASSERT_EQ(0, *obj.missing_member());
+}
+
+// validate() applies the strict rules on every member, whatever the object has been constructed with
+TEST(LazyObjectTests, Validate)
+{
+    const QByteArray json = jsonFromFile();
+
+    ASSERT_NO_THROW(LazyOuterClass(json, false).validate());
+    ASSERT_THROW(LazyMissingValuedClass(json, false).validate(), std::runtime_error);
+
+    const LazyMissingValuedClass mistyped{QByteArray(MISTYPED_JSON), false};
+    ASSERT_EQ(0, *mistyped.example_int());
+    ASSERT_THROW(mistyped.validate(), std::runtime_error);
+}
+
+// Malformed text is still detected by the constructor
+TEST(LazyObjectTests, MalformedText)
+{
+    const QByteArray json = R"({"example_int": 42, "example_str": )";
+
+    ASSERT_THROW(LazyOuterClass(json, true), std::runtime_error);
+    ASSERT_NO_THROW(LazyOuterClass(json, false));
+}
+
+// Converted members are cached and can be modified through the mutable accessors
+TEST(LazyObjectTests, Mutation)
+{
+    LazyOuterClass obj{jsonFromFile()};
+    obj.example_int() = 5;
+    obj.example_sub_class().example_sub_str() = "changed";
+
+    ASSERT_EQ(5, *obj.example_int());
+    ASSERT_EQ(5, obj.toJsonObject()["example_int"].toInt());
+    ASSERT_EQ("changed", obj.toJsonObject()["example_sub_class"].toObject()["example_sub_str"].toString());
+}
+
+// Lazy objects can be members of the eager ones in both parse modes
+TEST(LazyObjectTests, MemberOfEagerObject)
+{
+    const QByteArray json = jsonFromFile();
+    const EagerHolderClass fromDocument{json};
+    const EagerHolderClass direct = EagerHolderClass::fromJson(json);
+
+    ASSERT_EQ(EXPECTED_SUBSTRING_RESULT, *fromDocument.example_sub_class.example_sub_str());
+    ASSERT_EQ(EXPECTED_SUBSTRING_RESULT, *direct.example_sub_class.example_sub_str());
+    ASSERT_EQ(fromDocument.toJson(), direct.toJson());
+}
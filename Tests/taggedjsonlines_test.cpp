@@ -0,0 +1,112 @@
+#include <QBuffer>
+#include "gtest/gtest.h"
+#include "taggedjsonlines.h"
+#include "taggedjsonobject.h"
+#include "taggedjsonobjectmacros.h"
+
+namespace {
+    constexpr int RECORD_COUNT = 1000;
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(LogRecord,
+                                  (TaggedJSONInt, id),
+                                  (TaggedJSONString, message))
+
+    QByteArray makeLog(const int recordCount)
+    {
+        QByteArray log;
+        for (int i = 0; i < recordCount; ++i)
+            log += R"({"id": )" + QByteArray::number(i) + R"(, "message": "entry )" + QByteArray::number(i) + "\"}\n";
+        return log;
+    }
+
+    TaggedObject::JsonLinesOptions smallBatches(const bool preserveOrder)
+    {
+        TaggedObject::JsonLinesOptions options;
+        options.threadCount = 4;
+        options.batchLines = 7;
+        options.maxPendingBatches = 3;
+        options.preserveOrder = preserveOrder;
+        return options;
+    }
+}
+
+// Batches are delivered in input order and cover every line
+TEST(JsonLinesTests, OrderedBatchesFromBuffer)
+{
+    TaggedObject::JsonLinesReader<LogRecord> reader(smallBatches(true));
+    std::vector<int> ids;
+    qint64 expectedSequence = 0;
+    reader.read(makeLog(RECORD_COUNT), [&](TaggedObject::JsonLinesBatch<LogRecord>& batch) {
+        ASSERT_EQ(expectedSequence++, batch.sequence);
+        ASSERT_EQ(batch.sequence * 7 + 1, batch.firstLine);
+        for (const LogRecord& record : batch.records)
+            ids.push_back(*record.id);
+    });
+
+    ASSERT_EQ(RECORD_COUNT, static_cast<int>(ids.size()));
+    for (int i = 0; i < RECORD_COUNT; ++i)
+        ASSERT_EQ(i, ids[i]);
+}
+
+// Unordered delivery still delivers every record exactly once
+TEST(JsonLinesTests, UnorderedBatchesFromDevice)
+{
+    QByteArray log = makeLog(RECORD_COUNT);
+    QBuffer device(&log);
+    device.open(QIODevice::ReadOnly);
+
+    TaggedObject::JsonLinesReader<LogRecord> reader(smallBatches(false));
+    std::vector<LogRecord> records = reader.readAll(device);
+
+    ASSERT_EQ(RECORD_COUNT, static_cast<int>(records.size()));
+    std::vector<int> ids;
+    for (const LogRecord& record : records)
+        ids.push_back(*record.id);
+    std::sort(ids.begin(), ids.end());
+    for (int i = 0; i < RECORD_COUNT; ++i)
+        ASSERT_EQ(i, ids[i]);
+}
+
+// Failing lines are reported with their line numbers, blank lines and CRLF line endings are accepted
+TEST(JsonLinesTests, PerLineErrors)
+{
+    const QByteArray log = "{\"id\": 1, \"message\": \"a\"}\r\n"
+                           "\n"
+                           "{\"id\": 2, \"message\": \n"
+                           "{\"id\": 3}\n"
+                           "{\"id\": 4, \"message\": \"d\"}";
+
+    TaggedObject::JsonLinesReader<LogRecord> reader;
+    std::vector<TaggedObject::JsonLineError> errors;
+    const std::vector<LogRecord> records = reader.readAll(log, &errors);
+
+    ASSERT_EQ(2u, records.size());
+    ASSERT_EQ(1, *records[0].id);
+    ASSERT_EQ(4, *records[1].id);
+    ASSERT_EQ(2u, errors.size());
+    ASSERT_EQ(3, errors[0].line);
+    ASSERT_EQ(4, errors[1].line);
+}
+
+// Missing members aren't errors if the values aren't checked
+TEST(JsonLinesTests, MissingMembersNonStrictTestPass)
+{
+    TaggedObject::JsonLinesOptions options;
+    options.checkValues = false;
+    TaggedObject::JsonLinesReader<LogRecord> reader(options);
+    std::vector<TaggedObject::JsonLineError> errors;
+    const std::vector<LogRecord> records = reader.readAll(QByteArray("{\"id\": 3}\n"), &errors);
+
+    ASSERT_EQ(1u, records.size());
+    ASSERT_TRUE(errors.empty());
+}
+
+// Devices that aren't open are reported
+TEST(JsonLinesTests, UnreadableDeviceIsReported)
+{
+    QBuffer device;
+    TaggedObject::JsonLinesReader<LogRecord> reader;
+
+    ASSERT_FALSE(reader.read(device, [](TaggedObject::JsonLinesBatch<LogRecord>&) {}));
+    ASSERT_FALSE(reader.errorString().isEmpty());
+}
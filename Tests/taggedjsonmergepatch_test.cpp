@@ -0,0 +1,278 @@
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+#include "taggedjsonobject.h"
+#include "taggedjsonarray.h"
+#include "taggedjsonvector.h"
+#include "taggedjsonobjectmacros.h"
+
+// These tests have a runner of their own that is built with TJO_ENABLE_MODIFICATION_TRACKING, see CMakeLists.txt
+#ifndef TJO_ENABLE_MODIFICATION_TRACKING
+#error "The merge patch tests need TJO_ENABLE_MODIFICATION_TRACKING"
+#endif
+
+namespace {
+    constexpr auto STATE_JSON = R"({"name": "pump", "running": true, "rpm": 1200,
+                                    "position": {"x": 1.5, "y": 2.5},
+                                    "tags": ["a", "b"],
+                                    "extra": {"mode": "auto", "limit": 3},
+                                    "sensors": [{"x": 0, "y": 0}, {"x": 1, "y": 1}]})";
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(PatchPoint,
+                                  (TaggedJSONDouble, x),
+                                  (TaggedJSONDouble, y))
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(PatchState,
+                                  (TaggedJSONString, name),
+                                  (TaggedJSONBool, running),
+                                  (TaggedJSONInt, rpm),
+                                  (PatchPoint, position),
+                                  (TaggedJSONStringArray, tags),
+                                  (TaggedQJsonObject, extra),
+                                  (TaggedJSONArray<PatchPoint>, sensors))
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(PatchVectorState,
+                                  (TaggedJSONInt, rpm),
+                                  (TaggedJSONVector<int>, samples))
+}
+
+// A freshly parsed object has no baseline, the first patch is the whole object
+TEST(MergePatchTests, FirstPatchIsWholeObject)
+{
+    const PatchState state{QByteArray(STATE_JSON)};
+
+    ASSERT_TRUE(state.isModified());
+    ASSERT_EQ(state.toJsonObject(), PatchState{QByteArray(STATE_JSON)}.toMergePatch());
+}
+
+// Parsing doesn't flag the members, a read into an object that has a baseline compares every member once
+TEST(MergePatchTests, ParsedMembersAreNotModified)
+{
+    PatchState state = PatchState::fromJson(STATE_JSON);
+    ASSERT_FALSE(state.rpm.isModified());
+    ASSERT_FALSE(state.position.x.isModified());
+    ASSERT_FALSE(state.sensors.isModified());
+    state.clearModified();
+
+    QByteArray json(STATE_JSON);
+    json.replace("1200", "1300");
+    state.parseInto(json);
+    ASSERT_FALSE(state.rpm.isModified());
+    ASSERT_TRUE(state.isModified());
+    ASSERT_EQ(QJsonObject({{"rpm", 1300}}), state.toMergePatch());
+    ASSERT_EQ(state.toJsonObject(), state.updateJsonObject());
+    ASSERT_FALSE(state.isModified());
+}
+
+// A nested object that is read on its own is compared by the object that holds it
+TEST(MergePatchTests, NestedRead)
+{
+    PatchState state = PatchState::fromJson(STATE_JSON);
+    state.clearModified();
+
+    state.position.parseInto(R"({"x": 9, "y": 2.5})");
+    ASSERT_EQ(QJsonObject({{"position", QJsonObject{{"x", 9.0}}}}), state.toMergePatch());
+    state.clearModified();
+    ASSERT_TRUE(state.toMergePatch().isEmpty());
+    ASSERT_EQ(state.toJsonObject(), state.updateJsonObject());
+}
+
+// clearModified() takes the state as the baseline, unmodified objects give empty patches
+TEST(MergePatchTests, UnmodifiedObject)
+{
+    PatchState state = PatchState::fromJson(STATE_JSON);
+    const QJsonObject full = state.toJsonObject();
+    state.clearModified();
+
+    ASSERT_FALSE(state.isModified());
+    ASSERT_TRUE(state.toMergePatch().isEmpty());
+    ASSERT_EQ(full, state.toJsonObject());
+    ASSERT_EQ(full, state.updateJsonObject());
+}
+
+// Neither toJsonObject() nor toMergePatch() advances the baseline
+TEST(MergePatchTests, ConstMethodsKeepBaseline)
+{
+    PatchState state = PatchState::fromJson(STATE_JSON);
+    state.clearModified();
+    state.rpm = 1500;
+
+    const QJsonObject expected{{"rpm", 1500}};
+    ASSERT_EQ(1500, state.toJsonObject()["rpm"].toInt());
+    ASSERT_EQ(expected, state.toMergePatch());
+    ASSERT_EQ(expected, state.toMergePatch());
+    ASSERT_TRUE(state.isModified());
+
+    state.clearModified();
+    ASSERT_TRUE(state.toMergePatch().isEmpty());
+}
+
+// Reading through the mutable accessors flags the members, but unchanged values stay out of the patch
+TEST(MergePatchTests, MutableReads)
+{
+    PatchState state = PatchState::fromJson(STATE_JSON);
+    state.clearModified();
+
+    ASSERT_EQ(1200, *state.rpm);
+    ASSERT_EQ(QString("pump"), state.name.get());
+    ASSERT_EQ(QString("auto"), state.extra["mode"].toString());
+    ASSERT_EQ(0.0, state.sensors.at(0).x.get());
+
+    ASSERT_TRUE(state.toMergePatch().isEmpty());
+    ASSERT_FALSE(state.isModified());
+}
+
+// Assignments and set() end up in the patch, nested objects are patched recursively
+TEST(MergePatchTests, ChangedMembers)
+{
+    PatchState state = PatchState::fromJson(STATE_JSON);
+    state.clearModified();
+
+    state.rpm = 1500;
+    state.position.y.set(4.0);
+    state.running = true;
+
+    ASSERT_TRUE(state.isModified());
+    const QJsonObject expected{{"rpm", 1500}, {"position", QJsonObject{{"y", 4.0}}}};
+    ASSERT_EQ(expected, state.toMergePatch());
+    state.clearModified();
+    ASSERT_FALSE(state.isModified());
+    ASSERT_TRUE(state.toMergePatch().isEmpty());
+}
+
+// Keys removed from QJsonObject members are set to null
+TEST(MergePatchTests, RemovedKeys)
+{
+    PatchState state = PatchState::fromJson(STATE_JSON);
+    state.clearModified();
+
+    (*state.extra).remove("limit");
+    state.extra["mode"] = "manual";
+
+    const QJsonObject expected{{"extra", QJsonObject{{"limit", QJsonValue()}, {"mode", "manual"}}}};
+    ASSERT_EQ(expected, state.toMergePatch());
+}
+
+// Arrays are replaced as a whole, the mutable element access marks the array
+TEST(MergePatchTests, Arrays)
+{
+    PatchState state = PatchState::fromJson(STATE_JSON);
+    state.clearModified();
+
+    state.sensors.at(1).x = 5.0;
+    state.tags[0] = "c";
+
+    const QJsonObject patch = state.toMergePatch();
+    ASSERT_EQ(2, patch.size());
+    ASSERT_EQ(QJsonArray({"c", "b"}), patch["tags"].toArray());
+    ASSERT_EQ(5.0, patch["sensors"].toArray().at(1).toObject()["x"].toDouble());
+}
+
+// Applying the patches to the published document reproduces the current state
+TEST(MergePatchTests, ApplyReproducesState)
+{
+    PatchState state = PatchState::fromJson(STATE_JSON);
+    QJsonValue published = state.toMergePatch();
+    state.clearModified();
+
+    for (int i = 0; i < 5; ++i) {
+        state.rpm = 1000 + i;
+        state.position.x = i * 0.5;
+        (*state.extra).insert(QString("key%1").arg(i), i);
+        if (i % 2)
+            (*state.extra).remove(QString("key%1").arg(i - 1));
+        published = TaggedObject::applyMergePatch(published, state.toMergePatch());
+        state.clearModified();
+        ASSERT_EQ(QJsonValue(state.toJsonObject()), published);
+    }
+}
+
+// Assigning a whole object keeps the baseline of the destination
+TEST(MergePatchTests, AssignedObject)
+{
+    PatchState state = PatchState::fromJson(STATE_JSON);
+    state.clearModified();
+
+    PatchState other = PatchState::fromJson(STATE_JSON);
+    other.name = "fan";
+    other.clearModified();
+    state = other;
+
+    ASSERT_TRUE(state.isModified());
+    ASSERT_EQ(QJsonObject({{"name", "fan"}}), state.toMergePatch());
+    state.clearModified();
+
+    state.position = PatchPoint(TaggedJSONDouble(3.0), TaggedJSONDouble(2.5));
+    ASSERT_EQ(QJsonObject({{"position", QJsonObject{{"x", 3.0}}}}), state.toMergePatch());
+}
+
+// The baseline always matches a fresh serialization
+TEST(MergePatchTests, BaselineMatchesFreshSerialization)
+{
+    PatchState state = PatchState::fromJson(STATE_JSON);
+    state.clearModified();
+
+    state.name = "valve";
+    (*state.sensors).push_back(PatchPoint(TaggedJSONDouble(7.0), TaggedJSONDouble(8.0)));
+    const QByteArray json = R"({"rpm": 42})";
+    TaggedObject::JsonReader reader(json);
+    state.readJson(reader, false);
+
+    const PatchState fresh{state.toJsonObject()};
+    ASSERT_EQ(state.toJsonObject(), state.updateJsonObject());
+    ASSERT_EQ(42, *state.rpm);
+    ASSERT_EQ(3u, state.sensors->size());
+    ASSERT_EQ(QJsonDocument(state.toJsonObject()).toJson(), state.toJson());
+    ASSERT_EQ(fresh.toJson(), state.toJson());
+}
+
+// Members without modification tracking are compared every time, unchanged values stay out of the patch
+TEST(MergePatchTests, UntrackedMembers)
+{
+    PatchVectorState state = PatchVectorState::fromJson(R"({"rpm": 1, "samples": [1, 2, 3]})");
+    state.clearModified();
+
+    ASSERT_FALSE(state.isModified());
+    ASSERT_TRUE(state.toMergePatch().isEmpty());
+
+    (*state.samples).push_back(4);
+    ASSERT_EQ(QJsonObject({{"samples", QJsonArray({1, 2, 3, 4})}}), state.toMergePatch());
+}
+
+// The const methods don't write to the object, one object can be serialized and patched from several threads at once
+TEST(MergePatchTests, ConcurrentSerialization)
+{
+    PatchState state = PatchState::fromJson(STATE_JSON);
+    state.clearModified();
+    state.rpm = 1500;
+    const PatchState& shared = state;
+    const QJsonObject expected = shared.toJsonObject();
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&shared, &expected] {
+            for (int j = 0; j < 100; ++j) {
+                EXPECT_EQ(expected, shared.toJsonObject());
+                EXPECT_EQ(QJsonObject({{"rpm", 1500}}), shared.toMergePatch());
+                EXPECT_TRUE(shared.isModified());
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+}
+
+// The patch helpers follow the examples of RFC 7386
+TEST(MergePatchTests, Rfc7386Examples)
+{
+    const QJsonObject before = QJsonDocument::fromJson(R"({"title": "Goodbye!", "author": {"givenName": "John", "familyName": "Doe"},
+                                                           "tags": ["example", "sample"], "content": "This will be unchanged"})").object();
+    const QJsonObject after = QJsonDocument::fromJson(R"({"title": "Hello!", "author": {"givenName": "John"}, "tags": ["example"],
+                                                          "content": "This will be unchanged", "phoneNumber": "+01-123-456-7890"})").object();
+    const QJsonObject patch = QJsonDocument::fromJson(R"({"title": "Hello!", "phoneNumber": "+01-123-456-7890",
+                                                          "author": {"familyName": null}, "tags": ["example"]})").object();
+
+    ASSERT_EQ(patch, TaggedObject::createMergePatch(before, after));
+    ASSERT_EQ(QJsonValue(after), TaggedObject::applyMergePatch(before, patch));
+    ASSERT_EQ(QJsonValue(QJsonArray({1})), TaggedObject::applyMergePatch(QJsonObject{{"a", "b"}}, QJsonArray({1})));
+}
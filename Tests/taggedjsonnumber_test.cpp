@@ -0,0 +1,131 @@
+#include <cmath>
+#include <limits>
+#include "gtest/gtest.h"
+#include "taggedjsonobject.h"
+#include "taggedjsonarray.h"
+#include "taggedjsonvector.h"
+#include "taggedjsonobjectmacros.h"
+
+namespace {
+    TJO_DEFINE_JSON_TAGGED_OBJECT(WideCounters,
+                                  (TaggedJSONInt64, signedValue),
+                                  (TaggedJSONUInt64, unsignedValue),
+                                  (TaggedJSONInt, small),
+                                  (TaggedJSONInt64Vector, history))
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(WideValues,
+                                  (TaggedJSONArray<qint64>, samples),
+                                  (TaggedJSONObject<QJsonValue>, raw))
+
+    QByteArray formatDouble(const double value)
+    {
+        QByteArray ret;
+        TaggedObject::appendJsonDouble(ret, value);
+        return ret;
+    }
+}
+
+// Shortest round-trip text in the layout of QByteArray::number(value, 'g', QLocale::FloatingPointShortest)
+TEST(NumberTests, ShortestDoubleFormatting)
+{
+    ASSERT_EQ(QByteArray("0"), formatDouble(0));
+    ASSERT_EQ(QByteArray("0.5"), formatDouble(0.5));
+    ASSERT_EQ(QByteArray("-2.5"), formatDouble(-2.5));
+    ASSERT_EQ(QByteArray("123.25"), formatDouble(123.25));
+    ASSERT_EQ(QByteArray("0.30000000000000004"), formatDouble(0.1 + 0.2));
+    ASSERT_EQ(QByteArray("0.0001"), formatDouble(0.0001));
+    ASSERT_EQ(QByteArray("1e-05"), formatDouble(0.00001));
+    ASSERT_EQ(QByteArray("1.5e-07"), formatDouble(1.5e-7));
+    ASSERT_EQ(QByteArray("12345"), formatDouble(12345));
+    ASSERT_EQ(QByteArray("1e+05"), formatDouble(100000));
+    ASSERT_EQ(QByteArray("1.2e+06"), formatDouble(1200000));
+    ASSERT_EQ(QByteArray("1e+20"), formatDouble(1e20));
+    ASSERT_EQ(QByteArray("1.7976931348623157e+308"), formatDouble(std::numeric_limits<double>::max()));
+    ASSERT_EQ(QByteArray("5e-324"), formatDouble(std::numeric_limits<double>::denorm_min()));
+}
+
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+// The formatting follows Qt's own shortest 'g' form for doubles of every magnitude
+TEST(NumberTests, ShortestDoubleFormattingMatchesQt)
+{
+    for (int exponent = -320; exponent <= 308; ++exponent) {
+        const double power = std::pow(10.0, exponent);
+        for (const double value : { power, -1.5 * power, std::nextafter(power, 0.0), 0.1 + power })
+            ASSERT_EQ(QByteArray::number(value, 'g', QLocale::FloatingPointShortest), formatDouble(value)) << value;
+    }
+}
+#endif
+
+// Every formatted double parses back to the same value
+TEST(NumberTests, DoubleRoundTrip)
+{
+    for (const double value : {0.1, 1.0 / 3.0, 2.0 / 3.0e10, 6.02214076e23, -1.602176634e-19, 9007199254740993.0}) {
+        const QByteArray text = formatDouble(value);
+        ASSERT_EQ(value, TaggedObject::parseJsonDouble(text.constData(), text.constData() + text.size())) << text.constData();
+    }
+}
+
+// 64-bit members keep their full precision in the direct-binding parse and serialization
+TEST(NumberTests, ExactIntegersDirectBinding)
+{
+    const QByteArray json = R"({"signedValue": -9223372036854775808, "unsignedValue": 18446744073709551615, "small": 7, "history": [9007199254740993, -1]})";
+    const WideCounters counters = WideCounters::fromJson(json);
+    ASSERT_EQ(std::numeric_limits<qint64>::min(), *counters.signedValue);
+    ASSERT_EQ(std::numeric_limits<quint64>::max(), *counters.unsignedValue);
+    ASSERT_EQ(7, *counters.small);
+    ASSERT_EQ(9007199254740993LL, counters.history.at(0));
+
+    const WideCounters reparsed = WideCounters::fromJson(counters.toJson(QJsonDocument::Compact));
+    ASSERT_EQ(*counters.signedValue, *reparsed.signedValue);
+    ASSERT_EQ(*counters.unsignedValue, *reparsed.unsignedValue);
+    ASSERT_EQ(*counters.history, *reparsed.history);
+    ASSERT_TRUE(counters.toJson(QJsonDocument::Compact).contains("18446744073709551615"));
+}
+
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+// The QJsonValue constructors keep 64-bit integers that QJsonValue holds as integers, Qt 5 stores every number as a double
+TEST(NumberTests, ExactIntegersQJsonValue)
+{
+    const WideCounters counters(QJsonObject{{"signedValue", QJsonValue(qint64(9007199254740993LL))},
+                                            {"unsignedValue", QJsonValue(qint64(1) << 62)},
+                                            {"small", 1},
+                                            {"history", QJsonArray{QJsonValue(qint64(-9007199254740993LL))}}});
+    ASSERT_EQ(9007199254740993LL, *counters.signedValue);
+    ASSERT_EQ(quint64(1) << 62, *counters.unsignedValue);
+    ASSERT_EQ(-9007199254740993LL, counters.history.at(0));
+    ASSERT_EQ(9007199254740993LL, counters.toJsonObject().value(QStringLiteral("signedValue")).toInteger());
+}
+
+// The members that hold QJsonValues keep 64-bit integers of the JSON text as integers, the same as QJsonDocument
+TEST(NumberTests, ExactIntegersJsonText)
+{
+    const QByteArray json = R"({"samples": [9007199254740993, -9007199254740993, 1.5], "raw": 9007199254740993})";
+    const WideValues values = WideValues::fromJson(json);
+    ASSERT_EQ(9007199254740993LL, values.samples.at(0));
+    ASSERT_EQ(-9007199254740993LL, values.samples.at(1));
+    ASSERT_EQ(9007199254740993LL, values.raw->toInteger());
+    ASSERT_EQ(1.5, values.samples->at(2).toDouble());
+
+    const QByteArray text = values.toJson(QJsonDocument::Compact);
+    ASSERT_TRUE(text.contains("9007199254740993,"));
+    const WideValues reparsed = WideValues::fromJson(text);
+    ASSERT_EQ(9007199254740993LL, reparsed.samples.at(0));
+    ASSERT_EQ(9007199254740993LL, reparsed.raw->toInteger());
+    ASSERT_EQ(QJsonDocument::fromJson(json).object(), reparsed.toJsonObject());
+}
+#endif
+
+// Values that don't fit the member type or aren't integral fall back to 0, integral fractions and exponents are accepted
+TEST(NumberTests, IntegerConversionRules)
+{
+    const WideCounters counters = WideCounters::fromJson(R"({"signedValue": 1e3, "unsignedValue": -1, "small": 3000000000, "history": [2.0, 2.5, 1e400]})");
+    ASSERT_EQ(1000, *counters.signedValue);
+    ASSERT_EQ(0u, *counters.unsignedValue);
+    ASSERT_EQ(0, *counters.small);
+    ASSERT_EQ((std::vector<qint64>{2, 0, 0}), *counters.history);
+
+    qint64 value = 5;
+    const char overflow[] = "9223372036854775808";
+    ASSERT_FALSE(TaggedObject::parseJsonInteger(overflow, overflow + sizeof(overflow) - 1, value));
+    ASSERT_EQ(5, value);
+}
@@ -20,6 +20,16 @@ namespace {
     }
 }
 
+//Members m_<prefix><digit><digit>, 100 per prefix
+#define WIDE_TEN(prefix) (TaggedJSONInt, m_##prefix##0), (TaggedJSONInt, m_##prefix##1), (TaggedJSONInt, m_##prefix##2), (TaggedJSONInt, m_##prefix##3),\
+                         (TaggedJSONInt, m_##prefix##4), (TaggedJSONInt, m_##prefix##5), (TaggedJSONInt, m_##prefix##6), (TaggedJSONInt, m_##prefix##7),\
+                         (TaggedJSONInt, m_##prefix##8), (TaggedJSONInt, m_##prefix##9)
+#define WIDE_HUNDRED(prefix) WIDE_TEN(prefix##0), WIDE_TEN(prefix##1), WIDE_TEN(prefix##2), WIDE_TEN(prefix##3), WIDE_TEN(prefix##4),\
+                             WIDE_TEN(prefix##5), WIDE_TEN(prefix##6), WIDE_TEN(prefix##7), WIDE_TEN(prefix##8), WIDE_TEN(prefix##9)
+
+//More members than the former preprocessor recursion could expand
+TJO_DEFINE_JSON_TAGGED_OBJECT(WideClass, WIDE_HUNDRED(a), WIDE_HUNDRED(b), WIDE_HUNDRED(c), WIDE_HUNDRED(d))
+
 TJO_DEFINE_JSON_TAGGED_OBJECT(InnerClass,
                           (TaggedJSONString, example_sub_str))
 
@@ -98,6 +108,38 @@ TEST(ConstructorTests, ConstructorFromTextNonStrictTestPass)
 }
 
 
+// Direct-binding parser fills the same values as the QByteArray constructor
+TEST(ConstructorTests, ConstructFromJSONTextDirect)
+{
+    const QByteArray jsonText = jsonFromFile().toJson();
+    const OuterClass expected{jsonText};
+    const OuterClass obj = OuterClass::fromJson(jsonText);
+
+    ASSERT_EQ(expected.toJsonObject(), obj.toJsonObject());
+}
+
+// Direct-binding parser throws an exception if at least one of the keys doesn't exist on the target text
+TEST(ConstructorTests, ConstructorFromTextDirectStrictTestFail)
+{
+    const QByteArray jsonText = jsonFromFile().toJson();
+    ASSERT_THROW(MissingValuedClass::fromJson(jsonText, true), std::runtime_error);
+}
+
+// Direct-binding parser won't throw an exception for the missing keys if the values aren't checked
+TEST(ConstructorTests, ConstructorFromTextDirectNonStrictTestPass)
+{
+    const QByteArray jsonText = jsonFromFile().toJson();
+    ASSERT_NO_THROW(MissingValuedClass::fromJson(jsonText, false));
+}
+
+// Malformed JSON text is reported by the direct-binding parser only if the values are checked
+TEST(ConstructorTests, ConstructorFromMalformedTextDirect)
+{
+    const QByteArray jsonText = R"({"example_sub_str": "Hello" "World"})";
+    ASSERT_THROW(InnerClass::fromJson(jsonText, true), std::runtime_error);
+    ASSERT_TRUE(InnerClass::fromJson(jsonText, false).example_sub_str->isEmpty());
+}
+
 // Tagged objects can be constructed by a QJsonObject as well
 TEST(ConstructorTests, ConstructFromQJsonObject)
 {
@@ -120,6 +162,30 @@ TEST(ConstructorTests, ConstructorFromQJsonObjectNonStrictTestPass)
     ASSERT_NO_THROW(MissingValuedClass(jsonObject, false));
 }
 
+// Single-pass binding fills the same values as the per-member lookups
+TEST(ConstructorTests, ConstructFromQJsonObjectSinglePass)
+{
+    const QJsonObject jsonObject = jsonFromFile().object();
+    const OuterClass expected{jsonObject};
+    const OuterClass obj{TaggedObject::singlePassBinding, jsonObject};
+
+    ASSERT_EQ(expected.toJsonObject(), obj.toJsonObject());
+}
+
+// Single-pass binding throws an exception if at least one of the keys doesn't exist on the target object
+TEST(ConstructorTests, ConstructorFromQJsonObjectSinglePassStrictTestFail)
+{
+    const QJsonObject jsonObject = jsonFromFile().object();
+    ASSERT_THROW(MissingValuedClass(TaggedObject::singlePassBinding, jsonObject, true), std::runtime_error);
+}
+
+// Single-pass binding won't throw an exception for the missing keys if the values aren't checked
+TEST(ConstructorTests, ConstructorFromQJsonObjectSinglePassNonStrictTestPass)
+{
+    const QJsonObject jsonObject = jsonFromFile().object();
+    ASSERT_NO_THROW(MissingValuedClass(TaggedObject::singlePassBinding, jsonObject, false));
+}
+
 // Tagged object can be constructed with values of its members
 TEST(ConstructorTests, ConstructorFromMemberInitialization)
 {
@@ -318,3 +384,40 @@ TEST_F(TaggedObjectFixture, ToJsonObjectQJsonValue)
     const QJsonObject obj = testObj.toJsonObject();
     ASSERT_DOUBLE_EQ(EXPECTED_JSON_VALUE_RESULT, obj["example_json_value1"]["test_value"].toInt());
 }
+
+// Direct serialization of a tagged object is byte-identical to serializing its QJsonObject
+TEST_F(TaggedObjectFixture, DirectSerializationMatchesQJsonDocument)
+{
+    const QJsonDocument document{testObj.toJsonObject()};
+
+    ASSERT_EQ(document.toJson(QJsonDocument::Compact), testObj.toJson(QJsonDocument::Compact));
+    ASSERT_EQ(document.toJson(), testObj.toJson());
+}
+
+// Classes can have hundreds of members, every one of them is bound and serialized
+TEST(TaggedObjectTests, WideClass)
+{
+    static_assert(TaggedObject::fieldCount<WideClass> == 400);
+    QJsonObject obj;
+    for (int i = 0; i < 400; ++i) {
+        const char key[] = { 'm', '_', char('a' + i / 100), char('0' + i / 10 % 10), char('0' + i % 10), '\0' };
+        obj.insert(QString::fromLatin1(key), i);
+    }
+
+    const WideClass wide(obj);
+    ASSERT_EQ(0, *wide.m_a00);
+    ASSERT_EQ(399, *wide.m_d99);
+    ASSERT_EQ(obj, wide.toJsonObject());
+    ASSERT_EQ(obj, WideClass::fromJson(wide.toJson()).toJsonObject());
+    ASSERT_THROW(WideClass(QJsonObject{{"m_a00", 1}}), std::runtime_error);
+}
+
+#ifndef TJO_ENABLE_MODIFICATION_TRACKING
+// Without the modification tracking the members are as large as their values and the classes carry no baseline
+TEST(TaggedObjectTests, UntrackedLayout)
+{
+    static_assert(sizeof(TaggedJSONInt) == sizeof(int));
+    static_assert(sizeof(TaggedJSONDouble) == sizeof(double));
+    static_assert(sizeof(WideClass) == 400 * sizeof(int));
+}
+#endif
@@ -0,0 +1,194 @@
+#include <atomic>
+#include <memory_resource>
+#include <thread>
+#include "gtest/gtest.h"
+#include "taggedjsoncbor.h"
+#include "taggedjsonobject.h"
+#include "taggedjsonpmrarray.h"
+#include "taggedjsonobjectmacros.h"
+#include "taggedjsonthreadpool.h"
+
+namespace {
+    constexpr auto TREE_JSON = R"({"name": "root", "groups": [{"label": "a", "items": [{"value": 1}, {"value": 2}]},
+                                                                {"label": "b", "items": [{"value": 3}]}]})";
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(PmrItem,
+                                  (TaggedJSONInt, value))
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(PmrGroup,
+                                  (TaggedJSONString, label),
+                                  (TaggedJSONPmrArray<PmrItem>, items))
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(PmrTree,
+                                  (TaggedJSONString, name),
+                                  (TaggedJSONPmrArray<PmrGroup>, groups))
+
+    //Resource that counts the allocations it serves
+    class CountingResource : public std::pmr::memory_resource
+    {
+    public:
+        int allocations = 0;
+
+    private:
+        void* do_allocate(const std::size_t bytes, const std::size_t alignment) override
+        {
+            ++allocations;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+        void do_deallocate(void* p, const std::size_t bytes, const std::size_t alignment) override
+        {
+            std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+        }
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+    };
+
+    //Resets the parallel array threshold when the test ends
+    struct ParallelThresholdScope
+    {
+        explicit ParallelThresholdScope(const qsizetype threshold) { TaggedObject::setParallelArrayThreshold(threshold); }
+        ~ParallelThresholdScope() { TaggedObject::setParallelArrayThreshold(0); }
+    };
+}
+
+// Without a scope the arrays allocate from the default resource
+TEST(PmrArrayTests, DefaultResource)
+{
+    const PmrTree tree{QByteArray(TREE_JSON)};
+
+    ASSERT_EQ(std::pmr::get_default_resource(), tree.groups.resource());
+    ASSERT_EQ(3, *tree.groups.at(1).items.at(0).value);
+}
+
+// Every array of the tree allocates from the scoped resource, in both parse modes
+TEST(PmrArrayTests, ScopePropagatesIntoNestedArrays)
+{
+    CountingResource resource;
+    TaggedObject::MemoryResourceScope scope(&resource);
+    const PmrTree fromDocument{QByteArray(TREE_JSON)};
+    const PmrTree direct = PmrTree::fromJson(TREE_JSON);
+
+    for (const PmrTree* tree : {&fromDocument, &direct}) {
+        ASSERT_EQ(&resource, tree->groups.resource());
+        for (const PmrGroup& group : *tree->groups)
+            ASSERT_EQ(&resource, group.items.resource());
+    }
+    ASSERT_LT(0, resource.allocations);
+    ASSERT_EQ(fromDocument.toJson(), direct.toJson());
+}
+
+// Scopes nest and restore the previous resource
+TEST(PmrArrayTests, NestedScopes)
+{
+    CountingResource outer;
+    CountingResource inner;
+    TaggedObject::MemoryResourceScope outerScope(&outer);
+    {
+        TaggedObject::MemoryResourceScope innerScope(&inner);
+        ASSERT_EQ(&inner, TaggedObject::memoryResource());
+    }
+    ASSERT_EQ(&outer, TaggedObject::memoryResource());
+}
+
+// Copies leave the arena, so they stay valid after it has been released
+TEST(PmrArrayTests, CopiesUseDefaultResource)
+{
+    PmrTree copy;
+    {
+        std::pmr::monotonic_buffer_resource arena;
+        TaggedObject::MemoryResourceScope scope(&arena);
+        const PmrTree parsed = PmrTree::fromJson(TREE_JSON);
+        copy = PmrTree(parsed);
+    }
+
+    ASSERT_EQ(std::pmr::get_default_resource(), copy.groups.resource());
+    ASSERT_EQ(2, *copy.groups.at(0).items.at(1).value);
+}
+
+// Scoped arrays are built on the calling thread even if the parallel array mode is enabled
+TEST(PmrArrayTests, ScopeDisablesParallelMode)
+{
+    const ParallelThresholdScope threshold(1);
+    QJsonArray items;
+    for (int i = 0; i < 1000; ++i)
+        items.append(QJsonObject{{"value", i}});
+    const QJsonObject group{{"label", "wide"}, {"items", items}};
+
+    CountingResource resource;
+    TaggedObject::MemoryResourceScope scope(&resource);
+    const PmrGroup parsed{group};
+
+    ASSERT_EQ(1000, parsed.items->size());
+    ASSERT_EQ(999, *parsed.items.at(999).value);
+    ASSERT_EQ(&resource, parsed.items.resource());
+}
+
+// A thread inside of a scope that helps the pool runs the tasks of other threads outside of its scope
+TEST(PmrArrayTests, PoolTasksIgnoreTheScopeOfHelpingThread)
+{
+    constexpr qsizetype GROUP_COUNT = 2000;
+    const QJsonObject group{{"label", "a"}, {"items", QJsonArray{QJsonObject{{"value", 1}}, QJsonObject{{"value", 2}}}}};
+    std::vector<std::pmr::memory_resource*> resources(GROUP_COUNT, nullptr);
+    std::atomic<bool> finished{false};
+
+    CountingResource resource;
+    TaggedObject::MemoryResourceScope scope(&resource);
+    std::thread submitter([&] {
+        TaggedObject::parallelFor(GROUP_COUNT, 1, [&](const qsizetype i) {
+            const PmrGroup parsed{group};
+            resources[static_cast<std::size_t>(i)] = parsed.items.resource();
+        });
+        finished = true;
+    });
+    while (!finished)
+        TaggedObject::WorkStealingPool::global().runPendingTask();
+    submitter.join();
+
+    ASSERT_EQ(&resource, TaggedObject::memoryResource());
+    ASSERT_EQ(0, resource.allocations);
+    for (std::pmr::memory_resource* const used : resources)
+        ASSERT_EQ(std::pmr::get_default_resource(), used);
+}
+
+// CBOR decoding allocates from the scoped resource as well
+TEST(PmrArrayTests, Cbor)
+{
+    const QByteArray cbor = PmrTree::fromJson(TREE_JSON).toCbor();
+    CountingResource resource;
+    TaggedObject::MemoryResourceScope scope(&resource);
+    const PmrTree tree = PmrTree::fromCbor(cbor);
+
+    ASSERT_EQ(&resource, tree.groups.at(0).items.resource());
+    ASSERT_EQ(PmrTree::fromJson(TREE_JSON).toJson(), tree.toJson());
+}
+
+#ifdef TJO_ENABLE_MODIFICATION_TRACKING
+// The arrays are tracked like TaggedJSONArray, only the modified ones are in the merge patch
+TEST(PmrArrayTests, ModificationTracking)
+{
+    // Parsing doesn't flag the arrays, the object has no baseline yet
+    PmrTree tree = PmrTree::fromJson(TREE_JSON);
+    ASSERT_FALSE(tree.groups.isModified());
+    ASSERT_TRUE(tree.isModified());
+    tree.clearModified();
+    ASSERT_FALSE(tree.groups.isModified());
+    ASSERT_TRUE(tree.toMergePatch().isEmpty());
+
+    // Const access leaves the arrays unmodified
+    ASSERT_EQ(1, *std::as_const(tree.groups).at(0).items.at(0).value);
+    ASSERT_FALSE(tree.isModified());
+
+    tree.groups[1].items[0].value = 4;
+    ASSERT_TRUE(tree.groups.isModified());
+    const QJsonObject patch = tree.toMergePatch();
+    ASSERT_EQ(QStringList{"groups"}, patch.keys());
+    ASSERT_EQ(4, patch["groups"].toArray().at(1)["items"].toArray().at(0)["value"].toInt());
+    tree.clearModified();
+    ASSERT_FALSE(tree.groups.isModified());
+    ASSERT_TRUE(tree.toMergePatch().isEmpty());
+
+    tree.groups = PmrTree::fromJson(TREE_JSON).groups;
+    ASSERT_TRUE(tree.groups.isModified());
+    tree.parseInto(TREE_JSON);
+    ASSERT_EQ(QStringList{"groups"}, tree.toMergePatch().keys());
+}
+#endif
@@ -0,0 +1,55 @@
+#include "gtest/gtest.h"
+#include "taggedjsonreader.h"
+#include "taggedjsonobject.h"
+#include "taggedjsonarray.h"
+#include "taggedjsonobjectmacros.h"
+
+namespace {
+    TJO_DEFINE_JSON_TAGGED_OBJECT(ReaderRecord,
+                                  (TaggedJSONString, text),
+                                  (TaggedJSONInt, number))
+}
+
+// Escape sequences, surrogate pairs and escaped keys are decoded
+TEST(JsonReaderTests, StringUnescaping)
+{
+    const QByteArray jsonText = R"({"text": "line\nbreak \"quoted\" é 😀", "number": 1})";
+    const ReaderRecord record = ReaderRecord::fromJson(jsonText);
+
+    ASSERT_EQ(QString::fromUtf8("line\nbreak \"quoted\" \xc3\xa9 \xf0\x9f\x98\x80"), *record.text);
+}
+
+// Keys that aren't members of the tagged object are skipped together with their nested values
+TEST(JsonReaderTests, UnknownKeysAreSkipped)
+{
+    const QByteArray jsonText = R"({"skipped": {"a": [1, 2, {"b": "}"}]}, "number": 7, "text": "value"})";
+    const ReaderRecord record = ReaderRecord::fromJson(jsonText);
+
+    ASSERT_EQ(7, *record.number);
+    ASSERT_EQ(QString("value"), *record.text);
+}
+
+// Mismatching types get the same default values as the QJsonValue conversions
+TEST(JsonReaderTests, TypeMismatchDefaults)
+{
+    const QByteArray jsonText = R"({"text": 12, "number": 1.5})";
+    const ReaderRecord direct = ReaderRecord::fromJson(jsonText);
+    const ReaderRecord expected{jsonText};
+
+    ASSERT_EQ(*expected.text, *direct.text);
+    ASSERT_EQ(*expected.number, *direct.number);
+}
+
+// Trailing garbage and missing separators set the error flag of the reader
+TEST(JsonReaderTests, MalformedInputIsReported)
+{
+    const QByteArray trailingText = R"({"a": 1} x)";
+    TaggedObject::JsonReader trailing(trailingText);
+    trailing.skipValue();
+    ASSERT_FALSE(trailing.finish());
+
+    const QByteArray missingCommaText = R"([1 2])";
+    TaggedObject::JsonReader missingComma(missingCommaText);
+    missingComma.skipValue();
+    ASSERT_TRUE(missingComma.hasError());
+}
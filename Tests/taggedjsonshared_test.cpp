@@ -0,0 +1,140 @@
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+#include "taggedjsoncbor.h"
+#include "taggedjsonvalidation.h"
+#include "taggedjsonobject.h"
+#include "taggedjsonarray.h"
+#include "taggedjsonshared.h"
+#include "taggedjsonfields.h"
+#include "taggedjsonobjectmacros.h"
+
+namespace {
+    TJO_DEFINE_JSON_TAGGED_OBJECT(SharedItem,
+                                  (TaggedJSONInt, id),
+                                  (TaggedJSONString, label))
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(SharedCatalog,
+                                  (TaggedJSONString, title),
+                                  (TaggedJSONSharedArray<SharedItem>, items))
+
+    constexpr auto CATALOG = R"({"title": "catalog", "items": [{"id": 1, "label": "a"}, {"id": 2, "label": "b"}, {"id": 3, "label": "c"}]})";
+}
+
+// Copies share the value until one of them is accessed mutably, the others keep the previous value
+TEST(SharedTests, CopyOnWrite)
+{
+    TaggedJSONShared<SharedCatalog> catalog(SharedCatalog::fromJson(CATALOG));
+    TaggedJSONShared<SharedCatalog> snapshot = catalog;
+    ASSERT_TRUE(snapshot.isSharedWith(catalog));
+    ASSERT_FALSE(catalog.isDetached());
+    ASSERT_EQ(&*std::as_const(catalog), &*std::as_const(snapshot));
+
+    (*catalog).title = QString("changed");
+    ASSERT_FALSE(snapshot.isSharedWith(catalog));
+    ASSERT_TRUE(catalog.isDetached());
+    ASSERT_EQ(QString("catalog"), *snapshot->title);
+    ASSERT_EQ(QString("changed"), *catalog->title);
+    // The nested array is still shared by the two catalogs
+    ASSERT_TRUE(catalog->items.isSharedWith(snapshot->items));
+
+    (**(*catalog).items)[0].id = 10;
+    ASSERT_FALSE(catalog->items.isSharedWith(snapshot->items));
+    ASSERT_EQ(1, *snapshot->items->at(0).id);
+    ASSERT_EQ(10, *catalog->items->at(0).id);
+
+    // The default constructed instances share the default value, the moved-from ones get it back
+    TaggedJSONShared<SharedCatalog> empty;
+    ASSERT_TRUE(empty.isSharedWith(TaggedJSONShared<SharedCatalog>()));
+    TaggedJSONShared<SharedCatalog> moved = std::move(snapshot);
+    ASSERT_TRUE(snapshot.isSharedWith(empty));
+    ASSERT_EQ(QString("catalog"), *moved->title);
+}
+
+// As a member it keeps the JSON, CBOR and validation behavior of the stored type, copies of the object share it
+TEST(SharedTests, Member)
+{
+    const QJsonObject json = QJsonDocument::fromJson(CATALOG).object();
+    SharedCatalog catalog(json);
+    ASSERT_EQ(json, catalog.toJsonObject());
+    ASSERT_EQ(json, SharedCatalog::fromJson(catalog.toJson()).toJsonObject());
+    ASSERT_EQ(json, SharedCatalog::fromCbor(catalog.toCbor()).toJsonObject());
+    ASSERT_EQ(TaggedObject::FieldKind::Array, TaggedObject::fieldKind<TaggedJSONSharedArray<SharedItem>>());
+
+#ifdef TJO_ENABLE_MODIFICATION_TRACKING
+    catalog.clearModified();
+#endif
+    SharedCatalog copy = catalog;
+    ASSERT_TRUE(copy.items.isSharedWith(catalog.items));
+#ifdef TJO_ENABLE_MODIFICATION_TRACKING
+    ASSERT_TRUE(copy.toMergePatch().isEmpty());
+#endif
+
+    // The copy detaches, only the modified member is in its patch
+    (**copy.items).pop_back();
+    ASSERT_EQ(2, static_cast<int>((*std::as_const(copy.items))->size()));
+#ifdef TJO_ENABLE_MODIFICATION_TRACKING
+    const QJsonObject patch = copy.toMergePatch();
+    ASSERT_EQ(QStringList{"items"}, patch.keys());
+    ASSERT_EQ(2, patch["items"].toArray().size());
+#endif
+    ASSERT_EQ(3, *catalog.items->at(2).id);
+
+    copy.parseInto(CATALOG);
+    ASSERT_EQ(json, copy.toJsonObject());
+    copy.assign(QJsonDocument::fromJson(R"({"title": "t", "items": []})").object());
+    ASSERT_TRUE((*std::as_const(copy.items))->empty());
+    ASSERT_EQ(3, static_cast<int>((*catalog.items)->size()));
+
+    ASSERT_THROW(SharedCatalog(QJsonDocument::fromJson(R"({"title": "t", "items": [{"id": 1}]})").object()), std::runtime_error);
+    ASSERT_FALSE(SharedCatalog::tryFromJson(R"({"title": "t", "items": [{"id": 1}]})").hasValue());
+}
+
+// The snapshots are read and serialized on other threads while the original is modified
+TEST(SharedTests, Snapshots)
+{
+    SharedCatalog catalog = SharedCatalog::fromJson(CATALOG);
+    const QJsonObject expected = catalog.toJsonObject();
+
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 4; ++i) {
+        readers.emplace_back([snapshot = catalog, &expected] {
+            for (int j = 0; j < 100; ++j) {
+                EXPECT_EQ(expected["items"], snapshot.items.toJsonValue());
+                EXPECT_EQ(6, *snapshot.items->at(0).id + *snapshot.items->at(1).id + *snapshot.items->at(2).id);
+            }
+        });
+    }
+    for (int j = 0; j < 100; ++j)
+        (**catalog.items).push_back(SharedItem(QJsonDocument::fromJson(R"({"id": 4, "label": "d"})").object()));
+    for (std::thread& reader : readers)
+        reader.join();
+
+    ASSERT_EQ(103, static_cast<int>((*std::as_const(catalog.items))->size()));
+}
+
+// The const methods of the stored value don't write to it, the snapshots are serialized directly from several threads
+TEST(SharedTests, ConcurrentSerialization)
+{
+    TaggedJSONShared<SharedCatalog> catalog(SharedCatalog::fromJson(CATALOG));
+    const QJsonObject expected = catalog->toJsonObject();
+
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 4; ++i) {
+        readers.emplace_back([snapshot = catalog, &expected] {
+            for (int j = 0; j < 100; ++j) {
+                EXPECT_EQ(expected, snapshot->toJsonObject());
+#ifdef TJO_ENABLE_MODIFICATION_TRACKING
+                EXPECT_EQ(expected, snapshot->toMergePatch());
+#endif
+                EXPECT_EQ(expected["items"], snapshot->items->toJsonValue());
+            }
+        });
+    }
+    for (int j = 0; j < 100; ++j)
+        (*catalog).title = QString::number(j);
+    for (std::thread& reader : readers)
+        reader.join();
+
+    ASSERT_EQ(QString("99"), *catalog->title);
+}
@@ -0,0 +1,145 @@
+#include <sstream>
+#include "gtest/gtest.h"
+#include "taggedjsoncbor.h"
+#include "taggedjsonstringview.h"
+#include "taggedjsonobject.h"
+#include "taggedjsonobjectmacros.h"
+
+namespace {
+    constexpr auto MESSAGE_JSON = R"({"topic": "sensors/temperature", "body": "line\none \"quoted\" é", "unicode": "héllo wörld", "count": 3})";
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(ViewMessage,
+                                  (TaggedJSONStringView, topic),
+                                  (TaggedJSONStringView, body),
+                                  (TaggedJSONStringView, unicode),
+                                  (TaggedJSONInt, count))
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(StringMessage,
+                                  (TaggedJSONString, topic),
+                                  (TaggedJSONString, body),
+                                  (TaggedJSONString, unicode),
+                                  (TaggedJSONInt, count))
+}
+
+// Direct binding refers to the source text, escape sequences included
+TEST(StringViewTests, RefersToSource)
+{
+    const QByteArray json = MESSAGE_JSON;
+    const ViewMessage message = ViewMessage::fromJson(json);
+
+    ASSERT_TRUE(message.topic.isView());
+    ASSERT_FALSE(message.topic.isEscaped());
+    ASSERT_TRUE(message.body.isEscaped());
+    ASSERT_EQ(std::string_view(R"(line\none \"quoted\" é)"), message.body.rawUtf8());
+}
+
+// Decoding gives the same strings as TaggedJSONString
+TEST(StringViewTests, DecodesOnRequest)
+{
+    const QByteArray json = MESSAGE_JSON;
+    const ViewMessage view = ViewMessage::fromJson(json);
+    const StringMessage expected = StringMessage::fromJson(json);
+
+    ASSERT_EQ(*expected.topic, view.topic.toString());
+    ASSERT_EQ(*expected.body, view.body.toString());
+    ASSERT_EQ(*expected.unicode, view.unicode.toString());
+    ASSERT_EQ(expected.body->toUtf8(), view.body.toUtf8());
+}
+
+// Comparisons work on the bytes, decoding only the escaped strings
+TEST(StringViewTests, Comparisons)
+{
+    const QByteArray json = MESSAGE_JSON;
+    const ViewMessage message = ViewMessage::fromJson(json);
+
+    ASSERT_TRUE(message.topic == "sensors/temperature");
+    ASSERT_TRUE(message.topic != "sensors");
+    ASSERT_TRUE(message.body == "line\none \"quoted\" é");
+    ASSERT_TRUE(message.unicode == QString::fromUtf8("héllo wörld"));
+    ASSERT_TRUE(message.topic == TaggedJSONStringView(QString("sensors/temperature")));
+}
+
+// The view keeps the source alive, even if it was a temporary
+TEST(StringViewTests, SharesTemporarySource)
+{
+    const ViewMessage message = ViewMessage::fromJson(QByteArray(MESSAGE_JSON));
+
+    ASSERT_EQ("sensors/temperature", message.topic.toString());
+}
+
+// Readers over raw memory copy the quoted text, the views stay valid after the memory is gone
+TEST(StringViewTests, CopiesRawMemory)
+{
+    ViewMessage message;
+    {
+        const std::string text = MESSAGE_JSON;
+        TaggedObject::JsonReader reader(text.data(), static_cast<qsizetype>(text.size()));
+        message.readJson(reader);
+    }
+
+    ASSERT_TRUE(message.body.isView());
+    ASSERT_EQ(StringMessage::fromJson(MESSAGE_JSON).toJson(), message.toJson());
+}
+
+// Serialization gives the same text as TaggedJSONString in both paths
+TEST(StringViewTests, Serialization)
+{
+    const QByteArray json = MESSAGE_JSON;
+    const ViewMessage view = ViewMessage::fromJson(json);
+    const StringMessage expected = StringMessage::fromJson(json);
+
+    ASSERT_EQ(expected.toJson(), view.toJson());
+    ASSERT_EQ(expected.toJson(QJsonDocument::Compact), view.toJson(QJsonDocument::Compact));
+    ASSERT_EQ(expected.toJsonObject(), view.toJsonObject());
+}
+
+// Invalid UTF-8 in the source is decoded before it's used, the invalid sequences end up as U+FFFD like in TaggedJSONString
+TEST(StringViewTests, InvalidUtf8)
+{
+    const QByteArray json = "{\"topic\": \"bad \xff byte\", \"body\": \"cut \xc3\", \"unicode\": \"\xed\xa0\x80\", \"count\": 1}";
+    const ViewMessage view = ViewMessage::fromJson(json);
+    const StringMessage expected = StringMessage::fromJson(json);
+
+    ASSERT_TRUE(view.topic.isView());
+    ASSERT_FALSE(view.topic.isEscaped());
+    ASSERT_EQ(*expected.topic, view.topic.toString());
+    ASSERT_EQ(expected.topic->toUtf8(), view.topic.toUtf8());
+    ASSERT_TRUE(view.topic == "bad \xef\xbf\xbd byte");
+    ASSERT_TRUE(view.topic == TaggedJSONStringView(QString::fromUtf8("bad \xef\xbf\xbd byte")));
+    ASSERT_EQ(expected.toJson(), view.toJson());
+    ASSERT_EQ(expected.toJson(QJsonDocument::Compact), view.toJson(QJsonDocument::Compact));
+    ASSERT_FALSE(view.toJson().contains('\xff'));
+}
+
+// The QJsonValue and the CBOR paths hold the decoded string
+TEST(StringViewTests, DecodedSources)
+{
+    const QByteArray json = MESSAGE_JSON;
+    const ViewMessage fromDocument{json};
+    const ViewMessage fromCbor = ViewMessage::fromCbor(fromDocument.toCbor());
+
+    ASSERT_FALSE(fromDocument.topic.isView());
+    ASSERT_EQ(StringMessage::fromJson(json).toJson(), fromDocument.toJson());
+    ASSERT_EQ(fromDocument.toJson(), fromCbor.toJson());
+}
+
+// Values that aren't strings end up as empty strings, the same as TaggedJSONString
+TEST(StringViewTests, MismatchingType)
+{
+    const QByteArray json = R"({"topic": 12, "body": null, "unicode": [], "count": 1})";
+    const ViewMessage message = ViewMessage::fromJson(json);
+
+    ASSERT_TRUE(message.topic.isEmpty());
+    ASSERT_EQ(StringMessage::fromJson(json).toJson(), message.toJson());
+}
+
+// Stream output writes the decoded UTF-8 text
+TEST(StringViewTests, StdOut)
+{
+    const QByteArray json = MESSAGE_JSON;
+    const ViewMessage message = ViewMessage::fromJson(json);
+    std::ostringstream stream;
+    stream << message.topic;
+
+    ASSERT_EQ("sensors/temperature", stream.str());
+}
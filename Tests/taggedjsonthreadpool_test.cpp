@@ -0,0 +1,47 @@
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include "gtest/gtest.h"
+#include "taggedjsonthreadpool.h"
+
+namespace {
+    constexpr qsizetype INDEX_COUNT = 10000;
+}
+
+// Every index is visited exactly once
+TEST(ThreadPoolTests, ParallelForVisitsEveryIndex)
+{
+    std::vector<std::atomic<int>> visits(INDEX_COUNT);
+    TaggedObject::parallelFor(INDEX_COUNT, 16, [&](const qsizetype i) { ++visits[static_cast<std::size_t>(i)]; });
+
+    for (const std::atomic<int>& count : visits)
+        ASSERT_EQ(1, count.load());
+}
+
+// The exception of the lowest failing index is rethrown, whatever order the tasks have run in
+TEST(ThreadPoolTests, ParallelForExceptionIsDeterministic)
+{
+    for (int repeat = 0; repeat < 20; ++repeat) {
+        try {
+            TaggedObject::parallelFor(INDEX_COUNT, 1, [](const qsizetype i) {
+                if (i % 1000 == 999)
+                    throw std::runtime_error(std::to_string(i));
+            });
+            FAIL();
+        }
+        catch (const std::runtime_error& e) {
+            ASSERT_EQ(std::string("999"), e.what());
+        }
+    }
+}
+
+// parallelFor can be called from the tasks of another parallelFor
+TEST(ThreadPoolTests, NestedParallelFor)
+{
+    std::atomic<qsizetype> total{0};
+    TaggedObject::parallelFor(64, 1, [&](const qsizetype) {
+        TaggedObject::parallelFor(100, 10, [&](const qsizetype) { ++total; });
+    });
+
+    ASSERT_EQ(6400, total.load());
+}
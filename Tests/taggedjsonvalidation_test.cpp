@@ -0,0 +1,118 @@
+#include "gtest/gtest.h"
+#include "taggedjsonvalidation.h"
+#include "taggedjsonobject.h"
+#include "taggedjsonarray.h"
+#include "taggedjsonvector.h"
+#include "taggedjsonobjectmacros.h"
+
+namespace {
+    TJO_DEFINE_JSON_TAGGED_OBJECT(ValidatedPosition,
+                                  (TaggedJSONDouble, x),
+                                  (TaggedJSONDouble, y))
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(ValidatedShip,
+                                  (TaggedJSONInt, id),
+                                  (TaggedJSONString, label),
+                                  (ValidatedPosition, position))
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(ValidatedFleet,
+                                  (TaggedJSONString, name),
+                                  (TaggedJSONBool, active),
+                                  (TaggedJSONIntArray, codes),
+                                  (TaggedJSONVector<double>, weights),
+                                  (TaggedJSONArray<ValidatedShip>, ships))
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(ValidatedCounters,
+                                  (TaggedJSONInt64, signedValue),
+                                  (TaggedJSONUInt64, unsignedValue))
+
+    constexpr auto VALID_FLEET = R"({"name": "fleet", "active": true, "codes": [1, 2], "weights": [0.5],
+                                     "ships": [{"id": 1, "label": "a", "position": {"x": 1, "y": 2}}]})";
+
+    QStringList messages(const TaggedObject::ValidationErrors& errors)
+    {
+        QStringList ret;
+        for (const TaggedObject::ValidationError& error : errors)
+            ret.push_back(error.message());
+        return ret;
+    }
+}
+
+// A valid document gives the same object as the strict constructor
+TEST(ValidationTests, ValidDocument)
+{
+    const auto result = ValidatedFleet::tryFromJson(VALID_FLEET);
+    ASSERT_TRUE(result.hasValue());
+    ASSERT_TRUE(result.errors().empty());
+    ASSERT_EQ(result->toJsonObject(), ValidatedFleet(QByteArray(VALID_FLEET)).toJsonObject());
+    ASSERT_EQ(1, *result.value().ships.at(0).id);
+}
+
+// Every missing member is reported with its path, not only the first one
+TEST(ValidationTests, MissingMembers)
+{
+    const QJsonObject obj = QJsonDocument::fromJson(R"({"name": "fleet", "ships": [{"id": 1, "position": {"x": 1}}, {"label": "b"}]})").object();
+    ASSERT_THROW(ValidatedFleet strict(obj), std::runtime_error);
+
+    const auto result = ValidatedFleet::tryFrom(obj);
+    ASSERT_FALSE(result);
+    const QStringList expected{"$.active: missing",
+                               "$.codes: missing",
+                               "$.weights: missing",
+                               "$.ships[0].label: missing",
+                               "$.ships[0].position.y: missing",
+                               "$.ships[1].id: missing",
+                               "$.ships[1].position: missing"};
+    ASSERT_EQ(expected, messages(result.errors()));
+    ASSERT_EQ(TaggedObject::ValidationError::Kind::MissingField, result.errors().front().kind);
+}
+
+// Values of another type are reported with the expected type, the strict constructors would take the default value
+TEST(ValidationTests, TypeMismatches)
+{
+    const QJsonObject obj = QJsonDocument::fromJson(R"({"name": 7, "active": "yes", "codes": [1, 2.5, "3"], "weights": {},
+                                                        "ships": [{"id": 1.5, "label": "a", "position": [1, 2]}]})").object();
+    const QStringList expected{"$.name: expected string",
+                               "$.active: expected boolean",
+                               "$.codes[1]: expected integer",
+                               "$.codes[2]: expected integer",
+                               "$.weights: expected array",
+                               "$.ships[0].id: expected integer",
+                               "$.ships[0].position: expected object"};
+    ASSERT_EQ(expected, messages(ValidatedFleet::validate(obj)));
+    ASSERT_EQ(std::string_view("string"), ValidatedFleet::validate(obj).front().expected);
+}
+
+// The 64-bit bounds are the ones of the conversions, 2^63 and 2^64 are rounded doubles that would convert to 0
+TEST(ValidationTests, IntegerRange)
+{
+    const QStringList expected{"$.signedValue: expected integer", "$.unsignedValue: expected integer"};
+    ASSERT_EQ(expected, messages(ValidatedCounters::validate(QJsonDocument::fromJson(
+        R"({"signedValue": 9223372036854775808, "unsignedValue": 18446744073709551616})").object())));
+    ASSERT_EQ(expected, messages(ValidatedCounters::validate(QJsonObject{{"signedValue", 9223372036854775808.0},
+                                                                         {"unsignedValue", -1}})));
+    ASSERT_TRUE(ValidatedCounters::validate(QJsonDocument::fromJson(
+        R"({"signedValue": -9223372036854775808, "unsignedValue": 9223372036854775807})").object()).empty());
+    ASSERT_FALSE(ValidatedCounters::tryFromJson(R"({"signedValue": 1, "unsignedValue": 18446744073709551616})").hasValue());
+}
+
+// Malformed text and documents that aren't objects are reported at the document
+TEST(ValidationTests, MalformedDocument)
+{
+    const auto malformed = ValidatedFleet::tryFromJson(R"({"name": )");
+    ASSERT_FALSE(malformed.hasValue());
+    ASSERT_EQ(1u, malformed.errors().size());
+    ASSERT_EQ(TaggedObject::ValidationError::Kind::MalformedDocument, malformed.errors()[0].kind);
+    ASSERT_EQ(QString("$"), malformed.errors()[0].path);
+
+    const auto array = ValidatedFleet::tryFromJson("[1, 2]");
+    ASSERT_EQ(QStringList{"$: expected object"}, messages(array.errors()));
+}
+
+// value() of a failed result throws with the first error
+TEST(ValidationTests, ValueOfFailedResult)
+{
+    const auto result = ValidatedShip::tryFrom(QJsonObject{{"id", 1}, {"label", "a"}});
+    ASSERT_FALSE(result);
+    ASSERT_THROW(result.value(), std::runtime_error);
+}
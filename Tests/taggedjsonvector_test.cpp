@@ -0,0 +1,66 @@
+#include <numeric>
+#include "gtest/gtest.h"
+#include "taggedjsonvector.h"
+#include "taggedjsonarray.h"
+#include "taggedjsonobjectmacros.h"
+
+namespace {
+    constexpr auto SERIES_JSON = R"({"samples": [1.5, 2.5, -1, 4], "counts": [1, 2, 3, 2.5, "x"], "flags": [true, false, 1]})";
+    constexpr auto TYPED_SERIES_JSON = R"({"samples": [1.5, 2.5, -1, 4, 1e21], "counts": [1, 2, -3], "flags": [true, false]})";
+    constexpr double EXPECTED_SAMPLE_SUM = 7.0;
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(SeriesRecord,
+                                  (TaggedJSONDoubleVector, samples),
+                                  (TaggedJSONIntVector, counts),
+                                  (TaggedJSONBoolVector, flags))
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(SeriesArrayRecord,
+                                  (TaggedJSONDoubleArray, samples),
+                                  (TaggedJSONIntArray, counts),
+                                  (TaggedJSONBoolArray, flags))
+}
+
+// Elements are stored contiguously and can be reached through a raw pointer
+TEST(TaggedVectorTests, ContiguousAccess)
+{
+    const SeriesRecord record{QByteArray(SERIES_JSON)};
+
+    ASSERT_EQ(4, record.samples.size());
+    const double* begin = record.samples.data();
+    ASSERT_EQ(EXPECTED_SAMPLE_SUM, std::accumulate(begin, begin + record.samples.size(), 0.0));
+    ASSERT_EQ(2.5, record.samples[1]);
+}
+
+// Both parse modes give the same elements as the QJsonArray backed arrays, mismatching types included
+TEST(TaggedVectorTests, ConversionsMatchTaggedArray)
+{
+    const QByteArray json = SERIES_JSON;
+    const SeriesArrayRecord expected{json};
+    const SeriesRecord fromDocument{json};
+    const SeriesRecord direct = SeriesRecord::fromJson(json);
+
+    ASSERT_EQ(expected.samples.toStdVector(), *fromDocument.samples);
+    ASSERT_EQ(expected.counts.toStdVector(), *fromDocument.counts);
+    ASSERT_EQ(expected.flags.toStdVector(), *fromDocument.flags);
+    ASSERT_EQ(*fromDocument.samples, *direct.samples);
+    ASSERT_EQ(*fromDocument.counts, *direct.counts);
+    ASSERT_EQ(*fromDocument.flags, *direct.flags);
+}
+
+// QJsonArray is only built on request and serializes the same way as the QJsonArray backed arrays
+TEST(TaggedVectorTests, SerializationMatchesTaggedArray)
+{
+    const QByteArray json = TYPED_SERIES_JSON;
+    const SeriesArrayRecord expected{json};
+    const SeriesRecord record{json};
+
+    ASSERT_EQ(expected.toJsonObject(), record.toJsonObject());
+    ASSERT_EQ(expected.toJson(QJsonDocument::Compact), record.toJson(QJsonDocument::Compact));
+}
+
+// Missing arrays throw if the values are checked
+TEST(TaggedVectorTests, MissingArrayStrictTestFail)
+{
+    ASSERT_THROW(TaggedJSONDoubleVector(QJsonValue(QJsonValue::Undefined)), std::runtime_error);
+    ASSERT_NO_THROW(TaggedJSONDoubleVector(QJsonValue(QJsonValue::Undefined), false));
+}
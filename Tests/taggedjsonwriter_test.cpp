@@ -0,0 +1,109 @@
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+#include "gtest/gtest.h"
+#include "taggedjsonwriter.h"
+#include "taggedjsonobject.h"
+#include "taggedjsonarray.h"
+#include "taggedjsonobjectmacros.h"
+
+namespace {
+    TJO_DEFINE_JSON_TAGGED_OBJECT(WriterItem,
+                                  (TaggedJSONString, label),
+                                  (TaggedJSONDouble, weight))
+
+    TJO_DEFINE_JSON_TAGGED_OBJECT(WriterRecord,
+                                  (TaggedJSONString, text),
+                                  (TaggedJSONInt, number),
+                                  (TaggedJSONDouble, ratio),
+                                  (TaggedJSONBool, flag),
+                                  (WriterItem, nested),
+                                  (TaggedJSONValue, any),
+                                  (TaggedQJsonObject, object),
+                                  (TaggedJSONIntArray, numbers),
+                                  (TaggedJSONArray<WriterItem>, items))
+
+    QByteArray viaDocument(const WriterRecord& record, const QJsonDocument::JsonFormat format)
+    {
+        return QJsonDocument(record.toJsonObject()).toJson(format);
+    }
+}
+
+// Direct serialization gives the same bytes as QJsonDocument, in both formats
+TEST(JsonWriterTests, MatchesQJsonDocument)
+{
+    const QByteArray jsonText = R"({"text": "tab\t \"quoted\" back\\slash / \u0001 é 😀", "number": -42, "ratio": 0.1, "flag": true,
+                                    "nested": {"label": "inner", "weight": 1e21}, "any": [1, 2.5, null, "x", {"b": [], "a": {}}],
+                                    "object": {"z": 1, "y": [true, false]}, "numbers": [3, 2, 1],
+                                    "items": [{"label": "first", "weight": 0.5}, {"label": "second", "weight": -3}]})";
+    const WriterRecord record = WriterRecord::fromJson(jsonText);
+
+    ASSERT_EQ(viaDocument(record, QJsonDocument::Compact), record.toJson(QJsonDocument::Compact));
+    ASSERT_EQ(viaDocument(record, QJsonDocument::Indented), record.toJson(QJsonDocument::Indented));
+}
+
+// Empty containers and non-finite numbers follow the QJsonDocument formatting
+TEST(JsonWriterTests, EmptyContainersAndNonFiniteNumbers)
+{
+    WriterRecord record;
+    record.ratio = std::numeric_limits<double>::quiet_NaN();
+    record.nested.weight = std::numeric_limits<double>::infinity();
+
+    ASSERT_EQ(viaDocument(record, QJsonDocument::Compact), record.toJson(QJsonDocument::Compact));
+    ASSERT_EQ(viaDocument(record, QJsonDocument::Indented), record.toJson(QJsonDocument::Indented));
+}
+
+// Undefined values drop their key the same way QJsonObject::insert() does
+TEST(JsonWriterTests, UndefinedValuesAreDropped)
+{
+    WriterRecord record;
+    record.any = QJsonValue(QJsonValue::Undefined);
+
+    ASSERT_FALSE(record.toJson(QJsonDocument::Compact).contains("\"any\""));
+    ASSERT_EQ(viaDocument(record, QJsonDocument::Indented), record.toJson(QJsonDocument::Indented));
+}
+
+// writeJson() appends to the given buffer, so it can be reused for several objects
+TEST(JsonWriterTests, WriteJsonAppends)
+{
+    WriterItem item;
+    item.label = "label";
+    item.weight = 2;
+
+    QByteArray buffer = "prefix:";
+    item.writeJson(buffer, QJsonDocument::Compact);
+
+    ASSERT_EQ(QByteArray(R"(prefix:{"label":"label","weight":2})"), buffer);
+}
+
+// Doubles of every magnitude are written the same way as QJsonDocument writes them, random bit patterns included
+TEST(JsonWriterTests, DoublesMatchQJsonDocument)
+{
+    std::vector<double> values = { 0.0, -0.0, 0.1, 1.0 / 3.0, 9007199254740992.0, 9007199254740993.0, 1e21, 123456789012345680.0,
+                                   std::numeric_limits<double>::min(), std::numeric_limits<double>::max(),
+                                   std::numeric_limits<double>::denorm_min(), std::numeric_limits<double>::epsilon() };
+    for (int exponent = -320; exponent <= 308; ++exponent) {
+        const double power = std::pow(10.0, exponent);
+        values.push_back(power);
+        values.push_back(-1.5 * power);
+        values.push_back(std::nextafter(power, 0.0));
+    }
+    std::mt19937_64 random(1234);
+    while (values.size() < 20000) {
+        const quint64 bits = random();
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        if (std::isfinite(value))
+            values.push_back(value);
+    }
+
+    for (const double value : values) {
+        const QJsonArray array{ value };
+        QByteArray direct;
+        TaggedObject::JsonWriter writer(direct, QJsonDocument::Compact);
+        writer.writeArray(array);
+        ASSERT_EQ(QJsonDocument(array).toJson(QJsonDocument::Compact), direct);
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Created by William Swanson in 2012.
+ * Based on the MAP macro created by William Swanson in 2012 (https://github.com/swansontec/map-macro), which he dedicated to the public domain:
  *
  * I, William Swanson, dedicate this work to the public domain.
  * I waive all rights to the work worldwide under copyright law,
@@ -10,45 +10,2137 @@
  * even for commercial purposes, all without asking permission.
  */
 
+/*
+ * The end of the arguments is detected by peeking at the next argument the way the original does (MAP_GET_END, MAP_NEXT). The original EVAL based
+ * recursion rescans its whole output a fixed 365 times whatever the number of arguments is, which also caps the number of arguments. The arguments
+ * are walked by a chain of distinct macros (MAP_I0, MAP_I1, ...) instead, each step is expanded once as no macro of the chain is expanded inside
+ * itself, so the work is proportional to the number of arguments. The chain has MAP_MAX_ARGUMENTS steps, an argument beyond them ends up in a
+ * static_assert.
+ *
+ * This file is generated by tools/generate_map.cmake, change the script and run it (or the generate_map_h target) instead of editing the file.
+ */
+
 #ifndef MAP_H_INCLUDED
 #define MAP_H_INCLUDED
 
-#define EVAL0(...) __VA_ARGS__
-#define EVAL1(...) EVAL0(EVAL0(EVAL0(__VA_ARGS__)))
-#define EVAL2(...) EVAL1(EVAL1(EVAL1(__VA_ARGS__)))
-#define EVAL3(...) EVAL2(EVAL2(EVAL2(__VA_ARGS__)))
-#define EVAL4(...) EVAL3(EVAL3(EVAL3(__VA_ARGS__)))
-#define EVAL(...)  EVAL4(EVAL4(EVAL4(__VA_ARGS__)))
+#define MAP_MAX_ARGUMENTS 1024
 
 #define MAP_END(...)
-#define MAP_OUT
-#define MAP_COMMA ,
+#define MAP_COMMA() ,
+#define MAP_NOTHING()
 
 #define MAP_GET_END2() 0, MAP_END
 #define MAP_GET_END1(...) MAP_GET_END2
 #define MAP_GET_END(...) MAP_GET_END1
-#define MAP_NEXT0(test, next, ...) next MAP_OUT
-#define MAP_NEXT1(test, next) MAP_NEXT0(test, next, 0)
-#define MAP_NEXT(test, next)  MAP_NEXT1(MAP_GET_END test, next)
+#define MAP_NEXT0(test, next, ...) next
+#define MAP_NEXT(peek, sep, next) MAP_NEXT1(MAP_GET_END peek, sep, next)
 
-#define MAP0(f, x, peek, ...) f(x) MAP_NEXT(peek, MAP1)(f, peek, __VA_ARGS__)
-#define MAP1(f, x, peek, ...) f(x) MAP_NEXT(peek, MAP0)(f, peek, __VA_ARGS__)
+#define MAP_CALL(f, i, x) f(x)
+#define MAP_CALL_INDEXED(f, i, x) f(i, x)
 
-#define MAP_LIST_NEXT1(test, next) MAP_NEXT0(test, MAP_COMMA next, 0)
-#define MAP_LIST_NEXT(test, next)  MAP_LIST_NEXT1(MAP_GET_END test, next)
+/*
+ * The traditional preprocessor of MSVC passes the commas of __VA_ARGS__ and of expanded arguments on inside a single argument, so the steps would
+ * never see more than one argument. MAP_EXPAND rescans every call that takes them, which splits them again. /Zc:preprocessor selects the conforming
+ * preprocessor, defining MAP_TRADITIONAL_PREPROCESSOR selects the rescanning chain with any compiler.
+ */
+#if defined(_MSC_VER) && (!defined(_MSVC_TRADITIONAL) || _MSVC_TRADITIONAL) && !defined(MAP_TRADITIONAL_PREPROCESSOR)
+#define MAP_TRADITIONAL_PREPROCESSOR
+#endif
+
+#ifdef MAP_TRADITIONAL_PREPROCESSOR
+#define MAP_EXPAND(...) __VA_ARGS__
+#define MAP_NEXT1(test, sep, next) MAP_EXPAND(MAP_NEXT0(test, sep() next, 0))
+#define MAP_APPLY(m, f, sep, ...) MAP_EXPAND(MAP_I0(m, f, sep, __VA_ARGS__, ()()(), ()()(), ()()(), 0))
+
+//Step i calls m(f, i, x) for the argument x, inserts sep() if there is a next argument and continues with step i + 1
+#define MAP_I0(m, f, sep, x, peek, ...) m(f, 0, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I1)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I1(m, f, sep, x, peek, ...) m(f, 1, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I2)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I2(m, f, sep, x, peek, ...) m(f, 2, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I3)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I3(m, f, sep, x, peek, ...) m(f, 3, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I4)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I4(m, f, sep, x, peek, ...) m(f, 4, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I5)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I5(m, f, sep, x, peek, ...) m(f, 5, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I6)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I6(m, f, sep, x, peek, ...) m(f, 6, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I7)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I7(m, f, sep, x, peek, ...) m(f, 7, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I8)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I8(m, f, sep, x, peek, ...) m(f, 8, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I9)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I9(m, f, sep, x, peek, ...) m(f, 9, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I10)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I10(m, f, sep, x, peek, ...) m(f, 10, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I11)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I11(m, f, sep, x, peek, ...) m(f, 11, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I12)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I12(m, f, sep, x, peek, ...) m(f, 12, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I13)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I13(m, f, sep, x, peek, ...) m(f, 13, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I14)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I14(m, f, sep, x, peek, ...) m(f, 14, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I15)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I15(m, f, sep, x, peek, ...) m(f, 15, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I16)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I16(m, f, sep, x, peek, ...) m(f, 16, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I17)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I17(m, f, sep, x, peek, ...) m(f, 17, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I18)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I18(m, f, sep, x, peek, ...) m(f, 18, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I19)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I19(m, f, sep, x, peek, ...) m(f, 19, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I20)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I20(m, f, sep, x, peek, ...) m(f, 20, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I21)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I21(m, f, sep, x, peek, ...) m(f, 21, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I22)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I22(m, f, sep, x, peek, ...) m(f, 22, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I23)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I23(m, f, sep, x, peek, ...) m(f, 23, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I24)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I24(m, f, sep, x, peek, ...) m(f, 24, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I25)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I25(m, f, sep, x, peek, ...) m(f, 25, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I26)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I26(m, f, sep, x, peek, ...) m(f, 26, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I27)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I27(m, f, sep, x, peek, ...) m(f, 27, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I28)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I28(m, f, sep, x, peek, ...) m(f, 28, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I29)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I29(m, f, sep, x, peek, ...) m(f, 29, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I30)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I30(m, f, sep, x, peek, ...) m(f, 30, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I31)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I31(m, f, sep, x, peek, ...) m(f, 31, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I32)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I32(m, f, sep, x, peek, ...) m(f, 32, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I33)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I33(m, f, sep, x, peek, ...) m(f, 33, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I34)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I34(m, f, sep, x, peek, ...) m(f, 34, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I35)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I35(m, f, sep, x, peek, ...) m(f, 35, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I36)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I36(m, f, sep, x, peek, ...) m(f, 36, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I37)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I37(m, f, sep, x, peek, ...) m(f, 37, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I38)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I38(m, f, sep, x, peek, ...) m(f, 38, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I39)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I39(m, f, sep, x, peek, ...) m(f, 39, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I40)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I40(m, f, sep, x, peek, ...) m(f, 40, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I41)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I41(m, f, sep, x, peek, ...) m(f, 41, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I42)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I42(m, f, sep, x, peek, ...) m(f, 42, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I43)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I43(m, f, sep, x, peek, ...) m(f, 43, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I44)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I44(m, f, sep, x, peek, ...) m(f, 44, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I45)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I45(m, f, sep, x, peek, ...) m(f, 45, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I46)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I46(m, f, sep, x, peek, ...) m(f, 46, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I47)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I47(m, f, sep, x, peek, ...) m(f, 47, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I48)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I48(m, f, sep, x, peek, ...) m(f, 48, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I49)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I49(m, f, sep, x, peek, ...) m(f, 49, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I50)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I50(m, f, sep, x, peek, ...) m(f, 50, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I51)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I51(m, f, sep, x, peek, ...) m(f, 51, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I52)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I52(m, f, sep, x, peek, ...) m(f, 52, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I53)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I53(m, f, sep, x, peek, ...) m(f, 53, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I54)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I54(m, f, sep, x, peek, ...) m(f, 54, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I55)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I55(m, f, sep, x, peek, ...) m(f, 55, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I56)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I56(m, f, sep, x, peek, ...) m(f, 56, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I57)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I57(m, f, sep, x, peek, ...) m(f, 57, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I58)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I58(m, f, sep, x, peek, ...) m(f, 58, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I59)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I59(m, f, sep, x, peek, ...) m(f, 59, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I60)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I60(m, f, sep, x, peek, ...) m(f, 60, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I61)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I61(m, f, sep, x, peek, ...) m(f, 61, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I62)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I62(m, f, sep, x, peek, ...) m(f, 62, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I63)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I63(m, f, sep, x, peek, ...) m(f, 63, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I64)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I64(m, f, sep, x, peek, ...) m(f, 64, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I65)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I65(m, f, sep, x, peek, ...) m(f, 65, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I66)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I66(m, f, sep, x, peek, ...) m(f, 66, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I67)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I67(m, f, sep, x, peek, ...) m(f, 67, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I68)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I68(m, f, sep, x, peek, ...) m(f, 68, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I69)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I69(m, f, sep, x, peek, ...) m(f, 69, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I70)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I70(m, f, sep, x, peek, ...) m(f, 70, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I71)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I71(m, f, sep, x, peek, ...) m(f, 71, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I72)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I72(m, f, sep, x, peek, ...) m(f, 72, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I73)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I73(m, f, sep, x, peek, ...) m(f, 73, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I74)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I74(m, f, sep, x, peek, ...) m(f, 74, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I75)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I75(m, f, sep, x, peek, ...) m(f, 75, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I76)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I76(m, f, sep, x, peek, ...) m(f, 76, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I77)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I77(m, f, sep, x, peek, ...) m(f, 77, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I78)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I78(m, f, sep, x, peek, ...) m(f, 78, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I79)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I79(m, f, sep, x, peek, ...) m(f, 79, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I80)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I80(m, f, sep, x, peek, ...) m(f, 80, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I81)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I81(m, f, sep, x, peek, ...) m(f, 81, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I82)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I82(m, f, sep, x, peek, ...) m(f, 82, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I83)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I83(m, f, sep, x, peek, ...) m(f, 83, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I84)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I84(m, f, sep, x, peek, ...) m(f, 84, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I85)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I85(m, f, sep, x, peek, ...) m(f, 85, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I86)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I86(m, f, sep, x, peek, ...) m(f, 86, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I87)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I87(m, f, sep, x, peek, ...) m(f, 87, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I88)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I88(m, f, sep, x, peek, ...) m(f, 88, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I89)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I89(m, f, sep, x, peek, ...) m(f, 89, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I90)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I90(m, f, sep, x, peek, ...) m(f, 90, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I91)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I91(m, f, sep, x, peek, ...) m(f, 91, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I92)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I92(m, f, sep, x, peek, ...) m(f, 92, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I93)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I93(m, f, sep, x, peek, ...) m(f, 93, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I94)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I94(m, f, sep, x, peek, ...) m(f, 94, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I95)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I95(m, f, sep, x, peek, ...) m(f, 95, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I96)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I96(m, f, sep, x, peek, ...) m(f, 96, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I97)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I97(m, f, sep, x, peek, ...) m(f, 97, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I98)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I98(m, f, sep, x, peek, ...) m(f, 98, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I99)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I99(m, f, sep, x, peek, ...) m(f, 99, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I100)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I100(m, f, sep, x, peek, ...) m(f, 100, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I101)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I101(m, f, sep, x, peek, ...) m(f, 101, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I102)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I102(m, f, sep, x, peek, ...) m(f, 102, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I103)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I103(m, f, sep, x, peek, ...) m(f, 103, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I104)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I104(m, f, sep, x, peek, ...) m(f, 104, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I105)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I105(m, f, sep, x, peek, ...) m(f, 105, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I106)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I106(m, f, sep, x, peek, ...) m(f, 106, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I107)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I107(m, f, sep, x, peek, ...) m(f, 107, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I108)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I108(m, f, sep, x, peek, ...) m(f, 108, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I109)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I109(m, f, sep, x, peek, ...) m(f, 109, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I110)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I110(m, f, sep, x, peek, ...) m(f, 110, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I111)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I111(m, f, sep, x, peek, ...) m(f, 111, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I112)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I112(m, f, sep, x, peek, ...) m(f, 112, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I113)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I113(m, f, sep, x, peek, ...) m(f, 113, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I114)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I114(m, f, sep, x, peek, ...) m(f, 114, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I115)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I115(m, f, sep, x, peek, ...) m(f, 115, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I116)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I116(m, f, sep, x, peek, ...) m(f, 116, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I117)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I117(m, f, sep, x, peek, ...) m(f, 117, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I118)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I118(m, f, sep, x, peek, ...) m(f, 118, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I119)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I119(m, f, sep, x, peek, ...) m(f, 119, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I120)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I120(m, f, sep, x, peek, ...) m(f, 120, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I121)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I121(m, f, sep, x, peek, ...) m(f, 121, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I122)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I122(m, f, sep, x, peek, ...) m(f, 122, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I123)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I123(m, f, sep, x, peek, ...) m(f, 123, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I124)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I124(m, f, sep, x, peek, ...) m(f, 124, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I125)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I125(m, f, sep, x, peek, ...) m(f, 125, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I126)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I126(m, f, sep, x, peek, ...) m(f, 126, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I127)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I127(m, f, sep, x, peek, ...) m(f, 127, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I128)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I128(m, f, sep, x, peek, ...) m(f, 128, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I129)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I129(m, f, sep, x, peek, ...) m(f, 129, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I130)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I130(m, f, sep, x, peek, ...) m(f, 130, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I131)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I131(m, f, sep, x, peek, ...) m(f, 131, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I132)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I132(m, f, sep, x, peek, ...) m(f, 132, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I133)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I133(m, f, sep, x, peek, ...) m(f, 133, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I134)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I134(m, f, sep, x, peek, ...) m(f, 134, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I135)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I135(m, f, sep, x, peek, ...) m(f, 135, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I136)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I136(m, f, sep, x, peek, ...) m(f, 136, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I137)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I137(m, f, sep, x, peek, ...) m(f, 137, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I138)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I138(m, f, sep, x, peek, ...) m(f, 138, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I139)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I139(m, f, sep, x, peek, ...) m(f, 139, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I140)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I140(m, f, sep, x, peek, ...) m(f, 140, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I141)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I141(m, f, sep, x, peek, ...) m(f, 141, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I142)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I142(m, f, sep, x, peek, ...) m(f, 142, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I143)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I143(m, f, sep, x, peek, ...) m(f, 143, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I144)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I144(m, f, sep, x, peek, ...) m(f, 144, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I145)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I145(m, f, sep, x, peek, ...) m(f, 145, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I146)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I146(m, f, sep, x, peek, ...) m(f, 146, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I147)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I147(m, f, sep, x, peek, ...) m(f, 147, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I148)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I148(m, f, sep, x, peek, ...) m(f, 148, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I149)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I149(m, f, sep, x, peek, ...) m(f, 149, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I150)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I150(m, f, sep, x, peek, ...) m(f, 150, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I151)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I151(m, f, sep, x, peek, ...) m(f, 151, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I152)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I152(m, f, sep, x, peek, ...) m(f, 152, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I153)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I153(m, f, sep, x, peek, ...) m(f, 153, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I154)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I154(m, f, sep, x, peek, ...) m(f, 154, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I155)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I155(m, f, sep, x, peek, ...) m(f, 155, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I156)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I156(m, f, sep, x, peek, ...) m(f, 156, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I157)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I157(m, f, sep, x, peek, ...) m(f, 157, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I158)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I158(m, f, sep, x, peek, ...) m(f, 158, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I159)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I159(m, f, sep, x, peek, ...) m(f, 159, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I160)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I160(m, f, sep, x, peek, ...) m(f, 160, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I161)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I161(m, f, sep, x, peek, ...) m(f, 161, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I162)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I162(m, f, sep, x, peek, ...) m(f, 162, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I163)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I163(m, f, sep, x, peek, ...) m(f, 163, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I164)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I164(m, f, sep, x, peek, ...) m(f, 164, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I165)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I165(m, f, sep, x, peek, ...) m(f, 165, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I166)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I166(m, f, sep, x, peek, ...) m(f, 166, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I167)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I167(m, f, sep, x, peek, ...) m(f, 167, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I168)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I168(m, f, sep, x, peek, ...) m(f, 168, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I169)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I169(m, f, sep, x, peek, ...) m(f, 169, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I170)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I170(m, f, sep, x, peek, ...) m(f, 170, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I171)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I171(m, f, sep, x, peek, ...) m(f, 171, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I172)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I172(m, f, sep, x, peek, ...) m(f, 172, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I173)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I173(m, f, sep, x, peek, ...) m(f, 173, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I174)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I174(m, f, sep, x, peek, ...) m(f, 174, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I175)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I175(m, f, sep, x, peek, ...) m(f, 175, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I176)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I176(m, f, sep, x, peek, ...) m(f, 176, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I177)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I177(m, f, sep, x, peek, ...) m(f, 177, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I178)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I178(m, f, sep, x, peek, ...) m(f, 178, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I179)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I179(m, f, sep, x, peek, ...) m(f, 179, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I180)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I180(m, f, sep, x, peek, ...) m(f, 180, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I181)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I181(m, f, sep, x, peek, ...) m(f, 181, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I182)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I182(m, f, sep, x, peek, ...) m(f, 182, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I183)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I183(m, f, sep, x, peek, ...) m(f, 183, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I184)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I184(m, f, sep, x, peek, ...) m(f, 184, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I185)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I185(m, f, sep, x, peek, ...) m(f, 185, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I186)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I186(m, f, sep, x, peek, ...) m(f, 186, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I187)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I187(m, f, sep, x, peek, ...) m(f, 187, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I188)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I188(m, f, sep, x, peek, ...) m(f, 188, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I189)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I189(m, f, sep, x, peek, ...) m(f, 189, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I190)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I190(m, f, sep, x, peek, ...) m(f, 190, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I191)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I191(m, f, sep, x, peek, ...) m(f, 191, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I192)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I192(m, f, sep, x, peek, ...) m(f, 192, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I193)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I193(m, f, sep, x, peek, ...) m(f, 193, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I194)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I194(m, f, sep, x, peek, ...) m(f, 194, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I195)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I195(m, f, sep, x, peek, ...) m(f, 195, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I196)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I196(m, f, sep, x, peek, ...) m(f, 196, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I197)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I197(m, f, sep, x, peek, ...) m(f, 197, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I198)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I198(m, f, sep, x, peek, ...) m(f, 198, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I199)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I199(m, f, sep, x, peek, ...) m(f, 199, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I200)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I200(m, f, sep, x, peek, ...) m(f, 200, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I201)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I201(m, f, sep, x, peek, ...) m(f, 201, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I202)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I202(m, f, sep, x, peek, ...) m(f, 202, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I203)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I203(m, f, sep, x, peek, ...) m(f, 203, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I204)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I204(m, f, sep, x, peek, ...) m(f, 204, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I205)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I205(m, f, sep, x, peek, ...) m(f, 205, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I206)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I206(m, f, sep, x, peek, ...) m(f, 206, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I207)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I207(m, f, sep, x, peek, ...) m(f, 207, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I208)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I208(m, f, sep, x, peek, ...) m(f, 208, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I209)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I209(m, f, sep, x, peek, ...) m(f, 209, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I210)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I210(m, f, sep, x, peek, ...) m(f, 210, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I211)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I211(m, f, sep, x, peek, ...) m(f, 211, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I212)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I212(m, f, sep, x, peek, ...) m(f, 212, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I213)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I213(m, f, sep, x, peek, ...) m(f, 213, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I214)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I214(m, f, sep, x, peek, ...) m(f, 214, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I215)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I215(m, f, sep, x, peek, ...) m(f, 215, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I216)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I216(m, f, sep, x, peek, ...) m(f, 216, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I217)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I217(m, f, sep, x, peek, ...) m(f, 217, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I218)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I218(m, f, sep, x, peek, ...) m(f, 218, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I219)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I219(m, f, sep, x, peek, ...) m(f, 219, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I220)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I220(m, f, sep, x, peek, ...) m(f, 220, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I221)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I221(m, f, sep, x, peek, ...) m(f, 221, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I222)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I222(m, f, sep, x, peek, ...) m(f, 222, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I223)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I223(m, f, sep, x, peek, ...) m(f, 223, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I224)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I224(m, f, sep, x, peek, ...) m(f, 224, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I225)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I225(m, f, sep, x, peek, ...) m(f, 225, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I226)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I226(m, f, sep, x, peek, ...) m(f, 226, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I227)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I227(m, f, sep, x, peek, ...) m(f, 227, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I228)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I228(m, f, sep, x, peek, ...) m(f, 228, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I229)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I229(m, f, sep, x, peek, ...) m(f, 229, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I230)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I230(m, f, sep, x, peek, ...) m(f, 230, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I231)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I231(m, f, sep, x, peek, ...) m(f, 231, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I232)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I232(m, f, sep, x, peek, ...) m(f, 232, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I233)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I233(m, f, sep, x, peek, ...) m(f, 233, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I234)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I234(m, f, sep, x, peek, ...) m(f, 234, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I235)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I235(m, f, sep, x, peek, ...) m(f, 235, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I236)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I236(m, f, sep, x, peek, ...) m(f, 236, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I237)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I237(m, f, sep, x, peek, ...) m(f, 237, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I238)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I238(m, f, sep, x, peek, ...) m(f, 238, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I239)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I239(m, f, sep, x, peek, ...) m(f, 239, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I240)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I240(m, f, sep, x, peek, ...) m(f, 240, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I241)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I241(m, f, sep, x, peek, ...) m(f, 241, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I242)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I242(m, f, sep, x, peek, ...) m(f, 242, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I243)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I243(m, f, sep, x, peek, ...) m(f, 243, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I244)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I244(m, f, sep, x, peek, ...) m(f, 244, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I245)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I245(m, f, sep, x, peek, ...) m(f, 245, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I246)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I246(m, f, sep, x, peek, ...) m(f, 246, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I247)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I247(m, f, sep, x, peek, ...) m(f, 247, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I248)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I248(m, f, sep, x, peek, ...) m(f, 248, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I249)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I249(m, f, sep, x, peek, ...) m(f, 249, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I250)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I250(m, f, sep, x, peek, ...) m(f, 250, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I251)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I251(m, f, sep, x, peek, ...) m(f, 251, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I252)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I252(m, f, sep, x, peek, ...) m(f, 252, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I253)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I253(m, f, sep, x, peek, ...) m(f, 253, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I254)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I254(m, f, sep, x, peek, ...) m(f, 254, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I255)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I255(m, f, sep, x, peek, ...) m(f, 255, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I256)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I256(m, f, sep, x, peek, ...) m(f, 256, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I257)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I257(m, f, sep, x, peek, ...) m(f, 257, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I258)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I258(m, f, sep, x, peek, ...) m(f, 258, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I259)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I259(m, f, sep, x, peek, ...) m(f, 259, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I260)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I260(m, f, sep, x, peek, ...) m(f, 260, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I261)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I261(m, f, sep, x, peek, ...) m(f, 261, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I262)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I262(m, f, sep, x, peek, ...) m(f, 262, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I263)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I263(m, f, sep, x, peek, ...) m(f, 263, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I264)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I264(m, f, sep, x, peek, ...) m(f, 264, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I265)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I265(m, f, sep, x, peek, ...) m(f, 265, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I266)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I266(m, f, sep, x, peek, ...) m(f, 266, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I267)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I267(m, f, sep, x, peek, ...) m(f, 267, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I268)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I268(m, f, sep, x, peek, ...) m(f, 268, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I269)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I269(m, f, sep, x, peek, ...) m(f, 269, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I270)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I270(m, f, sep, x, peek, ...) m(f, 270, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I271)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I271(m, f, sep, x, peek, ...) m(f, 271, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I272)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I272(m, f, sep, x, peek, ...) m(f, 272, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I273)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I273(m, f, sep, x, peek, ...) m(f, 273, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I274)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I274(m, f, sep, x, peek, ...) m(f, 274, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I275)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I275(m, f, sep, x, peek, ...) m(f, 275, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I276)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I276(m, f, sep, x, peek, ...) m(f, 276, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I277)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I277(m, f, sep, x, peek, ...) m(f, 277, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I278)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I278(m, f, sep, x, peek, ...) m(f, 278, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I279)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I279(m, f, sep, x, peek, ...) m(f, 279, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I280)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I280(m, f, sep, x, peek, ...) m(f, 280, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I281)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I281(m, f, sep, x, peek, ...) m(f, 281, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I282)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I282(m, f, sep, x, peek, ...) m(f, 282, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I283)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I283(m, f, sep, x, peek, ...) m(f, 283, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I284)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I284(m, f, sep, x, peek, ...) m(f, 284, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I285)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I285(m, f, sep, x, peek, ...) m(f, 285, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I286)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I286(m, f, sep, x, peek, ...) m(f, 286, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I287)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I287(m, f, sep, x, peek, ...) m(f, 287, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I288)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I288(m, f, sep, x, peek, ...) m(f, 288, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I289)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I289(m, f, sep, x, peek, ...) m(f, 289, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I290)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I290(m, f, sep, x, peek, ...) m(f, 290, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I291)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I291(m, f, sep, x, peek, ...) m(f, 291, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I292)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I292(m, f, sep, x, peek, ...) m(f, 292, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I293)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I293(m, f, sep, x, peek, ...) m(f, 293, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I294)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I294(m, f, sep, x, peek, ...) m(f, 294, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I295)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I295(m, f, sep, x, peek, ...) m(f, 295, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I296)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I296(m, f, sep, x, peek, ...) m(f, 296, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I297)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I297(m, f, sep, x, peek, ...) m(f, 297, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I298)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I298(m, f, sep, x, peek, ...) m(f, 298, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I299)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I299(m, f, sep, x, peek, ...) m(f, 299, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I300)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I300(m, f, sep, x, peek, ...) m(f, 300, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I301)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I301(m, f, sep, x, peek, ...) m(f, 301, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I302)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I302(m, f, sep, x, peek, ...) m(f, 302, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I303)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I303(m, f, sep, x, peek, ...) m(f, 303, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I304)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I304(m, f, sep, x, peek, ...) m(f, 304, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I305)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I305(m, f, sep, x, peek, ...) m(f, 305, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I306)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I306(m, f, sep, x, peek, ...) m(f, 306, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I307)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I307(m, f, sep, x, peek, ...) m(f, 307, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I308)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I308(m, f, sep, x, peek, ...) m(f, 308, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I309)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I309(m, f, sep, x, peek, ...) m(f, 309, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I310)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I310(m, f, sep, x, peek, ...) m(f, 310, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I311)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I311(m, f, sep, x, peek, ...) m(f, 311, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I312)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I312(m, f, sep, x, peek, ...) m(f, 312, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I313)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I313(m, f, sep, x, peek, ...) m(f, 313, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I314)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I314(m, f, sep, x, peek, ...) m(f, 314, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I315)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I315(m, f, sep, x, peek, ...) m(f, 315, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I316)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I316(m, f, sep, x, peek, ...) m(f, 316, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I317)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I317(m, f, sep, x, peek, ...) m(f, 317, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I318)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I318(m, f, sep, x, peek, ...) m(f, 318, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I319)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I319(m, f, sep, x, peek, ...) m(f, 319, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I320)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I320(m, f, sep, x, peek, ...) m(f, 320, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I321)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I321(m, f, sep, x, peek, ...) m(f, 321, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I322)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I322(m, f, sep, x, peek, ...) m(f, 322, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I323)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I323(m, f, sep, x, peek, ...) m(f, 323, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I324)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I324(m, f, sep, x, peek, ...) m(f, 324, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I325)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I325(m, f, sep, x, peek, ...) m(f, 325, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I326)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I326(m, f, sep, x, peek, ...) m(f, 326, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I327)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I327(m, f, sep, x, peek, ...) m(f, 327, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I328)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I328(m, f, sep, x, peek, ...) m(f, 328, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I329)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I329(m, f, sep, x, peek, ...) m(f, 329, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I330)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I330(m, f, sep, x, peek, ...) m(f, 330, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I331)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I331(m, f, sep, x, peek, ...) m(f, 331, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I332)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I332(m, f, sep, x, peek, ...) m(f, 332, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I333)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I333(m, f, sep, x, peek, ...) m(f, 333, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I334)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I334(m, f, sep, x, peek, ...) m(f, 334, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I335)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I335(m, f, sep, x, peek, ...) m(f, 335, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I336)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I336(m, f, sep, x, peek, ...) m(f, 336, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I337)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I337(m, f, sep, x, peek, ...) m(f, 337, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I338)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I338(m, f, sep, x, peek, ...) m(f, 338, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I339)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I339(m, f, sep, x, peek, ...) m(f, 339, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I340)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I340(m, f, sep, x, peek, ...) m(f, 340, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I341)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I341(m, f, sep, x, peek, ...) m(f, 341, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I342)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I342(m, f, sep, x, peek, ...) m(f, 342, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I343)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I343(m, f, sep, x, peek, ...) m(f, 343, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I344)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I344(m, f, sep, x, peek, ...) m(f, 344, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I345)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I345(m, f, sep, x, peek, ...) m(f, 345, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I346)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I346(m, f, sep, x, peek, ...) m(f, 346, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I347)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I347(m, f, sep, x, peek, ...) m(f, 347, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I348)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I348(m, f, sep, x, peek, ...) m(f, 348, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I349)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I349(m, f, sep, x, peek, ...) m(f, 349, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I350)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I350(m, f, sep, x, peek, ...) m(f, 350, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I351)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I351(m, f, sep, x, peek, ...) m(f, 351, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I352)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I352(m, f, sep, x, peek, ...) m(f, 352, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I353)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I353(m, f, sep, x, peek, ...) m(f, 353, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I354)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I354(m, f, sep, x, peek, ...) m(f, 354, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I355)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I355(m, f, sep, x, peek, ...) m(f, 355, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I356)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I356(m, f, sep, x, peek, ...) m(f, 356, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I357)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I357(m, f, sep, x, peek, ...) m(f, 357, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I358)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I358(m, f, sep, x, peek, ...) m(f, 358, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I359)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I359(m, f, sep, x, peek, ...) m(f, 359, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I360)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I360(m, f, sep, x, peek, ...) m(f, 360, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I361)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I361(m, f, sep, x, peek, ...) m(f, 361, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I362)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I362(m, f, sep, x, peek, ...) m(f, 362, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I363)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I363(m, f, sep, x, peek, ...) m(f, 363, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I364)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I364(m, f, sep, x, peek, ...) m(f, 364, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I365)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I365(m, f, sep, x, peek, ...) m(f, 365, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I366)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I366(m, f, sep, x, peek, ...) m(f, 366, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I367)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I367(m, f, sep, x, peek, ...) m(f, 367, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I368)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I368(m, f, sep, x, peek, ...) m(f, 368, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I369)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I369(m, f, sep, x, peek, ...) m(f, 369, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I370)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I370(m, f, sep, x, peek, ...) m(f, 370, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I371)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I371(m, f, sep, x, peek, ...) m(f, 371, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I372)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I372(m, f, sep, x, peek, ...) m(f, 372, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I373)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I373(m, f, sep, x, peek, ...) m(f, 373, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I374)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I374(m, f, sep, x, peek, ...) m(f, 374, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I375)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I375(m, f, sep, x, peek, ...) m(f, 375, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I376)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I376(m, f, sep, x, peek, ...) m(f, 376, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I377)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I377(m, f, sep, x, peek, ...) m(f, 377, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I378)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I378(m, f, sep, x, peek, ...) m(f, 378, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I379)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I379(m, f, sep, x, peek, ...) m(f, 379, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I380)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I380(m, f, sep, x, peek, ...) m(f, 380, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I381)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I381(m, f, sep, x, peek, ...) m(f, 381, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I382)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I382(m, f, sep, x, peek, ...) m(f, 382, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I383)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I383(m, f, sep, x, peek, ...) m(f, 383, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I384)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I384(m, f, sep, x, peek, ...) m(f, 384, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I385)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I385(m, f, sep, x, peek, ...) m(f, 385, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I386)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I386(m, f, sep, x, peek, ...) m(f, 386, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I387)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I387(m, f, sep, x, peek, ...) m(f, 387, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I388)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I388(m, f, sep, x, peek, ...) m(f, 388, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I389)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I389(m, f, sep, x, peek, ...) m(f, 389, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I390)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I390(m, f, sep, x, peek, ...) m(f, 390, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I391)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I391(m, f, sep, x, peek, ...) m(f, 391, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I392)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I392(m, f, sep, x, peek, ...) m(f, 392, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I393)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I393(m, f, sep, x, peek, ...) m(f, 393, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I394)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I394(m, f, sep, x, peek, ...) m(f, 394, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I395)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I395(m, f, sep, x, peek, ...) m(f, 395, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I396)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I396(m, f, sep, x, peek, ...) m(f, 396, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I397)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I397(m, f, sep, x, peek, ...) m(f, 397, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I398)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I398(m, f, sep, x, peek, ...) m(f, 398, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I399)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I399(m, f, sep, x, peek, ...) m(f, 399, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I400)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I400(m, f, sep, x, peek, ...) m(f, 400, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I401)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I401(m, f, sep, x, peek, ...) m(f, 401, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I402)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I402(m, f, sep, x, peek, ...) m(f, 402, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I403)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I403(m, f, sep, x, peek, ...) m(f, 403, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I404)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I404(m, f, sep, x, peek, ...) m(f, 404, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I405)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I405(m, f, sep, x, peek, ...) m(f, 405, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I406)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I406(m, f, sep, x, peek, ...) m(f, 406, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I407)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I407(m, f, sep, x, peek, ...) m(f, 407, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I408)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I408(m, f, sep, x, peek, ...) m(f, 408, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I409)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I409(m, f, sep, x, peek, ...) m(f, 409, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I410)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I410(m, f, sep, x, peek, ...) m(f, 410, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I411)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I411(m, f, sep, x, peek, ...) m(f, 411, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I412)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I412(m, f, sep, x, peek, ...) m(f, 412, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I413)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I413(m, f, sep, x, peek, ...) m(f, 413, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I414)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I414(m, f, sep, x, peek, ...) m(f, 414, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I415)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I415(m, f, sep, x, peek, ...) m(f, 415, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I416)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I416(m, f, sep, x, peek, ...) m(f, 416, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I417)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I417(m, f, sep, x, peek, ...) m(f, 417, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I418)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I418(m, f, sep, x, peek, ...) m(f, 418, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I419)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I419(m, f, sep, x, peek, ...) m(f, 419, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I420)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I420(m, f, sep, x, peek, ...) m(f, 420, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I421)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I421(m, f, sep, x, peek, ...) m(f, 421, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I422)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I422(m, f, sep, x, peek, ...) m(f, 422, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I423)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I423(m, f, sep, x, peek, ...) m(f, 423, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I424)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I424(m, f, sep, x, peek, ...) m(f, 424, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I425)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I425(m, f, sep, x, peek, ...) m(f, 425, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I426)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I426(m, f, sep, x, peek, ...) m(f, 426, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I427)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I427(m, f, sep, x, peek, ...) m(f, 427, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I428)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I428(m, f, sep, x, peek, ...) m(f, 428, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I429)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I429(m, f, sep, x, peek, ...) m(f, 429, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I430)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I430(m, f, sep, x, peek, ...) m(f, 430, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I431)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I431(m, f, sep, x, peek, ...) m(f, 431, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I432)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I432(m, f, sep, x, peek, ...) m(f, 432, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I433)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I433(m, f, sep, x, peek, ...) m(f, 433, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I434)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I434(m, f, sep, x, peek, ...) m(f, 434, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I435)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I435(m, f, sep, x, peek, ...) m(f, 435, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I436)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I436(m, f, sep, x, peek, ...) m(f, 436, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I437)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I437(m, f, sep, x, peek, ...) m(f, 437, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I438)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I438(m, f, sep, x, peek, ...) m(f, 438, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I439)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I439(m, f, sep, x, peek, ...) m(f, 439, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I440)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I440(m, f, sep, x, peek, ...) m(f, 440, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I441)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I441(m, f, sep, x, peek, ...) m(f, 441, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I442)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I442(m, f, sep, x, peek, ...) m(f, 442, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I443)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I443(m, f, sep, x, peek, ...) m(f, 443, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I444)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I444(m, f, sep, x, peek, ...) m(f, 444, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I445)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I445(m, f, sep, x, peek, ...) m(f, 445, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I446)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I446(m, f, sep, x, peek, ...) m(f, 446, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I447)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I447(m, f, sep, x, peek, ...) m(f, 447, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I448)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I448(m, f, sep, x, peek, ...) m(f, 448, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I449)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I449(m, f, sep, x, peek, ...) m(f, 449, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I450)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I450(m, f, sep, x, peek, ...) m(f, 450, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I451)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I451(m, f, sep, x, peek, ...) m(f, 451, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I452)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I452(m, f, sep, x, peek, ...) m(f, 452, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I453)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I453(m, f, sep, x, peek, ...) m(f, 453, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I454)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I454(m, f, sep, x, peek, ...) m(f, 454, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I455)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I455(m, f, sep, x, peek, ...) m(f, 455, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I456)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I456(m, f, sep, x, peek, ...) m(f, 456, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I457)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I457(m, f, sep, x, peek, ...) m(f, 457, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I458)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I458(m, f, sep, x, peek, ...) m(f, 458, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I459)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I459(m, f, sep, x, peek, ...) m(f, 459, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I460)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I460(m, f, sep, x, peek, ...) m(f, 460, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I461)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I461(m, f, sep, x, peek, ...) m(f, 461, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I462)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I462(m, f, sep, x, peek, ...) m(f, 462, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I463)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I463(m, f, sep, x, peek, ...) m(f, 463, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I464)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I464(m, f, sep, x, peek, ...) m(f, 464, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I465)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I465(m, f, sep, x, peek, ...) m(f, 465, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I466)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I466(m, f, sep, x, peek, ...) m(f, 466, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I467)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I467(m, f, sep, x, peek, ...) m(f, 467, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I468)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I468(m, f, sep, x, peek, ...) m(f, 468, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I469)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I469(m, f, sep, x, peek, ...) m(f, 469, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I470)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I470(m, f, sep, x, peek, ...) m(f, 470, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I471)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I471(m, f, sep, x, peek, ...) m(f, 471, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I472)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I472(m, f, sep, x, peek, ...) m(f, 472, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I473)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I473(m, f, sep, x, peek, ...) m(f, 473, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I474)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I474(m, f, sep, x, peek, ...) m(f, 474, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I475)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I475(m, f, sep, x, peek, ...) m(f, 475, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I476)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I476(m, f, sep, x, peek, ...) m(f, 476, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I477)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I477(m, f, sep, x, peek, ...) m(f, 477, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I478)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I478(m, f, sep, x, peek, ...) m(f, 478, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I479)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I479(m, f, sep, x, peek, ...) m(f, 479, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I480)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I480(m, f, sep, x, peek, ...) m(f, 480, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I481)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I481(m, f, sep, x, peek, ...) m(f, 481, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I482)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I482(m, f, sep, x, peek, ...) m(f, 482, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I483)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I483(m, f, sep, x, peek, ...) m(f, 483, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I484)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I484(m, f, sep, x, peek, ...) m(f, 484, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I485)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I485(m, f, sep, x, peek, ...) m(f, 485, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I486)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I486(m, f, sep, x, peek, ...) m(f, 486, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I487)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I487(m, f, sep, x, peek, ...) m(f, 487, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I488)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I488(m, f, sep, x, peek, ...) m(f, 488, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I489)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I489(m, f, sep, x, peek, ...) m(f, 489, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I490)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I490(m, f, sep, x, peek, ...) m(f, 490, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I491)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I491(m, f, sep, x, peek, ...) m(f, 491, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I492)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I492(m, f, sep, x, peek, ...) m(f, 492, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I493)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I493(m, f, sep, x, peek, ...) m(f, 493, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I494)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I494(m, f, sep, x, peek, ...) m(f, 494, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I495)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I495(m, f, sep, x, peek, ...) m(f, 495, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I496)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I496(m, f, sep, x, peek, ...) m(f, 496, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I497)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I497(m, f, sep, x, peek, ...) m(f, 497, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I498)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I498(m, f, sep, x, peek, ...) m(f, 498, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I499)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I499(m, f, sep, x, peek, ...) m(f, 499, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I500)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I500(m, f, sep, x, peek, ...) m(f, 500, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I501)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I501(m, f, sep, x, peek, ...) m(f, 501, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I502)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I502(m, f, sep, x, peek, ...) m(f, 502, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I503)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I503(m, f, sep, x, peek, ...) m(f, 503, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I504)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I504(m, f, sep, x, peek, ...) m(f, 504, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I505)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I505(m, f, sep, x, peek, ...) m(f, 505, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I506)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I506(m, f, sep, x, peek, ...) m(f, 506, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I507)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I507(m, f, sep, x, peek, ...) m(f, 507, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I508)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I508(m, f, sep, x, peek, ...) m(f, 508, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I509)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I509(m, f, sep, x, peek, ...) m(f, 509, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I510)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I510(m, f, sep, x, peek, ...) m(f, 510, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I511)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I511(m, f, sep, x, peek, ...) m(f, 511, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I512)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I512(m, f, sep, x, peek, ...) m(f, 512, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I513)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I513(m, f, sep, x, peek, ...) m(f, 513, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I514)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I514(m, f, sep, x, peek, ...) m(f, 514, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I515)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I515(m, f, sep, x, peek, ...) m(f, 515, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I516)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I516(m, f, sep, x, peek, ...) m(f, 516, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I517)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I517(m, f, sep, x, peek, ...) m(f, 517, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I518)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I518(m, f, sep, x, peek, ...) m(f, 518, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I519)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I519(m, f, sep, x, peek, ...) m(f, 519, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I520)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I520(m, f, sep, x, peek, ...) m(f, 520, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I521)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I521(m, f, sep, x, peek, ...) m(f, 521, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I522)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I522(m, f, sep, x, peek, ...) m(f, 522, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I523)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I523(m, f, sep, x, peek, ...) m(f, 523, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I524)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I524(m, f, sep, x, peek, ...) m(f, 524, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I525)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I525(m, f, sep, x, peek, ...) m(f, 525, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I526)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I526(m, f, sep, x, peek, ...) m(f, 526, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I527)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I527(m, f, sep, x, peek, ...) m(f, 527, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I528)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I528(m, f, sep, x, peek, ...) m(f, 528, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I529)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I529(m, f, sep, x, peek, ...) m(f, 529, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I530)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I530(m, f, sep, x, peek, ...) m(f, 530, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I531)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I531(m, f, sep, x, peek, ...) m(f, 531, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I532)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I532(m, f, sep, x, peek, ...) m(f, 532, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I533)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I533(m, f, sep, x, peek, ...) m(f, 533, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I534)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I534(m, f, sep, x, peek, ...) m(f, 534, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I535)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I535(m, f, sep, x, peek, ...) m(f, 535, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I536)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I536(m, f, sep, x, peek, ...) m(f, 536, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I537)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I537(m, f, sep, x, peek, ...) m(f, 537, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I538)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I538(m, f, sep, x, peek, ...) m(f, 538, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I539)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I539(m, f, sep, x, peek, ...) m(f, 539, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I540)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I540(m, f, sep, x, peek, ...) m(f, 540, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I541)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I541(m, f, sep, x, peek, ...) m(f, 541, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I542)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I542(m, f, sep, x, peek, ...) m(f, 542, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I543)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I543(m, f, sep, x, peek, ...) m(f, 543, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I544)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I544(m, f, sep, x, peek, ...) m(f, 544, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I545)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I545(m, f, sep, x, peek, ...) m(f, 545, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I546)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I546(m, f, sep, x, peek, ...) m(f, 546, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I547)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I547(m, f, sep, x, peek, ...) m(f, 547, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I548)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I548(m, f, sep, x, peek, ...) m(f, 548, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I549)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I549(m, f, sep, x, peek, ...) m(f, 549, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I550)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I550(m, f, sep, x, peek, ...) m(f, 550, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I551)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I551(m, f, sep, x, peek, ...) m(f, 551, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I552)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I552(m, f, sep, x, peek, ...) m(f, 552, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I553)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I553(m, f, sep, x, peek, ...) m(f, 553, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I554)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I554(m, f, sep, x, peek, ...) m(f, 554, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I555)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I555(m, f, sep, x, peek, ...) m(f, 555, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I556)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I556(m, f, sep, x, peek, ...) m(f, 556, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I557)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I557(m, f, sep, x, peek, ...) m(f, 557, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I558)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I558(m, f, sep, x, peek, ...) m(f, 558, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I559)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I559(m, f, sep, x, peek, ...) m(f, 559, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I560)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I560(m, f, sep, x, peek, ...) m(f, 560, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I561)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I561(m, f, sep, x, peek, ...) m(f, 561, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I562)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I562(m, f, sep, x, peek, ...) m(f, 562, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I563)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I563(m, f, sep, x, peek, ...) m(f, 563, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I564)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I564(m, f, sep, x, peek, ...) m(f, 564, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I565)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I565(m, f, sep, x, peek, ...) m(f, 565, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I566)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I566(m, f, sep, x, peek, ...) m(f, 566, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I567)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I567(m, f, sep, x, peek, ...) m(f, 567, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I568)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I568(m, f, sep, x, peek, ...) m(f, 568, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I569)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I569(m, f, sep, x, peek, ...) m(f, 569, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I570)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I570(m, f, sep, x, peek, ...) m(f, 570, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I571)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I571(m, f, sep, x, peek, ...) m(f, 571, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I572)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I572(m, f, sep, x, peek, ...) m(f, 572, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I573)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I573(m, f, sep, x, peek, ...) m(f, 573, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I574)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I574(m, f, sep, x, peek, ...) m(f, 574, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I575)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I575(m, f, sep, x, peek, ...) m(f, 575, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I576)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I576(m, f, sep, x, peek, ...) m(f, 576, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I577)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I577(m, f, sep, x, peek, ...) m(f, 577, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I578)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I578(m, f, sep, x, peek, ...) m(f, 578, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I579)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I579(m, f, sep, x, peek, ...) m(f, 579, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I580)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I580(m, f, sep, x, peek, ...) m(f, 580, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I581)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I581(m, f, sep, x, peek, ...) m(f, 581, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I582)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I582(m, f, sep, x, peek, ...) m(f, 582, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I583)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I583(m, f, sep, x, peek, ...) m(f, 583, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I584)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I584(m, f, sep, x, peek, ...) m(f, 584, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I585)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I585(m, f, sep, x, peek, ...) m(f, 585, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I586)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I586(m, f, sep, x, peek, ...) m(f, 586, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I587)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I587(m, f, sep, x, peek, ...) m(f, 587, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I588)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I588(m, f, sep, x, peek, ...) m(f, 588, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I589)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I589(m, f, sep, x, peek, ...) m(f, 589, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I590)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I590(m, f, sep, x, peek, ...) m(f, 590, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I591)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I591(m, f, sep, x, peek, ...) m(f, 591, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I592)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I592(m, f, sep, x, peek, ...) m(f, 592, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I593)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I593(m, f, sep, x, peek, ...) m(f, 593, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I594)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I594(m, f, sep, x, peek, ...) m(f, 594, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I595)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I595(m, f, sep, x, peek, ...) m(f, 595, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I596)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I596(m, f, sep, x, peek, ...) m(f, 596, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I597)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I597(m, f, sep, x, peek, ...) m(f, 597, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I598)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I598(m, f, sep, x, peek, ...) m(f, 598, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I599)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I599(m, f, sep, x, peek, ...) m(f, 599, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I600)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I600(m, f, sep, x, peek, ...) m(f, 600, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I601)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I601(m, f, sep, x, peek, ...) m(f, 601, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I602)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I602(m, f, sep, x, peek, ...) m(f, 602, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I603)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I603(m, f, sep, x, peek, ...) m(f, 603, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I604)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I604(m, f, sep, x, peek, ...) m(f, 604, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I605)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I605(m, f, sep, x, peek, ...) m(f, 605, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I606)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I606(m, f, sep, x, peek, ...) m(f, 606, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I607)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I607(m, f, sep, x, peek, ...) m(f, 607, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I608)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I608(m, f, sep, x, peek, ...) m(f, 608, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I609)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I609(m, f, sep, x, peek, ...) m(f, 609, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I610)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I610(m, f, sep, x, peek, ...) m(f, 610, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I611)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I611(m, f, sep, x, peek, ...) m(f, 611, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I612)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I612(m, f, sep, x, peek, ...) m(f, 612, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I613)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I613(m, f, sep, x, peek, ...) m(f, 613, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I614)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I614(m, f, sep, x, peek, ...) m(f, 614, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I615)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I615(m, f, sep, x, peek, ...) m(f, 615, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I616)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I616(m, f, sep, x, peek, ...) m(f, 616, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I617)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I617(m, f, sep, x, peek, ...) m(f, 617, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I618)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I618(m, f, sep, x, peek, ...) m(f, 618, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I619)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I619(m, f, sep, x, peek, ...) m(f, 619, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I620)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I620(m, f, sep, x, peek, ...) m(f, 620, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I621)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I621(m, f, sep, x, peek, ...) m(f, 621, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I622)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I622(m, f, sep, x, peek, ...) m(f, 622, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I623)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I623(m, f, sep, x, peek, ...) m(f, 623, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I624)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I624(m, f, sep, x, peek, ...) m(f, 624, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I625)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I625(m, f, sep, x, peek, ...) m(f, 625, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I626)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I626(m, f, sep, x, peek, ...) m(f, 626, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I627)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I627(m, f, sep, x, peek, ...) m(f, 627, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I628)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I628(m, f, sep, x, peek, ...) m(f, 628, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I629)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I629(m, f, sep, x, peek, ...) m(f, 629, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I630)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I630(m, f, sep, x, peek, ...) m(f, 630, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I631)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I631(m, f, sep, x, peek, ...) m(f, 631, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I632)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I632(m, f, sep, x, peek, ...) m(f, 632, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I633)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I633(m, f, sep, x, peek, ...) m(f, 633, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I634)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I634(m, f, sep, x, peek, ...) m(f, 634, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I635)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I635(m, f, sep, x, peek, ...) m(f, 635, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I636)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I636(m, f, sep, x, peek, ...) m(f, 636, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I637)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I637(m, f, sep, x, peek, ...) m(f, 637, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I638)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I638(m, f, sep, x, peek, ...) m(f, 638, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I639)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I639(m, f, sep, x, peek, ...) m(f, 639, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I640)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I640(m, f, sep, x, peek, ...) m(f, 640, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I641)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I641(m, f, sep, x, peek, ...) m(f, 641, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I642)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I642(m, f, sep, x, peek, ...) m(f, 642, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I643)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I643(m, f, sep, x, peek, ...) m(f, 643, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I644)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I644(m, f, sep, x, peek, ...) m(f, 644, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I645)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I645(m, f, sep, x, peek, ...) m(f, 645, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I646)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I646(m, f, sep, x, peek, ...) m(f, 646, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I647)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I647(m, f, sep, x, peek, ...) m(f, 647, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I648)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I648(m, f, sep, x, peek, ...) m(f, 648, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I649)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I649(m, f, sep, x, peek, ...) m(f, 649, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I650)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I650(m, f, sep, x, peek, ...) m(f, 650, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I651)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I651(m, f, sep, x, peek, ...) m(f, 651, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I652)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I652(m, f, sep, x, peek, ...) m(f, 652, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I653)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I653(m, f, sep, x, peek, ...) m(f, 653, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I654)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I654(m, f, sep, x, peek, ...) m(f, 654, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I655)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I655(m, f, sep, x, peek, ...) m(f, 655, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I656)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I656(m, f, sep, x, peek, ...) m(f, 656, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I657)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I657(m, f, sep, x, peek, ...) m(f, 657, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I658)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I658(m, f, sep, x, peek, ...) m(f, 658, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I659)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I659(m, f, sep, x, peek, ...) m(f, 659, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I660)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I660(m, f, sep, x, peek, ...) m(f, 660, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I661)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I661(m, f, sep, x, peek, ...) m(f, 661, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I662)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I662(m, f, sep, x, peek, ...) m(f, 662, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I663)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I663(m, f, sep, x, peek, ...) m(f, 663, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I664)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I664(m, f, sep, x, peek, ...) m(f, 664, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I665)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I665(m, f, sep, x, peek, ...) m(f, 665, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I666)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I666(m, f, sep, x, peek, ...) m(f, 666, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I667)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I667(m, f, sep, x, peek, ...) m(f, 667, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I668)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I668(m, f, sep, x, peek, ...) m(f, 668, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I669)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I669(m, f, sep, x, peek, ...) m(f, 669, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I670)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I670(m, f, sep, x, peek, ...) m(f, 670, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I671)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I671(m, f, sep, x, peek, ...) m(f, 671, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I672)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I672(m, f, sep, x, peek, ...) m(f, 672, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I673)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I673(m, f, sep, x, peek, ...) m(f, 673, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I674)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I674(m, f, sep, x, peek, ...) m(f, 674, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I675)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I675(m, f, sep, x, peek, ...) m(f, 675, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I676)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I676(m, f, sep, x, peek, ...) m(f, 676, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I677)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I677(m, f, sep, x, peek, ...) m(f, 677, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I678)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I678(m, f, sep, x, peek, ...) m(f, 678, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I679)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I679(m, f, sep, x, peek, ...) m(f, 679, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I680)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I680(m, f, sep, x, peek, ...) m(f, 680, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I681)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I681(m, f, sep, x, peek, ...) m(f, 681, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I682)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I682(m, f, sep, x, peek, ...) m(f, 682, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I683)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I683(m, f, sep, x, peek, ...) m(f, 683, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I684)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I684(m, f, sep, x, peek, ...) m(f, 684, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I685)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I685(m, f, sep, x, peek, ...) m(f, 685, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I686)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I686(m, f, sep, x, peek, ...) m(f, 686, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I687)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I687(m, f, sep, x, peek, ...) m(f, 687, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I688)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I688(m, f, sep, x, peek, ...) m(f, 688, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I689)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I689(m, f, sep, x, peek, ...) m(f, 689, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I690)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I690(m, f, sep, x, peek, ...) m(f, 690, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I691)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I691(m, f, sep, x, peek, ...) m(f, 691, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I692)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I692(m, f, sep, x, peek, ...) m(f, 692, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I693)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I693(m, f, sep, x, peek, ...) m(f, 693, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I694)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I694(m, f, sep, x, peek, ...) m(f, 694, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I695)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I695(m, f, sep, x, peek, ...) m(f, 695, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I696)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I696(m, f, sep, x, peek, ...) m(f, 696, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I697)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I697(m, f, sep, x, peek, ...) m(f, 697, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I698)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I698(m, f, sep, x, peek, ...) m(f, 698, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I699)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I699(m, f, sep, x, peek, ...) m(f, 699, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I700)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I700(m, f, sep, x, peek, ...) m(f, 700, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I701)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I701(m, f, sep, x, peek, ...) m(f, 701, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I702)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I702(m, f, sep, x, peek, ...) m(f, 702, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I703)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I703(m, f, sep, x, peek, ...) m(f, 703, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I704)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I704(m, f, sep, x, peek, ...) m(f, 704, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I705)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I705(m, f, sep, x, peek, ...) m(f, 705, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I706)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I706(m, f, sep, x, peek, ...) m(f, 706, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I707)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I707(m, f, sep, x, peek, ...) m(f, 707, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I708)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I708(m, f, sep, x, peek, ...) m(f, 708, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I709)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I709(m, f, sep, x, peek, ...) m(f, 709, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I710)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I710(m, f, sep, x, peek, ...) m(f, 710, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I711)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I711(m, f, sep, x, peek, ...) m(f, 711, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I712)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I712(m, f, sep, x, peek, ...) m(f, 712, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I713)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I713(m, f, sep, x, peek, ...) m(f, 713, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I714)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I714(m, f, sep, x, peek, ...) m(f, 714, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I715)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I715(m, f, sep, x, peek, ...) m(f, 715, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I716)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I716(m, f, sep, x, peek, ...) m(f, 716, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I717)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I717(m, f, sep, x, peek, ...) m(f, 717, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I718)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I718(m, f, sep, x, peek, ...) m(f, 718, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I719)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I719(m, f, sep, x, peek, ...) m(f, 719, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I720)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I720(m, f, sep, x, peek, ...) m(f, 720, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I721)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I721(m, f, sep, x, peek, ...) m(f, 721, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I722)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I722(m, f, sep, x, peek, ...) m(f, 722, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I723)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I723(m, f, sep, x, peek, ...) m(f, 723, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I724)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I724(m, f, sep, x, peek, ...) m(f, 724, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I725)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I725(m, f, sep, x, peek, ...) m(f, 725, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I726)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I726(m, f, sep, x, peek, ...) m(f, 726, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I727)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I727(m, f, sep, x, peek, ...) m(f, 727, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I728)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I728(m, f, sep, x, peek, ...) m(f, 728, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I729)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I729(m, f, sep, x, peek, ...) m(f, 729, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I730)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I730(m, f, sep, x, peek, ...) m(f, 730, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I731)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I731(m, f, sep, x, peek, ...) m(f, 731, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I732)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I732(m, f, sep, x, peek, ...) m(f, 732, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I733)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I733(m, f, sep, x, peek, ...) m(f, 733, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I734)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I734(m, f, sep, x, peek, ...) m(f, 734, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I735)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I735(m, f, sep, x, peek, ...) m(f, 735, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I736)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I736(m, f, sep, x, peek, ...) m(f, 736, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I737)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I737(m, f, sep, x, peek, ...) m(f, 737, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I738)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I738(m, f, sep, x, peek, ...) m(f, 738, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I739)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I739(m, f, sep, x, peek, ...) m(f, 739, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I740)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I740(m, f, sep, x, peek, ...) m(f, 740, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I741)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I741(m, f, sep, x, peek, ...) m(f, 741, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I742)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I742(m, f, sep, x, peek, ...) m(f, 742, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I743)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I743(m, f, sep, x, peek, ...) m(f, 743, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I744)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I744(m, f, sep, x, peek, ...) m(f, 744, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I745)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I745(m, f, sep, x, peek, ...) m(f, 745, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I746)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I746(m, f, sep, x, peek, ...) m(f, 746, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I747)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I747(m, f, sep, x, peek, ...) m(f, 747, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I748)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I748(m, f, sep, x, peek, ...) m(f, 748, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I749)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I749(m, f, sep, x, peek, ...) m(f, 749, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I750)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I750(m, f, sep, x, peek, ...) m(f, 750, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I751)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I751(m, f, sep, x, peek, ...) m(f, 751, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I752)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I752(m, f, sep, x, peek, ...) m(f, 752, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I753)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I753(m, f, sep, x, peek, ...) m(f, 753, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I754)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I754(m, f, sep, x, peek, ...) m(f, 754, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I755)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I755(m, f, sep, x, peek, ...) m(f, 755, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I756)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I756(m, f, sep, x, peek, ...) m(f, 756, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I757)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I757(m, f, sep, x, peek, ...) m(f, 757, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I758)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I758(m, f, sep, x, peek, ...) m(f, 758, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I759)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I759(m, f, sep, x, peek, ...) m(f, 759, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I760)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I760(m, f, sep, x, peek, ...) m(f, 760, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I761)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I761(m, f, sep, x, peek, ...) m(f, 761, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I762)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I762(m, f, sep, x, peek, ...) m(f, 762, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I763)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I763(m, f, sep, x, peek, ...) m(f, 763, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I764)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I764(m, f, sep, x, peek, ...) m(f, 764, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I765)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I765(m, f, sep, x, peek, ...) m(f, 765, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I766)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I766(m, f, sep, x, peek, ...) m(f, 766, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I767)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I767(m, f, sep, x, peek, ...) m(f, 767, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I768)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I768(m, f, sep, x, peek, ...) m(f, 768, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I769)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I769(m, f, sep, x, peek, ...) m(f, 769, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I770)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I770(m, f, sep, x, peek, ...) m(f, 770, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I771)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I771(m, f, sep, x, peek, ...) m(f, 771, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I772)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I772(m, f, sep, x, peek, ...) m(f, 772, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I773)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I773(m, f, sep, x, peek, ...) m(f, 773, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I774)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I774(m, f, sep, x, peek, ...) m(f, 774, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I775)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I775(m, f, sep, x, peek, ...) m(f, 775, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I776)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I776(m, f, sep, x, peek, ...) m(f, 776, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I777)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I777(m, f, sep, x, peek, ...) m(f, 777, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I778)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I778(m, f, sep, x, peek, ...) m(f, 778, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I779)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I779(m, f, sep, x, peek, ...) m(f, 779, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I780)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I780(m, f, sep, x, peek, ...) m(f, 780, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I781)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I781(m, f, sep, x, peek, ...) m(f, 781, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I782)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I782(m, f, sep, x, peek, ...) m(f, 782, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I783)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I783(m, f, sep, x, peek, ...) m(f, 783, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I784)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I784(m, f, sep, x, peek, ...) m(f, 784, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I785)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I785(m, f, sep, x, peek, ...) m(f, 785, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I786)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I786(m, f, sep, x, peek, ...) m(f, 786, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I787)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I787(m, f, sep, x, peek, ...) m(f, 787, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I788)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I788(m, f, sep, x, peek, ...) m(f, 788, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I789)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I789(m, f, sep, x, peek, ...) m(f, 789, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I790)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I790(m, f, sep, x, peek, ...) m(f, 790, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I791)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I791(m, f, sep, x, peek, ...) m(f, 791, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I792)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I792(m, f, sep, x, peek, ...) m(f, 792, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I793)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I793(m, f, sep, x, peek, ...) m(f, 793, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I794)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I794(m, f, sep, x, peek, ...) m(f, 794, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I795)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I795(m, f, sep, x, peek, ...) m(f, 795, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I796)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I796(m, f, sep, x, peek, ...) m(f, 796, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I797)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I797(m, f, sep, x, peek, ...) m(f, 797, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I798)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I798(m, f, sep, x, peek, ...) m(f, 798, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I799)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I799(m, f, sep, x, peek, ...) m(f, 799, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I800)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I800(m, f, sep, x, peek, ...) m(f, 800, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I801)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I801(m, f, sep, x, peek, ...) m(f, 801, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I802)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I802(m, f, sep, x, peek, ...) m(f, 802, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I803)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I803(m, f, sep, x, peek, ...) m(f, 803, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I804)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I804(m, f, sep, x, peek, ...) m(f, 804, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I805)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I805(m, f, sep, x, peek, ...) m(f, 805, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I806)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I806(m, f, sep, x, peek, ...) m(f, 806, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I807)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I807(m, f, sep, x, peek, ...) m(f, 807, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I808)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I808(m, f, sep, x, peek, ...) m(f, 808, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I809)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I809(m, f, sep, x, peek, ...) m(f, 809, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I810)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I810(m, f, sep, x, peek, ...) m(f, 810, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I811)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I811(m, f, sep, x, peek, ...) m(f, 811, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I812)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I812(m, f, sep, x, peek, ...) m(f, 812, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I813)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I813(m, f, sep, x, peek, ...) m(f, 813, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I814)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I814(m, f, sep, x, peek, ...) m(f, 814, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I815)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I815(m, f, sep, x, peek, ...) m(f, 815, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I816)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I816(m, f, sep, x, peek, ...) m(f, 816, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I817)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I817(m, f, sep, x, peek, ...) m(f, 817, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I818)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I818(m, f, sep, x, peek, ...) m(f, 818, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I819)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I819(m, f, sep, x, peek, ...) m(f, 819, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I820)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I820(m, f, sep, x, peek, ...) m(f, 820, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I821)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I821(m, f, sep, x, peek, ...) m(f, 821, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I822)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I822(m, f, sep, x, peek, ...) m(f, 822, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I823)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I823(m, f, sep, x, peek, ...) m(f, 823, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I824)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I824(m, f, sep, x, peek, ...) m(f, 824, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I825)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I825(m, f, sep, x, peek, ...) m(f, 825, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I826)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I826(m, f, sep, x, peek, ...) m(f, 826, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I827)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I827(m, f, sep, x, peek, ...) m(f, 827, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I828)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I828(m, f, sep, x, peek, ...) m(f, 828, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I829)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I829(m, f, sep, x, peek, ...) m(f, 829, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I830)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I830(m, f, sep, x, peek, ...) m(f, 830, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I831)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I831(m, f, sep, x, peek, ...) m(f, 831, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I832)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I832(m, f, sep, x, peek, ...) m(f, 832, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I833)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I833(m, f, sep, x, peek, ...) m(f, 833, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I834)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I834(m, f, sep, x, peek, ...) m(f, 834, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I835)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I835(m, f, sep, x, peek, ...) m(f, 835, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I836)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I836(m, f, sep, x, peek, ...) m(f, 836, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I837)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I837(m, f, sep, x, peek, ...) m(f, 837, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I838)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I838(m, f, sep, x, peek, ...) m(f, 838, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I839)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I839(m, f, sep, x, peek, ...) m(f, 839, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I840)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I840(m, f, sep, x, peek, ...) m(f, 840, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I841)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I841(m, f, sep, x, peek, ...) m(f, 841, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I842)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I842(m, f, sep, x, peek, ...) m(f, 842, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I843)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I843(m, f, sep, x, peek, ...) m(f, 843, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I844)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I844(m, f, sep, x, peek, ...) m(f, 844, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I845)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I845(m, f, sep, x, peek, ...) m(f, 845, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I846)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I846(m, f, sep, x, peek, ...) m(f, 846, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I847)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I847(m, f, sep, x, peek, ...) m(f, 847, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I848)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I848(m, f, sep, x, peek, ...) m(f, 848, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I849)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I849(m, f, sep, x, peek, ...) m(f, 849, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I850)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I850(m, f, sep, x, peek, ...) m(f, 850, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I851)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I851(m, f, sep, x, peek, ...) m(f, 851, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I852)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I852(m, f, sep, x, peek, ...) m(f, 852, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I853)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I853(m, f, sep, x, peek, ...) m(f, 853, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I854)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I854(m, f, sep, x, peek, ...) m(f, 854, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I855)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I855(m, f, sep, x, peek, ...) m(f, 855, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I856)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I856(m, f, sep, x, peek, ...) m(f, 856, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I857)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I857(m, f, sep, x, peek, ...) m(f, 857, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I858)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I858(m, f, sep, x, peek, ...) m(f, 858, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I859)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I859(m, f, sep, x, peek, ...) m(f, 859, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I860)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I860(m, f, sep, x, peek, ...) m(f, 860, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I861)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I861(m, f, sep, x, peek, ...) m(f, 861, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I862)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I862(m, f, sep, x, peek, ...) m(f, 862, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I863)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I863(m, f, sep, x, peek, ...) m(f, 863, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I864)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I864(m, f, sep, x, peek, ...) m(f, 864, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I865)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I865(m, f, sep, x, peek, ...) m(f, 865, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I866)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I866(m, f, sep, x, peek, ...) m(f, 866, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I867)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I867(m, f, sep, x, peek, ...) m(f, 867, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I868)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I868(m, f, sep, x, peek, ...) m(f, 868, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I869)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I869(m, f, sep, x, peek, ...) m(f, 869, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I870)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I870(m, f, sep, x, peek, ...) m(f, 870, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I871)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I871(m, f, sep, x, peek, ...) m(f, 871, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I872)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I872(m, f, sep, x, peek, ...) m(f, 872, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I873)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I873(m, f, sep, x, peek, ...) m(f, 873, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I874)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I874(m, f, sep, x, peek, ...) m(f, 874, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I875)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I875(m, f, sep, x, peek, ...) m(f, 875, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I876)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I876(m, f, sep, x, peek, ...) m(f, 876, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I877)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I877(m, f, sep, x, peek, ...) m(f, 877, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I878)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I878(m, f, sep, x, peek, ...) m(f, 878, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I879)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I879(m, f, sep, x, peek, ...) m(f, 879, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I880)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I880(m, f, sep, x, peek, ...) m(f, 880, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I881)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I881(m, f, sep, x, peek, ...) m(f, 881, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I882)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I882(m, f, sep, x, peek, ...) m(f, 882, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I883)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I883(m, f, sep, x, peek, ...) m(f, 883, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I884)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I884(m, f, sep, x, peek, ...) m(f, 884, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I885)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I885(m, f, sep, x, peek, ...) m(f, 885, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I886)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I886(m, f, sep, x, peek, ...) m(f, 886, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I887)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I887(m, f, sep, x, peek, ...) m(f, 887, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I888)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I888(m, f, sep, x, peek, ...) m(f, 888, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I889)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I889(m, f, sep, x, peek, ...) m(f, 889, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I890)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I890(m, f, sep, x, peek, ...) m(f, 890, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I891)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I891(m, f, sep, x, peek, ...) m(f, 891, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I892)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I892(m, f, sep, x, peek, ...) m(f, 892, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I893)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I893(m, f, sep, x, peek, ...) m(f, 893, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I894)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I894(m, f, sep, x, peek, ...) m(f, 894, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I895)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I895(m, f, sep, x, peek, ...) m(f, 895, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I896)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I896(m, f, sep, x, peek, ...) m(f, 896, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I897)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I897(m, f, sep, x, peek, ...) m(f, 897, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I898)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I898(m, f, sep, x, peek, ...) m(f, 898, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I899)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I899(m, f, sep, x, peek, ...) m(f, 899, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I900)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I900(m, f, sep, x, peek, ...) m(f, 900, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I901)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I901(m, f, sep, x, peek, ...) m(f, 901, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I902)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I902(m, f, sep, x, peek, ...) m(f, 902, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I903)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I903(m, f, sep, x, peek, ...) m(f, 903, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I904)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I904(m, f, sep, x, peek, ...) m(f, 904, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I905)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I905(m, f, sep, x, peek, ...) m(f, 905, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I906)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I906(m, f, sep, x, peek, ...) m(f, 906, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I907)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I907(m, f, sep, x, peek, ...) m(f, 907, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I908)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I908(m, f, sep, x, peek, ...) m(f, 908, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I909)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I909(m, f, sep, x, peek, ...) m(f, 909, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I910)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I910(m, f, sep, x, peek, ...) m(f, 910, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I911)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I911(m, f, sep, x, peek, ...) m(f, 911, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I912)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I912(m, f, sep, x, peek, ...) m(f, 912, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I913)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I913(m, f, sep, x, peek, ...) m(f, 913, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I914)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I914(m, f, sep, x, peek, ...) m(f, 914, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I915)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I915(m, f, sep, x, peek, ...) m(f, 915, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I916)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I916(m, f, sep, x, peek, ...) m(f, 916, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I917)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I917(m, f, sep, x, peek, ...) m(f, 917, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I918)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I918(m, f, sep, x, peek, ...) m(f, 918, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I919)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I919(m, f, sep, x, peek, ...) m(f, 919, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I920)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I920(m, f, sep, x, peek, ...) m(f, 920, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I921)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I921(m, f, sep, x, peek, ...) m(f, 921, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I922)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I922(m, f, sep, x, peek, ...) m(f, 922, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I923)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I923(m, f, sep, x, peek, ...) m(f, 923, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I924)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I924(m, f, sep, x, peek, ...) m(f, 924, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I925)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I925(m, f, sep, x, peek, ...) m(f, 925, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I926)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I926(m, f, sep, x, peek, ...) m(f, 926, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I927)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I927(m, f, sep, x, peek, ...) m(f, 927, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I928)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I928(m, f, sep, x, peek, ...) m(f, 928, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I929)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I929(m, f, sep, x, peek, ...) m(f, 929, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I930)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I930(m, f, sep, x, peek, ...) m(f, 930, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I931)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I931(m, f, sep, x, peek, ...) m(f, 931, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I932)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I932(m, f, sep, x, peek, ...) m(f, 932, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I933)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I933(m, f, sep, x, peek, ...) m(f, 933, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I934)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I934(m, f, sep, x, peek, ...) m(f, 934, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I935)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I935(m, f, sep, x, peek, ...) m(f, 935, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I936)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I936(m, f, sep, x, peek, ...) m(f, 936, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I937)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I937(m, f, sep, x, peek, ...) m(f, 937, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I938)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I938(m, f, sep, x, peek, ...) m(f, 938, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I939)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I939(m, f, sep, x, peek, ...) m(f, 939, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I940)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I940(m, f, sep, x, peek, ...) m(f, 940, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I941)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I941(m, f, sep, x, peek, ...) m(f, 941, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I942)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I942(m, f, sep, x, peek, ...) m(f, 942, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I943)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I943(m, f, sep, x, peek, ...) m(f, 943, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I944)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I944(m, f, sep, x, peek, ...) m(f, 944, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I945)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I945(m, f, sep, x, peek, ...) m(f, 945, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I946)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I946(m, f, sep, x, peek, ...) m(f, 946, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I947)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I947(m, f, sep, x, peek, ...) m(f, 947, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I948)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I948(m, f, sep, x, peek, ...) m(f, 948, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I949)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I949(m, f, sep, x, peek, ...) m(f, 949, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I950)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I950(m, f, sep, x, peek, ...) m(f, 950, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I951)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I951(m, f, sep, x, peek, ...) m(f, 951, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I952)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I952(m, f, sep, x, peek, ...) m(f, 952, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I953)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I953(m, f, sep, x, peek, ...) m(f, 953, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I954)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I954(m, f, sep, x, peek, ...) m(f, 954, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I955)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I955(m, f, sep, x, peek, ...) m(f, 955, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I956)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I956(m, f, sep, x, peek, ...) m(f, 956, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I957)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I957(m, f, sep, x, peek, ...) m(f, 957, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I958)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I958(m, f, sep, x, peek, ...) m(f, 958, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I959)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I959(m, f, sep, x, peek, ...) m(f, 959, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I960)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I960(m, f, sep, x, peek, ...) m(f, 960, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I961)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I961(m, f, sep, x, peek, ...) m(f, 961, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I962)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I962(m, f, sep, x, peek, ...) m(f, 962, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I963)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I963(m, f, sep, x, peek, ...) m(f, 963, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I964)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I964(m, f, sep, x, peek, ...) m(f, 964, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I965)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I965(m, f, sep, x, peek, ...) m(f, 965, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I966)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I966(m, f, sep, x, peek, ...) m(f, 966, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I967)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I967(m, f, sep, x, peek, ...) m(f, 967, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I968)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I968(m, f, sep, x, peek, ...) m(f, 968, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I969)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I969(m, f, sep, x, peek, ...) m(f, 969, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I970)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I970(m, f, sep, x, peek, ...) m(f, 970, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I971)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I971(m, f, sep, x, peek, ...) m(f, 971, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I972)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I972(m, f, sep, x, peek, ...) m(f, 972, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I973)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I973(m, f, sep, x, peek, ...) m(f, 973, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I974)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I974(m, f, sep, x, peek, ...) m(f, 974, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I975)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I975(m, f, sep, x, peek, ...) m(f, 975, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I976)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I976(m, f, sep, x, peek, ...) m(f, 976, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I977)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I977(m, f, sep, x, peek, ...) m(f, 977, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I978)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I978(m, f, sep, x, peek, ...) m(f, 978, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I979)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I979(m, f, sep, x, peek, ...) m(f, 979, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I980)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I980(m, f, sep, x, peek, ...) m(f, 980, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I981)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I981(m, f, sep, x, peek, ...) m(f, 981, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I982)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I982(m, f, sep, x, peek, ...) m(f, 982, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I983)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I983(m, f, sep, x, peek, ...) m(f, 983, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I984)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I984(m, f, sep, x, peek, ...) m(f, 984, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I985)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I985(m, f, sep, x, peek, ...) m(f, 985, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I986)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I986(m, f, sep, x, peek, ...) m(f, 986, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I987)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I987(m, f, sep, x, peek, ...) m(f, 987, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I988)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I988(m, f, sep, x, peek, ...) m(f, 988, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I989)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I989(m, f, sep, x, peek, ...) m(f, 989, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I990)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I990(m, f, sep, x, peek, ...) m(f, 990, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I991)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I991(m, f, sep, x, peek, ...) m(f, 991, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I992)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I992(m, f, sep, x, peek, ...) m(f, 992, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I993)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I993(m, f, sep, x, peek, ...) m(f, 993, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I994)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I994(m, f, sep, x, peek, ...) m(f, 994, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I995)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I995(m, f, sep, x, peek, ...) m(f, 995, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I996)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I996(m, f, sep, x, peek, ...) m(f, 996, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I997)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I997(m, f, sep, x, peek, ...) m(f, 997, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I998)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I998(m, f, sep, x, peek, ...) m(f, 998, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I999)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I999(m, f, sep, x, peek, ...) m(f, 999, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I1000)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I1000(m, f, sep, x, peek, ...) m(f, 1000, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I1001)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I1001(m, f, sep, x, peek, ...) m(f, 1001, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I1002)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I1002(m, f, sep, x, peek, ...) m(f, 1002, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I1003)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I1003(m, f, sep, x, peek, ...) m(f, 1003, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I1004)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I1004(m, f, sep, x, peek, ...) m(f, 1004, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I1005)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I1005(m, f, sep, x, peek, ...) m(f, 1005, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I1006)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I1006(m, f, sep, x, peek, ...) m(f, 1006, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I1007)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I1007(m, f, sep, x, peek, ...) m(f, 1007, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I1008)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I1008(m, f, sep, x, peek, ...) m(f, 1008, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I1009)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I1009(m, f, sep, x, peek, ...) m(f, 1009, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I1010)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I1010(m, f, sep, x, peek, ...) m(f, 1010, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I1011)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I1011(m, f, sep, x, peek, ...) m(f, 1011, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I1012)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I1012(m, f, sep, x, peek, ...) m(f, 1012, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I1013)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I1013(m, f, sep, x, peek, ...) m(f, 1013, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I1014)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I1014(m, f, sep, x, peek, ...) m(f, 1014, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I1015)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I1015(m, f, sep, x, peek, ...) m(f, 1015, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I1016)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I1016(m, f, sep, x, peek, ...) m(f, 1016, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I1017)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I1017(m, f, sep, x, peek, ...) m(f, 1017, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I1018)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I1018(m, f, sep, x, peek, ...) m(f, 1018, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I1019)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I1019(m, f, sep, x, peek, ...) m(f, 1019, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I1020)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I1020(m, f, sep, x, peek, ...) m(f, 1020, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I1021)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I1021(m, f, sep, x, peek, ...) m(f, 1021, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I1022)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I1022(m, f, sep, x, peek, ...) m(f, 1022, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I1023)(m, f, sep, peek, __VA_ARGS__))
+#define MAP_I1023(m, f, sep, x, peek, ...) m(f, 1023, x) MAP_EXPAND(MAP_NEXT(peek, sep, MAP_I1024)(m, f, sep, peek, __VA_ARGS__))
 
-#define MAP_LIST0(f, x, peek, ...) f(x) MAP_LIST_NEXT(peek, MAP_LIST1)(f, peek, __VA_ARGS__)
-#define MAP_LIST1(f, x, peek, ...) f(x) MAP_LIST_NEXT(peek, MAP_LIST0)(f, peek, __VA_ARGS__)
+#else
+#define MAP_NEXT1(test, sep, next) MAP_NEXT0(test, sep() next, 0)
+#define MAP_APPLY(m, f, sep, ...) MAP_I0(m, f, sep, __VA_ARGS__, ()()(), ()()(), ()()(), 0)
+
+//Step i calls m(f, i, x) for the argument x, inserts sep() if there is a next argument and continues with step i + 1
+#define MAP_I0(m, f, sep, x, peek, ...) m(f, 0, x) MAP_NEXT(peek, sep, MAP_I1)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I1(m, f, sep, x, peek, ...) m(f, 1, x) MAP_NEXT(peek, sep, MAP_I2)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I2(m, f, sep, x, peek, ...) m(f, 2, x) MAP_NEXT(peek, sep, MAP_I3)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I3(m, f, sep, x, peek, ...) m(f, 3, x) MAP_NEXT(peek, sep, MAP_I4)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I4(m, f, sep, x, peek, ...) m(f, 4, x) MAP_NEXT(peek, sep, MAP_I5)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I5(m, f, sep, x, peek, ...) m(f, 5, x) MAP_NEXT(peek, sep, MAP_I6)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I6(m, f, sep, x, peek, ...) m(f, 6, x) MAP_NEXT(peek, sep, MAP_I7)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I7(m, f, sep, x, peek, ...) m(f, 7, x) MAP_NEXT(peek, sep, MAP_I8)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I8(m, f, sep, x, peek, ...) m(f, 8, x) MAP_NEXT(peek, sep, MAP_I9)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I9(m, f, sep, x, peek, ...) m(f, 9, x) MAP_NEXT(peek, sep, MAP_I10)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I10(m, f, sep, x, peek, ...) m(f, 10, x) MAP_NEXT(peek, sep, MAP_I11)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I11(m, f, sep, x, peek, ...) m(f, 11, x) MAP_NEXT(peek, sep, MAP_I12)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I12(m, f, sep, x, peek, ...) m(f, 12, x) MAP_NEXT(peek, sep, MAP_I13)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I13(m, f, sep, x, peek, ...) m(f, 13, x) MAP_NEXT(peek, sep, MAP_I14)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I14(m, f, sep, x, peek, ...) m(f, 14, x) MAP_NEXT(peek, sep, MAP_I15)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I15(m, f, sep, x, peek, ...) m(f, 15, x) MAP_NEXT(peek, sep, MAP_I16)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I16(m, f, sep, x, peek, ...) m(f, 16, x) MAP_NEXT(peek, sep, MAP_I17)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I17(m, f, sep, x, peek, ...) m(f, 17, x) MAP_NEXT(peek, sep, MAP_I18)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I18(m, f, sep, x, peek, ...) m(f, 18, x) MAP_NEXT(peek, sep, MAP_I19)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I19(m, f, sep, x, peek, ...) m(f, 19, x) MAP_NEXT(peek, sep, MAP_I20)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I20(m, f, sep, x, peek, ...) m(f, 20, x) MAP_NEXT(peek, sep, MAP_I21)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I21(m, f, sep, x, peek, ...) m(f, 21, x) MAP_NEXT(peek, sep, MAP_I22)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I22(m, f, sep, x, peek, ...) m(f, 22, x) MAP_NEXT(peek, sep, MAP_I23)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I23(m, f, sep, x, peek, ...) m(f, 23, x) MAP_NEXT(peek, sep, MAP_I24)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I24(m, f, sep, x, peek, ...) m(f, 24, x) MAP_NEXT(peek, sep, MAP_I25)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I25(m, f, sep, x, peek, ...) m(f, 25, x) MAP_NEXT(peek, sep, MAP_I26)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I26(m, f, sep, x, peek, ...) m(f, 26, x) MAP_NEXT(peek, sep, MAP_I27)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I27(m, f, sep, x, peek, ...) m(f, 27, x) MAP_NEXT(peek, sep, MAP_I28)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I28(m, f, sep, x, peek, ...) m(f, 28, x) MAP_NEXT(peek, sep, MAP_I29)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I29(m, f, sep, x, peek, ...) m(f, 29, x) MAP_NEXT(peek, sep, MAP_I30)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I30(m, f, sep, x, peek, ...) m(f, 30, x) MAP_NEXT(peek, sep, MAP_I31)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I31(m, f, sep, x, peek, ...) m(f, 31, x) MAP_NEXT(peek, sep, MAP_I32)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I32(m, f, sep, x, peek, ...) m(f, 32, x) MAP_NEXT(peek, sep, MAP_I33)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I33(m, f, sep, x, peek, ...) m(f, 33, x) MAP_NEXT(peek, sep, MAP_I34)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I34(m, f, sep, x, peek, ...) m(f, 34, x) MAP_NEXT(peek, sep, MAP_I35)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I35(m, f, sep, x, peek, ...) m(f, 35, x) MAP_NEXT(peek, sep, MAP_I36)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I36(m, f, sep, x, peek, ...) m(f, 36, x) MAP_NEXT(peek, sep, MAP_I37)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I37(m, f, sep, x, peek, ...) m(f, 37, x) MAP_NEXT(peek, sep, MAP_I38)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I38(m, f, sep, x, peek, ...) m(f, 38, x) MAP_NEXT(peek, sep, MAP_I39)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I39(m, f, sep, x, peek, ...) m(f, 39, x) MAP_NEXT(peek, sep, MAP_I40)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I40(m, f, sep, x, peek, ...) m(f, 40, x) MAP_NEXT(peek, sep, MAP_I41)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I41(m, f, sep, x, peek, ...) m(f, 41, x) MAP_NEXT(peek, sep, MAP_I42)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I42(m, f, sep, x, peek, ...) m(f, 42, x) MAP_NEXT(peek, sep, MAP_I43)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I43(m, f, sep, x, peek, ...) m(f, 43, x) MAP_NEXT(peek, sep, MAP_I44)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I44(m, f, sep, x, peek, ...) m(f, 44, x) MAP_NEXT(peek, sep, MAP_I45)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I45(m, f, sep, x, peek, ...) m(f, 45, x) MAP_NEXT(peek, sep, MAP_I46)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I46(m, f, sep, x, peek, ...) m(f, 46, x) MAP_NEXT(peek, sep, MAP_I47)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I47(m, f, sep, x, peek, ...) m(f, 47, x) MAP_NEXT(peek, sep, MAP_I48)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I48(m, f, sep, x, peek, ...) m(f, 48, x) MAP_NEXT(peek, sep, MAP_I49)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I49(m, f, sep, x, peek, ...) m(f, 49, x) MAP_NEXT(peek, sep, MAP_I50)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I50(m, f, sep, x, peek, ...) m(f, 50, x) MAP_NEXT(peek, sep, MAP_I51)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I51(m, f, sep, x, peek, ...) m(f, 51, x) MAP_NEXT(peek, sep, MAP_I52)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I52(m, f, sep, x, peek, ...) m(f, 52, x) MAP_NEXT(peek, sep, MAP_I53)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I53(m, f, sep, x, peek, ...) m(f, 53, x) MAP_NEXT(peek, sep, MAP_I54)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I54(m, f, sep, x, peek, ...) m(f, 54, x) MAP_NEXT(peek, sep, MAP_I55)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I55(m, f, sep, x, peek, ...) m(f, 55, x) MAP_NEXT(peek, sep, MAP_I56)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I56(m, f, sep, x, peek, ...) m(f, 56, x) MAP_NEXT(peek, sep, MAP_I57)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I57(m, f, sep, x, peek, ...) m(f, 57, x) MAP_NEXT(peek, sep, MAP_I58)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I58(m, f, sep, x, peek, ...) m(f, 58, x) MAP_NEXT(peek, sep, MAP_I59)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I59(m, f, sep, x, peek, ...) m(f, 59, x) MAP_NEXT(peek, sep, MAP_I60)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I60(m, f, sep, x, peek, ...) m(f, 60, x) MAP_NEXT(peek, sep, MAP_I61)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I61(m, f, sep, x, peek, ...) m(f, 61, x) MAP_NEXT(peek, sep, MAP_I62)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I62(m, f, sep, x, peek, ...) m(f, 62, x) MAP_NEXT(peek, sep, MAP_I63)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I63(m, f, sep, x, peek, ...) m(f, 63, x) MAP_NEXT(peek, sep, MAP_I64)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I64(m, f, sep, x, peek, ...) m(f, 64, x) MAP_NEXT(peek, sep, MAP_I65)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I65(m, f, sep, x, peek, ...) m(f, 65, x) MAP_NEXT(peek, sep, MAP_I66)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I66(m, f, sep, x, peek, ...) m(f, 66, x) MAP_NEXT(peek, sep, MAP_I67)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I67(m, f, sep, x, peek, ...) m(f, 67, x) MAP_NEXT(peek, sep, MAP_I68)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I68(m, f, sep, x, peek, ...) m(f, 68, x) MAP_NEXT(peek, sep, MAP_I69)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I69(m, f, sep, x, peek, ...) m(f, 69, x) MAP_NEXT(peek, sep, MAP_I70)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I70(m, f, sep, x, peek, ...) m(f, 70, x) MAP_NEXT(peek, sep, MAP_I71)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I71(m, f, sep, x, peek, ...) m(f, 71, x) MAP_NEXT(peek, sep, MAP_I72)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I72(m, f, sep, x, peek, ...) m(f, 72, x) MAP_NEXT(peek, sep, MAP_I73)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I73(m, f, sep, x, peek, ...) m(f, 73, x) MAP_NEXT(peek, sep, MAP_I74)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I74(m, f, sep, x, peek, ...) m(f, 74, x) MAP_NEXT(peek, sep, MAP_I75)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I75(m, f, sep, x, peek, ...) m(f, 75, x) MAP_NEXT(peek, sep, MAP_I76)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I76(m, f, sep, x, peek, ...) m(f, 76, x) MAP_NEXT(peek, sep, MAP_I77)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I77(m, f, sep, x, peek, ...) m(f, 77, x) MAP_NEXT(peek, sep, MAP_I78)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I78(m, f, sep, x, peek, ...) m(f, 78, x) MAP_NEXT(peek, sep, MAP_I79)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I79(m, f, sep, x, peek, ...) m(f, 79, x) MAP_NEXT(peek, sep, MAP_I80)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I80(m, f, sep, x, peek, ...) m(f, 80, x) MAP_NEXT(peek, sep, MAP_I81)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I81(m, f, sep, x, peek, ...) m(f, 81, x) MAP_NEXT(peek, sep, MAP_I82)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I82(m, f, sep, x, peek, ...) m(f, 82, x) MAP_NEXT(peek, sep, MAP_I83)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I83(m, f, sep, x, peek, ...) m(f, 83, x) MAP_NEXT(peek, sep, MAP_I84)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I84(m, f, sep, x, peek, ...) m(f, 84, x) MAP_NEXT(peek, sep, MAP_I85)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I85(m, f, sep, x, peek, ...) m(f, 85, x) MAP_NEXT(peek, sep, MAP_I86)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I86(m, f, sep, x, peek, ...) m(f, 86, x) MAP_NEXT(peek, sep, MAP_I87)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I87(m, f, sep, x, peek, ...) m(f, 87, x) MAP_NEXT(peek, sep, MAP_I88)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I88(m, f, sep, x, peek, ...) m(f, 88, x) MAP_NEXT(peek, sep, MAP_I89)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I89(m, f, sep, x, peek, ...) m(f, 89, x) MAP_NEXT(peek, sep, MAP_I90)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I90(m, f, sep, x, peek, ...) m(f, 90, x) MAP_NEXT(peek, sep, MAP_I91)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I91(m, f, sep, x, peek, ...) m(f, 91, x) MAP_NEXT(peek, sep, MAP_I92)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I92(m, f, sep, x, peek, ...) m(f, 92, x) MAP_NEXT(peek, sep, MAP_I93)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I93(m, f, sep, x, peek, ...) m(f, 93, x) MAP_NEXT(peek, sep, MAP_I94)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I94(m, f, sep, x, peek, ...) m(f, 94, x) MAP_NEXT(peek, sep, MAP_I95)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I95(m, f, sep, x, peek, ...) m(f, 95, x) MAP_NEXT(peek, sep, MAP_I96)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I96(m, f, sep, x, peek, ...) m(f, 96, x) MAP_NEXT(peek, sep, MAP_I97)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I97(m, f, sep, x, peek, ...) m(f, 97, x) MAP_NEXT(peek, sep, MAP_I98)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I98(m, f, sep, x, peek, ...) m(f, 98, x) MAP_NEXT(peek, sep, MAP_I99)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I99(m, f, sep, x, peek, ...) m(f, 99, x) MAP_NEXT(peek, sep, MAP_I100)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I100(m, f, sep, x, peek, ...) m(f, 100, x) MAP_NEXT(peek, sep, MAP_I101)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I101(m, f, sep, x, peek, ...) m(f, 101, x) MAP_NEXT(peek, sep, MAP_I102)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I102(m, f, sep, x, peek, ...) m(f, 102, x) MAP_NEXT(peek, sep, MAP_I103)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I103(m, f, sep, x, peek, ...) m(f, 103, x) MAP_NEXT(peek, sep, MAP_I104)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I104(m, f, sep, x, peek, ...) m(f, 104, x) MAP_NEXT(peek, sep, MAP_I105)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I105(m, f, sep, x, peek, ...) m(f, 105, x) MAP_NEXT(peek, sep, MAP_I106)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I106(m, f, sep, x, peek, ...) m(f, 106, x) MAP_NEXT(peek, sep, MAP_I107)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I107(m, f, sep, x, peek, ...) m(f, 107, x) MAP_NEXT(peek, sep, MAP_I108)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I108(m, f, sep, x, peek, ...) m(f, 108, x) MAP_NEXT(peek, sep, MAP_I109)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I109(m, f, sep, x, peek, ...) m(f, 109, x) MAP_NEXT(peek, sep, MAP_I110)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I110(m, f, sep, x, peek, ...) m(f, 110, x) MAP_NEXT(peek, sep, MAP_I111)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I111(m, f, sep, x, peek, ...) m(f, 111, x) MAP_NEXT(peek, sep, MAP_I112)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I112(m, f, sep, x, peek, ...) m(f, 112, x) MAP_NEXT(peek, sep, MAP_I113)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I113(m, f, sep, x, peek, ...) m(f, 113, x) MAP_NEXT(peek, sep, MAP_I114)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I114(m, f, sep, x, peek, ...) m(f, 114, x) MAP_NEXT(peek, sep, MAP_I115)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I115(m, f, sep, x, peek, ...) m(f, 115, x) MAP_NEXT(peek, sep, MAP_I116)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I116(m, f, sep, x, peek, ...) m(f, 116, x) MAP_NEXT(peek, sep, MAP_I117)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I117(m, f, sep, x, peek, ...) m(f, 117, x) MAP_NEXT(peek, sep, MAP_I118)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I118(m, f, sep, x, peek, ...) m(f, 118, x) MAP_NEXT(peek, sep, MAP_I119)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I119(m, f, sep, x, peek, ...) m(f, 119, x) MAP_NEXT(peek, sep, MAP_I120)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I120(m, f, sep, x, peek, ...) m(f, 120, x) MAP_NEXT(peek, sep, MAP_I121)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I121(m, f, sep, x, peek, ...) m(f, 121, x) MAP_NEXT(peek, sep, MAP_I122)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I122(m, f, sep, x, peek, ...) m(f, 122, x) MAP_NEXT(peek, sep, MAP_I123)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I123(m, f, sep, x, peek, ...) m(f, 123, x) MAP_NEXT(peek, sep, MAP_I124)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I124(m, f, sep, x, peek, ...) m(f, 124, x) MAP_NEXT(peek, sep, MAP_I125)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I125(m, f, sep, x, peek, ...) m(f, 125, x) MAP_NEXT(peek, sep, MAP_I126)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I126(m, f, sep, x, peek, ...) m(f, 126, x) MAP_NEXT(peek, sep, MAP_I127)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I127(m, f, sep, x, peek, ...) m(f, 127, x) MAP_NEXT(peek, sep, MAP_I128)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I128(m, f, sep, x, peek, ...) m(f, 128, x) MAP_NEXT(peek, sep, MAP_I129)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I129(m, f, sep, x, peek, ...) m(f, 129, x) MAP_NEXT(peek, sep, MAP_I130)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I130(m, f, sep, x, peek, ...) m(f, 130, x) MAP_NEXT(peek, sep, MAP_I131)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I131(m, f, sep, x, peek, ...) m(f, 131, x) MAP_NEXT(peek, sep, MAP_I132)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I132(m, f, sep, x, peek, ...) m(f, 132, x) MAP_NEXT(peek, sep, MAP_I133)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I133(m, f, sep, x, peek, ...) m(f, 133, x) MAP_NEXT(peek, sep, MAP_I134)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I134(m, f, sep, x, peek, ...) m(f, 134, x) MAP_NEXT(peek, sep, MAP_I135)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I135(m, f, sep, x, peek, ...) m(f, 135, x) MAP_NEXT(peek, sep, MAP_I136)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I136(m, f, sep, x, peek, ...) m(f, 136, x) MAP_NEXT(peek, sep, MAP_I137)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I137(m, f, sep, x, peek, ...) m(f, 137, x) MAP_NEXT(peek, sep, MAP_I138)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I138(m, f, sep, x, peek, ...) m(f, 138, x) MAP_NEXT(peek, sep, MAP_I139)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I139(m, f, sep, x, peek, ...) m(f, 139, x) MAP_NEXT(peek, sep, MAP_I140)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I140(m, f, sep, x, peek, ...) m(f, 140, x) MAP_NEXT(peek, sep, MAP_I141)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I141(m, f, sep, x, peek, ...) m(f, 141, x) MAP_NEXT(peek, sep, MAP_I142)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I142(m, f, sep, x, peek, ...) m(f, 142, x) MAP_NEXT(peek, sep, MAP_I143)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I143(m, f, sep, x, peek, ...) m(f, 143, x) MAP_NEXT(peek, sep, MAP_I144)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I144(m, f, sep, x, peek, ...) m(f, 144, x) MAP_NEXT(peek, sep, MAP_I145)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I145(m, f, sep, x, peek, ...) m(f, 145, x) MAP_NEXT(peek, sep, MAP_I146)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I146(m, f, sep, x, peek, ...) m(f, 146, x) MAP_NEXT(peek, sep, MAP_I147)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I147(m, f, sep, x, peek, ...) m(f, 147, x) MAP_NEXT(peek, sep, MAP_I148)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I148(m, f, sep, x, peek, ...) m(f, 148, x) MAP_NEXT(peek, sep, MAP_I149)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I149(m, f, sep, x, peek, ...) m(f, 149, x) MAP_NEXT(peek, sep, MAP_I150)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I150(m, f, sep, x, peek, ...) m(f, 150, x) MAP_NEXT(peek, sep, MAP_I151)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I151(m, f, sep, x, peek, ...) m(f, 151, x) MAP_NEXT(peek, sep, MAP_I152)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I152(m, f, sep, x, peek, ...) m(f, 152, x) MAP_NEXT(peek, sep, MAP_I153)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I153(m, f, sep, x, peek, ...) m(f, 153, x) MAP_NEXT(peek, sep, MAP_I154)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I154(m, f, sep, x, peek, ...) m(f, 154, x) MAP_NEXT(peek, sep, MAP_I155)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I155(m, f, sep, x, peek, ...) m(f, 155, x) MAP_NEXT(peek, sep, MAP_I156)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I156(m, f, sep, x, peek, ...) m(f, 156, x) MAP_NEXT(peek, sep, MAP_I157)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I157(m, f, sep, x, peek, ...) m(f, 157, x) MAP_NEXT(peek, sep, MAP_I158)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I158(m, f, sep, x, peek, ...) m(f, 158, x) MAP_NEXT(peek, sep, MAP_I159)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I159(m, f, sep, x, peek, ...) m(f, 159, x) MAP_NEXT(peek, sep, MAP_I160)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I160(m, f, sep, x, peek, ...) m(f, 160, x) MAP_NEXT(peek, sep, MAP_I161)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I161(m, f, sep, x, peek, ...) m(f, 161, x) MAP_NEXT(peek, sep, MAP_I162)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I162(m, f, sep, x, peek, ...) m(f, 162, x) MAP_NEXT(peek, sep, MAP_I163)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I163(m, f, sep, x, peek, ...) m(f, 163, x) MAP_NEXT(peek, sep, MAP_I164)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I164(m, f, sep, x, peek, ...) m(f, 164, x) MAP_NEXT(peek, sep, MAP_I165)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I165(m, f, sep, x, peek, ...) m(f, 165, x) MAP_NEXT(peek, sep, MAP_I166)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I166(m, f, sep, x, peek, ...) m(f, 166, x) MAP_NEXT(peek, sep, MAP_I167)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I167(m, f, sep, x, peek, ...) m(f, 167, x) MAP_NEXT(peek, sep, MAP_I168)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I168(m, f, sep, x, peek, ...) m(f, 168, x) MAP_NEXT(peek, sep, MAP_I169)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I169(m, f, sep, x, peek, ...) m(f, 169, x) MAP_NEXT(peek, sep, MAP_I170)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I170(m, f, sep, x, peek, ...) m(f, 170, x) MAP_NEXT(peek, sep, MAP_I171)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I171(m, f, sep, x, peek, ...) m(f, 171, x) MAP_NEXT(peek, sep, MAP_I172)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I172(m, f, sep, x, peek, ...) m(f, 172, x) MAP_NEXT(peek, sep, MAP_I173)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I173(m, f, sep, x, peek, ...) m(f, 173, x) MAP_NEXT(peek, sep, MAP_I174)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I174(m, f, sep, x, peek, ...) m(f, 174, x) MAP_NEXT(peek, sep, MAP_I175)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I175(m, f, sep, x, peek, ...) m(f, 175, x) MAP_NEXT(peek, sep, MAP_I176)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I176(m, f, sep, x, peek, ...) m(f, 176, x) MAP_NEXT(peek, sep, MAP_I177)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I177(m, f, sep, x, peek, ...) m(f, 177, x) MAP_NEXT(peek, sep, MAP_I178)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I178(m, f, sep, x, peek, ...) m(f, 178, x) MAP_NEXT(peek, sep, MAP_I179)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I179(m, f, sep, x, peek, ...) m(f, 179, x) MAP_NEXT(peek, sep, MAP_I180)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I180(m, f, sep, x, peek, ...) m(f, 180, x) MAP_NEXT(peek, sep, MAP_I181)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I181(m, f, sep, x, peek, ...) m(f, 181, x) MAP_NEXT(peek, sep, MAP_I182)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I182(m, f, sep, x, peek, ...) m(f, 182, x) MAP_NEXT(peek, sep, MAP_I183)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I183(m, f, sep, x, peek, ...) m(f, 183, x) MAP_NEXT(peek, sep, MAP_I184)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I184(m, f, sep, x, peek, ...) m(f, 184, x) MAP_NEXT(peek, sep, MAP_I185)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I185(m, f, sep, x, peek, ...) m(f, 185, x) MAP_NEXT(peek, sep, MAP_I186)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I186(m, f, sep, x, peek, ...) m(f, 186, x) MAP_NEXT(peek, sep, MAP_I187)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I187(m, f, sep, x, peek, ...) m(f, 187, x) MAP_NEXT(peek, sep, MAP_I188)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I188(m, f, sep, x, peek, ...) m(f, 188, x) MAP_NEXT(peek, sep, MAP_I189)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I189(m, f, sep, x, peek, ...) m(f, 189, x) MAP_NEXT(peek, sep, MAP_I190)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I190(m, f, sep, x, peek, ...) m(f, 190, x) MAP_NEXT(peek, sep, MAP_I191)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I191(m, f, sep, x, peek, ...) m(f, 191, x) MAP_NEXT(peek, sep, MAP_I192)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I192(m, f, sep, x, peek, ...) m(f, 192, x) MAP_NEXT(peek, sep, MAP_I193)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I193(m, f, sep, x, peek, ...) m(f, 193, x) MAP_NEXT(peek, sep, MAP_I194)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I194(m, f, sep, x, peek, ...) m(f, 194, x) MAP_NEXT(peek, sep, MAP_I195)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I195(m, f, sep, x, peek, ...) m(f, 195, x) MAP_NEXT(peek, sep, MAP_I196)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I196(m, f, sep, x, peek, ...) m(f, 196, x) MAP_NEXT(peek, sep, MAP_I197)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I197(m, f, sep, x, peek, ...) m(f, 197, x) MAP_NEXT(peek, sep, MAP_I198)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I198(m, f, sep, x, peek, ...) m(f, 198, x) MAP_NEXT(peek, sep, MAP_I199)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I199(m, f, sep, x, peek, ...) m(f, 199, x) MAP_NEXT(peek, sep, MAP_I200)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I200(m, f, sep, x, peek, ...) m(f, 200, x) MAP_NEXT(peek, sep, MAP_I201)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I201(m, f, sep, x, peek, ...) m(f, 201, x) MAP_NEXT(peek, sep, MAP_I202)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I202(m, f, sep, x, peek, ...) m(f, 202, x) MAP_NEXT(peek, sep, MAP_I203)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I203(m, f, sep, x, peek, ...) m(f, 203, x) MAP_NEXT(peek, sep, MAP_I204)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I204(m, f, sep, x, peek, ...) m(f, 204, x) MAP_NEXT(peek, sep, MAP_I205)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I205(m, f, sep, x, peek, ...) m(f, 205, x) MAP_NEXT(peek, sep, MAP_I206)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I206(m, f, sep, x, peek, ...) m(f, 206, x) MAP_NEXT(peek, sep, MAP_I207)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I207(m, f, sep, x, peek, ...) m(f, 207, x) MAP_NEXT(peek, sep, MAP_I208)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I208(m, f, sep, x, peek, ...) m(f, 208, x) MAP_NEXT(peek, sep, MAP_I209)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I209(m, f, sep, x, peek, ...) m(f, 209, x) MAP_NEXT(peek, sep, MAP_I210)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I210(m, f, sep, x, peek, ...) m(f, 210, x) MAP_NEXT(peek, sep, MAP_I211)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I211(m, f, sep, x, peek, ...) m(f, 211, x) MAP_NEXT(peek, sep, MAP_I212)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I212(m, f, sep, x, peek, ...) m(f, 212, x) MAP_NEXT(peek, sep, MAP_I213)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I213(m, f, sep, x, peek, ...) m(f, 213, x) MAP_NEXT(peek, sep, MAP_I214)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I214(m, f, sep, x, peek, ...) m(f, 214, x) MAP_NEXT(peek, sep, MAP_I215)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I215(m, f, sep, x, peek, ...) m(f, 215, x) MAP_NEXT(peek, sep, MAP_I216)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I216(m, f, sep, x, peek, ...) m(f, 216, x) MAP_NEXT(peek, sep, MAP_I217)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I217(m, f, sep, x, peek, ...) m(f, 217, x) MAP_NEXT(peek, sep, MAP_I218)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I218(m, f, sep, x, peek, ...) m(f, 218, x) MAP_NEXT(peek, sep, MAP_I219)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I219(m, f, sep, x, peek, ...) m(f, 219, x) MAP_NEXT(peek, sep, MAP_I220)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I220(m, f, sep, x, peek, ...) m(f, 220, x) MAP_NEXT(peek, sep, MAP_I221)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I221(m, f, sep, x, peek, ...) m(f, 221, x) MAP_NEXT(peek, sep, MAP_I222)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I222(m, f, sep, x, peek, ...) m(f, 222, x) MAP_NEXT(peek, sep, MAP_I223)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I223(m, f, sep, x, peek, ...) m(f, 223, x) MAP_NEXT(peek, sep, MAP_I224)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I224(m, f, sep, x, peek, ...) m(f, 224, x) MAP_NEXT(peek, sep, MAP_I225)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I225(m, f, sep, x, peek, ...) m(f, 225, x) MAP_NEXT(peek, sep, MAP_I226)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I226(m, f, sep, x, peek, ...) m(f, 226, x) MAP_NEXT(peek, sep, MAP_I227)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I227(m, f, sep, x, peek, ...) m(f, 227, x) MAP_NEXT(peek, sep, MAP_I228)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I228(m, f, sep, x, peek, ...) m(f, 228, x) MAP_NEXT(peek, sep, MAP_I229)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I229(m, f, sep, x, peek, ...) m(f, 229, x) MAP_NEXT(peek, sep, MAP_I230)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I230(m, f, sep, x, peek, ...) m(f, 230, x) MAP_NEXT(peek, sep, MAP_I231)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I231(m, f, sep, x, peek, ...) m(f, 231, x) MAP_NEXT(peek, sep, MAP_I232)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I232(m, f, sep, x, peek, ...) m(f, 232, x) MAP_NEXT(peek, sep, MAP_I233)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I233(m, f, sep, x, peek, ...) m(f, 233, x) MAP_NEXT(peek, sep, MAP_I234)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I234(m, f, sep, x, peek, ...) m(f, 234, x) MAP_NEXT(peek, sep, MAP_I235)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I235(m, f, sep, x, peek, ...) m(f, 235, x) MAP_NEXT(peek, sep, MAP_I236)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I236(m, f, sep, x, peek, ...) m(f, 236, x) MAP_NEXT(peek, sep, MAP_I237)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I237(m, f, sep, x, peek, ...) m(f, 237, x) MAP_NEXT(peek, sep, MAP_I238)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I238(m, f, sep, x, peek, ...) m(f, 238, x) MAP_NEXT(peek, sep, MAP_I239)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I239(m, f, sep, x, peek, ...) m(f, 239, x) MAP_NEXT(peek, sep, MAP_I240)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I240(m, f, sep, x, peek, ...) m(f, 240, x) MAP_NEXT(peek, sep, MAP_I241)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I241(m, f, sep, x, peek, ...) m(f, 241, x) MAP_NEXT(peek, sep, MAP_I242)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I242(m, f, sep, x, peek, ...) m(f, 242, x) MAP_NEXT(peek, sep, MAP_I243)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I243(m, f, sep, x, peek, ...) m(f, 243, x) MAP_NEXT(peek, sep, MAP_I244)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I244(m, f, sep, x, peek, ...) m(f, 244, x) MAP_NEXT(peek, sep, MAP_I245)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I245(m, f, sep, x, peek, ...) m(f, 245, x) MAP_NEXT(peek, sep, MAP_I246)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I246(m, f, sep, x, peek, ...) m(f, 246, x) MAP_NEXT(peek, sep, MAP_I247)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I247(m, f, sep, x, peek, ...) m(f, 247, x) MAP_NEXT(peek, sep, MAP_I248)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I248(m, f, sep, x, peek, ...) m(f, 248, x) MAP_NEXT(peek, sep, MAP_I249)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I249(m, f, sep, x, peek, ...) m(f, 249, x) MAP_NEXT(peek, sep, MAP_I250)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I250(m, f, sep, x, peek, ...) m(f, 250, x) MAP_NEXT(peek, sep, MAP_I251)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I251(m, f, sep, x, peek, ...) m(f, 251, x) MAP_NEXT(peek, sep, MAP_I252)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I252(m, f, sep, x, peek, ...) m(f, 252, x) MAP_NEXT(peek, sep, MAP_I253)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I253(m, f, sep, x, peek, ...) m(f, 253, x) MAP_NEXT(peek, sep, MAP_I254)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I254(m, f, sep, x, peek, ...) m(f, 254, x) MAP_NEXT(peek, sep, MAP_I255)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I255(m, f, sep, x, peek, ...) m(f, 255, x) MAP_NEXT(peek, sep, MAP_I256)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I256(m, f, sep, x, peek, ...) m(f, 256, x) MAP_NEXT(peek, sep, MAP_I257)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I257(m, f, sep, x, peek, ...) m(f, 257, x) MAP_NEXT(peek, sep, MAP_I258)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I258(m, f, sep, x, peek, ...) m(f, 258, x) MAP_NEXT(peek, sep, MAP_I259)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I259(m, f, sep, x, peek, ...) m(f, 259, x) MAP_NEXT(peek, sep, MAP_I260)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I260(m, f, sep, x, peek, ...) m(f, 260, x) MAP_NEXT(peek, sep, MAP_I261)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I261(m, f, sep, x, peek, ...) m(f, 261, x) MAP_NEXT(peek, sep, MAP_I262)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I262(m, f, sep, x, peek, ...) m(f, 262, x) MAP_NEXT(peek, sep, MAP_I263)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I263(m, f, sep, x, peek, ...) m(f, 263, x) MAP_NEXT(peek, sep, MAP_I264)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I264(m, f, sep, x, peek, ...) m(f, 264, x) MAP_NEXT(peek, sep, MAP_I265)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I265(m, f, sep, x, peek, ...) m(f, 265, x) MAP_NEXT(peek, sep, MAP_I266)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I266(m, f, sep, x, peek, ...) m(f, 266, x) MAP_NEXT(peek, sep, MAP_I267)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I267(m, f, sep, x, peek, ...) m(f, 267, x) MAP_NEXT(peek, sep, MAP_I268)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I268(m, f, sep, x, peek, ...) m(f, 268, x) MAP_NEXT(peek, sep, MAP_I269)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I269(m, f, sep, x, peek, ...) m(f, 269, x) MAP_NEXT(peek, sep, MAP_I270)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I270(m, f, sep, x, peek, ...) m(f, 270, x) MAP_NEXT(peek, sep, MAP_I271)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I271(m, f, sep, x, peek, ...) m(f, 271, x) MAP_NEXT(peek, sep, MAP_I272)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I272(m, f, sep, x, peek, ...) m(f, 272, x) MAP_NEXT(peek, sep, MAP_I273)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I273(m, f, sep, x, peek, ...) m(f, 273, x) MAP_NEXT(peek, sep, MAP_I274)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I274(m, f, sep, x, peek, ...) m(f, 274, x) MAP_NEXT(peek, sep, MAP_I275)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I275(m, f, sep, x, peek, ...) m(f, 275, x) MAP_NEXT(peek, sep, MAP_I276)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I276(m, f, sep, x, peek, ...) m(f, 276, x) MAP_NEXT(peek, sep, MAP_I277)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I277(m, f, sep, x, peek, ...) m(f, 277, x) MAP_NEXT(peek, sep, MAP_I278)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I278(m, f, sep, x, peek, ...) m(f, 278, x) MAP_NEXT(peek, sep, MAP_I279)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I279(m, f, sep, x, peek, ...) m(f, 279, x) MAP_NEXT(peek, sep, MAP_I280)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I280(m, f, sep, x, peek, ...) m(f, 280, x) MAP_NEXT(peek, sep, MAP_I281)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I281(m, f, sep, x, peek, ...) m(f, 281, x) MAP_NEXT(peek, sep, MAP_I282)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I282(m, f, sep, x, peek, ...) m(f, 282, x) MAP_NEXT(peek, sep, MAP_I283)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I283(m, f, sep, x, peek, ...) m(f, 283, x) MAP_NEXT(peek, sep, MAP_I284)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I284(m, f, sep, x, peek, ...) m(f, 284, x) MAP_NEXT(peek, sep, MAP_I285)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I285(m, f, sep, x, peek, ...) m(f, 285, x) MAP_NEXT(peek, sep, MAP_I286)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I286(m, f, sep, x, peek, ...) m(f, 286, x) MAP_NEXT(peek, sep, MAP_I287)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I287(m, f, sep, x, peek, ...) m(f, 287, x) MAP_NEXT(peek, sep, MAP_I288)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I288(m, f, sep, x, peek, ...) m(f, 288, x) MAP_NEXT(peek, sep, MAP_I289)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I289(m, f, sep, x, peek, ...) m(f, 289, x) MAP_NEXT(peek, sep, MAP_I290)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I290(m, f, sep, x, peek, ...) m(f, 290, x) MAP_NEXT(peek, sep, MAP_I291)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I291(m, f, sep, x, peek, ...) m(f, 291, x) MAP_NEXT(peek, sep, MAP_I292)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I292(m, f, sep, x, peek, ...) m(f, 292, x) MAP_NEXT(peek, sep, MAP_I293)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I293(m, f, sep, x, peek, ...) m(f, 293, x) MAP_NEXT(peek, sep, MAP_I294)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I294(m, f, sep, x, peek, ...) m(f, 294, x) MAP_NEXT(peek, sep, MAP_I295)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I295(m, f, sep, x, peek, ...) m(f, 295, x) MAP_NEXT(peek, sep, MAP_I296)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I296(m, f, sep, x, peek, ...) m(f, 296, x) MAP_NEXT(peek, sep, MAP_I297)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I297(m, f, sep, x, peek, ...) m(f, 297, x) MAP_NEXT(peek, sep, MAP_I298)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I298(m, f, sep, x, peek, ...) m(f, 298, x) MAP_NEXT(peek, sep, MAP_I299)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I299(m, f, sep, x, peek, ...) m(f, 299, x) MAP_NEXT(peek, sep, MAP_I300)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I300(m, f, sep, x, peek, ...) m(f, 300, x) MAP_NEXT(peek, sep, MAP_I301)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I301(m, f, sep, x, peek, ...) m(f, 301, x) MAP_NEXT(peek, sep, MAP_I302)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I302(m, f, sep, x, peek, ...) m(f, 302, x) MAP_NEXT(peek, sep, MAP_I303)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I303(m, f, sep, x, peek, ...) m(f, 303, x) MAP_NEXT(peek, sep, MAP_I304)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I304(m, f, sep, x, peek, ...) m(f, 304, x) MAP_NEXT(peek, sep, MAP_I305)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I305(m, f, sep, x, peek, ...) m(f, 305, x) MAP_NEXT(peek, sep, MAP_I306)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I306(m, f, sep, x, peek, ...) m(f, 306, x) MAP_NEXT(peek, sep, MAP_I307)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I307(m, f, sep, x, peek, ...) m(f, 307, x) MAP_NEXT(peek, sep, MAP_I308)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I308(m, f, sep, x, peek, ...) m(f, 308, x) MAP_NEXT(peek, sep, MAP_I309)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I309(m, f, sep, x, peek, ...) m(f, 309, x) MAP_NEXT(peek, sep, MAP_I310)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I310(m, f, sep, x, peek, ...) m(f, 310, x) MAP_NEXT(peek, sep, MAP_I311)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I311(m, f, sep, x, peek, ...) m(f, 311, x) MAP_NEXT(peek, sep, MAP_I312)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I312(m, f, sep, x, peek, ...) m(f, 312, x) MAP_NEXT(peek, sep, MAP_I313)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I313(m, f, sep, x, peek, ...) m(f, 313, x) MAP_NEXT(peek, sep, MAP_I314)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I314(m, f, sep, x, peek, ...) m(f, 314, x) MAP_NEXT(peek, sep, MAP_I315)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I315(m, f, sep, x, peek, ...) m(f, 315, x) MAP_NEXT(peek, sep, MAP_I316)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I316(m, f, sep, x, peek, ...) m(f, 316, x) MAP_NEXT(peek, sep, MAP_I317)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I317(m, f, sep, x, peek, ...) m(f, 317, x) MAP_NEXT(peek, sep, MAP_I318)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I318(m, f, sep, x, peek, ...) m(f, 318, x) MAP_NEXT(peek, sep, MAP_I319)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I319(m, f, sep, x, peek, ...) m(f, 319, x) MAP_NEXT(peek, sep, MAP_I320)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I320(m, f, sep, x, peek, ...) m(f, 320, x) MAP_NEXT(peek, sep, MAP_I321)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I321(m, f, sep, x, peek, ...) m(f, 321, x) MAP_NEXT(peek, sep, MAP_I322)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I322(m, f, sep, x, peek, ...) m(f, 322, x) MAP_NEXT(peek, sep, MAP_I323)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I323(m, f, sep, x, peek, ...) m(f, 323, x) MAP_NEXT(peek, sep, MAP_I324)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I324(m, f, sep, x, peek, ...) m(f, 324, x) MAP_NEXT(peek, sep, MAP_I325)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I325(m, f, sep, x, peek, ...) m(f, 325, x) MAP_NEXT(peek, sep, MAP_I326)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I326(m, f, sep, x, peek, ...) m(f, 326, x) MAP_NEXT(peek, sep, MAP_I327)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I327(m, f, sep, x, peek, ...) m(f, 327, x) MAP_NEXT(peek, sep, MAP_I328)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I328(m, f, sep, x, peek, ...) m(f, 328, x) MAP_NEXT(peek, sep, MAP_I329)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I329(m, f, sep, x, peek, ...) m(f, 329, x) MAP_NEXT(peek, sep, MAP_I330)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I330(m, f, sep, x, peek, ...) m(f, 330, x) MAP_NEXT(peek, sep, MAP_I331)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I331(m, f, sep, x, peek, ...) m(f, 331, x) MAP_NEXT(peek, sep, MAP_I332)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I332(m, f, sep, x, peek, ...) m(f, 332, x) MAP_NEXT(peek, sep, MAP_I333)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I333(m, f, sep, x, peek, ...) m(f, 333, x) MAP_NEXT(peek, sep, MAP_I334)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I334(m, f, sep, x, peek, ...) m(f, 334, x) MAP_NEXT(peek, sep, MAP_I335)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I335(m, f, sep, x, peek, ...) m(f, 335, x) MAP_NEXT(peek, sep, MAP_I336)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I336(m, f, sep, x, peek, ...) m(f, 336, x) MAP_NEXT(peek, sep, MAP_I337)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I337(m, f, sep, x, peek, ...) m(f, 337, x) MAP_NEXT(peek, sep, MAP_I338)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I338(m, f, sep, x, peek, ...) m(f, 338, x) MAP_NEXT(peek, sep, MAP_I339)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I339(m, f, sep, x, peek, ...) m(f, 339, x) MAP_NEXT(peek, sep, MAP_I340)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I340(m, f, sep, x, peek, ...) m(f, 340, x) MAP_NEXT(peek, sep, MAP_I341)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I341(m, f, sep, x, peek, ...) m(f, 341, x) MAP_NEXT(peek, sep, MAP_I342)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I342(m, f, sep, x, peek, ...) m(f, 342, x) MAP_NEXT(peek, sep, MAP_I343)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I343(m, f, sep, x, peek, ...) m(f, 343, x) MAP_NEXT(peek, sep, MAP_I344)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I344(m, f, sep, x, peek, ...) m(f, 344, x) MAP_NEXT(peek, sep, MAP_I345)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I345(m, f, sep, x, peek, ...) m(f, 345, x) MAP_NEXT(peek, sep, MAP_I346)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I346(m, f, sep, x, peek, ...) m(f, 346, x) MAP_NEXT(peek, sep, MAP_I347)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I347(m, f, sep, x, peek, ...) m(f, 347, x) MAP_NEXT(peek, sep, MAP_I348)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I348(m, f, sep, x, peek, ...) m(f, 348, x) MAP_NEXT(peek, sep, MAP_I349)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I349(m, f, sep, x, peek, ...) m(f, 349, x) MAP_NEXT(peek, sep, MAP_I350)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I350(m, f, sep, x, peek, ...) m(f, 350, x) MAP_NEXT(peek, sep, MAP_I351)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I351(m, f, sep, x, peek, ...) m(f, 351, x) MAP_NEXT(peek, sep, MAP_I352)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I352(m, f, sep, x, peek, ...) m(f, 352, x) MAP_NEXT(peek, sep, MAP_I353)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I353(m, f, sep, x, peek, ...) m(f, 353, x) MAP_NEXT(peek, sep, MAP_I354)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I354(m, f, sep, x, peek, ...) m(f, 354, x) MAP_NEXT(peek, sep, MAP_I355)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I355(m, f, sep, x, peek, ...) m(f, 355, x) MAP_NEXT(peek, sep, MAP_I356)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I356(m, f, sep, x, peek, ...) m(f, 356, x) MAP_NEXT(peek, sep, MAP_I357)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I357(m, f, sep, x, peek, ...) m(f, 357, x) MAP_NEXT(peek, sep, MAP_I358)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I358(m, f, sep, x, peek, ...) m(f, 358, x) MAP_NEXT(peek, sep, MAP_I359)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I359(m, f, sep, x, peek, ...) m(f, 359, x) MAP_NEXT(peek, sep, MAP_I360)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I360(m, f, sep, x, peek, ...) m(f, 360, x) MAP_NEXT(peek, sep, MAP_I361)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I361(m, f, sep, x, peek, ...) m(f, 361, x) MAP_NEXT(peek, sep, MAP_I362)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I362(m, f, sep, x, peek, ...) m(f, 362, x) MAP_NEXT(peek, sep, MAP_I363)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I363(m, f, sep, x, peek, ...) m(f, 363, x) MAP_NEXT(peek, sep, MAP_I364)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I364(m, f, sep, x, peek, ...) m(f, 364, x) MAP_NEXT(peek, sep, MAP_I365)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I365(m, f, sep, x, peek, ...) m(f, 365, x) MAP_NEXT(peek, sep, MAP_I366)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I366(m, f, sep, x, peek, ...) m(f, 366, x) MAP_NEXT(peek, sep, MAP_I367)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I367(m, f, sep, x, peek, ...) m(f, 367, x) MAP_NEXT(peek, sep, MAP_I368)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I368(m, f, sep, x, peek, ...) m(f, 368, x) MAP_NEXT(peek, sep, MAP_I369)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I369(m, f, sep, x, peek, ...) m(f, 369, x) MAP_NEXT(peek, sep, MAP_I370)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I370(m, f, sep, x, peek, ...) m(f, 370, x) MAP_NEXT(peek, sep, MAP_I371)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I371(m, f, sep, x, peek, ...) m(f, 371, x) MAP_NEXT(peek, sep, MAP_I372)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I372(m, f, sep, x, peek, ...) m(f, 372, x) MAP_NEXT(peek, sep, MAP_I373)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I373(m, f, sep, x, peek, ...) m(f, 373, x) MAP_NEXT(peek, sep, MAP_I374)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I374(m, f, sep, x, peek, ...) m(f, 374, x) MAP_NEXT(peek, sep, MAP_I375)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I375(m, f, sep, x, peek, ...) m(f, 375, x) MAP_NEXT(peek, sep, MAP_I376)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I376(m, f, sep, x, peek, ...) m(f, 376, x) MAP_NEXT(peek, sep, MAP_I377)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I377(m, f, sep, x, peek, ...) m(f, 377, x) MAP_NEXT(peek, sep, MAP_I378)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I378(m, f, sep, x, peek, ...) m(f, 378, x) MAP_NEXT(peek, sep, MAP_I379)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I379(m, f, sep, x, peek, ...) m(f, 379, x) MAP_NEXT(peek, sep, MAP_I380)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I380(m, f, sep, x, peek, ...) m(f, 380, x) MAP_NEXT(peek, sep, MAP_I381)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I381(m, f, sep, x, peek, ...) m(f, 381, x) MAP_NEXT(peek, sep, MAP_I382)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I382(m, f, sep, x, peek, ...) m(f, 382, x) MAP_NEXT(peek, sep, MAP_I383)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I383(m, f, sep, x, peek, ...) m(f, 383, x) MAP_NEXT(peek, sep, MAP_I384)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I384(m, f, sep, x, peek, ...) m(f, 384, x) MAP_NEXT(peek, sep, MAP_I385)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I385(m, f, sep, x, peek, ...) m(f, 385, x) MAP_NEXT(peek, sep, MAP_I386)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I386(m, f, sep, x, peek, ...) m(f, 386, x) MAP_NEXT(peek, sep, MAP_I387)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I387(m, f, sep, x, peek, ...) m(f, 387, x) MAP_NEXT(peek, sep, MAP_I388)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I388(m, f, sep, x, peek, ...) m(f, 388, x) MAP_NEXT(peek, sep, MAP_I389)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I389(m, f, sep, x, peek, ...) m(f, 389, x) MAP_NEXT(peek, sep, MAP_I390)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I390(m, f, sep, x, peek, ...) m(f, 390, x) MAP_NEXT(peek, sep, MAP_I391)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I391(m, f, sep, x, peek, ...) m(f, 391, x) MAP_NEXT(peek, sep, MAP_I392)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I392(m, f, sep, x, peek, ...) m(f, 392, x) MAP_NEXT(peek, sep, MAP_I393)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I393(m, f, sep, x, peek, ...) m(f, 393, x) MAP_NEXT(peek, sep, MAP_I394)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I394(m, f, sep, x, peek, ...) m(f, 394, x) MAP_NEXT(peek, sep, MAP_I395)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I395(m, f, sep, x, peek, ...) m(f, 395, x) MAP_NEXT(peek, sep, MAP_I396)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I396(m, f, sep, x, peek, ...) m(f, 396, x) MAP_NEXT(peek, sep, MAP_I397)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I397(m, f, sep, x, peek, ...) m(f, 397, x) MAP_NEXT(peek, sep, MAP_I398)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I398(m, f, sep, x, peek, ...) m(f, 398, x) MAP_NEXT(peek, sep, MAP_I399)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I399(m, f, sep, x, peek, ...) m(f, 399, x) MAP_NEXT(peek, sep, MAP_I400)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I400(m, f, sep, x, peek, ...) m(f, 400, x) MAP_NEXT(peek, sep, MAP_I401)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I401(m, f, sep, x, peek, ...) m(f, 401, x) MAP_NEXT(peek, sep, MAP_I402)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I402(m, f, sep, x, peek, ...) m(f, 402, x) MAP_NEXT(peek, sep, MAP_I403)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I403(m, f, sep, x, peek, ...) m(f, 403, x) MAP_NEXT(peek, sep, MAP_I404)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I404(m, f, sep, x, peek, ...) m(f, 404, x) MAP_NEXT(peek, sep, MAP_I405)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I405(m, f, sep, x, peek, ...) m(f, 405, x) MAP_NEXT(peek, sep, MAP_I406)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I406(m, f, sep, x, peek, ...) m(f, 406, x) MAP_NEXT(peek, sep, MAP_I407)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I407(m, f, sep, x, peek, ...) m(f, 407, x) MAP_NEXT(peek, sep, MAP_I408)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I408(m, f, sep, x, peek, ...) m(f, 408, x) MAP_NEXT(peek, sep, MAP_I409)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I409(m, f, sep, x, peek, ...) m(f, 409, x) MAP_NEXT(peek, sep, MAP_I410)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I410(m, f, sep, x, peek, ...) m(f, 410, x) MAP_NEXT(peek, sep, MAP_I411)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I411(m, f, sep, x, peek, ...) m(f, 411, x) MAP_NEXT(peek, sep, MAP_I412)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I412(m, f, sep, x, peek, ...) m(f, 412, x) MAP_NEXT(peek, sep, MAP_I413)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I413(m, f, sep, x, peek, ...) m(f, 413, x) MAP_NEXT(peek, sep, MAP_I414)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I414(m, f, sep, x, peek, ...) m(f, 414, x) MAP_NEXT(peek, sep, MAP_I415)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I415(m, f, sep, x, peek, ...) m(f, 415, x) MAP_NEXT(peek, sep, MAP_I416)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I416(m, f, sep, x, peek, ...) m(f, 416, x) MAP_NEXT(peek, sep, MAP_I417)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I417(m, f, sep, x, peek, ...) m(f, 417, x) MAP_NEXT(peek, sep, MAP_I418)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I418(m, f, sep, x, peek, ...) m(f, 418, x) MAP_NEXT(peek, sep, MAP_I419)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I419(m, f, sep, x, peek, ...) m(f, 419, x) MAP_NEXT(peek, sep, MAP_I420)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I420(m, f, sep, x, peek, ...) m(f, 420, x) MAP_NEXT(peek, sep, MAP_I421)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I421(m, f, sep, x, peek, ...) m(f, 421, x) MAP_NEXT(peek, sep, MAP_I422)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I422(m, f, sep, x, peek, ...) m(f, 422, x) MAP_NEXT(peek, sep, MAP_I423)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I423(m, f, sep, x, peek, ...) m(f, 423, x) MAP_NEXT(peek, sep, MAP_I424)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I424(m, f, sep, x, peek, ...) m(f, 424, x) MAP_NEXT(peek, sep, MAP_I425)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I425(m, f, sep, x, peek, ...) m(f, 425, x) MAP_NEXT(peek, sep, MAP_I426)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I426(m, f, sep, x, peek, ...) m(f, 426, x) MAP_NEXT(peek, sep, MAP_I427)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I427(m, f, sep, x, peek, ...) m(f, 427, x) MAP_NEXT(peek, sep, MAP_I428)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I428(m, f, sep, x, peek, ...) m(f, 428, x) MAP_NEXT(peek, sep, MAP_I429)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I429(m, f, sep, x, peek, ...) m(f, 429, x) MAP_NEXT(peek, sep, MAP_I430)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I430(m, f, sep, x, peek, ...) m(f, 430, x) MAP_NEXT(peek, sep, MAP_I431)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I431(m, f, sep, x, peek, ...) m(f, 431, x) MAP_NEXT(peek, sep, MAP_I432)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I432(m, f, sep, x, peek, ...) m(f, 432, x) MAP_NEXT(peek, sep, MAP_I433)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I433(m, f, sep, x, peek, ...) m(f, 433, x) MAP_NEXT(peek, sep, MAP_I434)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I434(m, f, sep, x, peek, ...) m(f, 434, x) MAP_NEXT(peek, sep, MAP_I435)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I435(m, f, sep, x, peek, ...) m(f, 435, x) MAP_NEXT(peek, sep, MAP_I436)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I436(m, f, sep, x, peek, ...) m(f, 436, x) MAP_NEXT(peek, sep, MAP_I437)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I437(m, f, sep, x, peek, ...) m(f, 437, x) MAP_NEXT(peek, sep, MAP_I438)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I438(m, f, sep, x, peek, ...) m(f, 438, x) MAP_NEXT(peek, sep, MAP_I439)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I439(m, f, sep, x, peek, ...) m(f, 439, x) MAP_NEXT(peek, sep, MAP_I440)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I440(m, f, sep, x, peek, ...) m(f, 440, x) MAP_NEXT(peek, sep, MAP_I441)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I441(m, f, sep, x, peek, ...) m(f, 441, x) MAP_NEXT(peek, sep, MAP_I442)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I442(m, f, sep, x, peek, ...) m(f, 442, x) MAP_NEXT(peek, sep, MAP_I443)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I443(m, f, sep, x, peek, ...) m(f, 443, x) MAP_NEXT(peek, sep, MAP_I444)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I444(m, f, sep, x, peek, ...) m(f, 444, x) MAP_NEXT(peek, sep, MAP_I445)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I445(m, f, sep, x, peek, ...) m(f, 445, x) MAP_NEXT(peek, sep, MAP_I446)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I446(m, f, sep, x, peek, ...) m(f, 446, x) MAP_NEXT(peek, sep, MAP_I447)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I447(m, f, sep, x, peek, ...) m(f, 447, x) MAP_NEXT(peek, sep, MAP_I448)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I448(m, f, sep, x, peek, ...) m(f, 448, x) MAP_NEXT(peek, sep, MAP_I449)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I449(m, f, sep, x, peek, ...) m(f, 449, x) MAP_NEXT(peek, sep, MAP_I450)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I450(m, f, sep, x, peek, ...) m(f, 450, x) MAP_NEXT(peek, sep, MAP_I451)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I451(m, f, sep, x, peek, ...) m(f, 451, x) MAP_NEXT(peek, sep, MAP_I452)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I452(m, f, sep, x, peek, ...) m(f, 452, x) MAP_NEXT(peek, sep, MAP_I453)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I453(m, f, sep, x, peek, ...) m(f, 453, x) MAP_NEXT(peek, sep, MAP_I454)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I454(m, f, sep, x, peek, ...) m(f, 454, x) MAP_NEXT(peek, sep, MAP_I455)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I455(m, f, sep, x, peek, ...) m(f, 455, x) MAP_NEXT(peek, sep, MAP_I456)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I456(m, f, sep, x, peek, ...) m(f, 456, x) MAP_NEXT(peek, sep, MAP_I457)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I457(m, f, sep, x, peek, ...) m(f, 457, x) MAP_NEXT(peek, sep, MAP_I458)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I458(m, f, sep, x, peek, ...) m(f, 458, x) MAP_NEXT(peek, sep, MAP_I459)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I459(m, f, sep, x, peek, ...) m(f, 459, x) MAP_NEXT(peek, sep, MAP_I460)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I460(m, f, sep, x, peek, ...) m(f, 460, x) MAP_NEXT(peek, sep, MAP_I461)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I461(m, f, sep, x, peek, ...) m(f, 461, x) MAP_NEXT(peek, sep, MAP_I462)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I462(m, f, sep, x, peek, ...) m(f, 462, x) MAP_NEXT(peek, sep, MAP_I463)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I463(m, f, sep, x, peek, ...) m(f, 463, x) MAP_NEXT(peek, sep, MAP_I464)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I464(m, f, sep, x, peek, ...) m(f, 464, x) MAP_NEXT(peek, sep, MAP_I465)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I465(m, f, sep, x, peek, ...) m(f, 465, x) MAP_NEXT(peek, sep, MAP_I466)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I466(m, f, sep, x, peek, ...) m(f, 466, x) MAP_NEXT(peek, sep, MAP_I467)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I467(m, f, sep, x, peek, ...) m(f, 467, x) MAP_NEXT(peek, sep, MAP_I468)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I468(m, f, sep, x, peek, ...) m(f, 468, x) MAP_NEXT(peek, sep, MAP_I469)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I469(m, f, sep, x, peek, ...) m(f, 469, x) MAP_NEXT(peek, sep, MAP_I470)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I470(m, f, sep, x, peek, ...) m(f, 470, x) MAP_NEXT(peek, sep, MAP_I471)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I471(m, f, sep, x, peek, ...) m(f, 471, x) MAP_NEXT(peek, sep, MAP_I472)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I472(m, f, sep, x, peek, ...) m(f, 472, x) MAP_NEXT(peek, sep, MAP_I473)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I473(m, f, sep, x, peek, ...) m(f, 473, x) MAP_NEXT(peek, sep, MAP_I474)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I474(m, f, sep, x, peek, ...) m(f, 474, x) MAP_NEXT(peek, sep, MAP_I475)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I475(m, f, sep, x, peek, ...) m(f, 475, x) MAP_NEXT(peek, sep, MAP_I476)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I476(m, f, sep, x, peek, ...) m(f, 476, x) MAP_NEXT(peek, sep, MAP_I477)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I477(m, f, sep, x, peek, ...) m(f, 477, x) MAP_NEXT(peek, sep, MAP_I478)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I478(m, f, sep, x, peek, ...) m(f, 478, x) MAP_NEXT(peek, sep, MAP_I479)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I479(m, f, sep, x, peek, ...) m(f, 479, x) MAP_NEXT(peek, sep, MAP_I480)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I480(m, f, sep, x, peek, ...) m(f, 480, x) MAP_NEXT(peek, sep, MAP_I481)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I481(m, f, sep, x, peek, ...) m(f, 481, x) MAP_NEXT(peek, sep, MAP_I482)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I482(m, f, sep, x, peek, ...) m(f, 482, x) MAP_NEXT(peek, sep, MAP_I483)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I483(m, f, sep, x, peek, ...) m(f, 483, x) MAP_NEXT(peek, sep, MAP_I484)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I484(m, f, sep, x, peek, ...) m(f, 484, x) MAP_NEXT(peek, sep, MAP_I485)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I485(m, f, sep, x, peek, ...) m(f, 485, x) MAP_NEXT(peek, sep, MAP_I486)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I486(m, f, sep, x, peek, ...) m(f, 486, x) MAP_NEXT(peek, sep, MAP_I487)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I487(m, f, sep, x, peek, ...) m(f, 487, x) MAP_NEXT(peek, sep, MAP_I488)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I488(m, f, sep, x, peek, ...) m(f, 488, x) MAP_NEXT(peek, sep, MAP_I489)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I489(m, f, sep, x, peek, ...) m(f, 489, x) MAP_NEXT(peek, sep, MAP_I490)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I490(m, f, sep, x, peek, ...) m(f, 490, x) MAP_NEXT(peek, sep, MAP_I491)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I491(m, f, sep, x, peek, ...) m(f, 491, x) MAP_NEXT(peek, sep, MAP_I492)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I492(m, f, sep, x, peek, ...) m(f, 492, x) MAP_NEXT(peek, sep, MAP_I493)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I493(m, f, sep, x, peek, ...) m(f, 493, x) MAP_NEXT(peek, sep, MAP_I494)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I494(m, f, sep, x, peek, ...) m(f, 494, x) MAP_NEXT(peek, sep, MAP_I495)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I495(m, f, sep, x, peek, ...) m(f, 495, x) MAP_NEXT(peek, sep, MAP_I496)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I496(m, f, sep, x, peek, ...) m(f, 496, x) MAP_NEXT(peek, sep, MAP_I497)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I497(m, f, sep, x, peek, ...) m(f, 497, x) MAP_NEXT(peek, sep, MAP_I498)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I498(m, f, sep, x, peek, ...) m(f, 498, x) MAP_NEXT(peek, sep, MAP_I499)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I499(m, f, sep, x, peek, ...) m(f, 499, x) MAP_NEXT(peek, sep, MAP_I500)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I500(m, f, sep, x, peek, ...) m(f, 500, x) MAP_NEXT(peek, sep, MAP_I501)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I501(m, f, sep, x, peek, ...) m(f, 501, x) MAP_NEXT(peek, sep, MAP_I502)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I502(m, f, sep, x, peek, ...) m(f, 502, x) MAP_NEXT(peek, sep, MAP_I503)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I503(m, f, sep, x, peek, ...) m(f, 503, x) MAP_NEXT(peek, sep, MAP_I504)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I504(m, f, sep, x, peek, ...) m(f, 504, x) MAP_NEXT(peek, sep, MAP_I505)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I505(m, f, sep, x, peek, ...) m(f, 505, x) MAP_NEXT(peek, sep, MAP_I506)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I506(m, f, sep, x, peek, ...) m(f, 506, x) MAP_NEXT(peek, sep, MAP_I507)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I507(m, f, sep, x, peek, ...) m(f, 507, x) MAP_NEXT(peek, sep, MAP_I508)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I508(m, f, sep, x, peek, ...) m(f, 508, x) MAP_NEXT(peek, sep, MAP_I509)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I509(m, f, sep, x, peek, ...) m(f, 509, x) MAP_NEXT(peek, sep, MAP_I510)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I510(m, f, sep, x, peek, ...) m(f, 510, x) MAP_NEXT(peek, sep, MAP_I511)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I511(m, f, sep, x, peek, ...) m(f, 511, x) MAP_NEXT(peek, sep, MAP_I512)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I512(m, f, sep, x, peek, ...) m(f, 512, x) MAP_NEXT(peek, sep, MAP_I513)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I513(m, f, sep, x, peek, ...) m(f, 513, x) MAP_NEXT(peek, sep, MAP_I514)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I514(m, f, sep, x, peek, ...) m(f, 514, x) MAP_NEXT(peek, sep, MAP_I515)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I515(m, f, sep, x, peek, ...) m(f, 515, x) MAP_NEXT(peek, sep, MAP_I516)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I516(m, f, sep, x, peek, ...) m(f, 516, x) MAP_NEXT(peek, sep, MAP_I517)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I517(m, f, sep, x, peek, ...) m(f, 517, x) MAP_NEXT(peek, sep, MAP_I518)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I518(m, f, sep, x, peek, ...) m(f, 518, x) MAP_NEXT(peek, sep, MAP_I519)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I519(m, f, sep, x, peek, ...) m(f, 519, x) MAP_NEXT(peek, sep, MAP_I520)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I520(m, f, sep, x, peek, ...) m(f, 520, x) MAP_NEXT(peek, sep, MAP_I521)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I521(m, f, sep, x, peek, ...) m(f, 521, x) MAP_NEXT(peek, sep, MAP_I522)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I522(m, f, sep, x, peek, ...) m(f, 522, x) MAP_NEXT(peek, sep, MAP_I523)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I523(m, f, sep, x, peek, ...) m(f, 523, x) MAP_NEXT(peek, sep, MAP_I524)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I524(m, f, sep, x, peek, ...) m(f, 524, x) MAP_NEXT(peek, sep, MAP_I525)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I525(m, f, sep, x, peek, ...) m(f, 525, x) MAP_NEXT(peek, sep, MAP_I526)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I526(m, f, sep, x, peek, ...) m(f, 526, x) MAP_NEXT(peek, sep, MAP_I527)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I527(m, f, sep, x, peek, ...) m(f, 527, x) MAP_NEXT(peek, sep, MAP_I528)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I528(m, f, sep, x, peek, ...) m(f, 528, x) MAP_NEXT(peek, sep, MAP_I529)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I529(m, f, sep, x, peek, ...) m(f, 529, x) MAP_NEXT(peek, sep, MAP_I530)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I530(m, f, sep, x, peek, ...) m(f, 530, x) MAP_NEXT(peek, sep, MAP_I531)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I531(m, f, sep, x, peek, ...) m(f, 531, x) MAP_NEXT(peek, sep, MAP_I532)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I532(m, f, sep, x, peek, ...) m(f, 532, x) MAP_NEXT(peek, sep, MAP_I533)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I533(m, f, sep, x, peek, ...) m(f, 533, x) MAP_NEXT(peek, sep, MAP_I534)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I534(m, f, sep, x, peek, ...) m(f, 534, x) MAP_NEXT(peek, sep, MAP_I535)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I535(m, f, sep, x, peek, ...) m(f, 535, x) MAP_NEXT(peek, sep, MAP_I536)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I536(m, f, sep, x, peek, ...) m(f, 536, x) MAP_NEXT(peek, sep, MAP_I537)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I537(m, f, sep, x, peek, ...) m(f, 537, x) MAP_NEXT(peek, sep, MAP_I538)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I538(m, f, sep, x, peek, ...) m(f, 538, x) MAP_NEXT(peek, sep, MAP_I539)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I539(m, f, sep, x, peek, ...) m(f, 539, x) MAP_NEXT(peek, sep, MAP_I540)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I540(m, f, sep, x, peek, ...) m(f, 540, x) MAP_NEXT(peek, sep, MAP_I541)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I541(m, f, sep, x, peek, ...) m(f, 541, x) MAP_NEXT(peek, sep, MAP_I542)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I542(m, f, sep, x, peek, ...) m(f, 542, x) MAP_NEXT(peek, sep, MAP_I543)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I543(m, f, sep, x, peek, ...) m(f, 543, x) MAP_NEXT(peek, sep, MAP_I544)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I544(m, f, sep, x, peek, ...) m(f, 544, x) MAP_NEXT(peek, sep, MAP_I545)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I545(m, f, sep, x, peek, ...) m(f, 545, x) MAP_NEXT(peek, sep, MAP_I546)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I546(m, f, sep, x, peek, ...) m(f, 546, x) MAP_NEXT(peek, sep, MAP_I547)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I547(m, f, sep, x, peek, ...) m(f, 547, x) MAP_NEXT(peek, sep, MAP_I548)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I548(m, f, sep, x, peek, ...) m(f, 548, x) MAP_NEXT(peek, sep, MAP_I549)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I549(m, f, sep, x, peek, ...) m(f, 549, x) MAP_NEXT(peek, sep, MAP_I550)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I550(m, f, sep, x, peek, ...) m(f, 550, x) MAP_NEXT(peek, sep, MAP_I551)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I551(m, f, sep, x, peek, ...) m(f, 551, x) MAP_NEXT(peek, sep, MAP_I552)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I552(m, f, sep, x, peek, ...) m(f, 552, x) MAP_NEXT(peek, sep, MAP_I553)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I553(m, f, sep, x, peek, ...) m(f, 553, x) MAP_NEXT(peek, sep, MAP_I554)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I554(m, f, sep, x, peek, ...) m(f, 554, x) MAP_NEXT(peek, sep, MAP_I555)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I555(m, f, sep, x, peek, ...) m(f, 555, x) MAP_NEXT(peek, sep, MAP_I556)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I556(m, f, sep, x, peek, ...) m(f, 556, x) MAP_NEXT(peek, sep, MAP_I557)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I557(m, f, sep, x, peek, ...) m(f, 557, x) MAP_NEXT(peek, sep, MAP_I558)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I558(m, f, sep, x, peek, ...) m(f, 558, x) MAP_NEXT(peek, sep, MAP_I559)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I559(m, f, sep, x, peek, ...) m(f, 559, x) MAP_NEXT(peek, sep, MAP_I560)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I560(m, f, sep, x, peek, ...) m(f, 560, x) MAP_NEXT(peek, sep, MAP_I561)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I561(m, f, sep, x, peek, ...) m(f, 561, x) MAP_NEXT(peek, sep, MAP_I562)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I562(m, f, sep, x, peek, ...) m(f, 562, x) MAP_NEXT(peek, sep, MAP_I563)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I563(m, f, sep, x, peek, ...) m(f, 563, x) MAP_NEXT(peek, sep, MAP_I564)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I564(m, f, sep, x, peek, ...) m(f, 564, x) MAP_NEXT(peek, sep, MAP_I565)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I565(m, f, sep, x, peek, ...) m(f, 565, x) MAP_NEXT(peek, sep, MAP_I566)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I566(m, f, sep, x, peek, ...) m(f, 566, x) MAP_NEXT(peek, sep, MAP_I567)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I567(m, f, sep, x, peek, ...) m(f, 567, x) MAP_NEXT(peek, sep, MAP_I568)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I568(m, f, sep, x, peek, ...) m(f, 568, x) MAP_NEXT(peek, sep, MAP_I569)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I569(m, f, sep, x, peek, ...) m(f, 569, x) MAP_NEXT(peek, sep, MAP_I570)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I570(m, f, sep, x, peek, ...) m(f, 570, x) MAP_NEXT(peek, sep, MAP_I571)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I571(m, f, sep, x, peek, ...) m(f, 571, x) MAP_NEXT(peek, sep, MAP_I572)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I572(m, f, sep, x, peek, ...) m(f, 572, x) MAP_NEXT(peek, sep, MAP_I573)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I573(m, f, sep, x, peek, ...) m(f, 573, x) MAP_NEXT(peek, sep, MAP_I574)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I574(m, f, sep, x, peek, ...) m(f, 574, x) MAP_NEXT(peek, sep, MAP_I575)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I575(m, f, sep, x, peek, ...) m(f, 575, x) MAP_NEXT(peek, sep, MAP_I576)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I576(m, f, sep, x, peek, ...) m(f, 576, x) MAP_NEXT(peek, sep, MAP_I577)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I577(m, f, sep, x, peek, ...) m(f, 577, x) MAP_NEXT(peek, sep, MAP_I578)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I578(m, f, sep, x, peek, ...) m(f, 578, x) MAP_NEXT(peek, sep, MAP_I579)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I579(m, f, sep, x, peek, ...) m(f, 579, x) MAP_NEXT(peek, sep, MAP_I580)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I580(m, f, sep, x, peek, ...) m(f, 580, x) MAP_NEXT(peek, sep, MAP_I581)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I581(m, f, sep, x, peek, ...) m(f, 581, x) MAP_NEXT(peek, sep, MAP_I582)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I582(m, f, sep, x, peek, ...) m(f, 582, x) MAP_NEXT(peek, sep, MAP_I583)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I583(m, f, sep, x, peek, ...) m(f, 583, x) MAP_NEXT(peek, sep, MAP_I584)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I584(m, f, sep, x, peek, ...) m(f, 584, x) MAP_NEXT(peek, sep, MAP_I585)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I585(m, f, sep, x, peek, ...) m(f, 585, x) MAP_NEXT(peek, sep, MAP_I586)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I586(m, f, sep, x, peek, ...) m(f, 586, x) MAP_NEXT(peek, sep, MAP_I587)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I587(m, f, sep, x, peek, ...) m(f, 587, x) MAP_NEXT(peek, sep, MAP_I588)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I588(m, f, sep, x, peek, ...) m(f, 588, x) MAP_NEXT(peek, sep, MAP_I589)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I589(m, f, sep, x, peek, ...) m(f, 589, x) MAP_NEXT(peek, sep, MAP_I590)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I590(m, f, sep, x, peek, ...) m(f, 590, x) MAP_NEXT(peek, sep, MAP_I591)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I591(m, f, sep, x, peek, ...) m(f, 591, x) MAP_NEXT(peek, sep, MAP_I592)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I592(m, f, sep, x, peek, ...) m(f, 592, x) MAP_NEXT(peek, sep, MAP_I593)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I593(m, f, sep, x, peek, ...) m(f, 593, x) MAP_NEXT(peek, sep, MAP_I594)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I594(m, f, sep, x, peek, ...) m(f, 594, x) MAP_NEXT(peek, sep, MAP_I595)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I595(m, f, sep, x, peek, ...) m(f, 595, x) MAP_NEXT(peek, sep, MAP_I596)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I596(m, f, sep, x, peek, ...) m(f, 596, x) MAP_NEXT(peek, sep, MAP_I597)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I597(m, f, sep, x, peek, ...) m(f, 597, x) MAP_NEXT(peek, sep, MAP_I598)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I598(m, f, sep, x, peek, ...) m(f, 598, x) MAP_NEXT(peek, sep, MAP_I599)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I599(m, f, sep, x, peek, ...) m(f, 599, x) MAP_NEXT(peek, sep, MAP_I600)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I600(m, f, sep, x, peek, ...) m(f, 600, x) MAP_NEXT(peek, sep, MAP_I601)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I601(m, f, sep, x, peek, ...) m(f, 601, x) MAP_NEXT(peek, sep, MAP_I602)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I602(m, f, sep, x, peek, ...) m(f, 602, x) MAP_NEXT(peek, sep, MAP_I603)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I603(m, f, sep, x, peek, ...) m(f, 603, x) MAP_NEXT(peek, sep, MAP_I604)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I604(m, f, sep, x, peek, ...) m(f, 604, x) MAP_NEXT(peek, sep, MAP_I605)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I605(m, f, sep, x, peek, ...) m(f, 605, x) MAP_NEXT(peek, sep, MAP_I606)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I606(m, f, sep, x, peek, ...) m(f, 606, x) MAP_NEXT(peek, sep, MAP_I607)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I607(m, f, sep, x, peek, ...) m(f, 607, x) MAP_NEXT(peek, sep, MAP_I608)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I608(m, f, sep, x, peek, ...) m(f, 608, x) MAP_NEXT(peek, sep, MAP_I609)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I609(m, f, sep, x, peek, ...) m(f, 609, x) MAP_NEXT(peek, sep, MAP_I610)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I610(m, f, sep, x, peek, ...) m(f, 610, x) MAP_NEXT(peek, sep, MAP_I611)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I611(m, f, sep, x, peek, ...) m(f, 611, x) MAP_NEXT(peek, sep, MAP_I612)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I612(m, f, sep, x, peek, ...) m(f, 612, x) MAP_NEXT(peek, sep, MAP_I613)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I613(m, f, sep, x, peek, ...) m(f, 613, x) MAP_NEXT(peek, sep, MAP_I614)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I614(m, f, sep, x, peek, ...) m(f, 614, x) MAP_NEXT(peek, sep, MAP_I615)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I615(m, f, sep, x, peek, ...) m(f, 615, x) MAP_NEXT(peek, sep, MAP_I616)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I616(m, f, sep, x, peek, ...) m(f, 616, x) MAP_NEXT(peek, sep, MAP_I617)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I617(m, f, sep, x, peek, ...) m(f, 617, x) MAP_NEXT(peek, sep, MAP_I618)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I618(m, f, sep, x, peek, ...) m(f, 618, x) MAP_NEXT(peek, sep, MAP_I619)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I619(m, f, sep, x, peek, ...) m(f, 619, x) MAP_NEXT(peek, sep, MAP_I620)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I620(m, f, sep, x, peek, ...) m(f, 620, x) MAP_NEXT(peek, sep, MAP_I621)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I621(m, f, sep, x, peek, ...) m(f, 621, x) MAP_NEXT(peek, sep, MAP_I622)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I622(m, f, sep, x, peek, ...) m(f, 622, x) MAP_NEXT(peek, sep, MAP_I623)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I623(m, f, sep, x, peek, ...) m(f, 623, x) MAP_NEXT(peek, sep, MAP_I624)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I624(m, f, sep, x, peek, ...) m(f, 624, x) MAP_NEXT(peek, sep, MAP_I625)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I625(m, f, sep, x, peek, ...) m(f, 625, x) MAP_NEXT(peek, sep, MAP_I626)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I626(m, f, sep, x, peek, ...) m(f, 626, x) MAP_NEXT(peek, sep, MAP_I627)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I627(m, f, sep, x, peek, ...) m(f, 627, x) MAP_NEXT(peek, sep, MAP_I628)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I628(m, f, sep, x, peek, ...) m(f, 628, x) MAP_NEXT(peek, sep, MAP_I629)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I629(m, f, sep, x, peek, ...) m(f, 629, x) MAP_NEXT(peek, sep, MAP_I630)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I630(m, f, sep, x, peek, ...) m(f, 630, x) MAP_NEXT(peek, sep, MAP_I631)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I631(m, f, sep, x, peek, ...) m(f, 631, x) MAP_NEXT(peek, sep, MAP_I632)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I632(m, f, sep, x, peek, ...) m(f, 632, x) MAP_NEXT(peek, sep, MAP_I633)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I633(m, f, sep, x, peek, ...) m(f, 633, x) MAP_NEXT(peek, sep, MAP_I634)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I634(m, f, sep, x, peek, ...) m(f, 634, x) MAP_NEXT(peek, sep, MAP_I635)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I635(m, f, sep, x, peek, ...) m(f, 635, x) MAP_NEXT(peek, sep, MAP_I636)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I636(m, f, sep, x, peek, ...) m(f, 636, x) MAP_NEXT(peek, sep, MAP_I637)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I637(m, f, sep, x, peek, ...) m(f, 637, x) MAP_NEXT(peek, sep, MAP_I638)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I638(m, f, sep, x, peek, ...) m(f, 638, x) MAP_NEXT(peek, sep, MAP_I639)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I639(m, f, sep, x, peek, ...) m(f, 639, x) MAP_NEXT(peek, sep, MAP_I640)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I640(m, f, sep, x, peek, ...) m(f, 640, x) MAP_NEXT(peek, sep, MAP_I641)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I641(m, f, sep, x, peek, ...) m(f, 641, x) MAP_NEXT(peek, sep, MAP_I642)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I642(m, f, sep, x, peek, ...) m(f, 642, x) MAP_NEXT(peek, sep, MAP_I643)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I643(m, f, sep, x, peek, ...) m(f, 643, x) MAP_NEXT(peek, sep, MAP_I644)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I644(m, f, sep, x, peek, ...) m(f, 644, x) MAP_NEXT(peek, sep, MAP_I645)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I645(m, f, sep, x, peek, ...) m(f, 645, x) MAP_NEXT(peek, sep, MAP_I646)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I646(m, f, sep, x, peek, ...) m(f, 646, x) MAP_NEXT(peek, sep, MAP_I647)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I647(m, f, sep, x, peek, ...) m(f, 647, x) MAP_NEXT(peek, sep, MAP_I648)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I648(m, f, sep, x, peek, ...) m(f, 648, x) MAP_NEXT(peek, sep, MAP_I649)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I649(m, f, sep, x, peek, ...) m(f, 649, x) MAP_NEXT(peek, sep, MAP_I650)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I650(m, f, sep, x, peek, ...) m(f, 650, x) MAP_NEXT(peek, sep, MAP_I651)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I651(m, f, sep, x, peek, ...) m(f, 651, x) MAP_NEXT(peek, sep, MAP_I652)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I652(m, f, sep, x, peek, ...) m(f, 652, x) MAP_NEXT(peek, sep, MAP_I653)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I653(m, f, sep, x, peek, ...) m(f, 653, x) MAP_NEXT(peek, sep, MAP_I654)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I654(m, f, sep, x, peek, ...) m(f, 654, x) MAP_NEXT(peek, sep, MAP_I655)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I655(m, f, sep, x, peek, ...) m(f, 655, x) MAP_NEXT(peek, sep, MAP_I656)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I656(m, f, sep, x, peek, ...) m(f, 656, x) MAP_NEXT(peek, sep, MAP_I657)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I657(m, f, sep, x, peek, ...) m(f, 657, x) MAP_NEXT(peek, sep, MAP_I658)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I658(m, f, sep, x, peek, ...) m(f, 658, x) MAP_NEXT(peek, sep, MAP_I659)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I659(m, f, sep, x, peek, ...) m(f, 659, x) MAP_NEXT(peek, sep, MAP_I660)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I660(m, f, sep, x, peek, ...) m(f, 660, x) MAP_NEXT(peek, sep, MAP_I661)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I661(m, f, sep, x, peek, ...) m(f, 661, x) MAP_NEXT(peek, sep, MAP_I662)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I662(m, f, sep, x, peek, ...) m(f, 662, x) MAP_NEXT(peek, sep, MAP_I663)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I663(m, f, sep, x, peek, ...) m(f, 663, x) MAP_NEXT(peek, sep, MAP_I664)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I664(m, f, sep, x, peek, ...) m(f, 664, x) MAP_NEXT(peek, sep, MAP_I665)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I665(m, f, sep, x, peek, ...) m(f, 665, x) MAP_NEXT(peek, sep, MAP_I666)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I666(m, f, sep, x, peek, ...) m(f, 666, x) MAP_NEXT(peek, sep, MAP_I667)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I667(m, f, sep, x, peek, ...) m(f, 667, x) MAP_NEXT(peek, sep, MAP_I668)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I668(m, f, sep, x, peek, ...) m(f, 668, x) MAP_NEXT(peek, sep, MAP_I669)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I669(m, f, sep, x, peek, ...) m(f, 669, x) MAP_NEXT(peek, sep, MAP_I670)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I670(m, f, sep, x, peek, ...) m(f, 670, x) MAP_NEXT(peek, sep, MAP_I671)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I671(m, f, sep, x, peek, ...) m(f, 671, x) MAP_NEXT(peek, sep, MAP_I672)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I672(m, f, sep, x, peek, ...) m(f, 672, x) MAP_NEXT(peek, sep, MAP_I673)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I673(m, f, sep, x, peek, ...) m(f, 673, x) MAP_NEXT(peek, sep, MAP_I674)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I674(m, f, sep, x, peek, ...) m(f, 674, x) MAP_NEXT(peek, sep, MAP_I675)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I675(m, f, sep, x, peek, ...) m(f, 675, x) MAP_NEXT(peek, sep, MAP_I676)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I676(m, f, sep, x, peek, ...) m(f, 676, x) MAP_NEXT(peek, sep, MAP_I677)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I677(m, f, sep, x, peek, ...) m(f, 677, x) MAP_NEXT(peek, sep, MAP_I678)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I678(m, f, sep, x, peek, ...) m(f, 678, x) MAP_NEXT(peek, sep, MAP_I679)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I679(m, f, sep, x, peek, ...) m(f, 679, x) MAP_NEXT(peek, sep, MAP_I680)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I680(m, f, sep, x, peek, ...) m(f, 680, x) MAP_NEXT(peek, sep, MAP_I681)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I681(m, f, sep, x, peek, ...) m(f, 681, x) MAP_NEXT(peek, sep, MAP_I682)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I682(m, f, sep, x, peek, ...) m(f, 682, x) MAP_NEXT(peek, sep, MAP_I683)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I683(m, f, sep, x, peek, ...) m(f, 683, x) MAP_NEXT(peek, sep, MAP_I684)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I684(m, f, sep, x, peek, ...) m(f, 684, x) MAP_NEXT(peek, sep, MAP_I685)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I685(m, f, sep, x, peek, ...) m(f, 685, x) MAP_NEXT(peek, sep, MAP_I686)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I686(m, f, sep, x, peek, ...) m(f, 686, x) MAP_NEXT(peek, sep, MAP_I687)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I687(m, f, sep, x, peek, ...) m(f, 687, x) MAP_NEXT(peek, sep, MAP_I688)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I688(m, f, sep, x, peek, ...) m(f, 688, x) MAP_NEXT(peek, sep, MAP_I689)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I689(m, f, sep, x, peek, ...) m(f, 689, x) MAP_NEXT(peek, sep, MAP_I690)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I690(m, f, sep, x, peek, ...) m(f, 690, x) MAP_NEXT(peek, sep, MAP_I691)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I691(m, f, sep, x, peek, ...) m(f, 691, x) MAP_NEXT(peek, sep, MAP_I692)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I692(m, f, sep, x, peek, ...) m(f, 692, x) MAP_NEXT(peek, sep, MAP_I693)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I693(m, f, sep, x, peek, ...) m(f, 693, x) MAP_NEXT(peek, sep, MAP_I694)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I694(m, f, sep, x, peek, ...) m(f, 694, x) MAP_NEXT(peek, sep, MAP_I695)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I695(m, f, sep, x, peek, ...) m(f, 695, x) MAP_NEXT(peek, sep, MAP_I696)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I696(m, f, sep, x, peek, ...) m(f, 696, x) MAP_NEXT(peek, sep, MAP_I697)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I697(m, f, sep, x, peek, ...) m(f, 697, x) MAP_NEXT(peek, sep, MAP_I698)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I698(m, f, sep, x, peek, ...) m(f, 698, x) MAP_NEXT(peek, sep, MAP_I699)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I699(m, f, sep, x, peek, ...) m(f, 699, x) MAP_NEXT(peek, sep, MAP_I700)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I700(m, f, sep, x, peek, ...) m(f, 700, x) MAP_NEXT(peek, sep, MAP_I701)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I701(m, f, sep, x, peek, ...) m(f, 701, x) MAP_NEXT(peek, sep, MAP_I702)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I702(m, f, sep, x, peek, ...) m(f, 702, x) MAP_NEXT(peek, sep, MAP_I703)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I703(m, f, sep, x, peek, ...) m(f, 703, x) MAP_NEXT(peek, sep, MAP_I704)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I704(m, f, sep, x, peek, ...) m(f, 704, x) MAP_NEXT(peek, sep, MAP_I705)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I705(m, f, sep, x, peek, ...) m(f, 705, x) MAP_NEXT(peek, sep, MAP_I706)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I706(m, f, sep, x, peek, ...) m(f, 706, x) MAP_NEXT(peek, sep, MAP_I707)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I707(m, f, sep, x, peek, ...) m(f, 707, x) MAP_NEXT(peek, sep, MAP_I708)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I708(m, f, sep, x, peek, ...) m(f, 708, x) MAP_NEXT(peek, sep, MAP_I709)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I709(m, f, sep, x, peek, ...) m(f, 709, x) MAP_NEXT(peek, sep, MAP_I710)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I710(m, f, sep, x, peek, ...) m(f, 710, x) MAP_NEXT(peek, sep, MAP_I711)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I711(m, f, sep, x, peek, ...) m(f, 711, x) MAP_NEXT(peek, sep, MAP_I712)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I712(m, f, sep, x, peek, ...) m(f, 712, x) MAP_NEXT(peek, sep, MAP_I713)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I713(m, f, sep, x, peek, ...) m(f, 713, x) MAP_NEXT(peek, sep, MAP_I714)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I714(m, f, sep, x, peek, ...) m(f, 714, x) MAP_NEXT(peek, sep, MAP_I715)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I715(m, f, sep, x, peek, ...) m(f, 715, x) MAP_NEXT(peek, sep, MAP_I716)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I716(m, f, sep, x, peek, ...) m(f, 716, x) MAP_NEXT(peek, sep, MAP_I717)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I717(m, f, sep, x, peek, ...) m(f, 717, x) MAP_NEXT(peek, sep, MAP_I718)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I718(m, f, sep, x, peek, ...) m(f, 718, x) MAP_NEXT(peek, sep, MAP_I719)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I719(m, f, sep, x, peek, ...) m(f, 719, x) MAP_NEXT(peek, sep, MAP_I720)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I720(m, f, sep, x, peek, ...) m(f, 720, x) MAP_NEXT(peek, sep, MAP_I721)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I721(m, f, sep, x, peek, ...) m(f, 721, x) MAP_NEXT(peek, sep, MAP_I722)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I722(m, f, sep, x, peek, ...) m(f, 722, x) MAP_NEXT(peek, sep, MAP_I723)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I723(m, f, sep, x, peek, ...) m(f, 723, x) MAP_NEXT(peek, sep, MAP_I724)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I724(m, f, sep, x, peek, ...) m(f, 724, x) MAP_NEXT(peek, sep, MAP_I725)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I725(m, f, sep, x, peek, ...) m(f, 725, x) MAP_NEXT(peek, sep, MAP_I726)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I726(m, f, sep, x, peek, ...) m(f, 726, x) MAP_NEXT(peek, sep, MAP_I727)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I727(m, f, sep, x, peek, ...) m(f, 727, x) MAP_NEXT(peek, sep, MAP_I728)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I728(m, f, sep, x, peek, ...) m(f, 728, x) MAP_NEXT(peek, sep, MAP_I729)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I729(m, f, sep, x, peek, ...) m(f, 729, x) MAP_NEXT(peek, sep, MAP_I730)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I730(m, f, sep, x, peek, ...) m(f, 730, x) MAP_NEXT(peek, sep, MAP_I731)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I731(m, f, sep, x, peek, ...) m(f, 731, x) MAP_NEXT(peek, sep, MAP_I732)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I732(m, f, sep, x, peek, ...) m(f, 732, x) MAP_NEXT(peek, sep, MAP_I733)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I733(m, f, sep, x, peek, ...) m(f, 733, x) MAP_NEXT(peek, sep, MAP_I734)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I734(m, f, sep, x, peek, ...) m(f, 734, x) MAP_NEXT(peek, sep, MAP_I735)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I735(m, f, sep, x, peek, ...) m(f, 735, x) MAP_NEXT(peek, sep, MAP_I736)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I736(m, f, sep, x, peek, ...) m(f, 736, x) MAP_NEXT(peek, sep, MAP_I737)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I737(m, f, sep, x, peek, ...) m(f, 737, x) MAP_NEXT(peek, sep, MAP_I738)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I738(m, f, sep, x, peek, ...) m(f, 738, x) MAP_NEXT(peek, sep, MAP_I739)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I739(m, f, sep, x, peek, ...) m(f, 739, x) MAP_NEXT(peek, sep, MAP_I740)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I740(m, f, sep, x, peek, ...) m(f, 740, x) MAP_NEXT(peek, sep, MAP_I741)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I741(m, f, sep, x, peek, ...) m(f, 741, x) MAP_NEXT(peek, sep, MAP_I742)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I742(m, f, sep, x, peek, ...) m(f, 742, x) MAP_NEXT(peek, sep, MAP_I743)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I743(m, f, sep, x, peek, ...) m(f, 743, x) MAP_NEXT(peek, sep, MAP_I744)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I744(m, f, sep, x, peek, ...) m(f, 744, x) MAP_NEXT(peek, sep, MAP_I745)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I745(m, f, sep, x, peek, ...) m(f, 745, x) MAP_NEXT(peek, sep, MAP_I746)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I746(m, f, sep, x, peek, ...) m(f, 746, x) MAP_NEXT(peek, sep, MAP_I747)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I747(m, f, sep, x, peek, ...) m(f, 747, x) MAP_NEXT(peek, sep, MAP_I748)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I748(m, f, sep, x, peek, ...) m(f, 748, x) MAP_NEXT(peek, sep, MAP_I749)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I749(m, f, sep, x, peek, ...) m(f, 749, x) MAP_NEXT(peek, sep, MAP_I750)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I750(m, f, sep, x, peek, ...) m(f, 750, x) MAP_NEXT(peek, sep, MAP_I751)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I751(m, f, sep, x, peek, ...) m(f, 751, x) MAP_NEXT(peek, sep, MAP_I752)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I752(m, f, sep, x, peek, ...) m(f, 752, x) MAP_NEXT(peek, sep, MAP_I753)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I753(m, f, sep, x, peek, ...) m(f, 753, x) MAP_NEXT(peek, sep, MAP_I754)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I754(m, f, sep, x, peek, ...) m(f, 754, x) MAP_NEXT(peek, sep, MAP_I755)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I755(m, f, sep, x, peek, ...) m(f, 755, x) MAP_NEXT(peek, sep, MAP_I756)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I756(m, f, sep, x, peek, ...) m(f, 756, x) MAP_NEXT(peek, sep, MAP_I757)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I757(m, f, sep, x, peek, ...) m(f, 757, x) MAP_NEXT(peek, sep, MAP_I758)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I758(m, f, sep, x, peek, ...) m(f, 758, x) MAP_NEXT(peek, sep, MAP_I759)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I759(m, f, sep, x, peek, ...) m(f, 759, x) MAP_NEXT(peek, sep, MAP_I760)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I760(m, f, sep, x, peek, ...) m(f, 760, x) MAP_NEXT(peek, sep, MAP_I761)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I761(m, f, sep, x, peek, ...) m(f, 761, x) MAP_NEXT(peek, sep, MAP_I762)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I762(m, f, sep, x, peek, ...) m(f, 762, x) MAP_NEXT(peek, sep, MAP_I763)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I763(m, f, sep, x, peek, ...) m(f, 763, x) MAP_NEXT(peek, sep, MAP_I764)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I764(m, f, sep, x, peek, ...) m(f, 764, x) MAP_NEXT(peek, sep, MAP_I765)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I765(m, f, sep, x, peek, ...) m(f, 765, x) MAP_NEXT(peek, sep, MAP_I766)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I766(m, f, sep, x, peek, ...) m(f, 766, x) MAP_NEXT(peek, sep, MAP_I767)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I767(m, f, sep, x, peek, ...) m(f, 767, x) MAP_NEXT(peek, sep, MAP_I768)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I768(m, f, sep, x, peek, ...) m(f, 768, x) MAP_NEXT(peek, sep, MAP_I769)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I769(m, f, sep, x, peek, ...) m(f, 769, x) MAP_NEXT(peek, sep, MAP_I770)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I770(m, f, sep, x, peek, ...) m(f, 770, x) MAP_NEXT(peek, sep, MAP_I771)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I771(m, f, sep, x, peek, ...) m(f, 771, x) MAP_NEXT(peek, sep, MAP_I772)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I772(m, f, sep, x, peek, ...) m(f, 772, x) MAP_NEXT(peek, sep, MAP_I773)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I773(m, f, sep, x, peek, ...) m(f, 773, x) MAP_NEXT(peek, sep, MAP_I774)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I774(m, f, sep, x, peek, ...) m(f, 774, x) MAP_NEXT(peek, sep, MAP_I775)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I775(m, f, sep, x, peek, ...) m(f, 775, x) MAP_NEXT(peek, sep, MAP_I776)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I776(m, f, sep, x, peek, ...) m(f, 776, x) MAP_NEXT(peek, sep, MAP_I777)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I777(m, f, sep, x, peek, ...) m(f, 777, x) MAP_NEXT(peek, sep, MAP_I778)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I778(m, f, sep, x, peek, ...) m(f, 778, x) MAP_NEXT(peek, sep, MAP_I779)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I779(m, f, sep, x, peek, ...) m(f, 779, x) MAP_NEXT(peek, sep, MAP_I780)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I780(m, f, sep, x, peek, ...) m(f, 780, x) MAP_NEXT(peek, sep, MAP_I781)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I781(m, f, sep, x, peek, ...) m(f, 781, x) MAP_NEXT(peek, sep, MAP_I782)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I782(m, f, sep, x, peek, ...) m(f, 782, x) MAP_NEXT(peek, sep, MAP_I783)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I783(m, f, sep, x, peek, ...) m(f, 783, x) MAP_NEXT(peek, sep, MAP_I784)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I784(m, f, sep, x, peek, ...) m(f, 784, x) MAP_NEXT(peek, sep, MAP_I785)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I785(m, f, sep, x, peek, ...) m(f, 785, x) MAP_NEXT(peek, sep, MAP_I786)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I786(m, f, sep, x, peek, ...) m(f, 786, x) MAP_NEXT(peek, sep, MAP_I787)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I787(m, f, sep, x, peek, ...) m(f, 787, x) MAP_NEXT(peek, sep, MAP_I788)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I788(m, f, sep, x, peek, ...) m(f, 788, x) MAP_NEXT(peek, sep, MAP_I789)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I789(m, f, sep, x, peek, ...) m(f, 789, x) MAP_NEXT(peek, sep, MAP_I790)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I790(m, f, sep, x, peek, ...) m(f, 790, x) MAP_NEXT(peek, sep, MAP_I791)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I791(m, f, sep, x, peek, ...) m(f, 791, x) MAP_NEXT(peek, sep, MAP_I792)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I792(m, f, sep, x, peek, ...) m(f, 792, x) MAP_NEXT(peek, sep, MAP_I793)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I793(m, f, sep, x, peek, ...) m(f, 793, x) MAP_NEXT(peek, sep, MAP_I794)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I794(m, f, sep, x, peek, ...) m(f, 794, x) MAP_NEXT(peek, sep, MAP_I795)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I795(m, f, sep, x, peek, ...) m(f, 795, x) MAP_NEXT(peek, sep, MAP_I796)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I796(m, f, sep, x, peek, ...) m(f, 796, x) MAP_NEXT(peek, sep, MAP_I797)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I797(m, f, sep, x, peek, ...) m(f, 797, x) MAP_NEXT(peek, sep, MAP_I798)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I798(m, f, sep, x, peek, ...) m(f, 798, x) MAP_NEXT(peek, sep, MAP_I799)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I799(m, f, sep, x, peek, ...) m(f, 799, x) MAP_NEXT(peek, sep, MAP_I800)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I800(m, f, sep, x, peek, ...) m(f, 800, x) MAP_NEXT(peek, sep, MAP_I801)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I801(m, f, sep, x, peek, ...) m(f, 801, x) MAP_NEXT(peek, sep, MAP_I802)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I802(m, f, sep, x, peek, ...) m(f, 802, x) MAP_NEXT(peek, sep, MAP_I803)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I803(m, f, sep, x, peek, ...) m(f, 803, x) MAP_NEXT(peek, sep, MAP_I804)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I804(m, f, sep, x, peek, ...) m(f, 804, x) MAP_NEXT(peek, sep, MAP_I805)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I805(m, f, sep, x, peek, ...) m(f, 805, x) MAP_NEXT(peek, sep, MAP_I806)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I806(m, f, sep, x, peek, ...) m(f, 806, x) MAP_NEXT(peek, sep, MAP_I807)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I807(m, f, sep, x, peek, ...) m(f, 807, x) MAP_NEXT(peek, sep, MAP_I808)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I808(m, f, sep, x, peek, ...) m(f, 808, x) MAP_NEXT(peek, sep, MAP_I809)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I809(m, f, sep, x, peek, ...) m(f, 809, x) MAP_NEXT(peek, sep, MAP_I810)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I810(m, f, sep, x, peek, ...) m(f, 810, x) MAP_NEXT(peek, sep, MAP_I811)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I811(m, f, sep, x, peek, ...) m(f, 811, x) MAP_NEXT(peek, sep, MAP_I812)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I812(m, f, sep, x, peek, ...) m(f, 812, x) MAP_NEXT(peek, sep, MAP_I813)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I813(m, f, sep, x, peek, ...) m(f, 813, x) MAP_NEXT(peek, sep, MAP_I814)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I814(m, f, sep, x, peek, ...) m(f, 814, x) MAP_NEXT(peek, sep, MAP_I815)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I815(m, f, sep, x, peek, ...) m(f, 815, x) MAP_NEXT(peek, sep, MAP_I816)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I816(m, f, sep, x, peek, ...) m(f, 816, x) MAP_NEXT(peek, sep, MAP_I817)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I817(m, f, sep, x, peek, ...) m(f, 817, x) MAP_NEXT(peek, sep, MAP_I818)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I818(m, f, sep, x, peek, ...) m(f, 818, x) MAP_NEXT(peek, sep, MAP_I819)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I819(m, f, sep, x, peek, ...) m(f, 819, x) MAP_NEXT(peek, sep, MAP_I820)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I820(m, f, sep, x, peek, ...) m(f, 820, x) MAP_NEXT(peek, sep, MAP_I821)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I821(m, f, sep, x, peek, ...) m(f, 821, x) MAP_NEXT(peek, sep, MAP_I822)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I822(m, f, sep, x, peek, ...) m(f, 822, x) MAP_NEXT(peek, sep, MAP_I823)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I823(m, f, sep, x, peek, ...) m(f, 823, x) MAP_NEXT(peek, sep, MAP_I824)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I824(m, f, sep, x, peek, ...) m(f, 824, x) MAP_NEXT(peek, sep, MAP_I825)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I825(m, f, sep, x, peek, ...) m(f, 825, x) MAP_NEXT(peek, sep, MAP_I826)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I826(m, f, sep, x, peek, ...) m(f, 826, x) MAP_NEXT(peek, sep, MAP_I827)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I827(m, f, sep, x, peek, ...) m(f, 827, x) MAP_NEXT(peek, sep, MAP_I828)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I828(m, f, sep, x, peek, ...) m(f, 828, x) MAP_NEXT(peek, sep, MAP_I829)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I829(m, f, sep, x, peek, ...) m(f, 829, x) MAP_NEXT(peek, sep, MAP_I830)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I830(m, f, sep, x, peek, ...) m(f, 830, x) MAP_NEXT(peek, sep, MAP_I831)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I831(m, f, sep, x, peek, ...) m(f, 831, x) MAP_NEXT(peek, sep, MAP_I832)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I832(m, f, sep, x, peek, ...) m(f, 832, x) MAP_NEXT(peek, sep, MAP_I833)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I833(m, f, sep, x, peek, ...) m(f, 833, x) MAP_NEXT(peek, sep, MAP_I834)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I834(m, f, sep, x, peek, ...) m(f, 834, x) MAP_NEXT(peek, sep, MAP_I835)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I835(m, f, sep, x, peek, ...) m(f, 835, x) MAP_NEXT(peek, sep, MAP_I836)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I836(m, f, sep, x, peek, ...) m(f, 836, x) MAP_NEXT(peek, sep, MAP_I837)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I837(m, f, sep, x, peek, ...) m(f, 837, x) MAP_NEXT(peek, sep, MAP_I838)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I838(m, f, sep, x, peek, ...) m(f, 838, x) MAP_NEXT(peek, sep, MAP_I839)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I839(m, f, sep, x, peek, ...) m(f, 839, x) MAP_NEXT(peek, sep, MAP_I840)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I840(m, f, sep, x, peek, ...) m(f, 840, x) MAP_NEXT(peek, sep, MAP_I841)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I841(m, f, sep, x, peek, ...) m(f, 841, x) MAP_NEXT(peek, sep, MAP_I842)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I842(m, f, sep, x, peek, ...) m(f, 842, x) MAP_NEXT(peek, sep, MAP_I843)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I843(m, f, sep, x, peek, ...) m(f, 843, x) MAP_NEXT(peek, sep, MAP_I844)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I844(m, f, sep, x, peek, ...) m(f, 844, x) MAP_NEXT(peek, sep, MAP_I845)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I845(m, f, sep, x, peek, ...) m(f, 845, x) MAP_NEXT(peek, sep, MAP_I846)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I846(m, f, sep, x, peek, ...) m(f, 846, x) MAP_NEXT(peek, sep, MAP_I847)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I847(m, f, sep, x, peek, ...) m(f, 847, x) MAP_NEXT(peek, sep, MAP_I848)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I848(m, f, sep, x, peek, ...) m(f, 848, x) MAP_NEXT(peek, sep, MAP_I849)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I849(m, f, sep, x, peek, ...) m(f, 849, x) MAP_NEXT(peek, sep, MAP_I850)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I850(m, f, sep, x, peek, ...) m(f, 850, x) MAP_NEXT(peek, sep, MAP_I851)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I851(m, f, sep, x, peek, ...) m(f, 851, x) MAP_NEXT(peek, sep, MAP_I852)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I852(m, f, sep, x, peek, ...) m(f, 852, x) MAP_NEXT(peek, sep, MAP_I853)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I853(m, f, sep, x, peek, ...) m(f, 853, x) MAP_NEXT(peek, sep, MAP_I854)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I854(m, f, sep, x, peek, ...) m(f, 854, x) MAP_NEXT(peek, sep, MAP_I855)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I855(m, f, sep, x, peek, ...) m(f, 855, x) MAP_NEXT(peek, sep, MAP_I856)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I856(m, f, sep, x, peek, ...) m(f, 856, x) MAP_NEXT(peek, sep, MAP_I857)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I857(m, f, sep, x, peek, ...) m(f, 857, x) MAP_NEXT(peek, sep, MAP_I858)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I858(m, f, sep, x, peek, ...) m(f, 858, x) MAP_NEXT(peek, sep, MAP_I859)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I859(m, f, sep, x, peek, ...) m(f, 859, x) MAP_NEXT(peek, sep, MAP_I860)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I860(m, f, sep, x, peek, ...) m(f, 860, x) MAP_NEXT(peek, sep, MAP_I861)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I861(m, f, sep, x, peek, ...) m(f, 861, x) MAP_NEXT(peek, sep, MAP_I862)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I862(m, f, sep, x, peek, ...) m(f, 862, x) MAP_NEXT(peek, sep, MAP_I863)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I863(m, f, sep, x, peek, ...) m(f, 863, x) MAP_NEXT(peek, sep, MAP_I864)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I864(m, f, sep, x, peek, ...) m(f, 864, x) MAP_NEXT(peek, sep, MAP_I865)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I865(m, f, sep, x, peek, ...) m(f, 865, x) MAP_NEXT(peek, sep, MAP_I866)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I866(m, f, sep, x, peek, ...) m(f, 866, x) MAP_NEXT(peek, sep, MAP_I867)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I867(m, f, sep, x, peek, ...) m(f, 867, x) MAP_NEXT(peek, sep, MAP_I868)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I868(m, f, sep, x, peek, ...) m(f, 868, x) MAP_NEXT(peek, sep, MAP_I869)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I869(m, f, sep, x, peek, ...) m(f, 869, x) MAP_NEXT(peek, sep, MAP_I870)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I870(m, f, sep, x, peek, ...) m(f, 870, x) MAP_NEXT(peek, sep, MAP_I871)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I871(m, f, sep, x, peek, ...) m(f, 871, x) MAP_NEXT(peek, sep, MAP_I872)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I872(m, f, sep, x, peek, ...) m(f, 872, x) MAP_NEXT(peek, sep, MAP_I873)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I873(m, f, sep, x, peek, ...) m(f, 873, x) MAP_NEXT(peek, sep, MAP_I874)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I874(m, f, sep, x, peek, ...) m(f, 874, x) MAP_NEXT(peek, sep, MAP_I875)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I875(m, f, sep, x, peek, ...) m(f, 875, x) MAP_NEXT(peek, sep, MAP_I876)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I876(m, f, sep, x, peek, ...) m(f, 876, x) MAP_NEXT(peek, sep, MAP_I877)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I877(m, f, sep, x, peek, ...) m(f, 877, x) MAP_NEXT(peek, sep, MAP_I878)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I878(m, f, sep, x, peek, ...) m(f, 878, x) MAP_NEXT(peek, sep, MAP_I879)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I879(m, f, sep, x, peek, ...) m(f, 879, x) MAP_NEXT(peek, sep, MAP_I880)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I880(m, f, sep, x, peek, ...) m(f, 880, x) MAP_NEXT(peek, sep, MAP_I881)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I881(m, f, sep, x, peek, ...) m(f, 881, x) MAP_NEXT(peek, sep, MAP_I882)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I882(m, f, sep, x, peek, ...) m(f, 882, x) MAP_NEXT(peek, sep, MAP_I883)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I883(m, f, sep, x, peek, ...) m(f, 883, x) MAP_NEXT(peek, sep, MAP_I884)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I884(m, f, sep, x, peek, ...) m(f, 884, x) MAP_NEXT(peek, sep, MAP_I885)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I885(m, f, sep, x, peek, ...) m(f, 885, x) MAP_NEXT(peek, sep, MAP_I886)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I886(m, f, sep, x, peek, ...) m(f, 886, x) MAP_NEXT(peek, sep, MAP_I887)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I887(m, f, sep, x, peek, ...) m(f, 887, x) MAP_NEXT(peek, sep, MAP_I888)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I888(m, f, sep, x, peek, ...) m(f, 888, x) MAP_NEXT(peek, sep, MAP_I889)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I889(m, f, sep, x, peek, ...) m(f, 889, x) MAP_NEXT(peek, sep, MAP_I890)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I890(m, f, sep, x, peek, ...) m(f, 890, x) MAP_NEXT(peek, sep, MAP_I891)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I891(m, f, sep, x, peek, ...) m(f, 891, x) MAP_NEXT(peek, sep, MAP_I892)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I892(m, f, sep, x, peek, ...) m(f, 892, x) MAP_NEXT(peek, sep, MAP_I893)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I893(m, f, sep, x, peek, ...) m(f, 893, x) MAP_NEXT(peek, sep, MAP_I894)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I894(m, f, sep, x, peek, ...) m(f, 894, x) MAP_NEXT(peek, sep, MAP_I895)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I895(m, f, sep, x, peek, ...) m(f, 895, x) MAP_NEXT(peek, sep, MAP_I896)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I896(m, f, sep, x, peek, ...) m(f, 896, x) MAP_NEXT(peek, sep, MAP_I897)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I897(m, f, sep, x, peek, ...) m(f, 897, x) MAP_NEXT(peek, sep, MAP_I898)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I898(m, f, sep, x, peek, ...) m(f, 898, x) MAP_NEXT(peek, sep, MAP_I899)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I899(m, f, sep, x, peek, ...) m(f, 899, x) MAP_NEXT(peek, sep, MAP_I900)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I900(m, f, sep, x, peek, ...) m(f, 900, x) MAP_NEXT(peek, sep, MAP_I901)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I901(m, f, sep, x, peek, ...) m(f, 901, x) MAP_NEXT(peek, sep, MAP_I902)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I902(m, f, sep, x, peek, ...) m(f, 902, x) MAP_NEXT(peek, sep, MAP_I903)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I903(m, f, sep, x, peek, ...) m(f, 903, x) MAP_NEXT(peek, sep, MAP_I904)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I904(m, f, sep, x, peek, ...) m(f, 904, x) MAP_NEXT(peek, sep, MAP_I905)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I905(m, f, sep, x, peek, ...) m(f, 905, x) MAP_NEXT(peek, sep, MAP_I906)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I906(m, f, sep, x, peek, ...) m(f, 906, x) MAP_NEXT(peek, sep, MAP_I907)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I907(m, f, sep, x, peek, ...) m(f, 907, x) MAP_NEXT(peek, sep, MAP_I908)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I908(m, f, sep, x, peek, ...) m(f, 908, x) MAP_NEXT(peek, sep, MAP_I909)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I909(m, f, sep, x, peek, ...) m(f, 909, x) MAP_NEXT(peek, sep, MAP_I910)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I910(m, f, sep, x, peek, ...) m(f, 910, x) MAP_NEXT(peek, sep, MAP_I911)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I911(m, f, sep, x, peek, ...) m(f, 911, x) MAP_NEXT(peek, sep, MAP_I912)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I912(m, f, sep, x, peek, ...) m(f, 912, x) MAP_NEXT(peek, sep, MAP_I913)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I913(m, f, sep, x, peek, ...) m(f, 913, x) MAP_NEXT(peek, sep, MAP_I914)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I914(m, f, sep, x, peek, ...) m(f, 914, x) MAP_NEXT(peek, sep, MAP_I915)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I915(m, f, sep, x, peek, ...) m(f, 915, x) MAP_NEXT(peek, sep, MAP_I916)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I916(m, f, sep, x, peek, ...) m(f, 916, x) MAP_NEXT(peek, sep, MAP_I917)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I917(m, f, sep, x, peek, ...) m(f, 917, x) MAP_NEXT(peek, sep, MAP_I918)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I918(m, f, sep, x, peek, ...) m(f, 918, x) MAP_NEXT(peek, sep, MAP_I919)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I919(m, f, sep, x, peek, ...) m(f, 919, x) MAP_NEXT(peek, sep, MAP_I920)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I920(m, f, sep, x, peek, ...) m(f, 920, x) MAP_NEXT(peek, sep, MAP_I921)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I921(m, f, sep, x, peek, ...) m(f, 921, x) MAP_NEXT(peek, sep, MAP_I922)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I922(m, f, sep, x, peek, ...) m(f, 922, x) MAP_NEXT(peek, sep, MAP_I923)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I923(m, f, sep, x, peek, ...) m(f, 923, x) MAP_NEXT(peek, sep, MAP_I924)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I924(m, f, sep, x, peek, ...) m(f, 924, x) MAP_NEXT(peek, sep, MAP_I925)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I925(m, f, sep, x, peek, ...) m(f, 925, x) MAP_NEXT(peek, sep, MAP_I926)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I926(m, f, sep, x, peek, ...) m(f, 926, x) MAP_NEXT(peek, sep, MAP_I927)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I927(m, f, sep, x, peek, ...) m(f, 927, x) MAP_NEXT(peek, sep, MAP_I928)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I928(m, f, sep, x, peek, ...) m(f, 928, x) MAP_NEXT(peek, sep, MAP_I929)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I929(m, f, sep, x, peek, ...) m(f, 929, x) MAP_NEXT(peek, sep, MAP_I930)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I930(m, f, sep, x, peek, ...) m(f, 930, x) MAP_NEXT(peek, sep, MAP_I931)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I931(m, f, sep, x, peek, ...) m(f, 931, x) MAP_NEXT(peek, sep, MAP_I932)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I932(m, f, sep, x, peek, ...) m(f, 932, x) MAP_NEXT(peek, sep, MAP_I933)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I933(m, f, sep, x, peek, ...) m(f, 933, x) MAP_NEXT(peek, sep, MAP_I934)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I934(m, f, sep, x, peek, ...) m(f, 934, x) MAP_NEXT(peek, sep, MAP_I935)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I935(m, f, sep, x, peek, ...) m(f, 935, x) MAP_NEXT(peek, sep, MAP_I936)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I936(m, f, sep, x, peek, ...) m(f, 936, x) MAP_NEXT(peek, sep, MAP_I937)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I937(m, f, sep, x, peek, ...) m(f, 937, x) MAP_NEXT(peek, sep, MAP_I938)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I938(m, f, sep, x, peek, ...) m(f, 938, x) MAP_NEXT(peek, sep, MAP_I939)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I939(m, f, sep, x, peek, ...) m(f, 939, x) MAP_NEXT(peek, sep, MAP_I940)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I940(m, f, sep, x, peek, ...) m(f, 940, x) MAP_NEXT(peek, sep, MAP_I941)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I941(m, f, sep, x, peek, ...) m(f, 941, x) MAP_NEXT(peek, sep, MAP_I942)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I942(m, f, sep, x, peek, ...) m(f, 942, x) MAP_NEXT(peek, sep, MAP_I943)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I943(m, f, sep, x, peek, ...) m(f, 943, x) MAP_NEXT(peek, sep, MAP_I944)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I944(m, f, sep, x, peek, ...) m(f, 944, x) MAP_NEXT(peek, sep, MAP_I945)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I945(m, f, sep, x, peek, ...) m(f, 945, x) MAP_NEXT(peek, sep, MAP_I946)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I946(m, f, sep, x, peek, ...) m(f, 946, x) MAP_NEXT(peek, sep, MAP_I947)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I947(m, f, sep, x, peek, ...) m(f, 947, x) MAP_NEXT(peek, sep, MAP_I948)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I948(m, f, sep, x, peek, ...) m(f, 948, x) MAP_NEXT(peek, sep, MAP_I949)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I949(m, f, sep, x, peek, ...) m(f, 949, x) MAP_NEXT(peek, sep, MAP_I950)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I950(m, f, sep, x, peek, ...) m(f, 950, x) MAP_NEXT(peek, sep, MAP_I951)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I951(m, f, sep, x, peek, ...) m(f, 951, x) MAP_NEXT(peek, sep, MAP_I952)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I952(m, f, sep, x, peek, ...) m(f, 952, x) MAP_NEXT(peek, sep, MAP_I953)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I953(m, f, sep, x, peek, ...) m(f, 953, x) MAP_NEXT(peek, sep, MAP_I954)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I954(m, f, sep, x, peek, ...) m(f, 954, x) MAP_NEXT(peek, sep, MAP_I955)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I955(m, f, sep, x, peek, ...) m(f, 955, x) MAP_NEXT(peek, sep, MAP_I956)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I956(m, f, sep, x, peek, ...) m(f, 956, x) MAP_NEXT(peek, sep, MAP_I957)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I957(m, f, sep, x, peek, ...) m(f, 957, x) MAP_NEXT(peek, sep, MAP_I958)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I958(m, f, sep, x, peek, ...) m(f, 958, x) MAP_NEXT(peek, sep, MAP_I959)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I959(m, f, sep, x, peek, ...) m(f, 959, x) MAP_NEXT(peek, sep, MAP_I960)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I960(m, f, sep, x, peek, ...) m(f, 960, x) MAP_NEXT(peek, sep, MAP_I961)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I961(m, f, sep, x, peek, ...) m(f, 961, x) MAP_NEXT(peek, sep, MAP_I962)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I962(m, f, sep, x, peek, ...) m(f, 962, x) MAP_NEXT(peek, sep, MAP_I963)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I963(m, f, sep, x, peek, ...) m(f, 963, x) MAP_NEXT(peek, sep, MAP_I964)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I964(m, f, sep, x, peek, ...) m(f, 964, x) MAP_NEXT(peek, sep, MAP_I965)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I965(m, f, sep, x, peek, ...) m(f, 965, x) MAP_NEXT(peek, sep, MAP_I966)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I966(m, f, sep, x, peek, ...) m(f, 966, x) MAP_NEXT(peek, sep, MAP_I967)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I967(m, f, sep, x, peek, ...) m(f, 967, x) MAP_NEXT(peek, sep, MAP_I968)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I968(m, f, sep, x, peek, ...) m(f, 968, x) MAP_NEXT(peek, sep, MAP_I969)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I969(m, f, sep, x, peek, ...) m(f, 969, x) MAP_NEXT(peek, sep, MAP_I970)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I970(m, f, sep, x, peek, ...) m(f, 970, x) MAP_NEXT(peek, sep, MAP_I971)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I971(m, f, sep, x, peek, ...) m(f, 971, x) MAP_NEXT(peek, sep, MAP_I972)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I972(m, f, sep, x, peek, ...) m(f, 972, x) MAP_NEXT(peek, sep, MAP_I973)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I973(m, f, sep, x, peek, ...) m(f, 973, x) MAP_NEXT(peek, sep, MAP_I974)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I974(m, f, sep, x, peek, ...) m(f, 974, x) MAP_NEXT(peek, sep, MAP_I975)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I975(m, f, sep, x, peek, ...) m(f, 975, x) MAP_NEXT(peek, sep, MAP_I976)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I976(m, f, sep, x, peek, ...) m(f, 976, x) MAP_NEXT(peek, sep, MAP_I977)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I977(m, f, sep, x, peek, ...) m(f, 977, x) MAP_NEXT(peek, sep, MAP_I978)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I978(m, f, sep, x, peek, ...) m(f, 978, x) MAP_NEXT(peek, sep, MAP_I979)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I979(m, f, sep, x, peek, ...) m(f, 979, x) MAP_NEXT(peek, sep, MAP_I980)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I980(m, f, sep, x, peek, ...) m(f, 980, x) MAP_NEXT(peek, sep, MAP_I981)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I981(m, f, sep, x, peek, ...) m(f, 981, x) MAP_NEXT(peek, sep, MAP_I982)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I982(m, f, sep, x, peek, ...) m(f, 982, x) MAP_NEXT(peek, sep, MAP_I983)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I983(m, f, sep, x, peek, ...) m(f, 983, x) MAP_NEXT(peek, sep, MAP_I984)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I984(m, f, sep, x, peek, ...) m(f, 984, x) MAP_NEXT(peek, sep, MAP_I985)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I985(m, f, sep, x, peek, ...) m(f, 985, x) MAP_NEXT(peek, sep, MAP_I986)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I986(m, f, sep, x, peek, ...) m(f, 986, x) MAP_NEXT(peek, sep, MAP_I987)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I987(m, f, sep, x, peek, ...) m(f, 987, x) MAP_NEXT(peek, sep, MAP_I988)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I988(m, f, sep, x, peek, ...) m(f, 988, x) MAP_NEXT(peek, sep, MAP_I989)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I989(m, f, sep, x, peek, ...) m(f, 989, x) MAP_NEXT(peek, sep, MAP_I990)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I990(m, f, sep, x, peek, ...) m(f, 990, x) MAP_NEXT(peek, sep, MAP_I991)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I991(m, f, sep, x, peek, ...) m(f, 991, x) MAP_NEXT(peek, sep, MAP_I992)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I992(m, f, sep, x, peek, ...) m(f, 992, x) MAP_NEXT(peek, sep, MAP_I993)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I993(m, f, sep, x, peek, ...) m(f, 993, x) MAP_NEXT(peek, sep, MAP_I994)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I994(m, f, sep, x, peek, ...) m(f, 994, x) MAP_NEXT(peek, sep, MAP_I995)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I995(m, f, sep, x, peek, ...) m(f, 995, x) MAP_NEXT(peek, sep, MAP_I996)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I996(m, f, sep, x, peek, ...) m(f, 996, x) MAP_NEXT(peek, sep, MAP_I997)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I997(m, f, sep, x, peek, ...) m(f, 997, x) MAP_NEXT(peek, sep, MAP_I998)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I998(m, f, sep, x, peek, ...) m(f, 998, x) MAP_NEXT(peek, sep, MAP_I999)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I999(m, f, sep, x, peek, ...) m(f, 999, x) MAP_NEXT(peek, sep, MAP_I1000)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I1000(m, f, sep, x, peek, ...) m(f, 1000, x) MAP_NEXT(peek, sep, MAP_I1001)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I1001(m, f, sep, x, peek, ...) m(f, 1001, x) MAP_NEXT(peek, sep, MAP_I1002)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I1002(m, f, sep, x, peek, ...) m(f, 1002, x) MAP_NEXT(peek, sep, MAP_I1003)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I1003(m, f, sep, x, peek, ...) m(f, 1003, x) MAP_NEXT(peek, sep, MAP_I1004)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I1004(m, f, sep, x, peek, ...) m(f, 1004, x) MAP_NEXT(peek, sep, MAP_I1005)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I1005(m, f, sep, x, peek, ...) m(f, 1005, x) MAP_NEXT(peek, sep, MAP_I1006)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I1006(m, f, sep, x, peek, ...) m(f, 1006, x) MAP_NEXT(peek, sep, MAP_I1007)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I1007(m, f, sep, x, peek, ...) m(f, 1007, x) MAP_NEXT(peek, sep, MAP_I1008)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I1008(m, f, sep, x, peek, ...) m(f, 1008, x) MAP_NEXT(peek, sep, MAP_I1009)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I1009(m, f, sep, x, peek, ...) m(f, 1009, x) MAP_NEXT(peek, sep, MAP_I1010)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I1010(m, f, sep, x, peek, ...) m(f, 1010, x) MAP_NEXT(peek, sep, MAP_I1011)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I1011(m, f, sep, x, peek, ...) m(f, 1011, x) MAP_NEXT(peek, sep, MAP_I1012)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I1012(m, f, sep, x, peek, ...) m(f, 1012, x) MAP_NEXT(peek, sep, MAP_I1013)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I1013(m, f, sep, x, peek, ...) m(f, 1013, x) MAP_NEXT(peek, sep, MAP_I1014)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I1014(m, f, sep, x, peek, ...) m(f, 1014, x) MAP_NEXT(peek, sep, MAP_I1015)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I1015(m, f, sep, x, peek, ...) m(f, 1015, x) MAP_NEXT(peek, sep, MAP_I1016)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I1016(m, f, sep, x, peek, ...) m(f, 1016, x) MAP_NEXT(peek, sep, MAP_I1017)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I1017(m, f, sep, x, peek, ...) m(f, 1017, x) MAP_NEXT(peek, sep, MAP_I1018)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I1018(m, f, sep, x, peek, ...) m(f, 1018, x) MAP_NEXT(peek, sep, MAP_I1019)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I1019(m, f, sep, x, peek, ...) m(f, 1019, x) MAP_NEXT(peek, sep, MAP_I1020)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I1020(m, f, sep, x, peek, ...) m(f, 1020, x) MAP_NEXT(peek, sep, MAP_I1021)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I1021(m, f, sep, x, peek, ...) m(f, 1021, x) MAP_NEXT(peek, sep, MAP_I1022)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I1022(m, f, sep, x, peek, ...) m(f, 1022, x) MAP_NEXT(peek, sep, MAP_I1023)(m, f, sep, peek, __VA_ARGS__)
+#define MAP_I1023(m, f, sep, x, peek, ...) m(f, 1023, x) MAP_NEXT(peek, sep, MAP_I1024)(m, f, sep, peek, __VA_ARGS__)
+
+#endif
+
+/*
+ * There is no step for an argument beyond the limit, the call ends up in a static_assert that names it. The form depends on the separator, so it
+ * fits where the list is expanded: a declaration or a statement after MAP and MAP_INDEXED, an expression after MAP_LIST and MAP_LIST_INDEXED.
+ * A MAP_LIST in a parameter list has no valid form, the compiler reports a syntax error there and the static_assert of the other lists follows.
+ */
+#define MAP_LIMIT_MESSAGE "map.h: MAP, MAP_LIST, MAP_INDEXED and MAP_LIST_INDEXED take at most MAP_MAX_ARGUMENTS (1024) arguments, see tools/generate_map.cmake"
+#define MAP_LIMIT_MAP_NOTHING static_assert(MAP_MAX_ARGUMENTS < 0, MAP_LIMIT_MESSAGE);
+#define MAP_LIMIT_MAP_COMMA ([] { static_assert(MAP_MAX_ARGUMENTS < 0, MAP_LIMIT_MESSAGE); }(), 0)
+#define MAP_I1024(m, f, sep, x, peek, ...) MAP_LIMIT_##sep
 
 /**
  * Applies the function macro `f` to each of the remaining parameters.
  */
-#define MAP(f, ...) EVAL(MAP1(f, __VA_ARGS__, ()()(), ()()(), ()()(), 0))
+#define MAP(f, ...) MAP_APPLY(MAP_CALL, f, MAP_NOTHING, __VA_ARGS__)
 
 /**
  * Applies the function macro `f` to each of the remaining parameters and
  * inserts commas between the results.
  */
-#define MAP_LIST(f, ...) EVAL(MAP_LIST1(f, __VA_ARGS__, ()()(), ()()(), ()()(), 0))
+#define MAP_LIST(f, ...) MAP_APPLY(MAP_CALL, f, MAP_COMMA, __VA_ARGS__)
+
+/**
+ * Applies the function macro `f` to the zero-based index and each of the
+ * remaining parameters.
+ */
+#define MAP_INDEXED(f, ...) MAP_APPLY(MAP_CALL_INDEXED, f, MAP_NOTHING, __VA_ARGS__)
+
+/**
+ * Applies the function macro `f` to the zero-based index and each of the
+ * remaining parameters and inserts commas between the results.
+ */
+#define MAP_LIST_INDEXED(f, ...) MAP_APPLY(MAP_CALL_INDEXED, f, MAP_COMMA, __VA_ARGS__)
 
 #endif
@@ -1,9 +1,18 @@
 #ifndef TAGGEDJSONARRAY_H
 #define TAGGEDJSONARRAY_H
+#include <atomic>
 #include <type_traits>
 #include <QJsonObject>
 #include <QJsonArray>
 #include <QVector>
+#include "taggedjsonreader.h"
+#include "taggedjsonwriter.h"
+#include "taggedjsonforward.h"
+#include "taggedjsonmemory.h"
+#include "taggedjsonthreadpool.h"
+#include "taggedjsoninstrumentation.h"
+#include "taggedjsonassign.h"
+#include "taggedjsonmergepatch.h"
 
 //! All types that can be encapsulated in QJsonObject
 #define TJO_JSON_COMPATIBLE std::is_arithmetic_v<T> || std::is_same_v<T, QJsonValue> || std::is_same_v<T, QJsonObject>|| std::is_same_v<T, QString> || std::is_same_v<T, QVariant>
@@ -14,11 +23,52 @@
                              std::is_constructible_v<T, const QString&, const bool> &&\
                              std::is_constructible_v<T, const QByteArray&, const bool>
 
+namespace TaggedObject {
+    //! Minimum number of the elements a task of the parallel array mode handles
+    constexpr qsizetype PARALLEL_ARRAY_GRAIN = 64;
+
+    //! Storage of the element count threshold of the parallel array mode, see setParallelArrayThreshold()
+    inline std::atomic<qsizetype>& parallelArrayThreshold()
+    {
+        static std::atomic<qsizetype> threshold{0};
+        return threshold;
+    }
+
+    /*!
+     * \brief setParallelArrayThreshold Enables the parallel mode for the arrays of tagged objects
+     *
+     * Arrays of tagged objects with at least \a elementCount elements construct, convert (toJsonValue()) and serialize (writeJson()) their elements
+     * on the global WorkStealingPool. Smaller arrays keep the sequential path. If several elements fail the checkValue validation, the exception of the
+     * first failing element is thrown, the same as in the sequential mode.
+     * \param elementCount Element count threshold, 0 disables the parallel mode (default)
+     */
+    inline void setParallelArrayThreshold(const qsizetype elementCount) { parallelArrayThreshold().store(elementCount); }
+
+    //! Returns true if an array of the given size uses the parallel mode
+    inline bool useParallelArray(const qsizetype elementCount)
+    {
+        const qsizetype threshold = parallelArrayThreshold().load(std::memory_order_relaxed);
+        return threshold > 0 && elementCount >= threshold && elementCount > PARALLEL_ARRAY_GRAIN;
+    }
+}
+
 namespace {
-    template<typename T>
-    std::vector<T> extractFromQJSONArray(const QJsonArray& arr, const bool checkValue)
+    //The output container is passed in so the allocator-aware arrays can keep their memory resource
+    template<typename T, typename Container = std::vector<T>>
+    Container extractFromQJSONArray(const QJsonArray& arr, const bool checkValue, Container out = Container())
     {
-        std::vector<T> out;
+        TJO_INSTRUMENT_SCOPE(TaggedObject::InstrumentationEvent::ArrayConstruct, TaggedObject::instrumentationName<T>(), arr.size());
+        out.clear();
+        //Memory resources aren't thread-safe, the elements of a scoped array are built on the calling thread
+        if (TaggedObject::useParallelArray(arr.size()) && !TaggedObject::hasMemoryResourceScope()) {
+            //Preallocated elements are assigned in place, each of them by exactly one task
+            out.resize(static_cast<std::size_t>(arr.size()));
+            TaggedObject::parallelFor(arr.size(), TaggedObject::PARALLEL_ARRAY_GRAIN, [&](const qsizetype i) {
+                out[static_cast<std::size_t>(i)] = T(arr.at(i), checkValue);
+            });
+            return out;
+        }
+
         out.reserve(arr.size());
         foreach(const QJsonValue & val, arr) {
             out.emplace_back(val, checkValue);
@@ -42,7 +92,7 @@ class TaggedJSONArray;
  * is more suitable for chaining JSON objects within JSON arrays.
  */
 template<typename T>
-class TaggedJSONArray <T, typename std::enable_if_t<TJO_JSON_COMPATIBLE>>
+class TaggedJSONArray <T, typename std::enable_if_t<TJO_JSON_COMPATIBLE>> : public TaggedObject::ModificationTracking
 {
 public:
     //! Default constructor, which is useful if the parameters planned to be filled later
@@ -71,9 +121,18 @@ public:
     template<typename V, typename = std::enable_if_t<std::is_convertible_v<V, QJsonArray>>>
     TaggedJSONArray(V&& val) : m_arr(std::forward<V>(val)) {};
 
+    TaggedJSONArray(const TaggedJSONArray&) = default;
+    TaggedJSONArray(TaggedJSONArray&&) = default;
+
+    //! Copy assignment, the array counts as modified
+    TaggedJSONArray& operator=(const TaggedJSONArray& other) { m_arr = other.m_arr; markModified(); return *this; };
+
+    //! Move assignment, the array counts as modified
+    TaggedJSONArray& operator=(TaggedJSONArray&& other) { m_arr = std::move(other.m_arr); markModified(); return *this; };
+
     //! Assignment operator setter
     template<typename V, typename = std::enable_if_t<std::is_convertible_v<V, QJsonArray>>>
-    TaggedJSONArray& operator=(V&& val) { m_arr = std::forward<V>(val); };
+    TaggedJSONArray& operator=(V&& val) { m_arr = std::forward<V>(val); markModified(); return *this; };
 
     //Operator overloads
     bool operator!=(const QJsonArray& other) const { return m_arr != other; };
@@ -83,9 +142,10 @@ public:
      * \brief operator * Operator overload for the whole JSON array
      *
      * If the contents of the array desired to be taken as std::vector or QVector, see toStdVector() and toQvector()
+     * The array counts as modified.
      * \return Stored JSON array
      */
-    QJsonArray& operator*() { return m_arr; };
+    QJsonArray& operator*() { markModified(); return m_arr; };
 
     /*!
      * \brief operator * Operator overload for the whole JSON array
@@ -106,7 +166,7 @@ public:
      * \param i index to be accessed
      * \return i'th element of the JSON array
      */
-    QJsonValueRef operator[](const qsizetype i) { return m_arr[i]; };
+    QJsonValueRef operator[](const qsizetype i) { markModified(); return m_arr[i]; };
 
     /*!
      * \brief operator [] Shortcut for the immutable access operator for the storage.
@@ -120,7 +180,7 @@ public:
      * \param i index to be accessed
      * \return i'th element of the JSON array
      */
-    QJsonValueRef at(const qsizetype i) { return m_arr[i]; };
+    QJsonValueRef at(const qsizetype i) { markModified(); return m_arr[i]; };
 
     /*!
      * \brief at Shortcut for the immutable access for the storage.
@@ -166,6 +226,62 @@ public:
 
     QJsonValue toJsonValue() const {return m_arr;}
 
+    //! Error-collecting validation, reports a missing array and every element of another type
+    static void validateJson(const QJsonValue& ref, TaggedObject::ValidationContext& context) { TaggedObject::validateJsonValueArray<T>(ref, context); }
+
+
+    /*!
+     * \brief readJson Direct-binding counterpart of the QJsonValue constructor, fills the array from the value the reader is positioned on.
+     * \param reader JSON reader positioned on the value of this member
+     * \param checkValue Unused, the value exists if the reader is positioned on it. Kept for the uniform member interface.
+     */
+    void readJson(TaggedObject::JsonReader& reader, const bool checkValue = true)
+    {
+        Q_UNUSED(checkValue)
+        m_arr = QJsonArray();
+        if (!reader.beginArray()) {
+            reader.skipValue();
+            return;
+        }
+
+        while (reader.nextElement())
+            m_arr.append(reader.readValue());
+    }
+
+    /*!
+     * \brief writeJson Direct serialization counterpart of toJsonValue(), writes the array as JSON text.
+     * \param writer JSON writer positioned where the value of this member belongs
+     */
+    void writeJson(TaggedObject::JsonWriter& writer) const { writer.writeArray(m_arr); }
+
+    /*!
+     * \brief readCbor CBOR counterpart of readJson(), fills the array from the value the reader is positioned on.
+     * \param reader CBOR reader positioned on the value of this member
+     * \param checkValue Unused, the value exists if the reader is positioned on it. Kept for the uniform member interface.
+     */
+    template<typename Reader>
+    void readCbor(Reader& reader, const bool checkValue = true)
+    {
+        Q_UNUSED(checkValue)
+        m_arr = QJsonArray();
+        if (!reader.isArray() || !reader.enterContainer()) {
+            reader.next();
+            return;
+        }
+
+        while (reader.hasNext())
+            m_arr.append(TaggedObject::readCborValue(reader));
+        if (!TaggedObject::hasCborError(reader))
+            reader.leaveContainer();
+    }
+
+    /*!
+     * \brief writeCbor CBOR counterpart of writeJson(), writes the array as a CBOR array.
+     * \param writer CBOR writer positioned where the value of this member belongs
+     */
+    template<typename Writer>
+    void writeCbor(Writer& writer) const { TaggedObject::writeCborValue(writer, m_arr); }
+
 private:
     QJsonArray m_arr;
 
@@ -176,7 +292,7 @@ private:
         if constexpr (std::is_same_v<T, bool>)
             return ref.toBool();
         else if constexpr (std::is_integral_v<T>)
-            return ref.toInt();
+            return TaggedObject::jsonValueToIntegral<T>(ref);
         else if constexpr (std::is_floating_point_v<T>)
             return ref.toDouble();
         else if constexpr (std::is_same_v<T, QJsonValue>)
@@ -222,7 +338,7 @@ std::ostream& operator<< (std::ostream& stream, const TaggedJSONArray<T>& obj)
  * @tparam T 
 */
 template<typename T>
-class TaggedJSONArray<T, typename std::enable_if_t<TJO_IS_TAGGED_OBJECT>>
+class TaggedJSONArray<T, typename std::enable_if_t<TJO_IS_TAGGED_OBJECT>> : public TaggedObject::ModificationTracking
 {
 public:
     //! Default constructor, which is useful if the parameters planned to be filled later
@@ -240,19 +356,54 @@ public:
             throw(std::runtime_error("Invalid data has been encountered while parsing the json data for TaggedJSONArray"));
     }
 
+    /*!
+     * @brief In-place counterpart of the main constructor, the existing elements are assigned in place and keep their storage.
+     *
+     * Elements are only constructed or destroyed if the number of the elements changes. The array counts as modified.
+     * @param ref QJsonValue that holds the array of predefined JSON objects.
+     * @param checkValue If set to true, invalid conversions (missing value, wrong type etc.) will throw a runtime error.
+    */
+    void assign(const QJsonValue& ref, const bool checkValue = true)
+    {
+        if (checkValue && ref.isUndefined())
+            throw(std::runtime_error("Invalid data has been encountered while parsing the json data for TaggedJSONArray"));
+
+        const QJsonArray arr = ref.toArray();
+        markModified();
+        m_arr.resize(static_cast<std::size_t>(arr.size()));
+        if (TaggedObject::useParallelArray(arr.size()) && !TaggedObject::hasMemoryResourceScope()) {
+            TaggedObject::parallelFor(arr.size(), TaggedObject::PARALLEL_ARRAY_GRAIN, [&](const qsizetype i) {
+                TaggedObject::assignMember(m_arr[static_cast<std::size_t>(i)], arr.at(i), checkValue);
+            });
+            return;
+        }
+
+        for (qsizetype i = 0; i < arr.size(); ++i)
+            TaggedObject::assignMember(m_arr[static_cast<std::size_t>(i)], arr.at(i), checkValue);
+    }
+
     //! Implicit value constructor for the tagged object constructor
     template<typename V, typename = std::enable_if_t<std::is_convertible_v<V, std::vector<T>>>>
     TaggedJSONArray(V&& val) : m_arr(std::forward<V>(val)) {};
 
+    TaggedJSONArray(const TaggedJSONArray&) = default;
+    TaggedJSONArray(TaggedJSONArray&&) = default;
+
+    //! Copy assignment, the array counts as modified
+    TaggedJSONArray& operator=(const TaggedJSONArray& other) { m_arr = other.m_arr; markModified(); return *this; };
+
+    //! Move assignment, the array counts as modified
+    TaggedJSONArray& operator=(TaggedJSONArray&& other) { m_arr = std::move(other.m_arr); markModified(); return *this; };
+
     //!Assignment operator to get the whole container data 
     template<typename V, typename = std::enable_if_t<std::is_convertible_v<V, std::vector<T>>>>
-    TaggedJSONArray& operator=(V&& val) { m_arr = std::forward<V>(val); };
+    TaggedJSONArray& operator=(V&& val) { m_arr = std::forward<V>(val); markModified(); return *this; };
 
     bool operator!=(const std::vector<T>& other) const { return m_arr != other; };
     bool operator==(const std::vector<T>& other) const { return m_arr == other; };
 
-    //!Mutable reference of the stored object
-    std::vector<T>& operator*() { return m_arr; };
+    //!Mutable reference of the stored object, the array counts as modified
+    std::vector<T>& operator*() { markModified(); return m_arr; };
 
     //!Immutable reference of the stored object
     const std::vector<T>& operator*() const { return m_arr; };
@@ -260,14 +411,14 @@ public:
     //!Can be used for accessing the std::vector operations on the encapsulated data
     const std::vector<T>* operator->() const { return &m_arr; };
 
-    //!Mutable access operator
-    T& operator[](const qsizetype i) { return m_arr[i]; };
+    //!Mutable access operator, the array counts as modified
+    T& operator[](const qsizetype i) { markModified(); return m_arr[i]; };
 
     //!Immutable access operator
     const T& at(const qsizetype i) const { return m_arr.at(i); };
 
-    //! Mutable access operator
-    T& at(const qsizetype i) { return m_arr.at(i); };
+    //! Mutable access operator, the array counts as modified
+    T& at(const qsizetype i) { markModified(); return m_arr.at(i); };
 
     //!QDebug enabler 
     operator QString() const {
@@ -281,16 +432,117 @@ public:
     //!QVector access
     QVector<T> toQVector() const { return QVector<T>::fromStdVector(m_arr); }
 
+    //! Error-collecting validation, reports a missing array and the errors of every element
+    static void validateJson(const QJsonValue& ref, TaggedObject::ValidationContext& context) { TaggedObject::validateTaggedArray<T>(ref, context); }
+
     //!Converts the holding values back to a QJsonArray that holds each TaggedObject information
     QJsonValue toJsonValue() const
     {
         QJsonArray ret;
+        if (TaggedObject::useParallelArray(static_cast<qsizetype>(m_arr.size()))) {
+            std::vector<QJsonValue> values(m_arr.size());
+            TaggedObject::parallelFor(static_cast<qsizetype>(m_arr.size()), TaggedObject::PARALLEL_ARRAY_GRAIN, [&](const qsizetype i) {
+                values[static_cast<std::size_t>(i)] = m_arr[static_cast<std::size_t>(i)].toJsonValue();
+            });
+            for (QJsonValue& value : values)
+                ret.append(std::move(value));
+            return ret;
+        }
+
         for(const T& curObj : m_arr){
             ret.append(curObj.toJsonValue());
         }
         return ret;
     }
 
+
+    /*!
+     * @brief Direct-binding counterpart of the main constructor, each element is parsed straight into its tagged object.
+     *
+     * The existing elements are read in place and keep their storage, so reading into the same array again reuses it.
+     * @param reader JSON reader positioned on the value of this member
+     * @param checkValue If set to true, missing members of the elements will throw a runtime error.
+    */
+    void readJson(TaggedObject::JsonReader& reader, const bool checkValue = true)
+    {
+        if (!reader.beginArray()) {
+            m_arr.clear();
+            reader.skipValue();
+            return;
+        }
+
+        std::size_t count = 0;
+        while (reader.nextElement()) {
+            if (count == m_arr.size())
+                m_arr.emplace_back();
+            TaggedObject::readMember(m_arr[count++], reader, checkValue, true);
+        }
+        m_arr.erase(m_arr.begin() + static_cast<std::ptrdiff_t>(count), m_arr.end());
+    }
+
+    /*!
+     * @brief writeJson Direct serialization counterpart of toJsonValue(), every element writes itself without building a QJsonArray.
+     * @param writer JSON writer positioned where the value of this member belongs
+    */
+    void writeJson(TaggedObject::JsonWriter& writer) const
+    {
+        writer.beginArray();
+        const qsizetype count = static_cast<qsizetype>(m_arr.size());
+        if (TaggedObject::useParallelArray(count)) {
+            //Each task writes a run of elements into its own fragment, the fragments are joined in order
+            const qsizetype runCount = (count + TaggedObject::PARALLEL_ARRAY_GRAIN - 1) / TaggedObject::PARALLEL_ARRAY_GRAIN;
+            std::vector<QByteArray> fragments(static_cast<std::size_t>(runCount));
+            TaggedObject::parallelFor(runCount, 1, [&](const qsizetype run) {
+                TaggedObject::JsonWriter fragmentWriter = writer.fragmentWriter(fragments[static_cast<std::size_t>(run)], run == 0);
+                const qsizetype end = std::min(count, (run + 1) * TaggedObject::PARALLEL_ARRAY_GRAIN);
+                for (qsizetype i = run * TaggedObject::PARALLEL_ARRAY_GRAIN; i < end; ++i)
+                    m_arr[static_cast<std::size_t>(i)].writeJson(fragmentWriter);
+            });
+            for (const QByteArray& fragment : fragments)
+                writer.appendFragment(fragment);
+        }
+        else {
+            for (const T& curObj : m_arr)
+                curObj.writeJson(writer);
+        }
+        writer.endArray();
+    }
+
+    /*!
+     * @brief readCbor CBOR counterpart of readJson(), each element is read straight into its tagged object.
+     * @param reader CBOR reader positioned on the value of this member
+     * @param checkValue If set to true, missing members of the elements will throw a runtime error.
+    */
+    template<typename Reader>
+    void readCbor(Reader& reader, const bool checkValue = true)
+    {
+        m_arr.clear();
+        if (!reader.isArray() || !reader.enterContainer()) {
+            reader.next();
+            return;
+        }
+
+        while (reader.hasNext()) {
+            m_arr.emplace_back();
+            m_arr.back().readCbor(reader, checkValue);
+        }
+        if (!TaggedObject::hasCborError(reader))
+            reader.leaveContainer();
+    }
+
+    /*!
+     * @brief writeCbor CBOR counterpart of writeJson(), every element writes itself into a CBOR array of known length.
+     * @param writer CBOR writer positioned where the value of this member belongs
+    */
+    template<typename Writer>
+    void writeCbor(Writer& writer) const
+    {
+        writer.startArray(static_cast<quint64>(m_arr.size()));
+        for (const T& curObj : m_arr)
+            curObj.writeCbor(writer);
+        writer.endArray();
+    }
+
 private:
     std::vector<T> m_arr;
 };
@@ -0,0 +1,335 @@
+#ifndef TAGGEDJSONARRAYREADER_H
+#define TAGGEDJSONARRAYREADER_H
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <QByteArray>
+#include <QIODevice>
+#include <QString>
+#include "taggedjsonreader.h"
+#include "taggedjsonassign.h"
+
+namespace TaggedObject {
+
+//! Element of the array that couldn't be turned into a tagged object
+struct JsonArrayElementError
+{
+    //! Position of the element in the array, starting from 0
+    qint64 index = 0;
+
+    //! Byte offset of the element in the input
+    qint64 offset = 0;
+
+    //! Description of the failure
+    QString message;
+};
+
+//! Settings of JsonArrayReader
+struct JsonArrayReaderOptions
+{
+    //! Size of the blocks that are read from the device. The buffer holds a block and the element that is being read, whatever the input size is.
+    qint64 blockSize = 1 << 16;
+
+    //! If set to true, the elements with missing members are invalid as well. Malformed elements are always invalid.
+    bool checkValues = true;
+
+    //! If set to true, invalid elements are skipped and reported to errorHandler. Otherwise next() throws on the first invalid element.
+    bool skipInvalid = false;
+
+    //! Optional handler of the skipped elements, invoked on the thread that calls next()
+    std::function<void(const JsonArrayElementError&)> errorHandler;
+};
+
+/*!
+ * \class JsonArrayReader
+ * \brief The JsonArrayReader class reads a top-level JSON array of tagged objects from a QIODevice one element at a time.
+ *
+ * The device is read in blocks of JsonArrayReaderOptions::blockSize bytes. Only the bytes of the element that is being read are kept, so the memory usage
+ * doesn't depend on the number of the elements. Each element is parsed in the direct-binding mode (see fromJson() on the classes generated by the
+ * #TJO_DEFINE_JSON_TAGGED_OBJECT() macro) into the same object, which keeps its storage from element to element.\n
+ * Invalid elements, malformed ones or the ones with missing members if JsonArrayReaderOptions::checkValues is set, throw a runtime error or are
+ * skipped if JsonArrayReaderOptions::skipInvalid is set. A broken array (the input isn't an array, the array is truncated etc.) ends the reading,
+ * it throws as well unless the invalid elements are skipped, see hasError() in that case.
+ * \code
+ * QFile file(path);
+ * file.open(QIODevice::ReadOnly);
+ * TaggedObject::JsonArrayReader<Record> records(file);
+ * for (const Record& record : records)
+ *     process(record);
+ * \endcode
+ * \tparam T Tagged object type of the elements
+ */
+template<typename T>
+class JsonArrayReader
+{
+public:
+    /*!
+     * \brief The Iterator class is the input iterator of the elements, the reader holds the current element
+     */
+    class Iterator
+    {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        //! The end iterator
+        Iterator() {}
+
+        T& operator*() const { return m_reader->m_current; }
+        T* operator->() const { return &m_reader->m_current; }
+
+        Iterator& operator++()
+        {
+            if (!m_reader->next(m_reader->m_current))
+                m_reader = nullptr;
+            return *this;
+        }
+
+        void operator++(int) { ++*this; }
+
+        bool operator==(const Iterator& other) const { return m_reader == other.m_reader; }
+        bool operator!=(const Iterator& other) const { return m_reader != other.m_reader; }
+
+    private:
+        friend class JsonArrayReader;
+
+        explicit Iterator(JsonArrayReader* reader) : m_reader(reader) { ++*this; }
+
+        JsonArrayReader* m_reader = nullptr;
+    };
+
+    /*!
+     * \brief JsonArrayReader Constructor that takes the device and the settings of the reader
+     * \param device Opened, readable device, positioned at the start of the array. It has to outlive the reader.
+     * \param options Settings of the reader
+     */
+    explicit JsonArrayReader(QIODevice& device, const JsonArrayReaderOptions& options = JsonArrayReaderOptions())
+        : m_device(&device), m_options(options)
+    {
+        if (m_options.blockSize < 1)
+            m_options.blockSize = 1;
+    }
+
+    /*!
+     * \brief next Reads the next element into the given object, which keeps its storage
+     *
+     * If an invalid element throws, the reader is positioned after it, so the reading can go on with the next call.
+     * \param element Receives the element, the members that aren't in the element are reset
+     * \return false at the end of the array, or if the array is broken and invalid elements are skipped
+     */
+    bool next(T& element)
+    {
+        while (true) {
+            qsizetype end = 0;
+            if (!nextElement(end))
+                return false;
+
+            const qint64 index = m_index++;
+            const qint64 offset = m_discarded + m_position;
+            try {
+                JsonReader reader(m_buffer.constData() + m_position, end - m_position);
+                readMember(element, reader, m_options.checkValues, true);
+                if (!reader.finish())
+                    throw(std::runtime_error("Malformed JSON text has been encountered in the element " + std::to_string(index) + " of the array"));
+                m_position = end;
+                return true;
+            }
+            catch (const std::exception& e) {
+                m_position = end;
+                if (!m_options.skipInvalid)
+                    throw;
+                ++m_skipped;
+                if (m_options.errorHandler)
+                    m_options.errorHandler({index, offset, QString::fromUtf8(e.what())});
+            }
+        }
+    }
+
+    //! Iterator of the first element, reads it. The reader can only be iterated once.
+    Iterator begin() { return Iterator(this); }
+
+    //! The end iterator
+    Iterator end() { return Iterator(); }
+
+    //! Returns true once the closing bracket of the array has been read
+    bool atEnd() const { return m_state == State::End; }
+
+    //! Returns true if the array is broken, see errorString()
+    bool hasError() const { return m_state == State::Failed; }
+
+    //! Description of the failure of the array, empty if there isn't one
+    QString errorString() const { return m_error; }
+
+    //! Number of the elements that have been read so far, the skipped ones included
+    qint64 elementCount() const { return m_index; }
+
+    //! Number of the invalid elements that have been skipped
+    qint64 skippedCount() const { return m_skipped; }
+
+private:
+    enum class State { Start, Elements, End, Failed };
+
+    QIODevice* m_device;
+    JsonArrayReaderOptions m_options;
+    //Unread input starts at m_position, the bytes before it belong to the elements that have been read already
+    QByteArray m_buffer;
+    qsizetype m_position = 0;
+    //Number of the bytes that have been dropped from the front of the buffer
+    qint64 m_discarded = 0;
+    State m_state = State::Start;
+    qint64 m_index = 0;
+    qint64 m_skipped = 0;
+    QString m_error;
+    T m_current;
+
+    static bool isWhitespace(const char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; }
+
+    //Drops the bytes that have been read and appends the next block, returns false at the end of the device
+    bool fill()
+    {
+        if (!m_device->isReadable())
+            return false;
+        m_buffer.remove(0, m_position);
+        m_discarded += m_position;
+        m_position = 0;
+
+        const qsizetype size = m_buffer.size();
+        m_buffer.resize(size + static_cast<qsizetype>(m_options.blockSize));
+        qint64 count = m_device->read(m_buffer.data() + size, m_options.blockSize);
+        while (count == 0 && !m_device->atEnd() && m_device->waitForReadyRead(-1))
+            count = m_device->read(m_buffer.data() + size, m_options.blockSize);
+        m_buffer.resize(size + static_cast<qsizetype>(count > 0 ? count : 0));
+        return count > 0;
+    }
+
+    bool fail(const QString& message)
+    {
+        m_state = State::Failed;
+        m_error = message;
+        if (!m_options.skipInvalid)
+            throw(std::runtime_error(m_error.toStdString()));
+        return false;
+    }
+
+    bool failAt(const char* message) { return fail(QStringLiteral("%1 at offset %2").arg(QString::fromLatin1(message)).arg(m_discarded + m_position)); }
+
+    //Skips the whitespace, returns false if the input ends
+    bool skipWhitespace()
+    {
+        while (true) {
+            while (m_position < m_buffer.size() && isWhitespace(m_buffer.at(m_position)))
+                ++m_position;
+            if (m_position < m_buffer.size())
+                return true;
+            if (!fill())
+                return false;
+        }
+    }
+
+    //Finds the next element, its bytes are [m_position, end) of the buffer
+    bool nextElement(qsizetype& end)
+    {
+        if (m_state == State::Start) {
+            if (!m_device->isReadable())
+                return fail(QStringLiteral("The device isn't open for reading"));
+            if (!skipWhitespace() || m_buffer.at(m_position) != '[')
+                return failAt("The input isn't a JSON array");
+            ++m_position;
+            if (!skipWhitespace())
+                return failAt("The array is truncated");
+            if (m_buffer.at(m_position) == ']') {
+                ++m_position;
+                m_state = State::End;
+                return false;
+            }
+            m_state = State::Elements;
+        }
+        else if (m_state == State::Elements) {
+            if (!skipWhitespace())
+                return failAt("The array is truncated");
+            const char separator = m_buffer.at(m_position);
+            if (separator == ']') {
+                ++m_position;
+                m_state = State::End;
+                return false;
+            }
+            if (separator != ',')
+                return failAt("Missing ',' or ']' between the elements of the array");
+            ++m_position;
+            if (!skipWhitespace())
+                return failAt("The array is truncated");
+        }
+        else
+            return false;
+
+        return scanElement(end);
+    }
+
+    //Finds the end of the element that starts at m_position by matching the brackets outside of the strings, the element itself is validated by its parser
+    bool scanElement(qsizetype& end)
+    {
+        int depth = 0;
+        bool inString = false;
+        bool escaped = false;
+        qsizetype it = m_position;
+        while (true) {
+            if (it == m_buffer.size()) {
+                const qsizetype scanned = it - m_position;
+                if (!fill())
+                    return failAt("The array is truncated");
+                it = m_position + scanned;
+            }
+
+            const char* const data = m_buffer.constData();
+            const qsizetype size = m_buffer.size();
+            for (; it < size; ++it) {
+                const char c = data[it];
+                if (inString) {
+                    if (escaped)
+                        escaped = false;
+                    else if (c == '\\')
+                        escaped = true;
+                    else if (c == '"') {
+                        inString = false;
+                        if (depth == 0) {
+                            end = it + 1;
+                            return true;
+                        }
+                    }
+                }
+                else if (c == '"')
+                    inString = true;
+                else if (c == '{' || c == '[')
+                    ++depth;
+                else if (c == '}' || c == ']') {
+                    if (depth == 0)
+                        break;
+                    if (--depth == 0) {
+                        end = it + 1;
+                        return true;
+                    }
+                }
+                else if (depth == 0 && (c == ',' || isWhitespace(c)))
+                    break;
+            }
+            if (it < size)
+                break;
+        }
+
+        //A scalar ends at the separator
+        if (it == m_position)
+            return failAt("Missing element in the array");
+        end = it;
+        return true;
+    }
+};
+
+}
+
+#endif // TAGGEDJSONARRAYREADER_H
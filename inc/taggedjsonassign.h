@@ -0,0 +1,76 @@
+#ifndef TAGGEDJSONASSIGN_H
+#define TAGGEDJSONASSIGN_H
+#include <type_traits>
+#include <utility>
+#include <QJsonValue>
+#include "taggedjsonreader.h"
+
+/*!
+ * In-place assignment of the members of the tagged objects (see assign() and parseInto() on the classes generated by the #TJO_DEFINE_JSON_TAGGED_OBJECT() macro).\n
+ * Members that have an assign(const QJsonValue&, bool) method repopulate their existing storage, the arrays of tagged objects reuse their elements and
+ * nested tagged objects recurse into their own members. Every other member is assigned from a newly constructed value, which is as cheap as it gets
+ * for the scalars and the implicitly shared Qt types.\n
+ * readJson() of a tagged object only overwrites the members that are in the text, replaceJson() resets the rest to their default values as well, so an
+ * object that is read with it ends up the same as a newly parsed one. The arrays of tagged objects read their reused elements that way.\n
+ * checkValues behaves the same way as in the constructors, the members that have no value in the source are reset to their default values if it isn't
+ * set. If an exception is thrown, the object is left partially assigned.
+ */
+namespace TaggedObject {
+
+    //! Detects the members that can be assigned in place from a QJsonValue
+    template<typename M, typename = void>
+    struct HasInPlaceAssign : std::false_type {};
+
+    template<typename M>
+    struct HasInPlaceAssign<M, std::void_t<decltype(std::declval<M&>().assign(std::declval<const QJsonValue&>(), true))>> : std::true_type {};
+
+    /*!
+     * \brief assignMember Assigns a member from its JSON value, in place if the member type allows it
+     * \param member The member to assign
+     * \param value JSON value of the member
+     * \param checkValues If set to true, invalid conversions (missing value, wrong type etc.) will throw a runtime error.
+     */
+    template<typename M>
+    void assignMember(M& member, const QJsonValue& value, const bool checkValues)
+    {
+        if constexpr (HasInPlaceAssign<M>::value)
+            member.assign(value, checkValues);
+        else
+            member = M(value, checkValues);
+    }
+
+    //! Detects the members that can be replaced in place from a JsonReader
+    template<typename M, typename = void>
+    struct HasReplaceJson : std::false_type {};
+
+    template<typename M>
+    struct HasReplaceJson<M, std::void_t<decltype(std::declval<M&>().replaceJson(std::declval<JsonReader&>(), true))>> : std::true_type {};
+
+    /*!
+     * \brief readMember Reads a member from the value the reader is positioned on
+     * \param member The member to read
+     * \param reader JSON reader positioned on the value of the member
+     * \param checkValues If set to true, missing members of nested tagged objects will throw a runtime error.
+     * \param replace If set to true, nested tagged objects reset the members that aren't in the text instead of keeping their values
+     */
+    template<typename M>
+    void readMember(M& member, JsonReader& reader, const bool checkValues, const bool replace)
+    {
+        if constexpr (HasReplaceJson<M>::value) {
+            if (replace) {
+                member.replaceJson(reader, checkValues);
+                return;
+            }
+        }
+        member.readJson(reader, checkValues);
+    }
+
+    //! Resets a member that has no value in the source to the default value, the same one a newly constructed tagged object would have
+    template<typename M>
+    void resetMember(M& member)
+    {
+        member = M();
+    }
+}
+
+#endif // TAGGEDJSONASSIGN_H
@@ -0,0 +1,224 @@
+#ifndef TAGGEDJSONCBOR_H
+#define TAGGEDJSONCBOR_H
+#include <bitset>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <QByteArray>
+#include <QCborStreamReader>
+#include <QCborStreamWriter>
+#include <QCborValue>
+#include <QJsonValue>
+#include <QLatin1String>
+#include <QString>
+#include "taggedjsonnumber.h"
+#include "taggedjsonforward.h"
+#include "taggedjsoninstrumentation.h"
+#include "taggedjsonmembers.h"
+
+/*!
+ * The CBOR counterparts of the JsonReader and JsonWriter helpers. The members of the tagged objects read and write CBOR through
+ * QCborStreamReader and QCborStreamWriter directly (see readCbor() and writeCbor() on the member types), these helpers only cover the
+ * parts that QCborStreamReader leaves to its users.\n
+ * The CBOR support is opt-in, the translation units that call fromCbor(), toCbor(), readCbor() or writeCbor() include this header.
+ */
+namespace TaggedObject {
+
+    //! Returns true if the reader has failed, the readers keep their position on failure so the loops have to check it
+    inline bool hasCborError(const QCborStreamReader& reader)
+    {
+        return reader.lastError() != QCborError::NoError;
+    }
+
+    /*!
+     * \brief readCborString Consumes a text string, chunked strings included
+     * \param reader CBOR reader positioned on the value
+     * \param out Receives the string, it is empty if the value isn't a text string
+     * \return false if the value isn't a text string, it is skipped in that case
+     */
+    inline bool readCborString(QCborStreamReader& reader, QString& out)
+    {
+        out.clear();
+        if (!reader.isString()) {
+            reader.next();
+            return false;
+        }
+
+        auto chunk = reader.readString();
+        while (chunk.status == QCborStreamReader::Ok) {
+            out += chunk.data;
+            chunk = reader.readString();
+        }
+        return chunk.status != QCborStreamReader::Error;
+    }
+
+    /*!
+     * \brief readCborNumber Consumes an integer or a floating point value
+     * \param reader CBOR reader positioned on the value
+     * \param out Receives the value
+     * \return false if the value isn't a number, it isn't consumed in that case
+     */
+    inline bool readCborNumber(QCborStreamReader& reader, double& out)
+    {
+        if (reader.isInteger())
+            out = static_cast<double>(reader.toInteger());
+        else if (reader.isDouble())
+            out = reader.toDouble();
+        else if (reader.isFloat())
+            out = reader.toFloat();
+        else if (reader.isFloat16())
+            out = reader.toFloat16();
+        else
+            return false;
+        reader.next();
+        return true;
+    }
+
+    /*!
+     * \brief readCborInteger Consumes a number and converts it into the integral type T
+     *
+     * CBOR integers are converted exactly, floating point values follow the rule of QJsonValue::toInt().
+     * \param reader CBOR reader positioned on the value
+     * \param out Receives the value, 0 if the number isn't an integral value within the range of T
+     * \return false if the value isn't a number, it isn't consumed in that case
+     */
+    template<typename T>
+    bool readCborInteger(QCborStreamReader& reader, T& out)
+    {
+        out = T();
+        if (reader.isUnsignedInteger()) {
+            const quint64 value = reader.toUnsignedInteger();
+            if (value <= static_cast<quint64>(std::numeric_limits<T>::max()))
+                out = static_cast<T>(value);
+        }
+        else if (reader.isNegativeInteger()) {
+            const qint64 value = reader.toInteger();
+            if constexpr (std::is_signed_v<T>) {
+                if (value >= static_cast<qint64>(std::numeric_limits<T>::min()))
+                    out = static_cast<T>(value);
+            }
+        }
+        else {
+            double number = 0;
+            if (!readCborNumber(reader, number))
+                return false;
+            integralFromDouble(number, out);
+            return true;
+        }
+        reader.next();
+        return true;
+    }
+
+    //! Consumes any value and converts it the way QCborValue::toJsonValue() does, used by the members that hold JSON values
+    inline QJsonValue readCborValue(QCborStreamReader& reader)
+    {
+        return QCborValue::fromCbor(reader).toJsonValue();
+    }
+
+    //! Writes a JSON value as CBOR, used by the members that hold JSON values
+    inline void writeCborValue(QCborStreamWriter& writer, const QJsonValue& value)
+    {
+        QCborValue::fromJsonValue(value).toCbor(writer);
+    }
+
+    template<typename C, typename Indices>
+    struct CborMembersBase;
+
+    template<typename C, std::size_t... I>
+    struct CborMembersBase<C, std::index_sequence<I...>>
+    {
+        using Members = GeneratedMembers<C>;
+        using Binder = void (*)(C&, QCborStreamReader&, const bool);
+        using MemberWriter = void (*)(const C&, QCborStreamWriter&);
+
+        static C fromCbor(const QByteArray& cbor, const bool checkValues)
+        {
+            TJO_INSTRUMENT_SCOPE(InstrumentationEvent::Parse, C::taggedClassName(), fieldIndex<C>.size(), cbor.size());
+            QCborStreamReader reader(cbor);
+            C ret;
+            readCbor(ret, reader, checkValues);
+            if (hasCborError(reader))
+                return C();
+            return ret;
+        }
+
+        static QByteArray toCbor(const C& self)
+        {
+            TJO_INSTRUMENT_SCOPE(InstrumentationEvent::SerializeText, C::taggedClassName(), fieldIndex<C>.size());
+            QByteArray ret;
+            {
+                QCborStreamWriter writer(&ret);
+                writeCbor(self, writer);
+            }
+            TJO_INSTRUMENT_SET_BYTES(ret.size());
+            return ret;
+        }
+
+        static void readCbor(C& self, QCborStreamReader& reader, const bool checkValues)
+        {
+            std::bitset<sizeof...(I)> found;
+            if (reader.isMap() && reader.enterContainer()) {
+                QString key;
+                while (reader.hasNext()) {
+                    const int index = readCborString(reader, key) ? fieldIndex<C>.indexOf(key) : -1;
+                    if (index < 0) {
+                        reader.next();
+                        continue;
+                    }
+                    binders[index](self, reader, checkValues);
+                    found.set(index);
+                }
+                if (!hasCborError(reader))
+                    reader.leaveContainer();
+            }
+            else
+                reader.next();
+            if (checkValues) {
+                if (hasCborError(reader))
+                    throw(std::runtime_error("Malformed CBOR data has been encountered while parsing the cbor data for " + std::string(C::taggedClassName())));
+                Members::throwIfMissing(found);
+            }
+        }
+
+        static void writeCbor(const C& self, QCborStreamWriter& writer)
+        {
+            writer.startMap(sizeof...(I));
+            for (std::size_t i = 0; i < sizeof...(I); ++i)
+                writers[fieldIndex<C>.sortedIndex(i)](self, writer);
+            writer.endMap();
+        }
+
+    private:
+        template<std::size_t J>
+        static void readCborAt(C& self, QCborStreamReader& reader, const bool checkValues)
+        {
+            (self.*(Members::template field<J>().member)).readCbor(reader, checkValues);
+        }
+
+        template<std::size_t J>
+        static void writeCborAt(const C& self, QCborStreamWriter& writer)
+        {
+            constexpr std::string_view name = Members::template field<J>().name;
+            writer.append(QLatin1String(name.data(), static_cast<qsizetype>(name.size())));
+            (self.*(Members::template field<J>().member)).writeCbor(writer);
+        }
+
+        static constexpr Binder binders[] = { &readCborAt<I>... };
+        static constexpr MemberWriter writers[] = { &writeCborAt<I>... };
+    };
+
+    /*!
+     * \brief The CborMembers struct implements the CBOR methods of the tagged object C, which forwards fromCbor(), toCbor(), readCbor() and
+     * writeCbor() to it
+     *
+     * The binders are indexed with the perfect hash of the member names the same way as the JSON binders of GeneratedMembers, the writers walk
+     * the members in the sorted key order.
+     */
+    template<typename C>
+    struct CborMembers : CborMembersBase<C, std::make_index_sequence<fieldCount<C>>> {};
+}
+
+#endif // TAGGEDJSONCBOR_H
@@ -0,0 +1,275 @@
+#ifndef TAGGEDJSONCOLUMNS_H
+#define TAGGEDJSONCOLUMNS_H
+#include <bitset>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <QByteArray>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QJsonValue>
+#include <QString>
+#include "taggedjsonarray.h"
+#include "taggedjsonreader.h"
+#include "taggedjsonfieldindex.h"
+#include "taggedjsoninstrumentation.h"
+#include "taggedjsonassign.h"
+#include "taggedjsonfields.h"
+
+namespace TaggedObject {
+
+    //! Element type of the column of a member type M, the stored value of the TaggedJSONObject/TaggedJSONArray etc. members and the member itself otherwise
+    template<typename M, typename = void>
+    struct ColumnValue
+    {
+        using Type = M;
+    };
+
+    template<typename M>
+    struct ColumnValue<M, std::enable_if_t<HasStoredValue<M>::value>>
+    {
+        using Type = std::remove_cv_t<std::remove_reference_t<decltype(*std::declval<const M&>())>>;
+    };
+
+    template<typename M>
+    using ColumnValueType = typename ColumnValue<M>::Type;
+
+    //! The column element of a member, moved out of it if it's an rvalue
+    template<typename M>
+    decltype(auto) columnValue(M&& member)
+    {
+        if constexpr (!HasStoredValue<std::remove_cv_t<std::remove_reference_t<M>>>::value)
+            return std::forward<M>(member);
+        else if constexpr (std::is_rvalue_reference_v<M&&>)
+            return std::move(*member);
+        else
+            return *member;
+    }
+}
+
+/*!
+ * \class TaggedJSONColumns
+ * \brief The TaggedJSONColumns class is a columnar (struct-of-arrays) projection of an array of tagged objects.
+ *
+ * Each selected member of the tagged object is stored in its own contiguous std::vector, e.g. a std::vector<double> for a TaggedJSONDouble member,
+ * so scans, filters and aggregations over a single member walk contiguous memory instead of jumping from object to object. The members that aren't
+ * selected aren't stored.\n
+ * The projection is built either on demand from the parsed objects (the range constructor, append()) or at parse time straight from the JSON text
+ * (fromJson(), readJson()), which doesn't build the objects at all and skips the values of the other members. Every column has the same number of
+ * elements, one per object.
+ * \code
+ * using Prices = TaggedJSONColumns<&Trade::price, &Trade::volume>;
+ * const Prices columns = Prices::fromJson(json);
+ * const std::vector<double>& prices = columns.column<&Trade::price>();
+ * \endcode
+ * \tparam Members Pointers to the selected members of a class generated by the #TJO_DEFINE_JSON_TAGGED_OBJECT() macro, in column order
+ */
+template<auto... Members>
+class TaggedJSONColumns
+{
+    static_assert(sizeof...(Members) > 0, "TaggedJSONColumns needs at least one member");
+
+    template<auto Member>
+    using ClassOf = typename TaggedObject::MemberPointerTraits<decltype(Member)>::Class;
+
+public:
+    //! The tagged object of the rows
+    using RowType = typename std::tuple_element_t<0, std::tuple<TaggedObject::MemberPointerTraits<decltype(Members)>...>>::Class;
+
+    //! Type of the selected member \a Member
+    template<auto Member>
+    using MemberType = typename TaggedObject::MemberPointerTraits<decltype(Member)>::Type;
+
+    //! Element type of the column of the member \a Member
+    template<auto Member>
+    using ValueType = TaggedObject::ColumnValueType<MemberType<Member>>;
+
+    static_assert((std::is_same_v<ClassOf<Members>, RowType> && ...), "The members of TaggedJSONColumns have to belong to the same tagged object");
+    static_assert(((!TaggedObject::fieldNameOf<Members>().empty()) && ...), "The members of TaggedJSONColumns have to be members of the tagged object");
+
+    //! Default constructor, the columns are empty
+    explicit TaggedJSONColumns() {}
+
+    /*!
+     * \brief TaggedJSONColumns On-demand projection of parsed tagged objects, the selected members of each object are copied into the columns
+     * \param rows Range of the tagged objects, e.g. a std::vector of them or the stored vector of a TaggedJSONArray
+     */
+    template<typename Range, typename = std::enable_if_t<std::is_convertible_v<decltype(*std::begin(std::declval<const Range&>())), const RowType&>>>
+    explicit TaggedJSONColumns(const Range& rows)
+    {
+        reserve(static_cast<qsizetype>(std::distance(std::begin(rows), std::end(rows))));
+        for (const RowType& row : rows)
+            append(row);
+    }
+
+    //! On-demand projection of the elements of a tagged array
+    explicit TaggedJSONColumns(const TaggedJSONArray<RowType>& rows) : TaggedJSONColumns(*rows) {}
+
+    /*!
+     * \brief TaggedJSONColumns constructor variant that takes QJsonValue input, only the selected members of each object are converted
+     * \param ref QJsonValue that holds the array of JSON objects
+     * \param checkValue If set to true, invalid conversions (missing value, wrong type etc.) will throw a runtime error.
+     */
+    explicit TaggedJSONColumns(const QJsonValue& ref, const bool checkValue = true)
+    {
+        if (checkValue && ref.isUndefined())
+            throw(std::runtime_error("Invalid data has been encountered while parsing the json data for TaggedJSONColumns"));
+
+        const QJsonArray arr = ref.toArray();
+        reserve(arr.size());
+        for (const QJsonValue& row : arr)
+            appendObject(row.toObject(), checkValue, std::index_sequence_for<decltype(Members)...>());
+    }
+
+    /*!
+     * \brief fromJson Parse-time projection of a JSON text that holds an array of objects
+     *
+     * The selected members are converted straight from the text into the columns, the tagged objects aren't built and the values of the other
+     * members are skipped.
+     * \param json UTF-8 encoded JSON text of the array
+     * \param checkValues If set to true, missing members and malformed JSON text will throw a runtime error.
+     * \return The columns, empty if the text is malformed and checkValues is false
+     */
+    static TaggedJSONColumns fromJson(const QByteArray& json, const bool checkValues = true)
+    {
+        TJO_INSTRUMENT_SCOPE(TaggedObject::InstrumentationEvent::Parse, TaggedObject::instrumentationName<RowType>(), sizeof...(Members), json.size());
+        TaggedObject::JsonReader reader(json);
+        TaggedJSONColumns ret;
+        ret.readJson(reader, checkValues);
+        if (!reader.finish()) {
+            if (checkValues)
+                throw(std::runtime_error("Malformed JSON text has been encountered while parsing the json data for TaggedJSONColumns"));
+            return TaggedJSONColumns();
+        }
+        return ret;
+    }
+
+    /*!
+     * \brief readJson Parse-time projection of the array the reader is positioned on, e.g. an array member of a larger document
+     *
+     * The columns are cleared first and keep their capacity. A member that appears more than once in an object is taken from its last occurrence.
+     * \param reader JSON reader positioned on the array
+     * \param checkValue If set to true, missing members will throw a runtime error.
+     */
+    void readJson(TaggedObject::JsonReader& reader, const bool checkValue = true)
+    {
+        clear();
+        if (!reader.beginArray()) {
+            reader.skipValue();
+            return;
+        }
+
+        //The values are read into these members first, so a repeated key doesn't add a second element to its column
+        std::tuple<MemberType<Members>...> scratch;
+        while (reader.nextElement())
+            readObject(reader, scratch, checkValue, std::index_sequence_for<decltype(Members)...>());
+    }
+
+    //! Appends the selected members of a tagged object as a new row
+    void append(const RowType& row)
+    {
+        std::apply([&row](auto&... columns) { (columns.push_back(TaggedObject::columnValue(row.*Members)), ...); }, m_columns);
+    }
+
+    /*!
+     * \brief column The contiguous column of the member \a Member
+     * \tparam Member One of the selected members, e.g. &Trade::price
+     */
+    template<auto Member>
+    const std::vector<ValueType<Member>>& column() const
+    {
+        constexpr std::size_t index = columnIndex<Member>();
+        static_assert(index < sizeof...(Members), "The member isn't a column of this TaggedJSONColumns");
+        return std::get<index>(m_columns);
+    }
+
+    //! Number of the rows, which every column has
+    qsizetype size() const { return static_cast<qsizetype>(std::get<0>(m_columns).size()); }
+
+    //! Returns true if there aren't any rows
+    bool empty() const { return std::get<0>(m_columns).empty(); }
+
+    //! Removes the rows, the columns keep their capacity
+    void clear() { std::apply([](auto&... columns) { (columns.clear(), ...); }, m_columns); }
+
+    //! Reserves the capacity of the given number of rows in every column
+    void reserve(const qsizetype rowCount)
+    {
+        std::apply([rowCount](auto&... columns) { (columns.reserve(static_cast<std::size_t>(rowCount)), ...); }, m_columns);
+    }
+
+    //! Declaration names of the selected members in column order, their JSON keys
+    static constexpr std::string_view columnNames[] = { TaggedObject::fieldNameOf<Members>()... };
+
+private:
+    std::tuple<std::vector<ValueType<Members>>...> m_columns;
+
+    static constexpr auto s_index = TaggedObject::makeFieldIndex(TaggedObject::fieldNameOf<Members>()...);
+
+    template<auto Member>
+    static constexpr std::size_t columnIndex()
+    {
+        constexpr bool matches[] = { TaggedObject::isSameMember<Member>(Members)... };
+        for (std::size_t i = 0; i < sizeof...(Members); ++i) {
+            if (matches[i])
+                return i;
+        }
+        return sizeof...(Members);
+    }
+
+    //The QJsonObject keys of the columns, built once per projection type
+    static const QString* jsonKeys()
+    {
+        static const QString keys[] = { QString::fromLatin1(TaggedObject::fieldNameOf<Members>().data(),
+                                                            static_cast<qsizetype>(TaggedObject::fieldNameOf<Members>().size()))... };
+        return keys;
+    }
+
+    template<std::size_t... I>
+    void appendObject(const QJsonObject& obj, const bool checkValue, std::index_sequence<I...>)
+    {
+        const QString* keys = jsonKeys();
+        (std::get<I>(m_columns).push_back(TaggedObject::columnValue(MemberType<Members>(obj[keys[I]], checkValue))), ...);
+    }
+
+    template<typename Scratch, std::size_t... I>
+    void readObject(TaggedObject::JsonReader& reader, Scratch& scratch, const bool checkValue, std::index_sequence<I...>)
+    {
+        std::bitset<sizeof...(Members)> found;
+        if (reader.beginObject()) {
+            std::string_view key;
+            while (reader.nextKey(key)) {
+                const int index = s_index.indexOf(key);
+                if (index < 0) {
+                    reader.skipValue();
+                    continue;
+                }
+                ((static_cast<std::size_t>(index) == I ? TaggedObject::readMember(std::get<I>(scratch), reader, checkValue, true) : void()), ...);
+                found.set(static_cast<std::size_t>(index));
+            }
+        }
+        else
+            reader.skipValue();
+
+        if (checkValue) {
+            if (reader.hasError())
+                throw(std::runtime_error("Malformed JSON text has been encountered while parsing the json data for TaggedJSONColumns"));
+            for (std::size_t i = 0; i < sizeof...(Members); ++i) {
+                if (!found.test(i))
+                    throw(std::runtime_error("Invalid data has been encountered while parsing the json data for the member " + std::string(columnNames[i])));
+            }
+        }
+
+        //Missing members get the default value of a newly constructed member
+        ((found.test(I) ? std::get<I>(m_columns).push_back(TaggedObject::columnValue(std::move(std::get<I>(scratch))))
+                        : std::get<I>(m_columns).push_back(TaggedObject::columnValue(MemberType<Members>()))), ...);
+    }
+};
+
+#endif // TAGGEDJSONCOLUMNS_H
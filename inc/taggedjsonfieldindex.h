@@ -0,0 +1,242 @@
+#ifndef TAGGEDJSONFIELDINDEX_H
+#define TAGGEDJSONFIELDINDEX_H
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <QJsonObject>
+#include <QJsonValue>
+#include <QString>
+
+namespace TaggedObject {
+
+/*!
+ * Tag type that selects the single-pass binding constructor of the classes defined by the #TJO_DEFINE_JSON_TAGGED_OBJECT() macro.\n
+ * The constructor iterates the keys of the object once and routes each key to its member through FieldIndex, which scales better than one
+ * lookup per member for wide objects.
+ */
+struct SinglePassBinding { explicit SinglePassBinding() = default; };
+
+//! Tag value for the single-pass binding constructor, see #TJO_DEFINE_JSON_TAGGED_OBJECT()
+inline constexpr SinglePassBinding singlePassBinding{};
+
+/*!
+ * \brief fieldHash Seeded FNV-1a hash used by FieldIndex
+ *
+ * Works on both UTF-8 and UTF-16 code units, which give the same result for the ASCII member names.
+ * \param key Characters to hash
+ * \param length Number of characters
+ * \param seed Seed that selects the hash function
+ * \return The hash value
+ */
+template<typename Char>
+constexpr quint32 fieldHash(const Char* key, const std::size_t length, const quint32 seed)
+{
+    quint32 hash = 2166136261u ^ (seed * 0x9E3779B9u);
+    for (std::size_t i = 0; i < length; ++i) {
+        hash ^= quint32(static_cast<std::make_unsigned_t<Char>>(key[i]));
+        hash *= 16777619u;
+    }
+    hash ^= hash >> 16;
+    hash *= 0x7FEB352Du;
+    hash ^= hash >> 15;
+    return hash;
+}
+
+/*!
+ * \class FieldIndex
+ * \brief The FieldIndex class is a perfect hash table of member names that is built at compile time.
+ *
+ * The table is built with the hash and displace method. Each name is assigned to a bucket by the unseeded hash and each bucket
+ * gets a seed that moves all of its names into free slots, so a lookup costs two hashes and a single string comparison whatever the member count is.\n
+ * The classes defined by the #TJO_DEFINE_JSON_TAGGED_OBJECT() macro use it to route the incoming keys to their members in a single pass.
+ * \tparam N Number of the member names
+ */
+template<std::size_t N>
+class FieldIndex
+{
+public:
+    /*!
+     * \brief FieldIndex Builds the perfect hash table, intended to be evaluated at compile time
+     * \param names Names of the members in declaration order, they have to be unique
+     */
+    constexpr explicit FieldIndex(const std::array<std::string_view, N>& names) : m_names(names)
+    {
+        for (std::size_t slot = 0; slot < SLOT_COUNT; ++slot)
+            m_slots[slot] = -1;
+
+        //Key order of QJsonObject, which sorts its keys. Bottom-up merge sort, which keeps wide classes within the constexpr evaluation limits.
+        for (std::size_t i = 0; i < N; ++i)
+            m_order[i] = static_cast<qint16>(i);
+        std::array<qint16, N> merged{};
+        for (std::size_t width = 1; width < N; width *= 2) {
+            for (std::size_t left = 0; left < N; left += 2 * width) {
+                const std::size_t middle = std::min(left + width, N);
+                const std::size_t right = std::min(left + 2 * width, N);
+                std::size_t a = left;
+                std::size_t b = middle;
+                std::size_t out = left;
+                while (a < middle && b < right)
+                    merged[out++] = m_names[m_order[b]] < m_names[m_order[a]] ? m_order[b++] : m_order[a++];
+                while (a < middle)
+                    merged[out++] = m_order[a++];
+                while (b < right)
+                    merged[out++] = m_order[b++];
+            }
+            m_order = merged;
+        }
+
+        //The members are grouped by their bucket, so the seed search of a bucket only goes through its own members
+        std::array<std::size_t, N> bucketOf{};
+        std::array<std::size_t, BUCKET_COUNT> bucketSize{};
+        for (std::size_t i = 0; i < N; ++i) {
+            bucketOf[i] = fieldHash(m_names[i].data(), m_names[i].size(), 0) % BUCKET_COUNT;
+            ++bucketSize[bucketOf[i]];
+        }
+        std::array<std::size_t, BUCKET_COUNT + 1> bucketStart{};
+        std::size_t largest = 0;
+        for (std::size_t b = 0; b < BUCKET_COUNT; ++b) {
+            bucketStart[b + 1] = bucketStart[b] + bucketSize[b];
+            largest = std::max(largest, bucketSize[b]);
+        }
+        std::array<qint16, N> members{};
+        std::array<std::size_t, BUCKET_COUNT> filled{};
+        for (std::size_t i = 0; i < N; ++i)
+            members[bucketStart[bucketOf[i]] + filled[bucketOf[i]]++] = static_cast<qint16>(i);
+
+        //Crowded buckets are placed first while there are still plenty of free slots, the buckets of the same size from the last one
+        for (std::size_t size = largest; size > 0; --size) {
+            for (std::size_t b = BUCKET_COUNT; b-- > 0;) {
+                if (bucketSize[b] == size)
+                    placeBucket(b, members, bucketStart[b], size);
+            }
+        }
+    }
+
+    //! Number of the indexed member names
+    static constexpr std::size_t size() { return N; }
+
+    //! Name of the member at the given declaration index
+    constexpr std::string_view name(const std::size_t index) const { return m_names[index]; }
+
+    //! Declaration index of the member at the given position of the sorted key order that QJsonObject iterates in
+    constexpr std::size_t sortedIndex(const std::size_t position) const { return static_cast<std::size_t>(m_order[position]); }
+
+    /*!
+     * \brief indexOf Looks up a UTF-8 key
+     * \param key The key to look up
+     * \return Declaration index of the matching member, -1 if the key doesn't belong to any of them
+     */
+    int indexOf(const std::string_view key) const
+    {
+        const int index = slotOf(key.data(), key.size());
+        return (index >= 0 && m_names[index] == key) ? index : -1;
+    }
+
+    /*!
+     * \brief indexOf Looks up a UTF-16 key, without converting it
+     * \param key The key to look up
+     * \return Declaration index of the matching member, -1 if the key doesn't belong to any of them
+     */
+    int indexOf(const QString& key) const
+    {
+        const auto* chars = key.utf16();
+        const std::size_t length = static_cast<std::size_t>(key.size());
+        const int index = slotOf(chars, length);
+        if (index < 0 || m_names[index].size() != length)
+            return -1;
+
+        for (std::size_t i = 0; i < length; ++i) {
+            if (chars[i] != static_cast<unsigned char>(m_names[index][i]))
+                return -1;
+        }
+        return index;
+    }
+
+private:
+    static constexpr std::size_t ceilPowerOfTwo(const std::size_t value)
+    {
+        std::size_t ret = 1;
+        while (ret < value)
+            ret <<= 1;
+        return ret;
+    }
+
+    //Half-empty slot table and two names per bucket on average keep the seed search short
+    static constexpr std::size_t SLOT_COUNT = ceilPowerOfTwo(2 * N);
+    static constexpr std::size_t BUCKET_COUNT = N / 2 + 1;
+    static constexpr quint32 MAX_SEED = 1u << 16;
+
+    std::array<std::string_view, N> m_names{};
+    std::array<quint32, BUCKET_COUNT> m_seeds{};
+    std::array<qint16, SLOT_COUNT> m_slots{};
+    std::array<qint16, N> m_order{};
+
+    //Finds the seed that moves the members of the bucket into free slots, the members are members[start, start + size)
+    constexpr void placeBucket(const std::size_t bucket, const std::array<qint16, N>& members, const std::size_t start, const std::size_t size)
+    {
+        std::array<std::size_t, N> taken{};
+        for (quint32 seed = 1; ; ++seed) {
+            if (seed > MAX_SEED)
+                throw std::logic_error("Member names of a tagged object have to be unique");
+
+            bool fits = true;
+            for (std::size_t k = 0; k < size && fits; ++k) {
+                const std::string_view name = m_names[members[start + k]];
+                const std::size_t slot = fieldHash(name.data(), name.size(), seed) & (SLOT_COUNT - 1);
+                fits = m_slots[slot] < 0;
+                for (std::size_t t = 0; t < k && fits; ++t)
+                    fits = taken[t] != slot;
+                taken[k] = slot;
+            }
+            if (!fits)
+                continue;
+
+            for (std::size_t k = 0; k < size; ++k)
+                m_slots[taken[k]] = members[start + k];
+            m_seeds[bucket] = seed;
+            return;
+        }
+    }
+
+    template<typename Char>
+    int slotOf(const Char* key, const std::size_t length) const
+    {
+        const quint32 seed = m_seeds[fieldHash(key, length, 0) % BUCKET_COUNT];
+        return m_slots[fieldHash(key, length, seed) & (SLOT_COUNT - 1)];
+    }
+};
+
+/*!
+ * \brief makeFieldIndex Builds a FieldIndex from the given member names
+ * \param names Names of the members in declaration order
+ * \return The perfect hash table of the names
+ */
+template<typename... Names>
+constexpr FieldIndex<sizeof...(Names)> makeFieldIndex(const Names&... names)
+{
+    return FieldIndex<sizeof...(Names)>(std::array<std::string_view, sizeof...(Names)>{std::string_view(names)...});
+}
+
+/*!
+ * \brief bindMember Assigns a member from its JSON value for the single-pass binding
+ *
+ * Nested tagged objects are bound in a single pass as well.
+ * \param member The member to assign
+ * \param value JSON value of the member
+ * \param checkValues If set to true, invalid conversions (missing value, wrong type etc.) will throw a runtime error.
+ */
+template<typename M>
+void bindMember(M& member, const QJsonValue& value, const bool checkValues)
+{
+    if constexpr (std::is_constructible_v<M, SinglePassBinding, const QJsonObject&, const bool>)
+        member = M(singlePassBinding, value.toObject(), checkValues);
+    else
+        member = M(value, checkValues);
+}
+
+}
+
+#endif // TAGGEDJSONFIELDINDEX_H
@@ -0,0 +1,612 @@
+#ifndef TAGGEDJSONFIELDS_H
+#define TAGGEDJSONFIELDS_H
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <QJsonObject>
+#include <QJsonValue>
+#include <QJsonArray>
+#include <QString>
+#include "taggedjsonreader.h"
+#include "taggedjsonwriter.h"
+#include "taggedjsonfieldindex.h"
+#include "taggedjsonmergepatch.h"
+#include "taggedjsonassign.h"
+#include "taggedjsoninstrumentation.h"
+
+/*!
+ * Field descriptors of the tagged objects and the table-driven binding.\n
+ * Every class generated by the #TJO_DEFINE_JSON_TAGGED_OBJECT() macro has a constexpr fieldDescriptors() list that holds the name, the pointer-to-member
+ * and the type tag of each member. forEachField() visits the members of an object through it.\n
+ * fieldTable() erases the member types of the descriptors into a table of FieldEntry records. Each operation (see FieldBind) has a table of its own
+ * (see fieldOperations), one function per member type, which all classes share, and a class only instantiates the operations it uses.
+ * bindFields(), readFields(), fieldsToJsonObject() and writeFields() bind and serialize any tagged object through those tables with one loop shared
+ * by all classes. Defining TJO_TABLE_DRIVEN_BINDING makes the QJsonObject and QJsonValue constructors, toJsonObject() and the merge patches of the
+ * generated classes use them, with an indirect call per member. Its effect on the binary size and the speed depends on the compiler and the classes
+ * and hasn't been measured against a real Qt build.
+ */
+namespace TaggedObject {
+
+    //! Type tag of a member, the JSON type it is stored as
+    enum class FieldKind { Bool, Integer, Double, String, Array, Object, Value };
+
+    //! Detects the member types that dereference to their stored value (TaggedJSONObject, TaggedJSONArray, TaggedJSONVector etc.)
+    template<typename M, typename = void>
+    struct HasStoredValue : std::false_type {};
+
+    template<typename M>
+    struct HasStoredValue<M, std::void_t<decltype(*std::declval<const M&>())>> : std::true_type {};
+
+    //! Detects the containers among the stored values
+    template<typename S, typename = void>
+    struct IsValueContainer : std::false_type {};
+
+    template<typename S>
+    struct IsValueContainer<S, std::void_t<typename S::value_type>> : std::true_type {};
+
+    //! Detects the members that keep a UTF-8 view of their string (TaggedJSONStringView)
+    template<typename M, typename = void>
+    struct HasRawUtf8 : std::false_type {};
+
+    template<typename M>
+    struct HasRawUtf8<M, std::void_t<decltype(std::declval<const M&>().rawUtf8())>> : std::true_type {};
+
+    //! Detects the members that hold their value in shared storage (TaggedJSONShared)
+    template<typename M, typename = void>
+    struct HasSharedValue : std::false_type {};
+
+    template<typename M>
+    struct HasSharedValue<M, std::void_t<typename M::SharedType>> : std::true_type {};
+
+    //! Type tag of the member type M, the shared members have the tag of their stored type
+    template<typename M>
+    constexpr FieldKind fieldKind()
+    {
+        if constexpr (HasSharedValue<M>::value)
+            return fieldKind<typename M::SharedType>();
+        else if constexpr (HasTaggedClassName<M>::value)
+            return FieldKind::Object;
+        else if constexpr (HasRawUtf8<M>::value)
+            return FieldKind::String;
+        else if constexpr (HasStoredValue<M>::value) {
+            using S = std::remove_cv_t<std::remove_reference_t<decltype(*std::declval<const M&>())>>;
+            if constexpr (std::is_same_v<S, bool>)
+                return FieldKind::Bool;
+            else if constexpr (std::is_integral_v<S>)
+                return FieldKind::Integer;
+            else if constexpr (std::is_floating_point_v<S>)
+                return FieldKind::Double;
+            else if constexpr (std::is_same_v<S, QString>)
+                return FieldKind::String;
+            else if constexpr (std::is_same_v<S, QJsonObject>)
+                return FieldKind::Object;
+            else if constexpr (std::is_same_v<S, QJsonArray> || IsValueContainer<S>::value)
+                return FieldKind::Array;
+            else
+                return FieldKind::Value;
+        }
+        else
+            return FieldKind::Value;
+    }
+
+    /*!
+     * \brief The FieldDescriptor struct describes a member of a tagged object at compile time
+     * \tparam C The tagged object
+     * \tparam M Type of the member
+     */
+    template<typename C, typename M>
+    struct FieldDescriptor
+    {
+        using Class = C;
+        using Type = M;
+
+        //! Name of the member, which is its JSON key
+        std::string_view name;
+        //! The member
+        M C::* member;
+        //! JSON type of the member
+        FieldKind kind;
+    };
+
+    //! Builds the descriptor of a member, the generated classes call it for each of their members
+    template<typename C, typename M>
+    constexpr FieldDescriptor<C, M> makeFieldDescriptor(const std::string_view name, M C::* member)
+    {
+        return FieldDescriptor<C, M>{name, member, fieldKind<M>()};
+    }
+
+    //! A descriptor in a FieldList, the index keeps the bases of the list distinct
+    template<std::size_t I, typename D>
+    struct FieldListEntry
+    {
+        D descriptor;
+    };
+
+    template<typename Indices, typename... Descriptors>
+    struct FieldListBase;
+
+    template<std::size_t... I, typename... Descriptors>
+    struct FieldListBase<std::index_sequence<I...>, Descriptors...> : FieldListEntry<I, Descriptors>...
+    {
+        constexpr explicit FieldListBase(const Descriptors&... descriptors) : FieldListEntry<I, Descriptors>{descriptors}... {}
+
+        template<typename F>
+        constexpr decltype(auto) apply(F&& function) const
+        {
+            return function(static_cast<const FieldListEntry<I, Descriptors>&>(*this).descriptor...);
+        }
+    };
+
+    /*!
+     * \brief The FieldList struct holds the field descriptors of a tagged object, fieldDescriptors() returns it
+     *
+     * Every descriptor is a direct base of the list, so neither building the list nor looking up a descriptor (see fieldAt()) instantiates anything
+     * recursively, unlike std::tuple, whose cost grows with the square of the member count. std::tuple_size and std::tuple_element work on it.
+     */
+    template<typename... Descriptors>
+    struct FieldList : FieldListBase<std::index_sequence_for<Descriptors...>, Descriptors...>
+    {
+        using FieldListBase<std::index_sequence_for<Descriptors...>, Descriptors...>::FieldListBase;
+    };
+
+    template<typename... Descriptors>
+    constexpr FieldList<Descriptors...> makeFieldList(const Descriptors&... descriptors)
+    {
+        return FieldList<Descriptors...>(descriptors...);
+    }
+
+    //! The descriptor of the member with the declaration index I, the base is found by deduction instead of recursion
+    template<std::size_t I, typename D>
+    constexpr const D& fieldAt(const FieldListEntry<I, D>& entry)
+    {
+        return entry.descriptor;
+    }
+
+    //! The field descriptors of the tagged object C, evaluated once per class
+    template<typename C>
+    inline constexpr auto fieldList = C::fieldDescriptors();
+
+    //! Number of members of the tagged object C
+    template<typename C>
+    inline constexpr std::size_t fieldCount = std::tuple_size<std::remove_const_t<decltype(fieldList<C>)>>::value;
+
+    /*!
+     * \brief forEachField Calls the visitor with the name and the member for each member of a tagged object, in declaration order
+     * \param object The tagged object, the members are passed as const if it's const
+     * \param visitor Callable with the (std::string_view name, Member& member) signature
+     */
+    template<typename C, typename F>
+    void forEachField(C& object, F&& visitor)
+    {
+        fieldList<std::remove_const_t<C>>.apply([&](const auto&... field) { (visitor(field.name, object.*(field.member)), ...); });
+    }
+
+    struct FieldTable;
+    template<typename C>
+    const FieldTable& fieldTable();
+
+    /*!
+     * \brief The FieldBind struct is the binding operation of the field table, see bindFields()
+     *
+     * Every operation of the table-driven binder and serializer is a struct like this one. Its apply() function converts a member of the type M,
+     * which is passed by its address, and fieldOperations holds one pointer to it per member of a class. The operations have separate tables, so
+     * a class only instantiates the ones it uses, and the functions are shared by all classes that have members of the same type.
+     */
+    struct FieldBind
+    {
+        using Function = void (*)(void* member, const QJsonValue& value, bool checkValues, bool construct);
+
+        //Nested tagged objects are bound through their own table, the other members are assigned in place (see assignMember())
+        template<typename M>
+        static void apply(void* member, const QJsonValue& value, const bool checkValues, const bool construct);
+    };
+
+    //! Serialization operation of the field table, see fieldsToJsonObject()
+    struct FieldToJsonValue
+    {
+        using Function = QJsonValue (*)(const void* member);
+
+        template<typename M>
+        static QJsonValue apply(const void* member) { return QJsonValue(static_cast<const M*>(member)->toJsonValue()); }
+    };
+
+    //! Direct-binding operation of the field table, see readFields()
+    struct FieldReadJson
+    {
+        using Function = void (*)(void* member, JsonReader& reader, bool checkValues);
+
+        template<typename M>
+        static void apply(void* member, JsonReader& reader, const bool checkValues) { static_cast<M*>(member)->readJson(reader, checkValues); }
+    };
+
+    //! Direct serialization operation of the field table, see writeFields()
+    struct FieldWriteJson
+    {
+        using Function = void (*)(const void* member, JsonWriter& writer);
+
+        template<typename M>
+        static void apply(const void* member, JsonWriter& writer) { static_cast<const M*>(member)->writeJson(writer); }
+    };
+
+#ifdef TJO_ENABLE_MODIFICATION_TRACKING
+    //! Merge patch operation of the field table, see fieldsMergePatch()
+    struct FieldAppendPatch
+    {
+        using Function = void (*)(QJsonObject& patch, const QString& key, const void* member, const QJsonObject& baseline, bool stale);
+
+        template<typename M>
+        static void apply(QJsonObject& patch, const QString& key, const void* member, const QJsonObject& baseline, const bool stale)
+        {
+            appendMemberPatch(patch, key, *static_cast<const M*>(member), baseline, stale);
+        }
+    };
+
+    //! Baseline update operation of the field table, see commitFields()
+    struct FieldCommit
+    {
+        using Function = bool (*)(const QString& key, void* member, QJsonObject& baseline, bool stale);
+
+        template<typename M>
+        static bool apply(const QString& key, void* member, QJsonObject& baseline, const bool stale)
+        {
+            return commitMember(key, *static_cast<M*>(member), baseline, stale);
+        }
+    };
+#endif
+
+    template<typename Operation, typename C, std::size_t... I>
+    constexpr std::array<typename Operation::Function, sizeof...(I)> makeFieldOperations(std::index_sequence<I...>)
+    {
+        return {{ &Operation::template apply<typename std::remove_reference_t<decltype(fieldAt<I>(fieldList<C>))>::Type>... }};
+    }
+
+    /*!
+     * \brief fieldOperations The functions of an operation of the field table for the members of the tagged object C, in declaration order
+     * \tparam Operation FieldBind, FieldToJsonValue, FieldReadJson, FieldWriteJson, FieldAppendPatch or FieldCommit (the last two with
+     *         TJO_ENABLE_MODIFICATION_TRACKING)
+     */
+    template<typename Operation, typename C>
+    inline constexpr auto fieldOperations = makeFieldOperations<Operation, C>(std::make_index_sequence<fieldCount<C>>());
+
+    void bindFields(void* object, const FieldTable& table, const FieldBind::Function* binders, const QJsonObject& obj, const bool checkValues,
+                    const bool construct);
+
+    template<typename M>
+    void FieldBind::apply(void* member, const QJsonValue& value, const bool checkValues, const bool construct)
+    {
+        if constexpr (HasTaggedClassName<M>::value)
+            bindFields(member, fieldTable<M>(), fieldOperations<FieldBind, M>.data(), value.toObject(), checkValues, construct);
+        else {
+            M& target = *static_cast<M*>(member);
+            assignMember(target, value, checkValues);
+            //A member of a newly constructed object doesn't count as modified, the same as one constructed by the generated constructors
+            if constexpr (HasModificationTracking<M>::value) {
+                if (construct)
+                    target.clearModified();
+            }
+        }
+    }
+
+    //! Extracts the class and the member type of a pointer-to-member
+    template<typename P>
+    struct MemberPointerTraits;
+
+    template<typename C, typename M>
+    struct MemberPointerTraits<M C::*>
+    {
+        using Class = C;
+        using Type = M;
+    };
+
+    //! Address of the member \a Member of the given object
+    template<auto Member>
+    void* memberAddress(void* object)
+    {
+        return &(static_cast<typename MemberPointerTraits<decltype(Member)>::Class*>(object)->*Member);
+    }
+
+    //! A member in the type-erased field table
+    struct FieldEntry
+    {
+        std::string_view name;
+        void* (*address)(void* object);
+    };
+
+    //! Type-erased field table of a tagged object, see fieldTable()
+    struct FieldTable
+    {
+        std::string_view className;
+        const FieldEntry* entries;
+        //! Names of the members as QStrings, the QJsonObject keys
+        const QString* keys;
+        std::size_t size;
+        //! Declaration indices of the members in the sorted key order that QJsonObject iterates in
+        const std::size_t* sortedOrder;
+        //! Declaration index of the member with the given key, -1 if there isn't any
+        int (*indexOf)(std::string_view key);
+    };
+
+    //! Builds the perfect hash table of the member names from the field descriptors
+    template<typename... Fields>
+    constexpr auto makeFieldIndex(const FieldList<Fields...>& descriptors)
+    {
+        return descriptors.apply([](const auto&... field) { return makeFieldIndex(field.name...); });
+    }
+
+    template<typename C, std::size_t... I>
+    constexpr std::array<FieldEntry, sizeof...(I)> makeFieldEntries(std::index_sequence<I...>)
+    {
+        return {{ FieldEntry{ fieldAt<I>(fieldList<C>).name, &memberAddress<fieldAt<I>(fieldList<C>).member> }... }};
+    }
+
+    //Declaration indices in the sorted key order
+    template<std::size_t N>
+    constexpr std::array<std::size_t, N> makeSortedOrder(const FieldIndex<N>& index)
+    {
+        std::array<std::size_t, N> ret{};
+        for (std::size_t i = 0; i < N; ++i)
+            ret[i] = index.sortedIndex(i);
+        return ret;
+    }
+
+    //Shared by all classes, so the keys are built by a single loop
+    inline void fillFieldKeys(QString* keys, const std::string_view* names, const std::size_t size)
+    {
+        for (std::size_t i = 0; i < size; ++i)
+            keys[i] = QString::fromLatin1(names[i].data(), static_cast<qsizetype>(names[i].size()));
+    }
+
+    //! The perfect hash table of the member names of the tagged object C
+    template<typename C>
+    inline constexpr auto fieldIndex = makeFieldIndex(fieldList<C>);
+
+    //Pointers-to-member of different types never point to the same member
+    template<auto Member, typename P>
+    constexpr bool isSameMember(const P other)
+    {
+        if constexpr (std::is_same_v<decltype(Member), P>)
+            return Member == other;
+        else
+            return false;
+    }
+
+    /*!
+     * \brief fieldNameOf The name of a member of a tagged object from its pointer-to-member, at compile time
+     * \tparam Member Pointer to a member of a class generated by the #TJO_DEFINE_JSON_TAGGED_OBJECT() macro, e.g. &Ship::label
+     * \return The JSON key of the member
+     */
+    template<auto Member>
+    constexpr std::string_view fieldNameOf()
+    {
+        using C = typename MemberPointerTraits<decltype(Member)>::Class;
+        return fieldList<C>.apply([](const auto&... field) {
+            std::string_view ret;
+            ((ret = isSameMember<Member>(field.member) ? field.name : ret), ...);
+            return ret;
+        });
+    }
+
+    /*!
+     * \brief fieldKeys The names of the members of the tagged object C as QStrings, in declaration order
+     *
+     * These are the QJsonObject keys of the members, the generated classes and their field table share them.
+     * \return The keys, which live until the end of the program
+     */
+    template<typename C>
+    const std::array<QString, fieldCount<C>>& fieldKeys()
+    {
+        static const std::array<QString, fieldCount<C>> keys = [] {
+            std::array<QString, fieldCount<C>> ret;
+            fieldList<C>.apply([&ret](const auto&... field) {
+                const std::string_view names[] = { field.name... };
+                fillFieldKeys(ret.data(), names, std::size(names));
+            });
+            return ret;
+        }();
+        return keys;
+    }
+
+    /*!
+     * \brief fieldTable Type-erased field table of the tagged object C, built from its field descriptors on the first call
+     * \return The table, which lives until the end of the program
+     */
+    template<typename C>
+    const FieldTable& fieldTable()
+    {
+        constexpr std::size_t N = fieldCount<C>;
+        static constexpr std::array<FieldEntry, N> entries = makeFieldEntries<C>(std::make_index_sequence<N>());
+        static constexpr std::array<std::size_t, N> sortedOrder = makeSortedOrder(fieldIndex<C>);
+        static const FieldTable table{ C::taggedClassName(), entries.data(), fieldKeys<C>().data(), N, sortedOrder.data(),
+                                       [](const std::string_view key) { return fieldIndex<C>.indexOf(key); } };
+        return table;
+    }
+
+    //The table-driven functions take the address of the object, the const ones go through the same address functions without writing
+    inline void* mutableObject(const void* object) { return const_cast<void*>(object); }
+
+    /*!
+     * \brief bindFields Table-driven counterpart of the QJsonObject constructor, assigns every member of the object in place
+     * \param object Address of the tagged object
+     * \param table Field table of the tagged object
+     * \param binders Binding functions of the members, fieldOperations<FieldBind, C>
+     * \param obj The JSON object
+     * \param checkValues If set to true, invalid conversions (missing value, wrong type etc.) will throw a runtime error.
+     * \param construct If set to true, the object has just been default-constructed and its members don't count as modified afterwards
+     */
+    inline void bindFields(void* object, const FieldTable& table, const FieldBind::Function* binders, const QJsonObject& obj, const bool checkValues,
+                           const bool construct)
+    {
+        for (std::size_t i = 0; i < table.size; ++i)
+            binders[i](table.entries[i].address(object), obj.value(table.keys[i]), checkValues, construct);
+    }
+
+    /*!
+     * \brief readFields Table-driven counterpart of readJson(), reads the object the reader is positioned on into the members
+     * \param object Address of the tagged object
+     * \param table Field table of the tagged object
+     * \param readers Reading functions of the members, fieldOperations<FieldReadJson, C>
+     * \param reader JSON reader positioned on the object
+     * \param checkValues If set to true, missing members and malformed JSON text will throw a runtime error.
+     */
+    inline void readFields(void* object, const FieldTable& table, const FieldReadJson::Function* readers, JsonReader& reader, const bool checkValues)
+    {
+        //One bit per member, on the stack for up to 256 members
+        constexpr std::size_t WORD_BITS = 64;
+        const std::size_t wordCount = (table.size + WORD_BITS - 1) / WORD_BITS;
+        quint64 inlineWords[4] = {};
+        std::unique_ptr<quint64[]> heapWords;
+        quint64* found = inlineWords;
+        if (wordCount > std::size(inlineWords)) {
+            heapWords = std::make_unique<quint64[]>(wordCount);
+            found = heapWords.get();
+        }
+
+        if (reader.beginObject()) {
+            std::string_view key;
+            while (reader.nextKey(key)) {
+                const int index = table.indexOf(key);
+                if (index < 0) {
+                    reader.skipValue();
+                    continue;
+                }
+                readers[index](table.entries[index].address(object), reader, checkValues);
+                found[index / WORD_BITS] |= quint64(1) << (index % WORD_BITS);
+            }
+        }
+        else
+            reader.skipValue();
+
+        if (!checkValues)
+            return;
+        if (reader.hasError())
+            throw(std::runtime_error("Malformed JSON text has been encountered while parsing the json data for " + std::string(table.className)));
+        for (std::size_t i = 0; i < table.size; ++i) {
+            if (!(found[i / WORD_BITS] & (quint64(1) << (i % WORD_BITS))))
+                throw(std::runtime_error("Invalid data has been encountered while parsing the json data for the member " + std::string(table.entries[i].name)));
+        }
+    }
+
+    /*!
+     * \brief fieldsToJsonObject Table-driven serialization into a newly built QJsonObject
+     * \param object Address of the tagged object
+     * \param table Field table of the tagged object
+     * \param converters Conversion functions of the members, fieldOperations<FieldToJsonValue, C>
+     * \return The JSON object of the members
+     */
+    inline QJsonObject fieldsToJsonObject(const void* object, const FieldTable& table, const FieldToJsonValue::Function* converters)
+    {
+        QJsonObject ret;
+        for (std::size_t i = 0; i < table.size; ++i)
+            ret.insert(table.keys[i], converters[i](table.entries[i].address(mutableObject(object))));
+        return ret;
+    }
+
+#ifdef TJO_ENABLE_MODIFICATION_TRACKING
+    /*!
+     * \brief fieldsMergePatch Table-driven merge patch of the changes since the baseline (see JsonObjectCache)
+     * \param object Address of the tagged object
+     * \param table Field table of the tagged object
+     * \param patchers Merge patch functions of the members, fieldOperations<FieldAppendPatch, C>
+     * \param cache Baseline of the tagged object
+     * \param patch The changes are added to it as a merge patch
+     */
+    inline void fieldsMergePatch(const void* object, const FieldTable& table, const FieldAppendPatch::Function* patchers, const JsonObjectCache& cache,
+                                 QJsonObject& patch)
+    {
+        for (std::size_t i = 0; i < table.size; ++i)
+            patchers[i](patch, table.keys[i], table.entries[i].address(mutableObject(object)), cache.object(), cache.isStale());
+    }
+
+    /*!
+     * \brief commitFields Table-driven update of the baseline, takes the members that have been modified since the previous update into it
+     * \param object Address of the tagged object
+     * \param table Field table of the tagged object
+     * \param committers Baseline update functions of the members, fieldOperations<FieldCommit, C>
+     * \param cache Baseline of the tagged object
+     */
+    inline void commitFields(void* object, const FieldTable& table, const FieldCommit::Function* committers, JsonObjectCache& cache)
+    {
+        for (std::size_t i = 0; i < table.size; ++i)
+            committers[i](table.keys[i], table.entries[i].address(object), cache.object(), cache.isStale());
+        cache.finishUpdate();
+    }
+#endif
+
+    /*!
+     * \brief writeFields Table-driven counterpart of writeJson(), writes the members as a JSON object in the key order of QJsonDocument
+     * \param object Address of the tagged object
+     * \param table Field table of the tagged object
+     * \param writers Writing functions of the members, fieldOperations<FieldWriteJson, C>
+     * \param writer JSON writer positioned where the object belongs
+     */
+    inline void writeFields(const void* object, const FieldTable& table, const FieldWriteJson::Function* writers, JsonWriter& writer)
+    {
+        writer.beginObject();
+        for (std::size_t i = 0; i < table.size; ++i) {
+            const std::size_t index = table.sortedOrder[i];
+            writer.key(table.entries[index].name);
+            writers[index](table.entries[index].address(mutableObject(object)), writer);
+        }
+        writer.endObject();
+    }
+
+    //! Typed convenience overloads, the table of C is looked up once per call and only the functions of the called operation are instantiated
+    template<typename C>
+    void bindFields(C& object, const QJsonObject& obj, const bool checkValues = true)
+    {
+        bindFields(&object, fieldTable<C>(), fieldOperations<FieldBind, C>.data(), obj, checkValues, false);
+    }
+
+    //! Binds the members of a newly default-constructed object, the table-driven constructors call it
+    template<typename C>
+    void constructFields(C& object, const QJsonObject& obj, const bool checkValues)
+    {
+        bindFields(&object, fieldTable<C>(), fieldOperations<FieldBind, C>.data(), obj, checkValues, true);
+    }
+
+    template<typename C>
+    void readFields(C& object, JsonReader& reader, const bool checkValues = true)
+    {
+        readFields(&object, fieldTable<C>(), fieldOperations<FieldReadJson, C>.data(), reader, checkValues);
+#ifdef TJO_ENABLE_MODIFICATION_TRACKING
+        JsonCacheAccess::of(object).invalidate();
+#endif
+    }
+
+    template<typename C>
+    QJsonObject fieldsToJsonObject(const C& object) { return fieldsToJsonObject(&object, fieldTable<C>(), fieldOperations<FieldToJsonValue, C>.data()); }
+
+    template<typename C>
+    void writeFields(const C& object, JsonWriter& writer) { writeFields(&object, fieldTable<C>(), fieldOperations<FieldWriteJson, C>.data(), writer); }
+
+#ifdef TJO_ENABLE_MODIFICATION_TRACKING
+    template<typename C>
+    void fieldsMergePatch(const C& object, const JsonObjectCache& cache, QJsonObject& patch)
+    {
+        fieldsMergePatch(&object, fieldTable<C>(), fieldOperations<FieldAppendPatch, C>.data(), cache, patch);
+    }
+
+    template<typename C>
+    void commitFields(C& object, JsonObjectCache& cache) { commitFields(&object, fieldTable<C>(), fieldOperations<FieldCommit, C>.data(), cache); }
+#endif
+}
+
+//Tuple protocol of the field lists
+namespace std {
+    template<typename... Descriptors>
+    struct tuple_size<TaggedObject::FieldList<Descriptors...>> : integral_constant<size_t, sizeof...(Descriptors)> {};
+
+    template<size_t I, typename... Descriptors>
+    struct tuple_element<I, TaggedObject::FieldList<Descriptors...>>
+    {
+        using type = remove_reference_t<decltype(TaggedObject::fieldAt<I>(declval<const TaggedObject::FieldList<Descriptors...>&>()))>;
+    };
+}
+
+#endif // TAGGEDJSONFIELDS_H
@@ -0,0 +1,96 @@
+#ifndef TAGGEDJSONFILE_H
+#define TAGGEDJSONFILE_H
+#include <QByteArray>
+#include <QFile>
+#include <QString>
+
+namespace TaggedObject {
+
+/*!
+ * \class JsonFileData
+ * \brief The JsonFileData class exposes the content of a JSON file without copying it into the heap.
+ *
+ * Regular files are memory-mapped with QFile::map(), so the parsers read straight from the page cache and the peak memory usage doesn't double
+ * for large files. Non-regular files (pipes, character devices etc.) can't be mapped, their content is read into a buffer instead, and so is the
+ * content of a regular file whose mapping fails.\n
+ * The class never throws. Open and read failures are reported by isValid() and errorString(). The content stays valid as long as the instance lives.
+ */
+class JsonFileData
+{
+public:
+    /*!
+     * \brief JsonFileData Opens and maps the given file
+     * \param filePath Path of the JSON file
+     */
+    explicit JsonFileData(const QString& filePath) : m_file(filePath)
+    {
+        if (!m_file.open(QIODevice::ReadOnly)) {
+            m_error = QStringLiteral("The json file %1 could not be opened: %2").arg(filePath, m_file.errorString());
+            return;
+        }
+
+        //Pipes and devices can't be mapped, neither can the files that report no size (such as the ones of procfs)
+        if (!m_file.isSequential() && m_file.size() > 0) {
+            m_map = m_file.map(0, m_file.size());
+            if (m_map) {
+                m_data = reinterpret_cast<const char*>(m_map);
+                m_size = static_cast<qsizetype>(m_file.size());
+                m_valid = true;
+                return;
+            }
+        }
+
+        //The content of the files that can't be mapped is read into the buffer, a failed mapping (e.g. on a filesystem that doesn't support it)
+        //doesn't make a readable file invalid
+        m_file.unsetError();
+        m_buffer = m_file.readAll();
+        if (m_file.error() != QFileDevice::NoError) {
+            m_error = QStringLiteral("The json file %1 could not be read: %2").arg(filePath, m_file.errorString());
+            m_buffer.clear();
+            return;
+        }
+        m_data = m_buffer.constData();
+        m_size = m_buffer.size();
+        m_valid = true;
+    }
+
+    JsonFileData(const JsonFileData&) = delete;
+    JsonFileData& operator=(const JsonFileData&) = delete;
+
+    ~JsonFileData()
+    {
+        if (m_map)
+            m_file.unmap(m_map);
+    }
+
+    //! Returns false if the file couldn't be opened or read
+    bool isValid() const { return m_valid; }
+
+    //! Description of the open or read failure, empty if there isn't one
+    QString errorString() const { return m_error; }
+
+    //! Returns true if the content is served from a memory mapping rather than a buffer
+    bool isMapped() const { return m_map != nullptr; }
+
+    //! Start of the file content
+    const char* data() const { return m_data; }
+
+    //! Size of the file content in bytes
+    qsizetype size() const { return m_size; }
+
+    //! The file content as a QByteArray that refers to the mapping without copying it, it mustn't outlive this instance
+    QByteArray bytes() const { return QByteArray::fromRawData(m_data, m_size); }
+
+private:
+    QFile m_file;
+    uchar* m_map = nullptr;
+    QByteArray m_buffer;
+    const char* m_data = "";
+    qsizetype m_size = 0;
+    bool m_valid = false;
+    QString m_error;
+};
+
+}
+
+#endif // TAGGEDJSONFILE_H
@@ -0,0 +1,277 @@
+#ifndef TAGGEDJSONFILECACHE_H
+#define TAGGEDJSONFILECACHE_H
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <typeindex>
+#include <utility>
+#include <QDateTime>
+#include <QFileInfo>
+#include <QString>
+#include "taggedjsonreader.h"
+#include "taggedjsonfile.h"
+#include "taggedjsonfields.h"
+#include "taggedjsoninstrumentation.h"
+
+namespace TaggedObject {
+
+/*!
+ * \class JsonFileCache
+ * \brief The JsonFileCache class shares the tagged objects parsed from the same files.
+ *
+ * load() returns a shared, immutable object of the file. The const methods of the tagged objects (toJsonObject(), toMergePatch(), toJson() etc.)
+ * don't write to the object, so the threads that share it can read and serialize it at the same time. The first load of a file parses it with fromFile() (see the classes generated by the
+ * #TJO_DEFINE_JSON_TAGGED_OBJECT() macro), the next ones only check the size and the modification time of the file and return the same object.
+ * A file that has changed is parsed again. The objects are kept per type and canonical path, so the different paths of the same file
+ * (relative paths, symbolic links) share the object as well. The canonical path is only resolved when a path is loaded for the first time or its
+ * object is missing or out of date, the hits look the absolute path up among the paths resolved before. A symbolic link that is pointed to another
+ * file of the same size and modification time keeps returning the object of the previous file until invalidate() is called for it.\n
+ * The file sizes are added up as the cost of the objects. Once the total exceeds maxBytes(), the least recently used objects are dropped from
+ * the cache, the objects that are still held elsewhere stay alive. A file that is larger than maxBytes() on its own isn't kept at all.\n
+ * Files that can't be read or aren't well-formed JSON aren't cached, without checkValues load() returns a default-constructed object for them like
+ * fromFile() does.\n
+ * Nothing is cached unless the cache is used, global() is the cache of the process. The cache can be used from several threads at once, the
+ * files are parsed outside of its lock, so two threads that load the same new file at the same time may both parse it.
+ * \code
+ * const std::shared_ptr<const Settings> settings = TaggedObject::JsonFileCache::global().load<Settings>(path);
+ * \endcode
+ */
+class JsonFileCache
+{
+public:
+    //! Default memory bound of the cache, in bytes of the cached files
+    static constexpr qint64 DEFAULT_MAX_BYTES = 64 * 1024 * 1024;
+
+    /*!
+     * \brief JsonFileCache Constructor that takes the memory bound of the cache
+     * \param maxBytes Upper limit of the total size of the cached files
+     */
+    explicit JsonFileCache(const qint64 maxBytes = DEFAULT_MAX_BYTES) : m_maxBytes(maxBytes) {}
+
+    JsonFileCache(const JsonFileCache&) = delete;
+    JsonFileCache& operator=(const JsonFileCache&) = delete;
+
+    //! The cache of the process
+    static JsonFileCache& global()
+    {
+        static JsonFileCache cache;
+        return cache;
+    }
+
+    /*!
+     * \brief load Returns the object of the given file, parses the file only if it isn't cached or has changed since
+     *
+     * An object that has been parsed without checkValues isn't returned for a load with checkValues, the file is parsed again.
+     * Missing files and the files that aren't well-formed JSON aren't cached, a default-constructed object is returned for them without checkValues.
+     * \param filePath Path of the JSON file
+     * \param checkValues If set to true, runtime error is raised when the file can't be read or a member is missing
+     * \return Shared object of the file
+     * \tparam T Tagged object type of the file
+     */
+    template<typename T>
+    std::shared_ptr<const T> load(const QString& filePath, const bool checkValues = true)
+    {
+        const QFileInfo info(filePath);
+        const QString absolute = info.absoluteFilePath();
+        const qint64 size = info.size();
+        const qint64 modified = info.lastModified().toMSecsSinceEpoch();
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            const auto alias = m_aliases.find(absolute);
+            if (alias != m_aliases.end()) {
+                if (std::shared_ptr<const void> object = find(Key(std::type_index(typeid(T)), alias->second), size, modified, checkValues))
+                    return std::static_pointer_cast<const T>(std::move(object));
+            }
+        }
+
+        //The canonical path costs a system call per path component, it's only resolved on a miss
+        const QString path = info.canonicalFilePath();
+        if (path.isEmpty())
+            return std::make_shared<const T>(T::fromFile(filePath, checkValues));
+
+        const Key key(std::type_index(typeid(T)), path);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            //Another path of the same file may have been loaded before
+            if (std::shared_ptr<const void> object = find(key, size, modified, checkValues)) {
+                m_aliases[absolute] = path;
+                return std::static_pointer_cast<const T>(std::move(object));
+            }
+            ++m_missCount;
+        }
+
+        //The stat precedes the parse, so a file that changes while it is parsed is parsed again by the next load
+        std::shared_ptr<const T> ret = parse<T>(path, checkValues);
+        if (!ret)
+            return std::make_shared<const T>();
+        std::lock_guard<std::mutex> lock(m_mutex);
+        erase(key);
+        if (size <= m_maxBytes) {
+            m_recent.push_front(key);
+            m_entries.emplace(key, Entry{ret, size, modified, checkValues, m_recent.begin()});
+            m_usedBytes += size;
+            m_aliases[absolute] = path;
+            evict();
+        }
+        return ret;
+    }
+
+    /*!
+     * \brief invalidate Drops the objects of the given file, of every type
+     * \param filePath Path of the file
+     */
+    void invalidate(const QString& filePath)
+    {
+        const QFileInfo info(filePath);
+        const QString canonical = info.canonicalFilePath();
+        const QString path = canonical.isEmpty() ? info.absoluteFilePath() : canonical;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto it = m_recent.begin(); it != m_recent.end();) {
+            const Key key = *it++;
+            if (key.second == path)
+                erase(key);
+        }
+        m_aliases.erase(info.absoluteFilePath());
+    }
+
+    //! Drops every object
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entries.clear();
+        m_recent.clear();
+        m_aliases.clear();
+        m_usedBytes = 0;
+    }
+
+    //! Sets the upper limit of the total size of the cached files, drops the least recently used objects above it
+    void setMaxBytes(const qint64 maxBytes)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_maxBytes = maxBytes;
+        evict();
+    }
+
+    //! Upper limit of the total size of the cached files
+    qint64 maxBytes() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_maxBytes;
+    }
+
+    //! Total size of the cached files
+    qint64 usedBytes() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_usedBytes;
+    }
+
+    //! Number of the cached objects
+    qsizetype size() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return static_cast<qsizetype>(m_entries.size());
+    }
+
+    //! Number of the loads that have returned a cached object
+    qint64 hitCount() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_hitCount;
+    }
+
+    //! Number of the loads that have parsed the file
+    qint64 missCount() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_missCount;
+    }
+
+private:
+    using Key = std::pair<std::type_index, QString>;
+
+    struct Entry
+    {
+        std::shared_ptr<const void> object;
+        qint64 size;
+        qint64 modified;
+        bool checked;
+        std::list<Key>::iterator position;
+    };
+
+    mutable std::mutex m_mutex;
+    std::map<Key, Entry> m_entries;
+    //Most recently used first
+    std::list<Key> m_recent;
+    //Canonical paths of the absolute paths that have been loaded, the entries of the dropped objects are removed with them
+    std::map<QString, QString> m_aliases;
+    qint64 m_maxBytes;
+    qint64 m_usedBytes = 0;
+    qint64 m_hitCount = 0;
+    qint64 m_missCount = 0;
+
+    //Parses the file the same way as T::fromFile(), returns nullptr instead of the default-constructed object if the file can't be read or parsed
+    template<typename T>
+    static std::shared_ptr<const T> parse(const QString& path, const bool checkValues)
+    {
+        const auto file = std::make_shared<const JsonFileData>(path);
+        if (!file->isValid()) {
+            if (checkValues)
+                throw(std::runtime_error(file->errorString().toStdString()));
+            return nullptr;
+        }
+        TJO_INSTRUMENT_SCOPE(InstrumentationEvent::Parse, T::taggedClassName(), static_cast<qint64>(fieldCount<T>), file->size());
+        const QByteArray text = file->bytes();
+        JsonReader reader(text, file);
+        T object;
+        object.readJson(reader, checkValues);
+        if (!reader.finish()) {
+            if (checkValues)
+                throw(std::runtime_error("Malformed JSON text has been encountered while parsing the json data for " + std::string(T::taggedClassName())));
+            return nullptr;
+        }
+        return std::make_shared<const T>(std::move(object));
+    }
+
+    //Returns the object of the key if it's up to date and counts the hit, the mutex has to be locked
+    std::shared_ptr<const void> find(const Key& key, const qint64 size, const qint64 modified, const bool checkValues)
+    {
+        const auto it = m_entries.find(key);
+        if (it == m_entries.end() || it->second.size != size || it->second.modified != modified || (!it->second.checked && checkValues))
+            return nullptr;
+        m_recent.splice(m_recent.begin(), m_recent, it->second.position);
+        ++m_hitCount;
+        return it->second.object;
+    }
+
+    void erase(const Key& key)
+    {
+        const auto it = m_entries.find(key);
+        if (it == m_entries.end())
+            return;
+        m_usedBytes -= it->second.size;
+        m_recent.erase(it->second.position);
+        m_entries.erase(it);
+        for (auto alias = m_aliases.begin(); alias != m_aliases.end();) {
+            if (alias->second == key.second)
+                alias = m_aliases.erase(alias);
+            else
+                ++alias;
+        }
+    }
+
+    void evict()
+    {
+        while (m_usedBytes > m_maxBytes && !m_recent.empty()) {
+            const Key key = m_recent.back();
+            erase(key);
+        }
+    }
+};
+
+}
+
+#endif // TAGGEDJSONFILECACHE_H
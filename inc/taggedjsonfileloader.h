@@ -0,0 +1,223 @@
+#ifndef TAGGEDJSONFILELOADER_H
+#define TAGGEDJSONFILELOADER_H
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <QString>
+#include <QStringList>
+#include "taggedjsonfile.h"
+#include "taggedjsonreader.h"
+#include "taggedjsonthreadpool.h"
+
+namespace TaggedObject {
+
+//! Settings of JsonFileLoader
+struct JsonFileLoadOptions
+{
+    //! Number of the loader threads, 0 shares the global pool that uses all of the hardware threads
+    int threadCount = 0;
+
+    //! Upper limit of the files that are open and parsed at the same time, 0 selects the thread count of the pool
+    int maxConcurrentFiles = 0;
+
+    //! If set to true, the files with missing members are reported as errors as well. Files that can't be read and malformed files are always reported.
+    bool checkValues = true;
+};
+
+/*!
+ * \brief The JsonFileResult struct holds the objects of a batch of files, in the order of the paths
+ * \tparam T Tagged object type of the files
+ */
+template<typename T>
+struct JsonFileResult
+{
+    //! Object of each file, a default constructed one for the files that have failed
+    std::vector<T> objects;
+
+    //! Error of each file, empty for the files that have been loaded
+    std::vector<QString> errors;
+
+    //! Number of the files that have failed
+    qsizetype failedCount() const { return std::count_if(errors.cbegin(), errors.cend(), [](const QString& error) { return !error.isEmpty(); }); }
+
+    //! Returns true if every file has been loaded
+    bool isComplete() const { return failedCount() == 0; }
+};
+
+/*!
+ * \class JsonFileLoader
+ * \brief The JsonFileLoader class loads many JSON files into tagged objects on a thread pool.
+ *
+ * Every file is memory-mapped (see JsonFileData) and parsed in the direct-binding mode (see fromFile() on the classes generated by the
+ * #TJO_DEFINE_JSON_TAGGED_OBJECT() macro). Up to JsonFileLoadOptions::maxConcurrentFiles files are loaded at the same time, each by its own task,
+ * so the page faults of one file overlap the parsing of the others. A failing file doesn't stop the others, its error is reported in
+ * JsonFileResult::errors at the index of its path.\n
+ * load() blocks and helps the pool while it waits. loadAsync() returns immediately with a std::future or calls a completion handler, which runs
+ * on one of the pool threads. A future of the loader mustn't be waited for on a thread of the same pool. A loader with its own pool
+ * (JsonFileLoadOptions::threadCount) waits for its batches in flight when it is destroyed.
+ * \tparam T Tagged object type of the files
+ */
+template<typename T>
+class JsonFileLoader
+{
+public:
+    //! Handler of the finished batch, invoked on one of the pool threads
+    using CompletionHandler = std::function<void(JsonFileResult<T>&)>;
+
+    /*!
+     * \brief JsonFileLoader Constructor that takes the settings of the loader
+     * \param options Settings of the loader
+     */
+    explicit JsonFileLoader(const JsonFileLoadOptions& options = JsonFileLoadOptions())
+        : m_options(options),
+          m_ownPool(options.threadCount > 0 ? std::make_unique<WorkStealingPool>(options.threadCount) : nullptr)
+    {
+    }
+
+    /*!
+     * \brief load Loads the given files and waits for them
+     * \param filePaths Paths of the JSON files
+     * \return The object and the error of each file, in the order of the paths
+     */
+    JsonFileResult<T> load(const QStringList& filePaths)
+    {
+        const auto batch = start(filePaths, nullptr);
+        WorkStealingPool& workers = pool();
+        while (true) {
+            {
+                std::lock_guard<std::mutex> lock(batch->mutex);
+                if (batch->finished)
+                    break;
+            }
+            if (!workers.runPendingTask()) {
+                std::unique_lock<std::mutex> lock(batch->mutex);
+                batch->done.wait(lock, [&batch] { return batch->finished; });
+                break;
+            }
+        }
+        return std::move(batch->result);
+    }
+
+    /*!
+     * \brief loadAsync Starts loading the given files and returns without waiting
+     * \param filePaths Paths of the JSON files
+     * \return Future of the object and the error of each file, in the order of the paths
+     */
+    std::future<JsonFileResult<T>> loadAsync(const QStringList& filePaths)
+    {
+        const auto promise = std::make_shared<std::promise<JsonFileResult<T>>>();
+        std::future<JsonFileResult<T>> ret = promise->get_future();
+        start(filePaths, [promise](JsonFileResult<T>& result) { promise->set_value(std::move(result)); });
+        return ret;
+    }
+
+    /*!
+     * \brief loadAsync Starts loading the given files and calls the handler once all of them are done
+     * \param filePaths Paths of the JSON files
+     * \param handler Completion handler, it mustn't throw
+     */
+    void loadAsync(const QStringList& filePaths, CompletionHandler handler) { start(filePaths, std::move(handler)); }
+
+    //! Number of the files that are loaded at the same time
+    int concurrency() { return m_options.maxConcurrentFiles > 0 ? m_options.maxConcurrentFiles : pool().threadCount(); }
+
+private:
+    //State of a batch, shared with its tasks
+    struct Batch
+    {
+        std::vector<QString> paths;
+        JsonFileResult<T> result;
+        std::atomic<qsizetype> nextFile{0};
+        qsizetype runningTasks = 0;
+        CompletionHandler handler;
+        bool checkValues = true;
+        std::mutex mutex;
+        std::condition_variable done;
+        bool finished = false;
+    };
+
+    JsonFileLoadOptions m_options;
+    std::unique_ptr<WorkStealingPool> m_ownPool;
+
+    WorkStealingPool& pool() { return m_ownPool ? *m_ownPool : WorkStealingPool::global(); }
+
+    static void loadFile(const QString& filePath, const bool checkValues, T& object, QString& error)
+    {
+        const auto file = std::make_shared<const JsonFileData>(filePath);
+        if (!file->isValid()) {
+            error = file->errorString();
+            return;
+        }
+        try {
+            const QByteArray text = file->bytes();
+            JsonReader reader(text, file);
+            object.readJson(reader, checkValues);
+            if (!reader.finish())
+                error = QStringLiteral("Malformed JSON text has been encountered in %1 at offset %2").arg(filePath).arg(reader.offset());
+        }
+        catch (const std::exception& e) {
+            error = QString::fromUtf8(e.what());
+        }
+        if (!error.isEmpty())
+            object = T();
+    }
+
+    //Each task takes the next file until there are none left, so the number of the tasks bounds the files in flight
+    static void runTask(const std::shared_ptr<Batch>& batch)
+    {
+        const qsizetype count = static_cast<qsizetype>(batch->paths.size());
+        for (qsizetype i = batch->nextFile.fetch_add(1); i < count; i = batch->nextFile.fetch_add(1)) {
+            const std::size_t index = static_cast<std::size_t>(i);
+            loadFile(batch->paths[index], batch->checkValues, batch->result.objects[index], batch->result.errors[index]);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(batch->mutex);
+            if (--batch->runningTasks > 0)
+                return;
+        }
+        finish(*batch);
+    }
+
+    //The handler runs before the waiting thread is released, the waiting thread then takes the result
+    static void finish(Batch& batch)
+    {
+        if (batch.handler)
+            batch.handler(batch.result);
+        std::lock_guard<std::mutex> lock(batch.mutex);
+        batch.finished = true;
+        batch.done.notify_all();
+    }
+
+    std::shared_ptr<Batch> start(const QStringList& filePaths, CompletionHandler handler)
+    {
+        const auto batch = std::make_shared<Batch>();
+        batch->paths.assign(filePaths.begin(), filePaths.end());
+        batch->result.objects.resize(batch->paths.size());
+        batch->result.errors.resize(batch->paths.size());
+        batch->handler = std::move(handler);
+        batch->checkValues = m_options.checkValues;
+
+        const qsizetype taskCount = std::min<qsizetype>(concurrency(), static_cast<qsizetype>(batch->paths.size()));
+        if (taskCount == 0) {
+            finish(*batch);
+            return batch;
+        }
+
+        batch->runningTasks = taskCount;
+        WorkStealingPool& workers = pool();
+        for (qsizetype i = 0; i < taskCount; ++i)
+            workers.submit([batch] { runTask(batch); });
+        return batch;
+    }
+};
+
+}
+
+#endif // TAGGEDJSONFILELOADER_H
@@ -0,0 +1,50 @@
+#ifndef TAGGEDJSONFORWARD_H
+#define TAGGEDJSONFORWARD_H
+#include <vector>
+#include <QtGlobal>
+#include <QJsonValue>
+#include <QString>
+
+QT_FORWARD_DECLARE_CLASS(QCborStreamReader)
+QT_FORWARD_DECLARE_CLASS(QCborStreamWriter)
+
+/*!
+ * Declarations of the optional CBOR and validation support.\n
+ * The member types and the generated classes only refer to these from templates, so a translation unit that doesn't use CBOR or the validation
+ * neither includes nor instantiates them. The definitions are in the opt-in headers: taggedjsoncbor.h for fromCbor(), toCbor(), readCbor() and
+ * writeCbor(), taggedjsonvalidation.h for validateJson(), validate(), tryFrom() and tryFromJson().
+ */
+namespace TaggedObject {
+
+    inline bool hasCborError(const QCborStreamReader& reader);
+    inline bool readCborString(QCborStreamReader& reader, QString& out);
+    inline bool readCborNumber(QCborStreamReader& reader, double& out);
+    template<typename T>
+    bool readCborInteger(QCborStreamReader& reader, T& out);
+    inline QJsonValue readCborValue(QCborStreamReader& reader);
+    inline void writeCborValue(QCborStreamWriter& writer, const QJsonValue& value);
+
+    template<typename C>
+    struct CborMembers;
+
+    struct ValidationError;
+    using ValidationErrors = std::vector<ValidationError>;
+    class ValidationContext;
+
+    template<typename T>
+    class ValidationResult;
+
+    template<typename T>
+    void validateJsonValue(const QJsonValue& val, ValidationContext& context);
+    template<typename T>
+    void validateJsonValueArray(const QJsonValue& val, ValidationContext& context);
+    template<typename T>
+    void validateTaggedArray(const QJsonValue& val, ValidationContext& context);
+    template<typename M>
+    void validateMemberValue(const QJsonValue& val, ValidationContext& context);
+
+    template<typename C>
+    struct ValidationMembers;
+}
+
+#endif // TAGGEDJSONFORWARD_H
@@ -0,0 +1,281 @@
+#ifndef TAGGEDJSONINSTRUMENTATION_H
+#define TAGGEDJSONINSTRUMENTATION_H
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <QString>
+#include <QtGlobal>
+
+/*!
+ * Opt-in instrumentation of the parse and serialization paths.\n
+ * The hooks are compiled in only if TJO_ENABLE_INSTRUMENTATION is defined, otherwise the TJO_INSTRUMENT_* macros expand to nothing and the
+ * generated classes have no instrumentation state. The definition changes the layout of the generated classes, so it has to be the same for
+ * every translation unit of a program (target_compile_definitions on the whole target).\n
+ * With the hooks compiled in, the events are reported to the sink that has been installed by setInstrumentationSink(). Nothing is measured while
+ * there is no sink, the hooks cost an atomic load then.
+ */
+namespace TaggedObject {
+
+    //! Operations the instrumentation hooks report
+    enum class InstrumentationEvent
+    {
+        Construct,      //!< A generated class has been constructed from a QJsonObject or QJsonValue, count is the member count
+        DocumentParse,  //!< QJsonDocument parse of the QByteArray and file path constructors, bytes is the size of the text
+        Parse,          //!< fromJson(), fromFile() or fromCbor(), bytes is the size of the input
+        ArrayConstruct, //!< Elements of a tagged array have been constructed from a QJsonArray, count is the element count
+        Serialize,      //!< toJsonObject(), count is the member count
+        SerializeText,  //!< toJson(), writeJson() into a QByteArray or toCbor(), bytes is the size of the output
+        MissingField,   //!< A member has no value in the source object, memberName names it
+        TypeMismatch    //!< A TaggedJSONObject has been given a value of another type and falls back to the default value
+    };
+
+    //! A single report of the instrumentation hooks
+    struct InstrumentationRecord
+    {
+        InstrumentationEvent event;
+        //! Generated class, the member type (TaggedJSONInt etc.) for the type mismatches
+        std::string_view className;
+        //! Member of the MissingField events, empty otherwise
+        std::string_view memberName;
+        //! Input or output size in bytes, -1 if it isn't known
+        qint64 bytes = -1;
+        //! Member or element count, -1 if it doesn't apply
+        qint64 count = -1;
+        //! Wall-clock duration of the operation, nested operations are included. 0 for the MissingField and TypeMismatch events.
+        qint64 elapsedNanoseconds = 0;
+    };
+
+    /*!
+     * \class InstrumentationSink
+     * \brief The InstrumentationSink class receives the reports of the instrumentation hooks.
+     *
+     * record() is called from every thread that parses or serializes, the parallel array mode included, so implementations have to be thread-safe.
+     * It is called on the hot path, so it should be cheap. The string views refer to static strings and stay valid.
+     */
+    class InstrumentationSink
+    {
+    public:
+        virtual ~InstrumentationSink() = default;
+        virtual void record(const InstrumentationRecord& record) = 0;
+    };
+
+    //! Detects the classes that have been generated by the tagged object macros, which know their name
+    template<typename T, typename = void>
+    struct HasTaggedClassName : std::false_type {};
+
+    template<typename T>
+    struct HasTaggedClassName<T, std::void_t<decltype(T::taggedClassName())>> : std::true_type {};
+
+    //! Name of the class in the reports
+    template<typename T>
+    constexpr std::string_view instrumentationName()
+    {
+        if constexpr (HasTaggedClassName<T>::value)
+            return T::taggedClassName();
+        else
+            return "TaggedObject";
+    }
+
+    //! Storage of the installed sink
+    inline std::atomic<InstrumentationSink*>& instrumentationSinkSlot()
+    {
+        static std::atomic<InstrumentationSink*> sink{nullptr};
+        return sink;
+    }
+
+    //! Installs the sink the hooks report into, nullptr stops the reporting. The sink has to outlive the operations that are in flight.
+    inline void setInstrumentationSink(InstrumentationSink* sink) { instrumentationSinkSlot().store(sink, std::memory_order_release); }
+
+    //! The installed sink, nullptr if there isn't one
+    inline InstrumentationSink* instrumentationSink() { return instrumentationSinkSlot().load(std::memory_order_acquire); }
+
+    //! Reports an event without a duration
+    inline void reportInstrumentationEvent(const InstrumentationEvent event, const std::string_view className, const std::string_view memberName = {})
+    {
+        if (InstrumentationSink* const sink = instrumentationSink()) {
+            InstrumentationRecord record;
+            record.event = event;
+            record.className = className;
+            record.memberName = memberName;
+            sink->record(record);
+        }
+    }
+
+    /*!
+     * \class InstrumentationScope
+     * \brief The InstrumentationScope class measures the operation of its scope and reports it when the scope ends.
+     *
+     * The clock is read only if a sink is installed when the scope starts. Operations that end with an exception aren't reported.
+     */
+    class InstrumentationScope
+    {
+    public:
+        InstrumentationScope(const InstrumentationEvent event, const std::string_view className, const qint64 count = -1, const qint64 bytes = -1)
+            : m_sink(instrumentationSink())
+        {
+            if (!m_sink)
+                return;
+            m_record.event = event;
+            m_record.className = className;
+            m_record.count = count;
+            m_record.bytes = bytes;
+            m_start = std::chrono::steady_clock::now();
+            m_exceptions = std::uncaught_exceptions();
+        }
+
+        InstrumentationScope(const InstrumentationScope&) = delete;
+        InstrumentationScope& operator=(const InstrumentationScope&) = delete;
+
+        ~InstrumentationScope()
+        {
+            if (!m_sink || std::uncaught_exceptions() > m_exceptions)
+                return;
+            m_record.elapsedNanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start).count();
+            m_sink->record(m_record);
+        }
+
+        //! Sets the size of the output, for the operations that know it only at the end
+        void setBytes(const qint64 bytes) { m_record.bytes = bytes; }
+
+    private:
+        InstrumentationSink* m_sink;
+        InstrumentationRecord m_record;
+        std::chrono::steady_clock::time_point m_start;
+        int m_exceptions = 0;
+    };
+
+    /*!
+     * \class ConstructionProbe
+     * \brief The ConstructionProbe class measures the member initialization of the generated constructors.
+     *
+     * It is the first data member of the generated classes, so it is initialized before the other members. It reports the missing members
+     * right away and the duration when the constructor body calls finish().
+     */
+    class ConstructionProbe
+    {
+    public:
+        ConstructionProbe() = default;
+
+        template<typename Index, typename Object>
+        ConstructionProbe(const std::string_view className, const Object& obj, const Index& index) : m_active(instrumentationSink() != nullptr)
+        {
+            if (!m_active)
+                return;
+            for (std::size_t i = 0; i < index.size(); ++i) {
+                const std::string_view name = index.name(i);
+                if (!obj.contains(QLatin1String(name.data(), static_cast<qsizetype>(name.size()))))
+                    reportInstrumentationEvent(InstrumentationEvent::MissingField, className, name);
+            }
+            m_className = className;
+            m_start = std::chrono::steady_clock::now();
+        }
+
+        //! Reports the construction, count is the member count
+        void finish(const qint64 count)
+        {
+            if (!m_active)
+                return;
+            m_active = false;
+            if (InstrumentationSink* const sink = instrumentationSink()) {
+                InstrumentationRecord record;
+                record.event = InstrumentationEvent::Construct;
+                record.className = m_className;
+                record.count = count;
+                record.elapsedNanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start).count();
+                sink->record(record);
+            }
+        }
+
+    private:
+        bool m_active = false;
+        std::string_view m_className;
+        std::chrono::steady_clock::time_point m_start;
+    };
+
+    /*!
+     * \class InstrumentationCounters
+     * \brief The InstrumentationCounters class is a ready-made sink that sums the reports per class and event.
+     *
+     * Each class and event pair counts the operations, their bytes and their time, and missing members are counted per member. A snapshot can be
+     * taken at any time, for example to feed a metrics system periodically.
+     */
+    class InstrumentationCounters : public InstrumentationSink
+    {
+    public:
+        //! Sums of a class and event pair
+        struct Totals
+        {
+            qint64 operations = 0;
+            qint64 bytes = 0;
+            qint64 items = 0;
+            qint64 elapsedNanoseconds = 0;
+        };
+
+        //! Class name and event, the member name is added for the MissingField events as "class.member"
+        using Key = std::pair<std::string, InstrumentationEvent>;
+
+        void record(const InstrumentationRecord& record) override
+        {
+            std::string name(record.className);
+            if (!record.memberName.empty())
+                name.append(".").append(record.memberName);
+
+            const std::lock_guard<std::mutex> lock(m_mutex);
+            Totals& totals = m_totals[Key(std::move(name), record.event)];
+            ++totals.operations;
+            totals.bytes += qMax<qint64>(record.bytes, 0);
+            totals.items += qMax<qint64>(record.count, 0);
+            totals.elapsedNanoseconds += record.elapsedNanoseconds;
+        }
+
+        //! Copy of the current sums
+        std::map<Key, Totals> snapshot() const
+        {
+            const std::lock_guard<std::mutex> lock(m_mutex);
+            return m_totals;
+        }
+
+        //! Sums of a single class and event pair, zero if there is no report
+        Totals totals(const std::string& className, const InstrumentationEvent event) const
+        {
+            const std::lock_guard<std::mutex> lock(m_mutex);
+            const auto it = m_totals.find(Key(className, event));
+            return it == m_totals.end() ? Totals() : it->second;
+        }
+
+        //! Clears the sums
+        void reset()
+        {
+            const std::lock_guard<std::mutex> lock(m_mutex);
+            m_totals.clear();
+        }
+
+    private:
+        mutable std::mutex m_mutex;
+        std::map<Key, Totals> m_totals;
+    };
+}
+
+#ifdef TJO_ENABLE_INSTRUMENTATION
+#define TJO_INSTRUMENT_SCOPE(...) TaggedObject::InstrumentationScope tjoInstrumentationScope(__VA_ARGS__)
+#define TJO_INSTRUMENT_SET_BYTES(bytes) tjoInstrumentationScope.setBytes(bytes)
+#define TJO_INSTRUMENT_EVENT(...) TaggedObject::reportInstrumentationEvent(__VA_ARGS__)
+#define TJO_INSTRUMENT_PROBE_MEMBER TaggedObject::ConstructionProbe m_constructionProbe;
+#define TJO_INSTRUMENT_PROBE_INIT(CLASS_NAME, obj) m_constructionProbe(#CLASS_NAME, obj, jsonFieldIndex()),
+#define TJO_INSTRUMENT_PROBE_FINISH(count) m_constructionProbe.finish(count);
+#else
+#define TJO_INSTRUMENT_SCOPE(...)
+#define TJO_INSTRUMENT_SET_BYTES(bytes)
+#define TJO_INSTRUMENT_EVENT(...)
+#define TJO_INSTRUMENT_PROBE_MEMBER
+#define TJO_INSTRUMENT_PROBE_INIT(CLASS_NAME, obj)
+#define TJO_INSTRUMENT_PROBE_FINISH(count)
+#endif
+
+#endif // TAGGEDJSONINSTRUMENTATION_H
@@ -0,0 +1,198 @@
+#ifndef TAGGEDJSONLAZYOBJECTMACROS_H
+#define TAGGEDJSONLAZYOBJECTMACROS_H
+
+#include "taggedjsonobjectmacros.h"
+#include <array>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+//Splits the (type, name) pair of a member for the macros that take its index as well, the extra level expands the pair before the call
+#define TAGGEDOBJECTMACRO_LAZY_INDEXED(m, index, pair) TAGGEDOBJECTMACRO_LAZY_INDEXED_I(m, index, TAGGEDOBJECTMACRO_MEMBER_TYPE pair, TAGGEDOBJECTMACRO_MEMBER_NAME pair)
+#define TAGGEDOBJECTMACRO_LAZY_INDEXED_I(m, index, type, name) m(index, type, name)
+
+#define TAGGEDOBJECTMACRO_LAZY_DECLARE_CACHE(type, name) mutable std::optional<type> m_cache_##name;
+#define TAGGEDOBJECTMACRO_LAZY_DECLARE_CACHE_UNPACK(pair) TAGGEDOBJECTMACRO_LAZY_DECLARE_CACHE pair
+
+#define TAGGEDOBJECTMACRO_LAZY_ACCESSOR(index, type, name) \
+    const type& name() const\
+    {\
+        if(!m_cache_##name)\
+            m_cache_##name.emplace(loadMember<type>(index, m_checkValues));\
+        return *m_cache_##name;\
+    }\
+    type& name()\
+    {\
+        std::as_const(*this).name();\
+        return *m_cache_##name;\
+    }
+#define TAGGEDOBJECTMACRO_LAZY_ACCESSOR_UNPACK(index, pair) TAGGEDOBJECTMACRO_LAZY_INDEXED(TAGGEDOBJECTMACRO_LAZY_ACCESSOR, index, pair)
+
+#define TAGGEDOBJECTMACRO_LAZY_VALIDATE(index, type, name) \
+    if(!m_cache_##name || !m_checkValues) {\
+        type value = loadMember<type>(index, true);\
+        if(!m_cache_##name)\
+            m_cache_##name.emplace(std::move(value));\
+    }
+#define TAGGEDOBJECTMACRO_LAZY_VALIDATE_UNPACK(index, pair) TAGGEDOBJECTMACRO_LAZY_INDEXED(TAGGEDOBJECTMACRO_LAZY_VALIDATE, index, pair)
+
+#define TAGGEDOBJECTMACRO_LAZY_PREPARE_JSON_OBJECT(index, type, name) ret.insert(jsonKeys()[index], name().toJsonValue());
+#define TAGGEDOBJECTMACRO_LAZY_PREPARE_JSON_OBJECT_UNPACK(index, pair) TAGGEDOBJECTMACRO_LAZY_INDEXED(TAGGEDOBJECTMACRO_LAZY_PREPARE_JSON_OBJECT, index, pair)
+
+namespace TaggedObject {
+    //! Reads the whole file into an owned buffer, the lazy tagged objects keep it as their source
+    inline QByteArray getJSONTextFromFile(const QString& filePath, const bool checkValues)
+    {
+        const JsonFileData file{ filePath };
+        if (!file.isValid()) {
+            if (checkValues)
+                throw(std::runtime_error(file.errorString().toStdString()));
+            return QByteArray();
+        }
+        return QByteArray(file.data(), file.size());
+    }
+};
+
+/*!
+* @brief This macro builds the lazy variant of the class that #TJO_DEFINE_JSON_TAGGED_OBJECT() builds.
+*
+* The arguments are the same as the ones of #TJO_DEFINE_JSON_TAGGED_OBJECT(). Instead of converting every member in the constructor, the lazy class keeps its
+* source and converts each member on the first access, so the construction cost is proportional to the members that are actually used.\n
+* The members are accessed through the accessor methods that have the names of the members, e.g. obj.name() instead of obj.name. The converted members are cached,
+* the mutable accessors can be used for modifying them.\n
+* The source is either a QJsonObject (QJsonObject and QJsonValue constructors) or the JSON text (QByteArray and file path constructors, fromJson()). The JSON text
+* is scanned once in the constructor to find the value of each member, which doesn't allocate anything, and every member is parsed straight from its own part of the
+* text on the first access.\n
+* With checkValues set, a missing or invalid member throws a runtime error on its first access instead of in the constructor. Malformed JSON text still throws in
+* the constructor. validate() checks every member of the source at once with the strict rules, whatever checkValues is, and keeps the members that have already
+* been converted (and possibly modified) as they are.\n
+* CBOR data (fromCbor(), readCbor()) is decoded into a QJsonObject source, only the member conversions are deferred. The CBOR methods need taggedjsoncbor.h.\n
+* The first access of a member modifies the cache, so a lazy object mustn't be accessed concurrently before it has been validated or fully accessed.
+*/
+#define TJO_DEFINE_LAZY_JSON_TAGGED_OBJECT(CLASS_NAME, ...) \
+class CLASS_NAME{\
+private:\
+    static constexpr std::string_view MEMBER_NAMES[] = { MAP_LIST(TAGGEDOBJECTMACRO_FIELD_NAME_UNPACK, __VA_ARGS__) };\
+    static const auto& jsonFieldIndex() { static constexpr auto index = TaggedObject::makeFieldIndex(MAP_LIST(TAGGEDOBJECTMACRO_FIELD_NAME_UNPACK, __VA_ARGS__)); return index; }\
+    static const auto& jsonKeys()\
+    {\
+        static const auto keys = [] {\
+            std::array<QString, std::size(MEMBER_NAMES)> ret;\
+            TaggedObject::fillFieldKeys(ret.data(), MEMBER_NAMES, ret.size());\
+            return ret;\
+        }();\
+        return keys;\
+    }\
+    using MemberSpan = std::pair<qsizetype, qsizetype>;\
+public:\
+    explicit CLASS_NAME() {}\
+    explicit CLASS_NAME(const QJsonObject& obj, const bool checkValues=true) : m_object(obj), m_checkValues(checkValues) {}\
+    explicit CLASS_NAME(const QJsonValue& val, const bool checkValues=true) : CLASS_NAME(val.toObject(), checkValues)\
+    {\
+        if(checkValues && val.isUndefined())\
+            throw(std::runtime_error("Invalid data has been encountered while parsing the json data for " #CLASS_NAME));\
+    }\
+    explicit CLASS_NAME(const QByteArray& json, const bool checkValues=true) : m_text(json), m_fromText(true), m_checkValues(checkValues) { indexText(); }\
+    explicit CLASS_NAME(const QString& filePath, const bool checkValues=true) : CLASS_NAME(TaggedObject::getJSONTextFromFile(filePath, checkValues), checkValues) {}\
+    static CLASS_NAME fromJson(const QByteArray& json, const bool checkValues=true) { return CLASS_NAME(json, checkValues); }\
+    MAP_INDEXED(TAGGEDOBJECTMACRO_LAZY_ACCESSOR_UNPACK, __VA_ARGS__)\
+    void validate() const\
+    {\
+        MAP_INDEXED(TAGGEDOBJECTMACRO_LAZY_VALIDATE_UNPACK, __VA_ARGS__)\
+    }\
+    QJsonObject toJsonObject() const\
+    {\
+        QJsonObject ret;\
+        MAP_INDEXED(TAGGEDOBJECTMACRO_LAZY_PREPARE_JSON_OBJECT_UNPACK, __VA_ARGS__)\
+        return ret;\
+    }\
+    QJsonValue toJsonValue() const { return toJsonObject(); }\
+    QByteArray toJson(const QJsonDocument::JsonFormat format=QJsonDocument::Indented) const\
+    {\
+        return QJsonDocument(toJsonObject()).toJson(format);\
+    }\
+    void readJson(TaggedObject::JsonReader& reader, const bool checkValues=true)\
+    {\
+        const char* data = nullptr;\
+        qsizetype size = 0;\
+        reader.skipValue(data, size);\
+        *this = CLASS_NAME(QByteArray(data, size), checkValues);\
+    }\
+    void writeJson(TaggedObject::JsonWriter& writer) const { writer.writeObject(toJsonObject()); }\
+    template<typename Reader = QCborStreamReader>\
+    static CLASS_NAME fromCbor(const QByteArray& cbor, const bool checkValues=true)\
+    {\
+        Reader reader(cbor);\
+        CLASS_NAME ret;\
+        ret.readCbor(reader, checkValues);\
+        return ret;\
+    }\
+    template<typename Writer = QCborStreamWriter>\
+    QByteArray toCbor() const\
+    {\
+        QByteArray ret;\
+        Writer writer(&ret);\
+        writeCbor(writer);\
+        return ret;\
+    }\
+    template<typename Reader>\
+    void readCbor(Reader& reader, const bool checkValues=true)\
+    {\
+        const QJsonValue value = TaggedObject::readCborValue(reader);\
+        if(TaggedObject::hasCborError(reader)) {\
+            if(checkValues)\
+                throw(std::runtime_error("Malformed CBOR data has been encountered while parsing the cbor data for " #CLASS_NAME));\
+            *this = CLASS_NAME();\
+            return;\
+        }\
+        *this = CLASS_NAME(value.toObject(), checkValues);\
+    }\
+    template<typename Writer>\
+    void writeCbor(Writer& writer) const { TaggedObject::writeCborValue(writer, toJsonValue()); }\
+private:\
+    QJsonObject m_object;\
+    QByteArray m_text;\
+    std::array<MemberSpan, std::size(MEMBER_NAMES)> m_spans{};\
+    bool m_fromText = false;\
+    bool m_checkValues = false;\
+    MAP(TAGGEDOBJECTMACRO_LAZY_DECLARE_CACHE_UNPACK, __VA_ARGS__)\
+    void indexText()\
+    {\
+        TaggedObject::JsonReader reader(m_text);\
+        if(reader.beginObject()) {\
+            std::string_view key;\
+            while(reader.nextKey(key)) {\
+                const int index = jsonFieldIndex().indexOf(key);\
+                const char* data = nullptr;\
+                qsizetype size = 0;\
+                reader.skipValue(data, size);\
+                if(index >= 0)\
+                    m_spans[index] = MemberSpan(data - m_text.constData(), size);\
+            }\
+        }\
+        else\
+            reader.skipValue();\
+        if(!reader.finish()) {\
+            m_spans = {};\
+            if(m_checkValues)\
+                throw(std::runtime_error("Malformed JSON text has been encountered while parsing the json data for " #CLASS_NAME));\
+        }\
+    }\
+    template<typename M>\
+    M loadMember(const std::size_t index, const bool checkValues) const\
+    {\
+        if(!m_fromText)\
+            return M(m_object[jsonKeys()[index]], checkValues);\
+        if(m_spans[index].second == 0) {\
+            if(checkValues)\
+                throw(std::runtime_error("Invalid data has been encountered while parsing the json data for the member " + std::string(MEMBER_NAMES[index])));\
+            return M();\
+        }\
+        TaggedObject::JsonReader reader(m_text.constData() + m_spans[index].first, m_spans[index].second);\
+        M ret;\
+        ret.readJson(reader, checkValues);\
+        return ret;\
+    }\
+};
+
+#endif // TAGGEDJSONLAZYOBJECTMACROS_H
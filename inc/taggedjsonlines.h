@@ -0,0 +1,346 @@
+#ifndef TAGGEDJSONLINES_H
+#define TAGGEDJSONLINES_H
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <QByteArray>
+#include <QIODevice>
+#include <QString>
+#include "taggedjsonreader.h"
+#include "taggedjsonthreadpool.h"
+
+namespace TaggedObject {
+
+//! Settings of JsonLinesReader
+struct JsonLinesOptions
+{
+    //! Number of the parser threads, 0 shares the global pool that uses all of the hardware threads
+    int threadCount = 0;
+
+    //! Number of the lines that are parsed together and delivered as one batch
+    qsizetype batchLines = 1024;
+
+    //! Upper limit of the batches that are read but not delivered yet, which bounds the memory usage. 0 selects twice the thread count.
+    int maxPendingBatches = 0;
+
+    //! If set to true, the batches are delivered in the order of the input. Otherwise they are delivered as soon as they are parsed.
+    bool preserveOrder = true;
+
+    //! If set to true, the lines with missing members are reported as errors as well. Malformed lines are always reported.
+    bool checkValues = true;
+};
+
+//! Line that couldn't be turned into a record
+struct JsonLineError
+{
+    //! Line number in the input, starting from 1
+    qint64 line = 0;
+
+    //! Description of the failure
+    QString message;
+};
+
+/*!
+ * \brief The JsonLinesBatch struct holds the records of consecutive input lines
+ * \tparam T Tagged object type of the records
+ */
+template<typename T>
+struct JsonLinesBatch
+{
+    //! Position of the batch in the input, starting from 0
+    qint64 sequence = 0;
+
+    //! Line number of the first line of the batch, starting from 1
+    qint64 firstLine = 0;
+
+    //! Records of the lines that have been parsed successfully, in input order
+    std::vector<T> records;
+
+    //! Lines of the batch that have failed, in input order
+    std::vector<JsonLineError> errors;
+};
+
+/*!
+ * \class JsonLinesReader
+ * \brief The JsonLinesReader class turns newline-delimited JSON (JSON Lines) into tagged objects on all cores.
+ *
+ * The input, either a QByteArray or a QIODevice, is split into batches of lines on the calling thread. The batches are parsed in the
+ * direct-binding mode (see fromJson() on the classes generated by the #TJO_DEFINE_JSON_TAGGED_OBJECT() macro) by the tasks of a WorkStealingPool.
+ * The parsed batches are handed back to the calling thread, which invokes the batch handler, so the handler doesn't have to be thread safe.\n
+ * At most JsonLinesOptions::maxPendingBatches batches are in flight at any time, so the memory usage doesn't depend on the input size.
+ * Blank lines are skipped and a failing line doesn't stop the reader, it is reported in JsonLinesBatch::errors with its line number.
+ * \tparam T Tagged object type of the records
+ */
+template<typename T>
+class JsonLinesReader
+{
+public:
+    //! Handler of the parsed batches, invoked on the thread that calls read()
+    using BatchHandler = std::function<void(JsonLinesBatch<T>&)>;
+
+    /*!
+     * \brief JsonLinesReader Constructor that takes the settings of the reader
+     * \param options Settings of the reader
+     */
+    explicit JsonLinesReader(const JsonLinesOptions& options = JsonLinesOptions())
+        : m_options(options),
+          m_ownPool(options.threadCount > 0 ? std::make_unique<WorkStealingPool>(options.threadCount) : nullptr)
+    {
+        m_options.batchLines = std::max<qsizetype>(1, m_options.batchLines);
+    }
+
+    /*!
+     * \brief read Parses the given JSON Lines text
+     * \param data The JSON Lines text, which isn't copied
+     * \param handler Handler of the parsed batches
+     */
+    void read(const QByteArray& data, const BatchHandler& handler)
+    {
+        qsizetype position = 0;
+        run([&](QByteArray& chunk, qint64& lineCount) {
+            if (position >= data.size())
+                return false;
+            const qsizetype start = position;
+            lineCount = 0;
+            while (lineCount < m_options.batchLines && position < data.size()) {
+                const void* newLine = std::memchr(data.constData() + position, '\n', static_cast<std::size_t>(data.size() - position));
+                position = newLine ? static_cast<const char*>(newLine) - data.constData() + 1 : data.size();
+                ++lineCount;
+            }
+            chunk = QByteArray::fromRawData(data.constData() + start, position - start);
+            return true;
+        }, handler);
+    }
+
+    /*!
+     * \brief read Parses the JSON Lines text of the given device until its end
+     * \param device Opened, readable device
+     * \param handler Handler of the parsed batches
+     * \return false if the device isn't readable, see errorString()
+     */
+    bool read(QIODevice& device, const BatchHandler& handler)
+    {
+        if (!device.isReadable()) {
+            m_error = QStringLiteral("The device isn't open for reading");
+            return false;
+        }
+        m_error.clear();
+
+        QByteArray pending;
+        qsizetype scanned = 0;
+        bool atEnd = false;
+        run([&](QByteArray& chunk, qint64& lineCount) {
+            lineCount = 0;
+            qsizetype cut = 0;
+            while (true) {
+                while (lineCount < m_options.batchLines) {
+                    const void* newLine = std::memchr(pending.constData() + scanned, '\n', static_cast<std::size_t>(pending.size() - scanned));
+                    if (!newLine) {
+                        scanned = pending.size();
+                        break;
+                    }
+                    scanned = static_cast<const char*>(newLine) - pending.constData() + 1;
+                    cut = scanned;
+                    ++lineCount;
+                }
+                if (lineCount == m_options.batchLines || atEnd)
+                    break;
+
+                const QByteArray block = readBlock(device);
+                if (block.isEmpty()) {
+                    //The last line doesn't need a line break
+                    atEnd = true;
+                    cut = pending.size();
+                }
+                pending += block;
+            }
+            if (cut == 0)
+                return false;
+
+            chunk = pending;
+            pending = pending.mid(cut);
+            chunk.truncate(cut);
+            scanned -= cut;
+            return true;
+        }, handler);
+        return true;
+    }
+
+    /*!
+     * \brief readAll Parses the given JSON Lines text into a single vector
+     * \param data The JSON Lines text
+     * \param errors If not null, receives the failed lines
+     * \return The records, in input order if JsonLinesOptions::preserveOrder is set
+     */
+    std::vector<T> readAll(const QByteArray& data, std::vector<JsonLineError>* errors = nullptr)
+    {
+        std::vector<T> ret;
+        read(data, collector(ret, errors));
+        return ret;
+    }
+
+    /*!
+     * \brief readAll Parses the JSON Lines text of the given device into a single vector
+     * \param device Opened, readable device
+     * \param errors If not null, receives the failed lines
+     * \return The records, in input order if JsonLinesOptions::preserveOrder is set
+     */
+    std::vector<T> readAll(QIODevice& device, std::vector<JsonLineError>* errors = nullptr)
+    {
+        std::vector<T> ret;
+        read(device, collector(ret, errors));
+        return ret;
+    }
+
+    //! Description of the last device failure, empty if there isn't one
+    QString errorString() const { return m_error; }
+
+private:
+    static constexpr qint64 BLOCK_SIZE = 1 << 16;
+
+    //State that is shared with the parser tasks
+    struct Pipeline
+    {
+        std::mutex mutex;
+        std::condition_variable parsed;
+        std::map<qint64, JsonLinesBatch<T>> done;
+    };
+
+    JsonLinesOptions m_options;
+    std::unique_ptr<WorkStealingPool> m_ownPool;
+    QString m_error;
+
+    WorkStealingPool& pool() { return m_ownPool ? *m_ownPool : WorkStealingPool::global(); }
+
+    static QByteArray readBlock(QIODevice& device)
+    {
+        QByteArray block = device.read(BLOCK_SIZE);
+        while (block.isEmpty() && !device.atEnd() && device.waitForReadyRead(-1))
+            block = device.read(BLOCK_SIZE);
+        return block;
+    }
+
+    static BatchHandler collector(std::vector<T>& records, std::vector<JsonLineError>* errors)
+    {
+        return [&records, errors](JsonLinesBatch<T>& batch) {
+            records.insert(records.end(), std::make_move_iterator(batch.records.begin()), std::make_move_iterator(batch.records.end()));
+            if (errors)
+                errors->insert(errors->end(), batch.errors.begin(), batch.errors.end());
+        };
+    }
+
+    static bool isBlank(const char* begin, const char* end)
+    {
+        return std::all_of(begin, end, [](const char c) { return c == ' ' || c == '\t' || c == '\r'; });
+    }
+
+    static void parseChunk(const QByteArray& chunk, const bool checkValues, JsonLinesBatch<T>& batch)
+    {
+        const char* it = chunk.constData();
+        const char* const end = it + chunk.size();
+        for (qint64 line = batch.firstLine; it < end; ++line) {
+            const void* newLine = std::memchr(it, '\n', static_cast<std::size_t>(end - it));
+            const char* lineEnd = newLine ? static_cast<const char*>(newLine) : end;
+            if (!isBlank(it, lineEnd)) {
+                try {
+                    TaggedObject::JsonReader reader(it, lineEnd - it);
+                    T record;
+                    record.readJson(reader, checkValues);
+                    if (reader.finish())
+                        batch.records.push_back(std::move(record));
+                    else
+                        batch.errors.push_back({line, QStringLiteral("Malformed JSON text has been encountered at column %1").arg(reader.offset() + 1)});
+                }
+                catch (const std::exception& e) {
+                    batch.errors.push_back({line, QString::fromUtf8(e.what())});
+                }
+            }
+            it = lineEnd + 1;
+        }
+    }
+
+    //Splits the input with nextChunk on the calling thread, parses the chunks on the pool and delivers them to the handler
+    template<typename NextChunk>
+    void run(NextChunk nextChunk, const BatchHandler& handler)
+    {
+        WorkStealingPool& workers = pool();
+        const int maxPending = m_options.maxPendingBatches > 0 ? m_options.maxPendingBatches : 2 * workers.threadCount();
+        const bool checkValues = m_options.checkValues;
+        const auto pipeline = std::make_shared<Pipeline>();
+
+        qint64 submitted = 0;
+        qint64 delivered = 0;
+        qint64 nextLine = 1;
+        bool hasInput = true;
+
+        //Waits for the next batch to deliver while helping the workers, so a caller on a pool thread can't dead-lock
+        const auto takeParsed = [&]() {
+            while (true) {
+                {
+                    std::unique_lock<std::mutex> lock(pipeline->mutex);
+                    const auto ready = m_options.preserveOrder ? pipeline->done.find(delivered) : pipeline->done.begin();
+                    if (ready != pipeline->done.end()) {
+                        JsonLinesBatch<T> batch = std::move(ready->second);
+                        pipeline->done.erase(ready);
+                        return batch;
+                    }
+                }
+                if (workers.runPendingTask())
+                    continue;
+
+                std::unique_lock<std::mutex> lock(pipeline->mutex);
+                pipeline->parsed.wait(lock, [&] {
+                    return m_options.preserveOrder ? pipeline->done.count(delivered) > 0 : !pipeline->done.empty();
+                });
+            }
+        };
+
+        try {
+            while (hasInput || delivered < submitted) {
+                while (hasInput && submitted - delivered < maxPending) {
+                    QByteArray chunk;
+                    qint64 lineCount = 0;
+                    hasInput = nextChunk(chunk, lineCount);
+                    if (!hasInput)
+                        break;
+
+                    const qint64 sequence = submitted++;
+                    const qint64 firstLine = nextLine;
+                    nextLine += lineCount;
+                    workers.submit([pipeline, chunk, sequence, firstLine, checkValues]() {
+                        JsonLinesBatch<T> batch;
+                        batch.sequence = sequence;
+                        batch.firstLine = firstLine;
+                        parseChunk(chunk, checkValues, batch);
+
+                        std::lock_guard<std::mutex> lock(pipeline->mutex);
+                        pipeline->done.emplace(sequence, std::move(batch));
+                        pipeline->parsed.notify_all();
+                    });
+                }
+
+                if (delivered < submitted) {
+                    JsonLinesBatch<T> batch = takeParsed();
+                    ++delivered;
+                    handler(batch);
+                }
+            }
+        }
+        catch (...) {
+            //The tasks may refer to the input of the caller, they have to finish before the exception leaves
+            for (; delivered < submitted; ++delivered)
+                takeParsed();
+            throw;
+        }
+    }
+};
+
+}
+
+#endif // TAGGEDJSONLINES_H
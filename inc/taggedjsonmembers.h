@@ -0,0 +1,130 @@
+#ifndef TAGGEDJSONMEMBERS_H
+#define TAGGEDJSONMEMBERS_H
+#include <bitset>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <QJsonObject>
+#include <QJsonValue>
+#include "taggedjsonreader.h"
+#include "taggedjsonwriter.h"
+#include "taggedjsonfieldindex.h"
+#include "taggedjsonmergepatch.h"
+#include "taggedjsonassign.h"
+#include "taggedjsonfields.h"
+
+/*!
+ * Member-wise operations of the classes generated by the #TJO_DEFINE_JSON_TAGGED_OBJECT() macro.\n
+ * The macro only expands the declarations that need the names of the members (the members themselves, the field descriptors and the constructors).
+ * Everything else is expanded from the field descriptors by the variadic templates of GeneratedMembers, which is much cheaper to compile than
+ * expanding every operation with the preprocessor. The pointers-to-member are constant expressions, so the generated code is the same as if the
+ * operations were spelled out member by member. The CBOR and validation counterparts (CborMembers and ValidationMembers) are in the opt-in headers
+ * taggedjsoncbor.h and taggedjsonvalidation.h.
+ */
+namespace TaggedObject {
+
+    template<typename C, typename Indices>
+    struct GeneratedMembersBase;
+
+    template<typename C, std::size_t... I>
+    struct GeneratedMembersBase<C, std::index_sequence<I...>>
+    {
+        using JsonBinder = void (*)(C&, JsonReader&, const bool, const bool);
+        using ValueBinder = void (*)(C&, const QJsonValue&, const bool);
+        using JsonMemberWriter = void (*)(const C&, JsonWriter&);
+        using Resetter = void (*)(C&);
+
+        //! Descriptor of the member with the declaration index J
+        template<std::size_t J>
+        static constexpr const auto& field() { return fieldAt<J>(fieldList<C>); }
+
+        //! Type of the member with the declaration index J
+        template<std::size_t J>
+        using FieldType = typename std::remove_reference_t<decltype(fieldAt<J>(fieldList<C>))>::Type;
+
+        //! Source is a QJsonObject or a QJsonValue holding one, the values are looked up without copying the object out of the value
+        template<typename Source>
+        static void assign(C& self, const Source& source, const bool checkValues)
+        {
+            const auto& keys = fieldKeys<C>();
+            (assignMember(self.*(field<I>().member), source[keys[I]], checkValues), ...);
+        }
+
+        static QJsonObject toJsonObject(const C& self)
+        {
+            const auto& keys = fieldKeys<C>();
+            QJsonObject ret;
+            (ret.insert(keys[I], QJsonValue((self.*(field<I>().member)).toJsonValue())), ...);
+            return ret;
+        }
+
+#ifdef TJO_ENABLE_MODIFICATION_TRACKING
+        //! Adds the changes since the baseline to the patch, see appendMemberPatch()
+        static void appendPatch(const C& self, const QJsonObject& baseline, const bool stale, QJsonObject& patch)
+        {
+            const auto& keys = fieldKeys<C>();
+            (appendMemberPatch(patch, keys[I], self.*(field<I>().member), baseline, stale), ...);
+        }
+
+        //! Takes the current values into the baseline, returns false if it is known to be unchanged (see commitMember())
+        static bool commit(C& self, QJsonObject& baseline, const bool stale)
+        {
+            const auto& keys = fieldKeys<C>();
+            return (false | ... | commitMember(keys[I], self.*(field<I>().member), baseline, stale));
+        }
+#endif
+
+        //! Throws a runtime error that names the first member that hasn't been found by a parser
+        static void throwIfMissing(const std::bitset<sizeof...(I)>& found)
+        {
+            if (found.all())
+                return;
+            for (std::size_t i = 0; i < found.size(); ++i) {
+                if (!found.test(i))
+                    throw(std::runtime_error("Invalid data has been encountered while parsing the json data for the member " + std::string(fieldIndex<C>.name(i))));
+            }
+        }
+
+        template<std::size_t J>
+        static void readMemberAt(C& self, JsonReader& reader, const bool checkValues, const bool replace)
+        {
+            readMember(self.*(field<J>().member), reader, checkValues, replace);
+        }
+
+        template<std::size_t J>
+        static void bindMemberAt(C& self, const QJsonValue& value, const bool checkValues)
+        {
+            bindMember(self.*(field<J>().member), value, checkValues);
+        }
+
+        template<std::size_t J>
+        static void writeJsonAt(const C& self, JsonWriter& writer)
+        {
+            writer.key(field<J>().name);
+            (self.*(field<J>().member)).writeJson(writer);
+        }
+
+        template<std::size_t J>
+        static void resetAt(C& self) { resetMember(self.*(field<J>().member)); }
+
+        static constexpr JsonBinder jsonBinders[] = { &readMemberAt<I>... };
+        static constexpr ValueBinder valueBinders[] = { &bindMemberAt<I>... };
+        static constexpr JsonMemberWriter jsonWriters[] = { &writeJsonAt<I>... };
+        static constexpr Resetter resetters[] = { &resetAt<I>... };
+    };
+
+    /*!
+     * \brief The GeneratedMembers struct expands the member-wise operations of the tagged object C from its field descriptors
+     *
+     * The folds go through the members in declaration order. The tables hold one function per member in declaration order as well, the parsers
+     * index them with the perfect hash of the member names and the writers walk them in the sorted key order. The class may still be incomplete
+     * where GeneratedMembers<C> is named, the descriptors are only evaluated when a member of it is used.
+     */
+    template<typename C>
+    struct GeneratedMembers : GeneratedMembersBase<C, std::make_index_sequence<fieldCount<C>>> {};
+}
+
+#endif // TAGGEDJSONMEMBERS_H
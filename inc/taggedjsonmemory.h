@@ -0,0 +1,58 @@
+#ifndef TAGGEDJSONMEMORY_H
+#define TAGGEDJSONMEMORY_H
+#include <memory_resource>
+
+namespace TaggedObject {
+
+    //! Storage of the memory resource of the calling thread, see MemoryResourceScope
+    inline std::pmr::memory_resource*& scopedMemoryResource()
+    {
+        static thread_local std::pmr::memory_resource* resource = nullptr;
+        return resource;
+    }
+
+    //! Returns true if a MemoryResourceScope is active on the calling thread
+    inline bool hasMemoryResourceScope() { return scopedMemoryResource() != nullptr; }
+
+    //! Memory resource the allocator-aware tagged types of the calling thread allocate from, the default resource if no scope is active
+    inline std::pmr::memory_resource* memoryResource()
+    {
+        std::pmr::memory_resource* const resource = scopedMemoryResource();
+        return resource ? resource : std::pmr::get_default_resource();
+    }
+
+    /*!
+     * \class MemoryResourceScope
+     * \brief The MemoryResourceScope class selects the memory resource of the allocator-aware tagged types on the calling thread.
+     *
+     * The tagged objects are constructed by the generated constructors and parse functions, which have no allocator parameter. Instead, the
+     * allocator-aware members (see TaggedJSONPmrArray) pick the resource of the innermost scope when they are constructed and keep it for their
+     * lifetime, so the whole tree parsed inside the scope allocates from the same resource, nested members included.\n
+     * With a std::pmr::monotonic_buffer_resource, a parsed request can be released in one shot. The objects mustn't outlive the resource.
+     * Copies get the default resource and are safe to keep, moves keep the resource of their source.\n
+     * The standard memory resources aren't thread-safe, so the arrays that are parsed inside a scope don't use the parallel array mode.
+     * Scopes nest, a scope restores the previous resource when it ends. A scope of nullptr selects the default resource until it ends.
+     */
+    class MemoryResourceScope
+    {
+    public:
+        /*!
+         * \brief MemoryResourceScope Selects the given resource until the end of the scope
+         * \param resource Resource to allocate from, it has to outlive every object that allocates from it. nullptr selects the default resource
+         */
+        explicit MemoryResourceScope(std::pmr::memory_resource* resource) : m_previous(scopedMemoryResource())
+        {
+            scopedMemoryResource() = resource;
+        }
+
+        MemoryResourceScope(const MemoryResourceScope&) = delete;
+        MemoryResourceScope& operator=(const MemoryResourceScope&) = delete;
+
+        ~MemoryResourceScope() { scopedMemoryResource() = m_previous; }
+
+    private:
+        std::pmr::memory_resource* m_previous;
+    };
+}
+
+#endif // TAGGEDJSONMEMORY_H
@@ -0,0 +1,267 @@
+#ifndef TAGGEDJSONMERGEPATCH_H
+#define TAGGEDJSONMERGEPATCH_H
+#include <type_traits>
+#include <utility>
+#include <QJsonObject>
+#include <QJsonValue>
+#include <QString>
+#include "taggedjsoninstrumentation.h"
+
+/*!
+ * Modification tracking of the tagged objects and the JSON Merge Patch (RFC 7386) helpers.\n
+ * The tracking is opt-in: it is only compiled in if TJO_ENABLE_MODIFICATION_TRACKING is defined, the same way in every translation unit of the
+ * program. Without it the member types carry no flag, the generated classes carry no baseline and they have no toMergePatch(), isModified(),
+ * updateJsonObject() or clearModified(). createMergePatch() and applyMergePatch() work on QJsonObjects either way.\n
+ * With it, the member types flag themselves as modified on assignment, set() and mutable access (see ModificationTracking). Parsing doesn't flag
+ * them, the generated classes mark their own baseline as stale instead when they are read or assigned from JSON or CBOR, so every member is compared
+ * once. The classes build their merge patches against a baseline (see JsonObjectCache) that only clearModified() and updateJsonObject() advance.
+ * A flagged member is serialized and compared with the baseline, an unflagged one is skipped, so a member that has only been read through a
+ * mutable accessor costs a comparison but never ends up in the patch. The member types that don't track modifications are compared on every call.
+ * Building a patch doesn't change the object, so the const methods can be called from several threads at once.\n
+ * toJsonObject() always serializes the whole object. Only updateJsonObject() reuses the baseline, it serializes the flagged members into it and
+ * returns it.
+ */
+namespace TaggedObject {
+
+#ifdef TJO_ENABLE_MODIFICATION_TRACKING
+    /*!
+     * \class ModificationTracking
+     * \brief The ModificationTracking class holds the modification flag of TaggedJSONObject, TaggedJSONArray, TaggedJSONPmrArray and TaggedJSONShared.
+     *
+     * Without TJO_ENABLE_MODIFICATION_TRACKING it is an empty base, so the members are as large as their values and markModified() compiles to nothing.
+     */
+    class ModificationTracking
+    {
+    public:
+        //! Returns true if the value has been assigned or accessed mutably since the last clearModified() call
+        bool isModified() const { return m_modified; }
+
+        //! Marks the value as unmodified, the tagged objects call it when they take their baseline (see JsonObjectCache)
+        void clearModified() { m_modified = false; }
+
+    protected:
+        void markModified() { m_modified = true; }
+
+    private:
+        bool m_modified = false;
+    };
+#else
+    class ModificationTracking
+    {
+    protected:
+        void markModified() {}
+    };
+#endif
+
+    //! Detects the member types that track their modifications
+    template<typename M, typename = void>
+    struct HasModificationTracking : std::false_type {};
+
+    template<typename M>
+    struct HasModificationTracking<M, std::void_t<decltype(std::declval<const M&>().isModified()), decltype(std::declval<M&>().clearModified())>>
+        : std::true_type {};
+
+    template<typename C>
+    struct GeneratedMembers;
+
+    inline void appendMergePatch(QJsonObject& patch, const QString& key, const QJsonValue& before, const QJsonValue& after);
+
+    /*!
+     * \brief createMergePatch Builds the JSON Merge Patch that turns one object into the other
+     *
+     * Removed keys are set to null. Nested objects are patched recursively, every other value (arrays included) is replaced as a whole.
+     * RFC 7386 can't set a value to null, so null values of the target object end up as removed keys after the patch has been applied.
+     * \param before The object the patch is applied to
+     * \param after The object the patch has to produce
+     * \return The patch, empty if the objects are equal
+     */
+    inline QJsonObject createMergePatch(const QJsonObject& before, const QJsonObject& after)
+    {
+        QJsonObject patch;
+        for (auto it = before.constBegin(); it != before.constEnd(); ++it) {
+            if (!after.contains(it.key()))
+                patch.insert(it.key(), QJsonValue(QJsonValue::Null));
+        }
+        for (auto it = after.constBegin(); it != after.constEnd(); ++it)
+            appendMergePatch(patch, it.key(), before.value(it.key()), it.value());
+        return patch;
+    }
+
+    /*!
+     * \brief appendMergePatch Adds the change of a single key to a merge patch
+     * \param patch The patch to extend
+     * \param key Key of the value
+     * \param before Previous value, undefined if the key didn't exist
+     * \param after Current value, undefined if the key has been removed
+     */
+    inline void appendMergePatch(QJsonObject& patch, const QString& key, const QJsonValue& before, const QJsonValue& after)
+    {
+        if (after.isUndefined()) {
+            if (!before.isUndefined())
+                patch.insert(key, QJsonValue(QJsonValue::Null));
+        }
+        else if (before.isObject() && after.isObject()) {
+            QJsonObject nested = createMergePatch(before.toObject(), after.toObject());
+            if (!nested.isEmpty())
+                patch.insert(key, nested);
+        }
+        else if (before != after)
+            patch.insert(key, after);
+    }
+
+    /*!
+     * \brief applyMergePatch Applies a JSON Merge Patch as described in RFC 7386
+     * \param target The value to patch
+     * \param patch The patch, a value other than an object replaces the target
+     * \return The patched value
+     */
+    inline QJsonValue applyMergePatch(const QJsonValue& target, const QJsonValue& patch)
+    {
+        if (!patch.isObject())
+            return patch;
+
+        QJsonObject result = target.toObject();
+        const QJsonObject patchObject = patch.toObject();
+        for (auto it = patchObject.constBegin(); it != patchObject.constEnd(); ++it) {
+            if (it.value().isNull())
+                result.remove(it.key());
+            else
+                result.insert(it.key(), applyMergePatch(result.value(it.key()), it.value()));
+        }
+        return result;
+    }
+
+#ifdef TJO_ENABLE_MODIFICATION_TRACKING
+    /*!
+     * \class JsonObjectCache
+     * \brief The JsonObjectCache class keeps the baseline of the merge patches of a tagged object.
+     *
+     * The baseline is the QJsonObject the object has been serialized to at the last clearModified() or updateJsonObject() call, it's empty until
+     * then. It's only updated by those non-const methods, one modified member at a time, so an object that never calls them carries an empty
+     * object and the const methods never write to it.\n
+     * Copies take over the baseline of their source, which matches their members. Assignments keep the baseline of the destination and mark it
+     * as stale, so every member is compared on the next patch. Reading the object from JSON or CBOR marks it as replaced, which the enclosing
+     * objects see as well: their next patch compares every member of this one, and their next update clears the mark.
+     */
+    class JsonObjectCache
+    {
+    public:
+        JsonObjectCache() = default;
+        JsonObjectCache(const JsonObjectCache&) = default;
+        JsonObjectCache(JsonObjectCache&&) noexcept = default;
+        JsonObjectCache& operator=(const JsonObjectCache&) { m_stale = true; return *this; }
+        JsonObjectCache& operator=(JsonObjectCache&&) noexcept { m_stale = true; return *this; }
+
+        //! Returns true if every member has to be compared with the baseline, which is the case until the first update, after assignments and reads
+        bool isStale() const { return m_stale || m_replaced; }
+
+        //! Returns true if the members have been read since the last update of the object or of an enclosing object
+        bool isReplaced() const { return m_replaced; }
+
+        //! Marks the members as read as a whole, their modification flags aren't set by the parsers
+        void invalidate() { m_replaced = true; }
+
+        //! The baseline
+        const QJsonObject& object() const { return m_object; }
+
+        //! Mutable baseline, the update of the members goes through it and ends with finishUpdate()
+        QJsonObject& object() { return m_object; }
+
+        //! Ends the update of all members
+        void finishUpdate() { m_stale = false; m_replaced = false; }
+
+        //! Ends an update of an enclosing object, which only covers the replacement, this baseline stays as it is
+        void finishEnclosingUpdate() { m_replaced = false; }
+
+    private:
+        QJsonObject m_object;
+        bool m_stale = true;
+        bool m_replaced = false;
+    };
+
+    //! Gives the helpers access to the baseline of the tagged objects, which the generated classes keep private
+    struct JsonCacheAccess
+    {
+        template<typename C>
+        static const JsonObjectCache& of(const C& object) { return object.m_jsonCache; }
+
+        template<typename C>
+        static JsonObjectCache& of(C& object) { return object.m_jsonCache; }
+    };
+
+    /*!
+     * \brief appendMemberPatch Adds the change of a member since the baseline to a merge patch
+     *
+     * Nested tagged objects are compared member by member with their part of the baseline.
+     * \param patch The patch to extend
+     * \param key JSON key of the member
+     * \param member The member
+     * \param baseline The object that holds the baseline value of the member
+     * \param stale If set to true, the modification flags aren't trusted and every member is compared
+     */
+    template<typename M>
+    void appendMemberPatch(QJsonObject& patch, const QString& key, const M& member, const QJsonObject& baseline, const bool stale)
+    {
+        if constexpr (HasTaggedClassName<M>::value) {
+            const QJsonValue before = baseline.value(key);
+            if (before.isObject()) {
+                QJsonObject nested;
+                GeneratedMembers<M>::appendPatch(member, before.toObject(), stale || JsonCacheAccess::of(member).isReplaced(), nested);
+                if (!nested.isEmpty())
+                    patch.insert(key, nested);
+                return;
+            }
+        }
+        else if constexpr (HasModificationTracking<M>::value) {
+            if (!stale && !member.isModified())
+                return;
+        }
+        appendMergePatch(patch, key, baseline.value(key), QJsonValue(member.toJsonValue()));
+    }
+
+    /*!
+     * \brief commitMember Takes the current value of a member into the baseline and clears its modification flags
+     * \param key JSON key of the member
+     * \param member The member
+     * \param baseline The object that holds the baseline value of the member
+     * \param stale If set to true, the modification flags aren't trusted and every member is compared
+     * \return False if the baseline is known to be unchanged
+     */
+    template<typename M>
+    bool commitMember(const QString& key, M& member, QJsonObject& baseline, const bool stale)
+    {
+        if constexpr (HasTaggedClassName<M>::value) {
+            const QJsonValue before = baseline.value(key);
+            QJsonObject nested = before.toObject();
+            //A nested object that has been read as a whole is compared member by member, its own baseline isn't touched
+            JsonObjectCache& cache = JsonCacheAccess::of(member);
+            const bool replaced = cache.isReplaced();
+            cache.finishEnclosingUpdate();
+            if (!GeneratedMembers<M>::commit(member, nested, stale || replaced || !before.isObject()) && before.isObject())
+                return false;
+            baseline.insert(key, nested);
+            return true;
+        }
+        else {
+            //The modified members are taken as they are, the members without tracking are compared first
+            if constexpr (HasModificationTracking<M>::value) {
+                if (!stale && !member.isModified())
+                    return false;
+                member.clearModified();
+            }
+            const QJsonValue value = member.toJsonValue();
+            if constexpr (!HasModificationTracking<M>::value) {
+                if (value == baseline.value(key))
+                    return false;
+            }
+            if (value.isUndefined())
+                baseline.remove(key);
+            else
+                baseline.insert(key, value);
+            return true;
+        }
+    }
+#endif
+}
+
+#endif // TAGGEDJSONMERGEPATCH_H
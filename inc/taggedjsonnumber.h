@@ -0,0 +1,238 @@
+#ifndef TAGGEDJSONNUMBER_H
+#define TAGGEDJSONNUMBER_H
+#include <charconv>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <QtGlobal>
+#include <QByteArray>
+#include <QLocale>
+#include <QJsonValue>
+
+/*!
+ * Numeric kernel of the direct-binding parse and the direct serialization.\n
+ * Number text is converted with std::from_chars and std::to_chars, without Qt's locale-aware conversions in between. Integers are parsed straight into
+ * their target type, so 64-bit members keep their full precision instead of going through a double. Doubles are written with the shortest representation
+ * that round-trips, in the same layout QJsonDocument uses. Standard libraries without the floating point overloads of std::from_chars and std::to_chars
+ * fall back to Qt's conversions.
+ */
+namespace TaggedObject {
+
+    /*!
+     * \brief parseJsonInteger Parses the text of a JSON integer ("-"? digits) exactly
+     * \param first Start of the text
+     * \param last End of the text
+     * \param out Receives the value
+     * \return false if the text isn't an integer within the range of T, out is left as it is then
+     */
+    template<typename T>
+    bool parseJsonInteger(const char* first, const char* last, T& out)
+    {
+        T value;
+        const std::from_chars_result result = std::from_chars(first, last, value);
+        if (result.ec != std::errc() || result.ptr != last)
+            return false;
+        out = value;
+        return true;
+    }
+
+    /*!
+     * \brief parseJsonDouble Parses the text of a JSON number, which has already been validated
+     * \param first Start of the text
+     * \param last End of the text
+     * \return The nearest double, infinity if the value is out of range
+     */
+    inline double parseJsonDouble(const char* first, const char* last)
+    {
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+        double value = 0;
+        const std::from_chars_result result = std::from_chars(first, last, value);
+        if (result.ec == std::errc::result_out_of_range)
+            //Same result as strtod: overflow is infinity and underflow is zero
+            return std::strtod(std::string(first, last).c_str(), nullptr);
+        return value;
+#else
+        return QByteArray::fromRawData(first, last - first).toDouble();
+#endif
+    }
+
+    /*!
+     * \brief integralFromDouble Converts a double that holds an integral value within the range of T
+     * \param value The double
+     * \param out Receives the value
+     * \return false if the value has a fraction or doesn't fit in T, out is left as it is then
+     */
+    template<typename T>
+    bool integralFromDouble(const double value, T& out)
+    {
+        //The maximum of the 64-bit types rounds up to a power of two, which is already out of range
+        if (!(value >= static_cast<double>(std::numeric_limits<T>::min()) && value < static_cast<double>(std::numeric_limits<T>::max()) + 1.0))
+            return false;
+        if (std::trunc(value) != value)
+            return false;
+        out = static_cast<T>(value);
+        return true;
+    }
+
+    /*!
+     * \brief integralFromJsonValue Converts a QJsonValue that holds an integral value within the range of T
+     *
+     * Qt 6 keeps the integers of a QJsonValue apart from the doubles, so 64-bit values are converted exactly.
+     * \param val The value
+     * \param out Receives the value
+     * \return false if the value isn't a number, has a fraction or doesn't fit in T, out is left as it is then
+     */
+    template<typename T>
+    bool integralFromJsonValue(const QJsonValue& val, T& out)
+    {
+        if (!val.isDouble())
+            return false;
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+        if constexpr (sizeof(T) > sizeof(int)) {
+            //The minimum is the marker of the values that aren't stored as integers, the double conversion below is exact for it
+            constexpr qint64 notInteger = std::numeric_limits<qint64>::min();
+            const qint64 integer = val.toInteger(notInteger);
+            if (integer != notInteger) {
+                if constexpr (std::is_unsigned_v<T>) {
+                    if (integer < 0)
+                        return false;
+                }
+                out = static_cast<T>(integer);
+                return true;
+            }
+        }
+#endif
+        return integralFromDouble(val.toDouble(), out);
+    }
+
+    /*!
+     * \brief jsonValueToIntegral Converts a QJsonValue into the integral type T
+     *
+     * Same rule as QJsonValue::toInt() for every integral type: integral values within the range of T are converted, anything else is 0
+     * (see integralFromJsonValue()).
+     */
+    template<typename T>
+    T jsonValueToIntegral(const QJsonValue& val)
+    {
+        T ret = T();
+        integralFromJsonValue(val, ret);
+        return ret;
+    }
+
+    //! Returns false if the conversion of the value into T falls back to the default value, the validation and the instrumentation use it
+    template<typename T>
+    bool matchesJsonType(const QJsonValue& val)
+    {
+        if constexpr (std::is_same_v<T, bool>)
+            return val.isBool();
+        else if constexpr (std::is_integral_v<T>) {
+            //The conversion itself decides, so only the values that it doesn't turn into 0 are accepted
+            T value = T();
+            return integralFromJsonValue(val, value);
+        }
+        else if constexpr (std::is_floating_point_v<T>)
+            return val.isDouble();
+        else if constexpr (std::is_same_v<T, QJsonObject>)
+            return val.isObject();
+        else if constexpr (std::is_same_v<T, QString>)
+            return val.isString();
+        else
+            return true;
+    }
+
+    //! Builds the QJsonValue of an integral value, unsigned values beyond the qint64 range can only be stored as a double
+    template<typename T>
+    QJsonValue integralToJsonValue(const T value)
+    {
+        if constexpr (std::is_unsigned_v<T> && sizeof(T) >= sizeof(qint64)) {
+            if (value > static_cast<T>(std::numeric_limits<qint64>::max()))
+                return QJsonValue(static_cast<double>(value));
+        }
+        return QJsonValue(static_cast<qint64>(value));
+    }
+
+    //! Appends the decimal text of an integer
+    template<typename T>
+    void appendJsonInteger(QByteArray& out, const T value)
+    {
+        char buffer[24];
+        const std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        out.append(buffer, static_cast<qsizetype>(result.ptr - buffer));
+    }
+
+    /*!
+     * \brief appendJsonDouble Appends the shortest text of a finite double that round-trips
+     *
+     * The layout is the one of QByteArray::number(value, 'g', QLocale::FloatingPointShortest), which QJsonDocument uses in Qt 6: the decimal form
+     * unless the exponent form is shorter, at least two exponent digits ("1e+20", "1.5e-07", "0.0001", "123.25").
+     */
+    inline void appendJsonDouble(QByteArray& out, const double value)
+    {
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+        //The shortest scientific form gives the significant digits and the exponent: "-d.ddde-XX"
+        char scientific[32];
+        const char* const end = std::to_chars(scientific, scientific + sizeof(scientific), value, std::chars_format::scientific).ptr;
+        const char* it = scientific;
+        const bool negative = *it == '-';
+        if (negative)
+            ++it;
+
+        char digits[20];
+        int digitCount = 0;
+        for (; *it != 'e'; ++it) {
+            if (*it != '.')
+                digits[digitCount++] = *it;
+        }
+        int exponent = 0;
+        std::from_chars(*(it + 1) == '+' ? it + 2 : it + 1, end, exponent);
+
+        //Position of the decimal point relative to the digits, the same decision QLocale makes for the shortest 'g' form
+        const int decimalPoint = exponent + 1;
+        const bool useDecimal = decimalPoint <= 0 ? 1 - decimalPoint <= 4 : decimalPoint <= digitCount + 4;
+
+        char buffer[48];
+        char* cur = buffer;
+        if (negative)
+            *cur++ = '-';
+        if (useDecimal) {
+            if (decimalPoint <= 0) {
+                *cur++ = '0';
+                *cur++ = '.';
+                for (int i = decimalPoint; i < 0; ++i)
+                    *cur++ = '0';
+                for (int i = 0; i < digitCount; ++i)
+                    *cur++ = digits[i];
+            }
+            else {
+                for (int i = 0; i < digitCount || i < decimalPoint; ++i) {
+                    if (i == decimalPoint)
+                        *cur++ = '.';
+                    *cur++ = i < digitCount ? digits[i] : '0';
+                }
+            }
+        }
+        else {
+            *cur++ = digits[0];
+            if (digitCount > 1) {
+                *cur++ = '.';
+                for (int i = 1; i < digitCount; ++i)
+                    *cur++ = digits[i];
+            }
+            *cur++ = 'e';
+            *cur++ = exponent < 0 ? '-' : '+';
+            const int absolute = std::abs(exponent);
+            if (absolute < 10)
+                *cur++ = '0';
+            cur = std::to_chars(cur, buffer + sizeof(buffer), absolute).ptr;
+        }
+        out.append(buffer, static_cast<qsizetype>(cur - buffer));
+#else
+        out += QByteArray::number(value, 'g', QLocale::FloatingPointShortest);
+#endif
+    }
+}
+
+#endif // TAGGEDJSONNUMBER_H
@@ -2,6 +2,11 @@
 #define TAGGEDJSONOBJECT_H
 #include <QJsonObject>
 #include <QJsonArray>
+#include "taggedjsonreader.h"
+#include "taggedjsonwriter.h"
+#include "taggedjsonforward.h"
+#include "taggedjsoninstrumentation.h"
+#include "taggedjsonmergepatch.h"
 
 //! All types that can be encapsulated in QJsonObject
 #define TJO_JSON_COMPATIBLE std::is_arithmetic_v<T> || std::is_same_v<T, QJsonValue> || std::is_same_v<T, QJsonObject>|| std::is_same_v<T, QString> || std::is_same_v<T, QVariant>
@@ -16,7 +21,7 @@
  * TaggedJSONObject can store all types of data JSON format accepts.
  */
 template <typename T, typename=std::enable_if_t<TJO_JSON_COMPATIBLE>>
-class TaggedJSONObject
+class TaggedJSONObject : public TaggedObject::ModificationTracking
 {
 public:
     //! Default constructor, which is useful if the parameters planned to be filled later
@@ -34,11 +39,20 @@ public:
     template<typename V, typename = std::enable_if_t<std::is_convertible_v<V, T>>>
     TaggedJSONObject(V&& val) : m_value(std::forward<V>(val)) {};
 
+    TaggedJSONObject(const TaggedJSONObject&) = default;
+    TaggedJSONObject(TaggedJSONObject&&) = default;
+
+    //! Copy assignment, the value counts as modified
+    TaggedJSONObject& operator=(const TaggedJSONObject& other) {m_value = other.m_value; markModified(); return *this;};
+
+    //! Move assignment, the value counts as modified
+    TaggedJSONObject& operator=(TaggedJSONObject&& other) {m_value = std::move(other.m_value); markModified(); return *this;};
+
     /*!
-     * \brief l-value reference getter for the contained object
+     * \brief l-value reference getter for the contained object, the value counts as modified
      * \return The l-value reference of the contained object
      */
-    T& get() {return m_value;};
+    T& get() {markModified(); return m_value;};
 
     /*!
      * \brief const reference getter for the contained object
@@ -52,14 +66,14 @@ public:
      * \return Modified instance of this class
      */
     template<typename V, typename=std::enable_if_t<std::is_convertible_v<V, T>>>
-    TaggedJSONObject& operator=(V&& val) {m_value = std::forward<V>(val); return *this;};
+    TaggedJSONObject& operator=(V&& val) {m_value = std::forward<V>(val); markModified(); return *this;};
 
     /*!
      * \brief set Setter for the contained object
      * \param val Value to set
      */
     template<typename V, typename= std::enable_if_t<std::is_convertible_v<V, T>>>
-    void set(V&& val) {m_value = std::forward<V>(val);};
+    void set(V&& val) {m_value = std::forward<V>(val); markModified();};
 
     //Assignment shortcuts
     bool operator!=(const T& other) const {return m_value != other;};
@@ -68,10 +82,10 @@ public:
     bool operator==(const TaggedJSONObject<T>& other) const { return m_value == other.m_value; };
 
     /*!
-     * \brief operator * l-value getter for the contained object
+     * \brief operator * l-value getter for the contained object, the value counts as modified
      * \return The l-value reference of the contained object
      */
-    T& operator*() {return m_value;};
+    T& operator*() {markModified(); return m_value;};
 
     /*!
      * \brief operator * const reference getter for the contained object
@@ -90,7 +104,7 @@ public:
     QJsonValue operator[](const QString& key) const { return m_value[key]; };
 
     template<typename S = T, typename = std::enable_if_t<std::is_same_v<S, QJsonObject>>>
-    QJsonValueRef operator[](const QString& key) { return m_value[key]; };
+    QJsonValueRef operator[](const QString& key) { markModified(); return m_value[key]; };
 
     template<typename S = T, typename = std::enable_if_t<std::is_same_v<S, QJsonValue>>>
     QJsonValue operator[](const qsizetype i) const { return m_value[i]; };
@@ -103,7 +117,93 @@ public:
             return QString(m_value);
     };
 
-    QJsonValue toJsonValue() const {return QJsonValue{m_value};}
+    QJsonValue toJsonValue() const
+    {
+        if constexpr(std::is_integral_v<T> && !std::is_same_v<T, bool>)
+            return TaggedObject::integralToJsonValue(m_value);
+        else
+            return QJsonValue{m_value};
+    }
+
+    //! Error-collecting counterpart of the checkValue validation, reports a missing value or a value of another type
+    static void validateJson(const QJsonValue& val, TaggedObject::ValidationContext& context) {TaggedObject::validateJsonValue<T>(val, context);}
+
+
+    /*!
+     * \brief readJson Direct-binding counterpart of the QJsonValue constructor, converts the value the reader is positioned on.
+     * \param reader JSON reader positioned on the value of this member
+     * \param checkValue Unused, the value exists if the reader is positioned on it. Kept for the uniform member interface.
+     */
+    void readJson(TaggedObject::JsonReader& reader, const bool checkValue=true)
+    {
+        Q_UNUSED(checkValue)
+        if constexpr(std::is_same_v<T, QString>) {
+            //Decoded into the stored string, reading into an existing object keeps its buffer
+            if(reader.peek() == TaggedObject::JsonReader::Token::String)
+                reader.readString(m_value);
+            else {
+                reader.skipValue();
+                m_value = QString();
+            }
+        }
+        else
+            m_value = readValue(reader);
+    }
+
+    /*!
+     * \brief writeJson Direct serialization counterpart of toJsonValue(), writes the value as JSON text.
+     * \param writer JSON writer positioned where the value of this member belongs
+     */
+    void writeJson(TaggedObject::JsonWriter& writer) const
+    {
+        if constexpr(std::is_same_v<T, bool>)
+            writer.writeBool(m_value);
+        else if constexpr(std::is_integral_v<T> && std::is_unsigned_v<T>)
+            writer.writeUnsignedInteger(m_value);
+        else if constexpr(std::is_integral_v<T>)
+            writer.writeInteger(m_value);
+        else if constexpr(std::is_floating_point_v<T>)
+            writer.writeDouble(m_value);
+        else if constexpr(std::is_same_v<T, QString>)
+            writer.writeString(m_value);
+        else if constexpr(std::is_same_v<T, QJsonObject>)
+            writer.writeObject(m_value);
+        else
+            writer.writeValue(toJsonValue());
+    }
+
+    /*!
+     * \brief readCbor CBOR counterpart of readJson(), converts the value the reader is positioned on.
+     * \param reader CBOR reader positioned on the value of this member
+     * \param checkValue Unused, the value exists if the reader is positioned on it. Kept for the uniform member interface.
+     */
+    template<typename Reader>
+    void readCbor(Reader& reader, const bool checkValue=true)
+    {
+        Q_UNUSED(checkValue)
+        m_value = readValue(reader);
+    }
+
+    /*!
+     * \brief writeCbor CBOR counterpart of writeJson(), integers are written as CBOR integers and doubles as CBOR doubles.
+     * \param writer CBOR writer positioned where the value of this member belongs
+     */
+    template<typename Writer>
+    void writeCbor(Writer& writer) const
+    {
+        if constexpr(std::is_same_v<T, bool>)
+            writer.append(m_value);
+        else if constexpr(std::is_integral_v<T> && std::is_unsigned_v<T>)
+            writer.append(static_cast<quint64>(m_value));
+        else if constexpr(std::is_integral_v<T>)
+            writer.append(static_cast<qint64>(m_value));
+        else if constexpr(std::is_floating_point_v<T>)
+            writer.append(static_cast<double>(m_value));
+        else if constexpr(std::is_same_v<T, QString>)
+            writer.append(m_value);
+        else
+            TaggedObject::writeCborValue(writer, toJsonValue());
+    }
 
 private:
     T m_value;
@@ -117,10 +217,15 @@ private:
         if(checkValue && val.isUndefined())
             throw(std::runtime_error("Invalid data has been encountered while parsing the json data for TaggedJSONObject"));
 
+#ifdef TJO_ENABLE_INSTRUMENTATION
+        if(!val.isUndefined() && !TaggedObject::matchesJsonType<T>(val))
+            TaggedObject::reportInstrumentationEvent(TaggedObject::InstrumentationEvent::TypeMismatch, instrumentationTypeName());
+#endif
+
         if constexpr(std::is_same_v<T, bool>)
             return val.toBool();
         else if constexpr(std::is_integral_v<T>)
-            return val.toInt();
+            return TaggedObject::jsonValueToIntegral<T>(val);
         else if constexpr(std::is_floating_point_v<T>)
             return val.toDouble();
         else if constexpr(std::is_same_v<T, QJsonValue>)
@@ -135,6 +240,103 @@ private:
             throw(std::invalid_argument("Template argument for the TaggedJSONObject is not valid"));
     }
 
+#ifdef TJO_ENABLE_INSTRUMENTATION
+    //Name of the type in the instrumentation reports
+    static constexpr std::string_view instrumentationTypeName()
+    {
+        if constexpr(std::is_same_v<T, bool>)
+            return "TaggedJSONBool";
+        else if constexpr(std::is_same_v<T, int>)
+            return "TaggedJSONInt";
+        else if constexpr(std::is_same_v<T, double>)
+            return "TaggedJSONDouble";
+        else if constexpr(std::is_same_v<T, QJsonObject>)
+            return "TaggedQJsonObject";
+        else if constexpr(std::is_same_v<T, QString>)
+            return "TaggedJSONString";
+        else
+            return "TaggedJSONObject";
+    }
+#endif
+
+    //Direct-binding counterpart of dispatchValue, mismatching types end up with the same defaults the QJsonValue conversions return
+    static T readValue(TaggedObject::JsonReader& reader)
+    {
+        using Token = TaggedObject::JsonReader::Token;
+        const Token token = reader.peek();
+
+        if constexpr(std::is_same_v<T, bool>) {
+            if(token == Token::Bool)
+                return reader.readBool();
+        }
+        else if constexpr(std::is_integral_v<T>) {
+            if(token == Token::Number) {
+                //Same rule as QJsonValue::toInt(), only integral values within the range of T are accepted, integers are parsed exactly
+                T value = T();
+                reader.readInteger(value);
+                return value;
+            }
+        }
+        else if constexpr(std::is_floating_point_v<T>) {
+            if(token == Token::Number)
+                return reader.readDouble();
+        }
+        else if constexpr(std::is_same_v<T, QJsonValue>)
+            return reader.readValue();
+        else if constexpr(std::is_same_v<T, QJsonObject>) {
+            if(token == Token::Object)
+                return reader.readValue().toObject();
+        }
+        else if constexpr(std::is_same_v<T, QString>) {
+            if(token == Token::String)
+                return reader.readString();
+        }
+        else if constexpr(std::is_same_v<T, QVariant>)
+            return reader.readValue().toVariant();
+
+        reader.skipValue();
+        return T();
+    }
+
+    //CBOR counterpart of the JSON readValue(), the conversion rules are the same
+    template<typename Reader>
+    static T readValue(Reader& reader)
+    {
+        if constexpr(std::is_same_v<T, bool>) {
+            if(reader.isBool()) {
+                const bool value = reader.toBool();
+                reader.next();
+                return value;
+            }
+        }
+        else if constexpr(std::is_integral_v<T>) {
+            T value = T();
+            if(TaggedObject::readCborInteger(reader, value))
+                return value;
+        }
+        else if constexpr(std::is_floating_point_v<T>) {
+            double number = 0;
+            if(TaggedObject::readCborNumber(reader, number))
+                return number;
+        }
+        else if constexpr(std::is_same_v<T, QJsonValue>)
+            return TaggedObject::readCborValue(reader);
+        else if constexpr(std::is_same_v<T, QJsonObject>) {
+            if(reader.isMap())
+                return TaggedObject::readCborValue(reader).toObject();
+        }
+        else if constexpr(std::is_same_v<T, QString>) {
+            QString value;
+            TaggedObject::readCborString(reader, value);
+            return value;
+        }
+        else if constexpr(std::is_same_v<T, QVariant>)
+            return TaggedObject::readCborValue(reader).toVariant();
+
+        reader.next();
+        return T();
+    }
+
 };
 
 /*!
@@ -159,6 +361,8 @@ std::ostream& operator<< (std::ostream& stream, const TaggedJSONObject<T>& obj)
 //Type aliases
 using TaggedJSONBool = TaggedJSONObject<bool>;
 using TaggedJSONInt = TaggedJSONObject<int>;
+using TaggedJSONInt64 = TaggedJSONObject<qint64>;
+using TaggedJSONUInt64 = TaggedJSONObject<quint64>;
 using TaggedJSONDouble = TaggedJSONObject<double>;
 using TaggedJSONValue = TaggedJSONObject<QJsonValue>;
 using TaggedQJsonObject = TaggedJSONObject<QJsonObject>;
@@ -2,40 +2,113 @@
 #define TAGGEDJSONOBJECTMACROS_H
 
 #include "map.h"
+#include "taggedjsonreader.h"
+#include "taggedjsonwriter.h"
+#include "taggedjsonforward.h"
+#include "taggedjsonfieldindex.h"
+#include "taggedjsonfile.h"
+#include "taggedjsonmergepatch.h"
+#include "taggedjsoninstrumentation.h"
+#include "taggedjsonassign.h"
+#include "taggedjsonfields.h"
+#include "taggedjsonmembers.h"
+#include <bitset>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
 #include <QFile>
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QByteArray>
+#include <QString>
 
-#define TAGGEDOBJECTMACRO_PREPARE_JSON_OBJECT(type, name) ret[#name] = name.toJsonValue();
-#define TAGGEDOBJECTMACRO_PREPARE_JSON_OBJECT_UNPACK(pair) TAGGEDOBJECTMACRO_PREPARE_JSON_OBJECT pair
+#ifdef TJO_TABLE_DRIVEN_BINDING
+//The constructors, the serialization and the merge patches go through the field table, the members are default-initialized and bound in place in the constructor body
+#define TAGGEDOBJECTMACRO_INITIALIZE_MEMBER(index, name) name()
+#define TAGGEDOBJECTMACRO_INITIALIZE_MEMBER_VALUE(index, name) name()
+#define TAGGEDOBJECTMACRO_BIND_FIELDS(CLASS_NAME, obj) TaggedObject::constructFields(*this, obj, checkValues);
+#define TAGGEDOBJECTMACRO_TO_JSON_OBJECT(CLASS_NAME) TaggedObject::fieldsToJsonObject(*this)
+#define TAGGEDOBJECTMACRO_MERGE_PATCH(SELF) TaggedObject::fieldsMergePatch<SELF>(*this, m_jsonCache, patch);
+#define TAGGEDOBJECTMACRO_COMMIT_JSON_CACHE(SELF) TaggedObject::commitFields<SELF>(*this, m_jsonCache);
+#else
+#define TAGGEDOBJECTMACRO_INITIALIZE_MEMBER(index, name) name(obj[jsonKeys()[index]], checkValues)
+#define TAGGEDOBJECTMACRO_INITIALIZE_MEMBER_VALUE(index, name) name(val[jsonKeys()[index]], checkValues)
+#define TAGGEDOBJECTMACRO_BIND_FIELDS(CLASS_NAME, obj)
+#define TAGGEDOBJECTMACRO_TO_JSON_OBJECT(CLASS_NAME) Members::toJsonObject(*this)
+#define TAGGEDOBJECTMACRO_MERGE_PATCH(SELF) TaggedObject::GeneratedMembers<SELF>::appendPatch(*this, m_jsonCache.object(), m_jsonCache.isStale(), patch);
+#define TAGGEDOBJECTMACRO_COMMIT_JSON_CACHE(SELF) TaggedObject::GeneratedMembers<SELF>::commit(*this, m_jsonCache.object(), m_jsonCache.isStale()); m_jsonCache.finishUpdate();
+#endif
+#ifdef TJO_ENABLE_MODIFICATION_TRACKING
+//The baseline of the merge patches and the methods that use it, see taggedjsonmergepatch.h
+#define TAGGEDOBJECTMACRO_JSON_CACHE_MEMBER TaggedObject::JsonObjectCache m_jsonCache; friend struct TaggedObject::JsonCacheAccess;
+#define TAGGEDOBJECTMACRO_INVALIDATE_JSON_CACHE m_jsonCache.invalidate();
+#define TAGGEDOBJECTMACRO_MERGE_PATCH_METHODS(CLASS_NAME) \
+    template<typename Self = CLASS_NAME>\
+    QJsonObject toMergePatch() const\
+    {\
+        QJsonObject patch;\
+        TAGGEDOBJECTMACRO_MERGE_PATCH(Self)\
+        return patch;\
+    }\
+    template<typename Self = CLASS_NAME>\
+    bool isModified() const { return m_jsonCache.isStale() || !toMergePatch<Self>().isEmpty(); }\
+    template<typename Self = CLASS_NAME>\
+    const QJsonObject& updateJsonObject()\
+    {\
+        TJO_INSTRUMENT_SCOPE(TaggedObject::InstrumentationEvent::Serialize, #CLASS_NAME, jsonFieldIndex().size());\
+        TAGGEDOBJECTMACRO_COMMIT_JSON_CACHE(Self)\
+        return m_jsonCache.object();\
+    }\
+    template<typename Self = CLASS_NAME>\
+    void clearModified() { updateJsonObject<Self>(); }
+#else
+#define TAGGEDOBJECTMACRO_JSON_CACHE_MEMBER
+#define TAGGEDOBJECTMACRO_INVALIDATE_JSON_CACHE
+#define TAGGEDOBJECTMACRO_MERGE_PATCH_METHODS(CLASS_NAME)
+#endif
+#define TAGGEDOBJECTMACRO_INITIALIZE_MEMBER_UNPACK(index, pair) TAGGEDOBJECTMACRO_INITIALIZE_MEMBER(index, TAGGEDOBJECTMACRO_MEMBER_NAME pair)
+#define TAGGEDOBJECTMACRO_INITIALIZE_MEMBER_VALUE_UNPACK(index, pair) TAGGEDOBJECTMACRO_INITIALIZE_MEMBER_VALUE(index, TAGGEDOBJECTMACRO_MEMBER_NAME pair)
+
+#define TAGGEDOBJECTMACRO_MEMBER_TYPE(type, name) type
+#define TAGGEDOBJECTMACRO_MEMBER_NAME(type, name) name
 
 #define TAGGEDOBJECTMACRO_DECLARE_MEMBER(type, name) type name;
 #define TAGGEDOBJECTMACRO_DECLARE_MEMBER_UNPACK(pair) TAGGEDOBJECTMACRO_DECLARE_MEMBER pair
 
-#define TAGGEDOBJECTMACRO_INITIALIZE_MEMBER(type, name) name(obj[#name], checkValues)
-#define TAGGEDOBJECTMACRO_INITIALIZE_MEMBER_UNPACK(pair) TAGGEDOBJECTMACRO_INITIALIZE_MEMBER pair
-
-#define TAGGEDOBJECTMACRO_INITIALIZE_MEMBER_VALUE(type, name) name(val[#name], checkValues)
-#define TAGGEDOBJECTMACRO_INITIALIZE_MEMBER_VALUE_UNPACK(pair) TAGGEDOBJECTMACRO_INITIALIZE_MEMBER_VALUE pair
-
 #define TAGGEDOBJECTMACRO_LIST_MEMBERS(type, name) type name
 #define TAGGEDOBJECTMACRO_LIST_MEMBERS_UNPACK(pair) TAGGEDOBJECTMACRO_LIST_MEMBERS pair
 
 #define TAGGEDOBJECTMACRO_MOVE_PARAMETERS(type, name) name(std::move(name))
 #define TAGGEDOBJECTMACRO_MOVE_PARAMETERS_UNPACK(pair) TAGGEDOBJECTMACRO_MOVE_PARAMETERS pair
 
+#define TAGGEDOBJECTMACRO_FIELD_NAME(type, name) #name
+#define TAGGEDOBJECTMACRO_FIELD_NAME_UNPACK(pair) TAGGEDOBJECTMACRO_FIELD_NAME pair
+
+#define TAGGEDOBJECTMACRO_FIELD_DESCRIPTOR(type, name) TaggedObject::makeFieldDescriptor(#name, &SelfType::name)
+#define TAGGEDOBJECTMACRO_FIELD_DESCRIPTOR_UNPACK(pair) TAGGEDOBJECTMACRO_FIELD_DESCRIPTOR pair
+
 
 namespace TaggedObject {
-    inline QJsonObject getJSONObjectFromJSONText(const QByteArray& json)
+    inline QJsonObject getJSONObjectFromJSONText(const QByteArray& json, const std::string_view className = {})
     {
+        Q_UNUSED(className)
+        TJO_INSTRUMENT_SCOPE(InstrumentationEvent::DocumentParse, className, -1, json.size());
         return QJsonDocument::fromJson(json).object();
     }
-    inline QJsonObject getJSONObjectFromFile(const QString& filePath)
+    inline QJsonObject getJSONObjectFromFile(const QString& filePath, const bool checkValues=false, const std::string_view className = {})
     {
-        QFile f{ filePath };
-        f.open(QIODevice::ReadOnly);
-        return QJsonDocument::fromJson(f.readAll()).object();
+        Q_UNUSED(className)
+        //The document is parsed straight from the mapping, the file isn't copied into the heap
+        const JsonFileData file{ filePath };
+        if (!file.isValid()) {
+            if (checkValues)
+                throw(std::runtime_error(file.errorString().toStdString()));
+            return QJsonObject();
+        }
+        TJO_INSTRUMENT_SCOPE(InstrumentationEvent::DocumentParse, className, -1, file.size());
+        return QJsonDocument::fromJson(file.bytes()).object();
     }
 };
 
@@ -47,24 +120,194 @@ namespace TaggedObject {
 Example : TJO_DEFINE_JSON_TAGGED_OBJECT(MyObj, (TaggedJSONString, name), (TaggedJSONInt, age)), defines a class named MyObj, which can hold "name" and "age" fields.\n
 Defined object can be constructed either by a QJSONObject, a QJsonValue, a QByteArray that represents the JSON data or a QString that holds the path of the target JSON file. Defined 
 object also have a optional checkValues parameter for each constructor, which indicated if there can be a missing field on any of the members. If any of the members don't have a 
-respective JSON data, a runtime error will be raised.
+respective JSON data, a runtime error will be raised.\n
+Passing TaggedObject::singlePassBinding as the first argument of the QJsonObject constructor selects the single-pass binding (see TaggedObject::FieldIndex).\n
+The static fromJson() and fromFile() methods bind the members straight from the JSON text or the memory-mapped file (see TaggedObject::JsonReader and
+TaggedObject::JsonFileData), toJson() and writeJson() write the text straight from the members (see TaggedObject::JsonWriter) and toJsonObject() builds a
+new QJsonObject. checkValues behaves the same way as in the constructors, malformed JSON text and files that can't be read raise a runtime error as well.\n
+The rest of the methods are described in the headers that implement them: assign(), parseInto() and replaceJson() in taggedjsonassign.h, fieldDescriptors()
+in taggedjsonfields.h, fromCbor() and toCbor() in taggedjsoncbor.h, tryFrom() and validate() in taggedjsonvalidation.h and the merge patch methods, which
+are only generated if TJO_ENABLE_MODIFICATION_TRACKING is defined, in taggedjsonmergepatch.h. The CBOR, validation and merge patch methods are member
+templates, so they are only instantiated in the translation units that call them, which include those headers.\n
+A class can have up to MAP_MAX_ARGUMENTS (1024) members. More fail with the static_assert of map.h, which GCC reports after a few syntax errors
+in the parameter list of the member constructor.
 */
 #define TJO_DEFINE_JSON_TAGGED_OBJECT(CLASS_NAME, ...) \
 class CLASS_NAME{\
 public:\
+    static constexpr auto fieldDescriptors()\
+    {\
+        using SelfType = CLASS_NAME;\
+        return TaggedObject::makeFieldList(MAP_LIST(TAGGEDOBJECTMACRO_FIELD_DESCRIPTOR_UNPACK, __VA_ARGS__));\
+    }\
+private:\
+    using Members = TaggedObject::GeneratedMembers<CLASS_NAME>;\
+    static const auto& jsonKeys() { return TaggedObject::fieldKeys<CLASS_NAME>(); }\
+    static const auto& jsonFieldIndex() { return TaggedObject::fieldIndex<CLASS_NAME>; }\
+    TJO_INSTRUMENT_PROBE_MEMBER\
+    TAGGEDOBJECTMACRO_JSON_CACHE_MEMBER \
+public:\
+    static constexpr std::string_view taggedClassName() { return #CLASS_NAME; }\
     explicit CLASS_NAME() {}\
-    explicit CLASS_NAME(const QJsonObject& obj, const bool checkValues=true) : MAP_LIST(TAGGEDOBJECTMACRO_INITIALIZE_MEMBER_UNPACK, __VA_ARGS__) {}; \
-    explicit CLASS_NAME(const QJsonValue& val, const bool checkValues=true) : MAP_LIST(TAGGEDOBJECTMACRO_INITIALIZE_MEMBER_VALUE_UNPACK, __VA_ARGS__) {}; \
-    explicit CLASS_NAME(const QByteArray& json, const bool checkValues=true) : CLASS_NAME(TaggedObject::getJSONObjectFromJSONText(json), checkValues) {};\
-    explicit CLASS_NAME(const QString& filePath, const bool checkValues=true) : CLASS_NAME(TaggedObject::getJSONObjectFromFile(filePath), checkValues) {};\
-    explicit CLASS_NAME(MAP_LIST(TAGGEDOBJECTMACRO_LIST_MEMBERS_UNPACK, __VA_ARGS__), const bool checkValues=true) : MAP_LIST(TAGGEDOBJECTMACRO_MOVE_PARAMETERS_UNPACK, __VA_ARGS__) {};\
+    explicit CLASS_NAME(const QJsonObject& obj, const bool checkValues=true)\
+        : TJO_INSTRUMENT_PROBE_INIT(CLASS_NAME, obj) MAP_LIST_INDEXED(TAGGEDOBJECTMACRO_INITIALIZE_MEMBER_UNPACK, __VA_ARGS__) { TAGGEDOBJECTMACRO_BIND_FIELDS(CLASS_NAME, obj) TJO_INSTRUMENT_PROBE_FINISH(jsonFieldIndex().size()) }; \
+    explicit CLASS_NAME(const QJsonValue& val, const bool checkValues=true)\
+        : TJO_INSTRUMENT_PROBE_INIT(CLASS_NAME, val.toObject()) MAP_LIST_INDEXED(TAGGEDOBJECTMACRO_INITIALIZE_MEMBER_VALUE_UNPACK, __VA_ARGS__) { TAGGEDOBJECTMACRO_BIND_FIELDS(CLASS_NAME, val.toObject()) TJO_INSTRUMENT_PROBE_FINISH(jsonFieldIndex().size()) }; \
+    explicit CLASS_NAME(TaggedObject::SinglePassBinding, const QJsonObject& obj, const bool checkValues=true) { bindSinglePass(obj, checkValues); }\
+    explicit CLASS_NAME(const QByteArray& json, const bool checkValues=true) : CLASS_NAME(TaggedObject::getJSONObjectFromJSONText(json, #CLASS_NAME), checkValues) {};\
+    explicit CLASS_NAME(const QString& filePath, const bool checkValues=true) : CLASS_NAME(TaggedObject::getJSONObjectFromFile(filePath, checkValues, #CLASS_NAME), checkValues) {};\
+    explicit CLASS_NAME(MAP_LIST(TAGGEDOBJECTMACRO_LIST_MEMBERS_UNPACK, __VA_ARGS__), const bool /*checkValues*/=true) : MAP_LIST(TAGGEDOBJECTMACRO_MOVE_PARAMETERS_UNPACK, __VA_ARGS__) {};\
+    void assign(const QJsonObject& obj, const bool checkValues=true)\
+    {\
+        TJO_INSTRUMENT_SCOPE(TaggedObject::InstrumentationEvent::Construct, #CLASS_NAME, jsonFieldIndex().size());\
+        TAGGEDOBJECTMACRO_INVALIDATE_JSON_CACHE\
+        Members::assign(*this, obj, checkValues);\
+    }\
+    void assign(const QJsonValue& val, const bool checkValues=true)\
+    {\
+        TJO_INSTRUMENT_SCOPE(TaggedObject::InstrumentationEvent::Construct, #CLASS_NAME, jsonFieldIndex().size());\
+        TAGGEDOBJECTMACRO_INVALIDATE_JSON_CACHE\
+        Members::assign(*this, val, checkValues);\
+    }\
+    void parseInto(const QByteArray& json, const bool checkValues=true)\
+    {\
+        TJO_INSTRUMENT_SCOPE(TaggedObject::InstrumentationEvent::Parse, #CLASS_NAME, jsonFieldIndex().size(), json.size());\
+        TaggedObject::JsonReader reader(json);\
+        replaceJson(reader, checkValues);\
+        if(!reader.finish()) {\
+            if(checkValues)\
+                throw(std::runtime_error("Malformed JSON text has been encountered while parsing the json data for " #CLASS_NAME));\
+            *this = CLASS_NAME();\
+        }\
+    }\
+    template<typename Self = CLASS_NAME>\
+    static void validateJson(const QJsonValue& val, TaggedObject::ValidationContext& context) { TaggedObject::ValidationMembers<Self>::validateJson(val, context); }\
+    template<typename Self = CLASS_NAME>\
+    static auto validate(const QJsonObject& obj) { return TaggedObject::ValidationMembers<Self>::validate(obj); }\
+    template<typename Self = CLASS_NAME>\
+    static TaggedObject::ValidationResult<Self> tryFrom(const QJsonObject& obj) { return TaggedObject::ValidationMembers<Self>::tryFrom(obj); }\
+    template<typename Self = CLASS_NAME>\
+    static TaggedObject::ValidationResult<Self> tryFromJson(const QByteArray& json) { return TaggedObject::ValidationMembers<Self>::tryFromJson(json); }\
     QJsonObject toJsonObject() const\
     {\
-        QJsonObject ret;\
-        MAP(TAGGEDOBJECTMACRO_PREPARE_JSON_OBJECT_UNPACK, __VA_ARGS__)\
-        return ret;\
+        TJO_INSTRUMENT_SCOPE(TaggedObject::InstrumentationEvent::Serialize, #CLASS_NAME, jsonFieldIndex().size());\
+        return TAGGEDOBJECTMACRO_TO_JSON_OBJECT(CLASS_NAME);\
     }\
     QJsonValue toJsonValue() const { return toJsonObject(); }\
+    TAGGEDOBJECTMACRO_MERGE_PATCH_METHODS(CLASS_NAME)\
+    QByteArray toJson(const QJsonDocument::JsonFormat format=QJsonDocument::Indented) const\
+    {\
+        QByteArray ret;\
+        writeJson(ret, format);\
+        return ret;\
+    }\
+    void writeJson(QByteArray& out, const QJsonDocument::JsonFormat format=QJsonDocument::Indented) const\
+    {\
+        TJO_INSTRUMENT_SCOPE(TaggedObject::InstrumentationEvent::SerializeText, #CLASS_NAME, jsonFieldIndex().size());\
+        const qsizetype initialSize = out.size();\
+        Q_UNUSED(initialSize)\
+        TaggedObject::JsonWriter writer(out, format);\
+        writeJson(writer);\
+        TJO_INSTRUMENT_SET_BYTES(out.size() - initialSize);\
+    }\
+    void writeJson(TaggedObject::JsonWriter& writer) const\
+    {\
+        writer.beginObject();\
+        for(std::size_t i = 0; i < std::size(Members::jsonWriters); ++i)\
+            Members::jsonWriters[jsonFieldIndex().sortedIndex(i)](*this, writer);\
+        writer.endObject();\
+    }\
+    static CLASS_NAME fromJson(const QByteArray& json, const bool checkValues=true)\
+    {\
+        TJO_INSTRUMENT_SCOPE(TaggedObject::InstrumentationEvent::Parse, #CLASS_NAME, jsonFieldIndex().size(), json.size());\
+        TaggedObject::JsonReader reader(json);\
+        return readDocument(reader, checkValues);\
+    }\
+    static CLASS_NAME fromFile(const QString& filePath, const bool checkValues=true)\
+    {\
+        const auto file = std::make_shared<const TaggedObject::JsonFileData>(filePath);\
+        if(!file->isValid()) {\
+            if(checkValues)\
+                throw(std::runtime_error(file->errorString().toStdString()));\
+            return CLASS_NAME();\
+        }\
+        TJO_INSTRUMENT_SCOPE(TaggedObject::InstrumentationEvent::Parse, #CLASS_NAME, jsonFieldIndex().size(), file->size());\
+        const QByteArray text = file->bytes();\
+        TaggedObject::JsonReader reader(text, file);\
+        return readDocument(reader, checkValues);\
+    }\
+    void readJson(TaggedObject::JsonReader& reader, const bool checkValues=true) { readMembers(reader, checkValues, false); }\
+    void replaceJson(TaggedObject::JsonReader& reader, const bool checkValues=true) { readMembers(reader, checkValues, true); }\
+    template<typename Self = CLASS_NAME>\
+    static Self fromCbor(const QByteArray& cbor, const bool checkValues=true) { return TaggedObject::CborMembers<Self>::fromCbor(cbor, checkValues); }\
+    template<typename Self = CLASS_NAME>\
+    QByteArray toCbor() const { return TaggedObject::CborMembers<Self>::toCbor(*this); }\
+    template<typename Self = CLASS_NAME>\
+    void readCbor(QCborStreamReader& reader, const bool checkValues=true) { TAGGEDOBJECTMACRO_INVALIDATE_JSON_CACHE TaggedObject::CborMembers<Self>::readCbor(*this, reader, checkValues); }\
+    template<typename Self = CLASS_NAME>\
+    void writeCbor(QCborStreamWriter& writer) const { TaggedObject::CborMembers<Self>::writeCbor(*this, writer); }\
+private:\
+    void readMembers(TaggedObject::JsonReader& reader, const bool checkValues, const bool replace)\
+    {\
+        TAGGEDOBJECTMACRO_INVALIDATE_JSON_CACHE\
+        std::bitset<std::size(Members::jsonBinders)> found;\
+        if(reader.beginObject()) {\
+            std::string_view key;\
+            while(reader.nextKey(key)) {\
+                const int index = jsonFieldIndex().indexOf(key);\
+                if(index < 0) {\
+                    reader.skipValue();\
+                    continue;\
+                }\
+                Members::jsonBinders[index](*this, reader, checkValues, replace);\
+                found.set(index);\
+            }\
+        }\
+        else\
+            reader.skipValue();\
+        if(checkValues) {\
+            if(reader.hasError())\
+                throw(std::runtime_error("Malformed JSON text has been encountered while parsing the json data for " #CLASS_NAME));\
+            Members::throwIfMissing(found);\
+        }\
+        else if(replace)\
+            resetMissing(found);\
+    }\
+    static CLASS_NAME readDocument(TaggedObject::JsonReader& reader, const bool checkValues)\
+    {\
+        CLASS_NAME ret;\
+        ret.readJson(reader, checkValues);\
+        if(!reader.finish()) {\
+            if(checkValues)\
+                throw(std::runtime_error("Malformed JSON text has been encountered while parsing the json data for " #CLASS_NAME));\
+            return CLASS_NAME();\
+        }\
+        return ret;\
+    }\
+    template<std::size_t N>\
+    void resetMissing(const std::bitset<N>& found)\
+    {\
+        if(found.all())\
+            return;\
+        for(std::size_t i = 0; i < N; ++i) {\
+            if(!found.test(i))\
+                Members::resetters[i](*this);\
+        }\
+    }\
+    void bindSinglePass(const QJsonObject& obj, const bool checkValues)\
+    {\
+        std::bitset<std::size(Members::valueBinders)> found;\
+        for(auto it = obj.constBegin(); it != obj.constEnd(); ++it) {\
+            const int index = jsonFieldIndex().indexOf(it.key());\
+            if(index < 0)\
+                continue;\
+            Members::valueBinders[index](*this, it.value(), checkValues);\
+            found.set(index);\
+        }\
+        if(checkValues)\
+            Members::throwIfMissing(found);\
+    }\
+public:\
     MAP(TAGGEDOBJECTMACRO_DECLARE_MEMBER_UNPACK, __VA_ARGS__)\
 };
 
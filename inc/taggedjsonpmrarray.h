@@ -0,0 +1,191 @@
+#ifndef TAGGEDJSONPMRARRAY_H
+#define TAGGEDJSONPMRARRAY_H
+#include <memory_resource>
+#include <vector>
+#include "taggedjsonarray.h"
+#include "taggedjsonmemory.h"
+
+/*!
+ * \class TaggedJSONPmrArray
+ * \brief The TaggedJSONPmrArray class is the allocator-aware variant of the TaggedJSONArray of tagged objects.
+ *
+ * The elements are stored in a std::pmr::vector that allocates from the memory resource of the innermost TaggedObject::MemoryResourceScope
+ * of the constructing thread (the default resource if there isn't one). Nested arrays of the elements are constructed in the same scope, so a
+ * whole parsed tree ends up in the same resource and a std::pmr::monotonic_buffer_resource can release it in one shot.\n
+ * Only the element storage is allocator-aware. The Qt members of the elements (QString, QJsonValue etc.) keep their own allocations.\n
+ * Copies allocate from the default resource, so they can outlive the scope. Moves and assignments keep the resource of the destination.
+ * \tparam T Tagged object type of the elements
+ */
+template<typename T>
+class TaggedJSONPmrArray : public TaggedObject::ModificationTracking
+{
+    static_assert(TJO_IS_TAGGED_OBJECT, "TaggedJSONPmrArray only stores the objects that have been defined with the TJO_DEFINE_JSON_TAGGED_OBJECT macro");
+
+public:
+    //! Default constructor, the array allocates from the memory resource of the current scope
+    explicit TaggedJSONPmrArray() : m_arr(TaggedObject::memoryResource()) {}
+
+    /*!
+     * @brief Main constructor that is intended to be used with the #TJO_DEFINE_JSON_TAGGED_OBJECT() macro.
+     * @param ref QJsonValue that holds the array of predefined JSON objects.
+     * @param checkValue If set to true, invalid conversions (missing value, wrong type etc.) will throw a runtime error.
+    */
+    explicit TaggedJSONPmrArray(const QJsonValue& ref, const bool checkValue = true)
+        : m_arr(extractFromQJSONArray<T, std::pmr::vector<T>>(ref.toArray(), checkValue, std::pmr::vector<T>(TaggedObject::memoryResource())))
+    {
+        //Check if there is a valid data if it's intended
+        if (checkValue && ref.isUndefined())
+            throw(std::runtime_error("Invalid data has been encountered while parsing the json data for TaggedJSONPmrArray"));
+    }
+
+    /*!
+     * @brief In-place counterpart of the main constructor, the existing elements are assigned in place and the array keeps its memory resource.
+     * @param ref QJsonValue that holds the array of predefined JSON objects.
+     * @param checkValue If set to true, invalid conversions (missing value, wrong type etc.) will throw a runtime error.
+    */
+    void assign(const QJsonValue& ref, const bool checkValue = true)
+    {
+        if (checkValue && ref.isUndefined())
+            throw(std::runtime_error("Invalid data has been encountered while parsing the json data for TaggedJSONPmrArray"));
+
+        const QJsonArray arr = ref.toArray();
+        markModified();
+        m_arr.resize(static_cast<std::size_t>(arr.size()));
+        for (qsizetype i = 0; i < arr.size(); ++i)
+            TaggedObject::assignMember(m_arr[static_cast<std::size_t>(i)], arr.at(i), checkValue);
+    }
+
+    TaggedJSONPmrArray(const TaggedJSONPmrArray&) = default;
+    TaggedJSONPmrArray(TaggedJSONPmrArray&&) = default;
+
+    //! Copy assignment, the array keeps its memory resource and counts as modified
+    TaggedJSONPmrArray& operator=(const TaggedJSONPmrArray& other) { m_arr = other.m_arr; markModified(); return *this; };
+
+    //! Move assignment, the array keeps its memory resource and counts as modified
+    TaggedJSONPmrArray& operator=(TaggedJSONPmrArray&& other) { m_arr = std::move(other.m_arr); markModified(); return *this; };
+
+    bool operator!=(const TaggedJSONPmrArray& other) const { return m_arr != other.m_arr; };
+    bool operator==(const TaggedJSONPmrArray& other) const { return m_arr == other.m_arr; };
+
+    //!Mutable reference of the stored object, the array counts as modified
+    std::pmr::vector<T>& operator*() { markModified(); return m_arr; };
+
+    //!Immutable reference of the stored object
+    const std::pmr::vector<T>& operator*() const { return m_arr; };
+
+    //!Can be used for accessing the std::pmr::vector operations on the encapsulated data
+    const std::pmr::vector<T>* operator->() const { return &m_arr; };
+
+    //!Mutable access operator, the array counts as modified
+    T& operator[](const qsizetype i) { markModified(); return m_arr[i]; };
+
+    //!Immutable access operator
+    const T& at(const qsizetype i) const { return m_arr.at(i); };
+
+    //! Mutable access operator, the array counts as modified
+    T& at(const qsizetype i) { markModified(); return m_arr.at(i); };
+
+    //! Memory resource the elements are allocated from
+    std::pmr::memory_resource* resource() const { return m_arr.get_allocator().resource(); }
+
+    //!QDebug enabler
+    operator QString() const {
+        QString ret;
+
+        for (const auto& curVal : m_arr)
+            ret.append(QString(curVal) + "\n");
+        return ret;
+    };
+
+    //!Copies the elements into a std::vector that allocates from the default heap
+    std::vector<T> toStdVector() const { return std::vector<T>(m_arr.begin(), m_arr.end()); }
+
+    //! Error-collecting validation, reports a missing array and the errors of every element
+    static void validateJson(const QJsonValue& ref, TaggedObject::ValidationContext& context) { TaggedObject::validateTaggedArray<T>(ref, context); }
+
+
+    //!Converts the holding values back to a QJsonArray that holds each TaggedObject information
+    QJsonValue toJsonValue() const
+    {
+        QJsonArray ret;
+        for (const T& curObj : m_arr)
+            ret.append(curObj.toJsonValue());
+        return ret;
+    }
+
+    /*!
+     * @brief Direct-binding counterpart of the main constructor, each element is parsed straight into its tagged object.
+     *
+     * The existing elements are read in place and keep their storage, so reading into the same array again reuses it.
+     * @param reader JSON reader positioned on the value of this member
+     * @param checkValue If set to true, missing members of the elements will throw a runtime error.
+    */
+    void readJson(TaggedObject::JsonReader& reader, const bool checkValue = true)
+    {
+        if (!reader.beginArray()) {
+            m_arr.clear();
+            reader.skipValue();
+            return;
+        }
+
+        std::size_t count = 0;
+        while (reader.nextElement()) {
+            if (count == m_arr.size())
+                m_arr.emplace_back();
+            TaggedObject::readMember(m_arr[count++], reader, checkValue, true);
+        }
+        m_arr.erase(m_arr.begin() + static_cast<std::ptrdiff_t>(count), m_arr.end());
+    }
+
+    /*!
+     * @brief writeJson Direct serialization counterpart of toJsonValue(), every element writes itself without building a QJsonArray.
+     * @param writer JSON writer positioned where the value of this member belongs
+    */
+    void writeJson(TaggedObject::JsonWriter& writer) const
+    {
+        writer.beginArray();
+        for (const T& curObj : m_arr)
+            curObj.writeJson(writer);
+        writer.endArray();
+    }
+
+    /*!
+     * @brief readCbor CBOR counterpart of readJson(), each element is read straight into its tagged object.
+     * @param reader CBOR reader positioned on the value of this member
+     * @param checkValue If set to true, missing members of the elements will throw a runtime error.
+    */
+    template<typename Reader>
+    void readCbor(Reader& reader, const bool checkValue = true)
+    {
+        m_arr.clear();
+        if (!reader.isArray() || !reader.enterContainer()) {
+            reader.next();
+            return;
+        }
+
+        while (reader.hasNext()) {
+            m_arr.emplace_back();
+            m_arr.back().readCbor(reader, checkValue);
+        }
+        if (!TaggedObject::hasCborError(reader))
+            reader.leaveContainer();
+    }
+
+    /*!
+     * @brief writeCbor CBOR counterpart of writeJson(), every element writes itself into a CBOR array of known length.
+     * @param writer CBOR writer positioned where the value of this member belongs
+    */
+    template<typename Writer>
+    void writeCbor(Writer& writer) const
+    {
+        writer.startArray(static_cast<quint64>(m_arr.size()));
+        for (const T& curObj : m_arr)
+            curObj.writeCbor(writer);
+        writer.endArray();
+    }
+
+private:
+    std::pmr::vector<T> m_arr;
+};
+
+#endif // TAGGEDJSONPMRARRAY_H
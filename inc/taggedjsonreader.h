@@ -0,0 +1,718 @@
+#ifndef TAGGEDJSONREADER_H
+#define TAGGEDJSONREADER_H
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <QByteArray>
+#include <QString>
+#include <QJsonValue>
+#include <QJsonObject>
+#include <QJsonArray>
+#include "taggedjsonnumber.h"
+
+namespace TaggedObject {
+
+/*!
+ * \brief isValidUtf8 Checks that the bytes are well-formed UTF-8 as the Unicode standard defines it
+ *
+ * Overlong forms, surrogates, code points above U+10FFFF and truncated sequences are rejected, which are the sequences QString::fromUtf8() replaces by U+FFFD.
+ * \param data The bytes to check
+ * \param size Number of the bytes
+ * \return true if the bytes can be used as UTF-8 text as they are
+ */
+inline bool isValidUtf8(const char* data, const qsizetype size)
+{
+    const unsigned char* it = reinterpret_cast<const unsigned char*>(data);
+    const unsigned char* const end = it + size;
+    while (it != end) {
+        const unsigned char lead = *it++;
+        if (lead < 0x80)
+            continue;
+
+        //Number of the continuation bytes and the range of the first one, which excludes the overlong forms, the surrogates and the values above U+10FFFF
+        int count;
+        unsigned char low = 0x80;
+        unsigned char high = 0xBF;
+        if (lead >= 0xC2 && lead <= 0xDF)
+            count = 1;
+        else if (lead >= 0xE0 && lead <= 0xEF) {
+            count = 2;
+            if (lead == 0xE0)
+                low = 0xA0;
+            else if (lead == 0xED)
+                high = 0x9F;
+        }
+        else if (lead >= 0xF0 && lead <= 0xF4) {
+            count = 3;
+            if (lead == 0xF0)
+                low = 0x90;
+            else if (lead == 0xF4)
+                high = 0x8F;
+        }
+        else
+            return false;
+
+        if (end - it < count || *it < low || *it > high)
+            return false;
+        for (++it; --count > 0; ++it) {
+            if ((*it & 0xC0) != 0x80)
+                return false;
+        }
+    }
+    return true;
+}
+
+/*!
+ * \class JsonReader
+ * \brief The JsonReader class is a pull tokenizer that walks a UTF-8 JSON text exactly once.
+ *
+ * It is the engine behind the direct-binding parse mode of the tagged objects (see fromJson() on the classes generated by
+ * the #TJO_DEFINE_JSON_TAGGED_OBJECT() macro). Instead of building a QJsonDocument, the reader hands out one token at a time and
+ * each TaggedJSONObject/TaggedJSONArray member converts its own value straight from the text.\n
+ * The reader never throws. Malformed input sets the error flag, after which every call behaves as if the end of the input had been reached.
+ * The referenced buffer must outlive the reader.
+ */
+class JsonReader
+{
+public:
+    //! Kind of the value the reader is currently positioned on
+    enum class Token { Invalid, Null, Bool, Number, String, Object, Array };
+
+    /*!
+     * \brief JsonReader Constructor that reads the given JSON text
+     * \param json UTF-8 encoded JSON text. It isn't copied, so it has to outlive the reader.
+     */
+    explicit JsonReader(const QByteArray& json) : JsonReader(json.constData(), json.size()) { m_source = &json; }
+
+    /*!
+     * \brief JsonReader Constructor that reads a QByteArray that refers to memory it doesn't own, such as TaggedObject::JsonFileData::bytes()
+     * \param json UTF-8 encoded JSON text made by QByteArray::fromRawData(). It isn't copied, so it has to outlive the reader.
+     * \param owner Keeps the memory json refers to alive, the members that refer to the text share it (see TaggedJSONStringView)
+     */
+    JsonReader(const QByteArray& json, std::shared_ptr<const void> owner) : JsonReader(json) { m_owner = std::move(owner); }
+
+    //! The reader doesn't own its input, temporaries would dangle
+    explicit JsonReader(QByteArray&& json) = delete;
+
+    /*!
+     * \brief JsonReader Constructor that reads the given raw memory range
+     * \param data Start of the UTF-8 encoded JSON text
+     * \param size Length of the text in bytes
+     */
+    JsonReader(const char* data, const qsizetype size) : m_begin(data), m_cur(data), m_end(data + size) {}
+
+    //! The QByteArray the reader has been constructed with, null if it reads a raw memory range
+    const QByteArray* source() const { return m_source; }
+
+    //! Owner of the memory the source refers to, null if the source owns its data (or if there is no source)
+    const std::shared_ptr<const void>& owner() const { return m_owner; }
+
+    //! Returns true if malformed JSON has been encountered
+    bool hasError() const { return m_error; }
+
+    //! Byte offset of the current read position (or of the error, if there is one)
+    qsizetype offset() const { return m_error ? m_errorOffset : m_cur - m_begin; }
+
+    /*!
+     * \brief peek Skips the whitespace and classifies the next value without consuming it
+     * \return Kind of the next value, Token::Invalid if there isn't a valid one
+     */
+    Token peek()
+    {
+        skipWhitespace();
+        if (m_cur == m_end)
+            return Token::Invalid;
+
+        switch (*m_cur) {
+        case '{': return Token::Object;
+        case '[': return Token::Array;
+        case '"': return Token::String;
+        case 't':
+        case 'f': return Token::Bool;
+        case 'n': return Token::Null;
+        default:
+            return (*m_cur == '-' || isDigit(*m_cur)) ? Token::Number : Token::Invalid;
+        }
+    }
+
+    /*!
+     * \brief beginObject Consumes the opening brace of an object
+     * \return false (without consuming anything) if the next value isn't an object
+     */
+    bool beginObject() { return beginContainer('{'); }
+
+    /*!
+     * \brief nextKey Advances to the next member of the current object and consumes its key
+     *
+     * The value of the member has to be consumed (read or skipped) before calling this method again.
+     * \param key Receives the unescaped key. It stays valid until the next call.
+     * \return false once the closing brace has been consumed or an error occurred
+     */
+    bool nextKey(std::string_view& key)
+    {
+        if (!nextEntry('}'))
+            return false;
+
+        if (m_cur == m_end || *m_cur != '"')
+            return fail();
+
+        const char* start;
+        qsizetype length;
+        bool escaped;
+        if (!scanString(start, length, escaped))
+            return false;
+
+        if (escaped) {
+            m_keyBuffer.clear();
+            if (!unescape(start, length, m_keyBuffer))
+                return false;
+            key = std::string_view(m_keyBuffer.data(), m_keyBuffer.size());
+        }
+        else {
+            key = std::string_view(start, size_t(length));
+        }
+
+        skipWhitespace();
+        if (m_cur == m_end || *m_cur != ':')
+            return fail();
+        ++m_cur;
+        m_needComma = false;
+        return true;
+    }
+
+    /*!
+     * \brief beginArray Consumes the opening bracket of an array
+     * \return false (without consuming anything) if the next value isn't an array
+     */
+    bool beginArray() { return beginContainer('['); }
+
+    /*!
+     * \brief nextElement Advances to the next element of the current array
+     *
+     * The element has to be consumed (read or skipped) before calling this method again.
+     * \return false once the closing bracket has been consumed or an error occurred
+     */
+    bool nextElement() { return nextEntry(']'); }
+
+    //! Consumes the next value whatever its type is
+    void skipValue()
+    {
+        switch (peek()) {
+        case Token::Object: {
+            if (!enter())
+                return;
+            beginObject();
+            std::string_view key;
+            while (nextKey(key))
+                skipValue();
+            leave();
+            break;
+        }
+        case Token::Array:
+            if (!enter())
+                return;
+            beginArray();
+            while (nextElement())
+                skipValue();
+            leave();
+            break;
+        case Token::String: {
+            const char* start;
+            qsizetype length;
+            bool escaped;
+            if (scanString(start, length, escaped))
+                m_needComma = true;
+            break;
+        }
+        case Token::Bool:
+            readBool();
+            break;
+        case Token::Null:
+            readNull();
+            break;
+        case Token::Number:
+            readDouble();
+            break;
+        case Token::Invalid:
+            fail();
+            break;
+        }
+    }
+
+    /*!
+     * \brief skipValue Consumes the next value and reports where its text is
+     * \param data Receives the start of the value text
+     * \param size Receives the length of the value text in bytes
+     * \return false if the value is malformed
+     */
+    bool skipValue(const char*& data, qsizetype& size)
+    {
+        skipWhitespace();
+        const char* const start = m_cur;
+        skipValue();
+        data = start;
+        size = m_error ? 0 : m_cur - start;
+        return !m_error;
+    }
+
+    //! Consumes a null literal
+    void readNull() { expectLiteral("null", 4); }
+
+    /*!
+     * \brief readBool Consumes a boolean literal
+     * \return The parsed value
+     */
+    bool readBool()
+    {
+        if (m_cur != m_end && *m_cur == 't')
+            return expectLiteral("true", 4);
+        expectLiteral("false", 5);
+        return false;
+    }
+
+    /*!
+     * \brief readDouble Consumes a number
+     * \return The parsed value, 0 on malformed input
+     */
+    double readDouble()
+    {
+        const char* start = m_cur;
+        bool integral = true;
+        if (!scanNumber(integral))
+            return 0;
+
+        const qsizetype length = m_cur - start;
+        //Short integers can be accumulated exactly without a string conversion
+        if (integral && length < 16) {
+            const bool negative = *start == '-';
+            qint64 value = 0;
+            for (const char* it = negative ? start + 1 : start; it != m_cur; ++it)
+                value = value * 10 + (*it - '0');
+            return double(negative ? -value : value);
+        }
+        return parseJsonDouble(start, m_cur);
+    }
+
+    /*!
+     * \brief readNumber Consumes a number as a QJsonValue
+     *
+     * On Qt 6 integers within the qint64 range are kept exact the same way QJsonDocument keeps them, every other number is a double.
+     * \return The parsed value, 0 on malformed input
+     */
+    QJsonValue readNumber()
+    {
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+        const char* start = m_cur;
+        bool integral = true;
+        if (!scanNumber(integral))
+            return QJsonValue(0.0);
+        qint64 integer = 0;
+        if (integral && parseJsonInteger(start, m_cur, integer))
+            return QJsonValue(integer);
+        return QJsonValue(parseJsonDouble(start, m_cur));
+#else
+        return QJsonValue(readDouble());
+#endif
+    }
+
+    /*!
+     * \brief readInteger Consumes a number and converts it into the integral type T
+     *
+     * Integers are parsed exactly, so 64-bit values keep their full precision. Fractions and exponents that still denote an integral value ("1.0", "1e3")
+     * are accepted the same way QJsonValue::toInt() accepts them.
+     * \param out Receives the value
+     * \return false if the number isn't an integral value within the range of T or the input is malformed, out is left as it is then
+     */
+    template<typename T>
+    bool readInteger(T& out)
+    {
+        const char* start = m_cur;
+        bool integral = true;
+        if (!scanNumber(integral))
+            return false;
+        if (integral && parseJsonInteger(start, m_cur, out))
+            return true;
+        return integralFromDouble(parseJsonDouble(start, m_cur), out);
+    }
+
+    /*!
+     * \brief readRawString Consumes a string value without decoding it, the reader has to be positioned on a string
+     * \param data Receives the start of the string content, which is right after the opening quote
+     * \param size Receives the length of the string content in bytes
+     * \param escaped Receives true if the content has escape sequences, it is plain UTF-8 otherwise
+     * \return false if the value is malformed
+     */
+    bool readRawString(const char*& data, qsizetype& size, bool& escaped)
+    {
+        if (!scanString(data, size, escaped))
+            return false;
+        m_needComma = true;
+        return true;
+    }
+
+    /*!
+     * \brief readString Consumes a string and decodes it
+     * \return The decoded string
+     */
+    QString readString()
+    {
+        const char* start;
+        qsizetype length;
+        bool escaped;
+        if (!scanString(start, length, escaped))
+            return QString();
+        m_needComma = true;
+
+        if (!escaped)
+            return QString::fromUtf8(start, length);
+
+        std::string decoded;
+        if (!unescape(start, length, decoded))
+            return QString();
+        return QString::fromUtf8(decoded.data(), qsizetype(decoded.size()));
+    }
+
+    /*!
+     * \brief readString Consumes a string and decodes it into an existing QString
+     *
+     * ASCII text is widened into the buffer of \a out, which keeps its capacity if it isn't shared, so repeated reads into the same string don't allocate.
+     * \param out Receives the decoded string, a null string on malformed input
+     * \return false if the value is malformed
+     */
+    bool readString(QString& out)
+    {
+        const char* start;
+        qsizetype length;
+        bool escaped;
+        if (!scanString(start, length, escaped)) {
+            out = QString();
+            return false;
+        }
+        m_needComma = true;
+
+        if (escaped) {
+            std::string decoded;
+            if (!unescape(start, length, decoded)) {
+                out = QString();
+                return false;
+            }
+            out = QString::fromUtf8(decoded.data(), qsizetype(decoded.size()));
+            return true;
+        }
+
+        out.resize(length);
+        QChar* dest = out.data();
+        for (qsizetype i = 0; i < length; ++i) {
+            const uchar c = static_cast<uchar>(start[i]);
+            if (c >= 0x80) {
+                out = QString::fromUtf8(start, length);
+                return true;
+            }
+            dest[i] = QChar(static_cast<char16_t>(c));
+        }
+        return true;
+    }
+
+    /*!
+     * \brief readValue Consumes the next value and builds its QJsonValue representation
+     *
+     * This is the fallback for the members that store Qt's JSON types (QJsonValue, QJsonObject, QVariant), so only that subtree is materialized.
+     * \return The parsed value, an undefined value on malformed input
+     */
+    QJsonValue readValue()
+    {
+        switch (peek()) {
+        case Token::Object: {
+            if (!enter())
+                return QJsonValue(QJsonValue::Undefined);
+            QJsonObject obj;
+            beginObject();
+            std::string_view key;
+            while (nextKey(key)) {
+                const QString keyString = QString::fromUtf8(key.data(), qsizetype(key.size()));
+                obj.insert(keyString, readValue());
+            }
+            leave();
+            return m_error ? QJsonValue(QJsonValue::Undefined) : QJsonValue(obj);
+        }
+        case Token::Array: {
+            if (!enter())
+                return QJsonValue(QJsonValue::Undefined);
+            QJsonArray arr;
+            beginArray();
+            while (nextElement())
+                arr.append(readValue());
+            leave();
+            return m_error ? QJsonValue(QJsonValue::Undefined) : QJsonValue(arr);
+        }
+        case Token::String:
+            return readString();
+        case Token::Bool:
+            return readBool();
+        case Token::Null:
+            readNull();
+            return QJsonValue(QJsonValue::Null);
+        case Token::Number:
+            return readNumber();
+        case Token::Invalid:
+            break;
+        }
+        fail();
+        return QJsonValue(QJsonValue::Undefined);
+    }
+
+    /*!
+     * \brief finish Verifies that nothing but whitespace follows the top level value
+     * \return true if the whole input has been consumed without any errors
+     */
+    bool finish()
+    {
+        skipWhitespace();
+        if (m_cur != m_end)
+            fail();
+        return !m_error;
+    }
+
+private:
+    //Same nesting limit as the QJsonDocument parser
+    static constexpr int MAX_DEPTH = 1024;
+
+    const char* m_begin;
+    const char* m_cur;
+    const char* m_end;
+    const QByteArray* m_source = nullptr;
+    std::shared_ptr<const void> m_owner;
+    qsizetype m_errorOffset = 0;
+    int m_depth = 0;
+    bool m_needComma = false;
+    bool m_error = false;
+    std::string m_keyBuffer;
+
+    static bool isDigit(const char c) { return c >= '0' && c <= '9'; }
+
+    bool fail()
+    {
+        if (!m_error) {
+            m_error = true;
+            m_errorOffset = m_cur - m_begin;
+        }
+        m_cur = m_end;
+        return false;
+    }
+
+    bool enter() { return ++m_depth <= MAX_DEPTH || fail(); }
+    void leave() { --m_depth; }
+
+    void skipWhitespace()
+    {
+        while (m_cur != m_end && (*m_cur == ' ' || *m_cur == '\n' || *m_cur == '\r' || *m_cur == '\t'))
+            ++m_cur;
+    }
+
+    bool beginContainer(const char open)
+    {
+        skipWhitespace();
+        if (m_cur == m_end || *m_cur != open)
+            return false;
+        ++m_cur;
+        m_needComma = false;
+        return true;
+    }
+
+    //Handles the separators between the entries of an object or an array
+    bool nextEntry(const char close)
+    {
+        skipWhitespace();
+        if (m_cur == m_end)
+            return fail();
+
+        if (*m_cur == close) {
+            ++m_cur;
+            m_needComma = true;
+            return false;
+        }
+
+        if (m_needComma) {
+            if (*m_cur != ',')
+                return fail();
+            ++m_cur;
+            skipWhitespace();
+        }
+        m_needComma = false;
+        return true;
+    }
+
+    bool expectLiteral(const char* literal, const qsizetype length)
+    {
+        if (m_end - m_cur < length || std::memcmp(m_cur, literal, size_t(length)) != 0)
+            return fail();
+        m_cur += length;
+        m_needComma = true;
+        return true;
+    }
+
+    //Validates the JSON number grammar and consumes it
+    bool scanNumber(bool& integral)
+    {
+        if (m_cur != m_end && *m_cur == '-')
+            ++m_cur;
+
+        if (m_cur == m_end || !isDigit(*m_cur))
+            return fail();
+        if (*m_cur == '0')
+            ++m_cur;
+        else
+            while (m_cur != m_end && isDigit(*m_cur))
+                ++m_cur;
+
+        if (m_cur != m_end && *m_cur == '.') {
+            integral = false;
+            ++m_cur;
+            if (m_cur == m_end || !isDigit(*m_cur))
+                return fail();
+            while (m_cur != m_end && isDigit(*m_cur))
+                ++m_cur;
+        }
+
+        if (m_cur != m_end && (*m_cur == 'e' || *m_cur == 'E')) {
+            integral = false;
+            ++m_cur;
+            if (m_cur != m_end && (*m_cur == '+' || *m_cur == '-'))
+                ++m_cur;
+            if (m_cur == m_end || !isDigit(*m_cur))
+                return fail();
+            while (m_cur != m_end && isDigit(*m_cur))
+                ++m_cur;
+        }
+
+        m_needComma = true;
+        return true;
+    }
+
+    //Finds the bounds of the string the reader is positioned on, without decoding it
+    bool scanString(const char*& start, qsizetype& length, bool& escaped)
+    {
+        ++m_cur;
+        start = m_cur;
+        escaped = false;
+        while (m_cur != m_end) {
+            const char c = *m_cur;
+            if (c == '"') {
+                length = m_cur - start;
+                ++m_cur;
+                return true;
+            }
+            if (static_cast<unsigned char>(c) < 0x20)
+                return fail();
+            if (c == '\\') {
+                escaped = true;
+                if (++m_cur == m_end)
+                    break;
+            }
+            ++m_cur;
+        }
+        return fail();
+    }
+
+    static int hexValue(const char c)
+    {
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        return -1;
+    }
+
+    static bool readHex4(const char* it, const char* end, unsigned& out)
+    {
+        if (end - it < 4)
+            return false;
+        out = 0;
+        for (int i = 0; i < 4; ++i) {
+            const int digit = hexValue(it[i]);
+            if (digit < 0)
+                return false;
+            out = (out << 4) | unsigned(digit);
+        }
+        return true;
+    }
+
+    static void appendUtf8(std::string& out, unsigned codePoint)
+    {
+        if (codePoint < 0x80) {
+            out += char(codePoint);
+        }
+        else if (codePoint < 0x800) {
+            out += char(0xC0 | (codePoint >> 6));
+            out += char(0x80 | (codePoint & 0x3F));
+        }
+        else if (codePoint < 0x10000) {
+            out += char(0xE0 | (codePoint >> 12));
+            out += char(0x80 | ((codePoint >> 6) & 0x3F));
+            out += char(0x80 | (codePoint & 0x3F));
+        }
+        else {
+            out += char(0xF0 | (codePoint >> 18));
+            out += char(0x80 | ((codePoint >> 12) & 0x3F));
+            out += char(0x80 | ((codePoint >> 6) & 0x3F));
+            out += char(0x80 | (codePoint & 0x3F));
+        }
+    }
+
+    //Resolves the escape sequences of a string scanned by scanString()
+    bool unescape(const char* it, const qsizetype length, std::string& out)
+    {
+        const char* end = it + length;
+        out.reserve(out.size() + size_t(length));
+        while (it != end) {
+            const char* plain = it;
+            while (it != end && *it != '\\')
+                ++it;
+            out.append(plain, size_t(it - plain));
+            if (it == end)
+                break;
+
+            ++it;
+            switch (*it++) {
+            case '"': out += '"'; break;
+            case '\\': out += '\\'; break;
+            case '/': out += '/'; break;
+            case 'b': out += '\b'; break;
+            case 'f': out += '\f'; break;
+            case 'n': out += '\n'; break;
+            case 'r': out += '\r'; break;
+            case 't': out += '\t'; break;
+            case 'u': {
+                unsigned codePoint;
+                if (!readHex4(it, end, codePoint))
+                    return fail();
+                it += 4;
+
+                //Combine the surrogate pairs, lone surrogates are replaced by U+FFFD
+                if (codePoint >= 0xD800 && codePoint < 0xDC00) {
+                    unsigned low;
+                    if (end - it >= 6 && it[0] == '\\' && it[1] == 'u' && readHex4(it + 2, end, low) && low >= 0xDC00 && low < 0xE000) {
+                        codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+                        it += 6;
+                    }
+                    else {
+                        codePoint = 0xFFFD;
+                    }
+                }
+                else if (codePoint >= 0xDC00 && codePoint < 0xE000) {
+                    codePoint = 0xFFFD;
+                }
+                appendUtf8(out, codePoint);
+                break;
+            }
+            default:
+                return fail();
+            }
+        }
+        return true;
+    }
+};
+
+}
+
+#endif // TAGGEDJSONREADER_H
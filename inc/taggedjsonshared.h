@@ -0,0 +1,177 @@
+#ifndef TAGGEDJSONSHARED_H
+#define TAGGEDJSONSHARED_H
+#include <atomic>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <QJsonValue>
+#include "taggedjsonarray.h"
+#include "taggedjsonreader.h"
+#include "taggedjsonwriter.h"
+#include "taggedjsonforward.h"
+#include "taggedjsonassign.h"
+#include "taggedjsonmergepatch.h"
+
+/*!
+ * \class TaggedJSONShared
+ * \brief The TaggedJSONShared class holds a tagged object or a member in implicitly shared, copy-on-write storage.
+ *
+ * Copying a TaggedJSONShared only increments a reference count, the same as copying a QJsonObject, whatever the size of the stored value is.
+ * The copies share the value until one of them is accessed mutably (operator*, detach(), assign(), readJson() etc.), which copies the value
+ * for that copy first (detaches) if it's shared. A copy can be handed to another thread as a read-only snapshot: the const accessors,
+ * toJsonValue(), writeJson() and writeCbor() can be used on the copies of the same value from several threads at once, the same as the const
+ * methods of the stored value (toJsonObject(), toJson() etc.), none of which write to it.\n
+ * A reference that has been taken through the mutable accessors points into the storage of that copy, it must not be used after the
+ * TaggedJSONShared has been copied.\n
+ * TaggedJSONShared can be a member of the #TJO_DEFINE_JSON_TAGGED_OBJECT() macro, in which case copying the object that holds it doesn't copy the
+ * stored value either. The JSON, CBOR and validation behavior is the one of the stored type.
+ * \code
+ * TaggedJSONShared<Catalog> catalog(Catalog::fromFile(path));
+ * TaggedJSONShared<Catalog> snapshot = catalog;      //no copy of the catalog
+ * worker.post([snapshot] { index(*snapshot); });
+ * (*catalog).title = QString("Updated");           //the catalog detaches, the snapshot keeps the previous value
+ * \endcode
+ * \tparam M Tagged object or member type of the stored value
+ */
+template<typename M>
+class TaggedJSONShared : public TaggedObject::ModificationTracking
+{
+public:
+    //! Type of the stored value
+    using SharedType = M;
+
+    //! Default constructor, the default constructed instances share a single default value until they are modified
+    explicit TaggedJSONShared() : m_data(defaultData()) {}
+
+    /*!
+     * \brief TaggedJSONShared constructor variant that takes QJsonValue input
+     *
+     * This constructor is intended for the #TJO_DEFINE_JSON_TAGGED_OBJECT() macro
+     * \param ref target JSON data
+     * \param checkValue If set to true, invalid conversions (missing value, wrong type etc.) will throw a runtime error.
+     */
+    explicit TaggedJSONShared(const QJsonValue& ref, const bool checkValue = true) : m_data(std::make_shared<M>(ref, checkValue)) {}
+
+    //! Implicit value constructor, the value is moved into the shared storage
+    template<typename V, typename = std::enable_if_t<std::is_convertible_v<V, M> && !std::is_same_v<std::decay_t<V>, TaggedJSONShared>>>
+    TaggedJSONShared(V&& val) : m_data(std::make_shared<M>(std::forward<V>(val))) {}
+
+    TaggedJSONShared(const TaggedJSONShared&) = default;
+
+    //! Move constructor, the source is left with the default value
+    TaggedJSONShared(TaggedJSONShared&& other) noexcept : TaggedObject::ModificationTracking(other), m_data(std::exchange(other.m_data, defaultData())) {}
+
+    //! Copy assignment, shares the value of the other instance. The value counts as modified.
+    TaggedJSONShared& operator=(const TaggedJSONShared& other) { m_data = other.m_data; markModified(); return *this; }
+
+    //! Move assignment, the source is left with the default value. The value counts as modified.
+    TaggedJSONShared& operator=(TaggedJSONShared&& other) noexcept { m_data = std::exchange(other.m_data, defaultData()); markModified(); return *this; }
+
+    //! Assignment operator setter, the value is moved into new storage. The value counts as modified.
+    template<typename V, typename = std::enable_if_t<std::is_convertible_v<V, M> && !std::is_same_v<std::decay_t<V>, TaggedJSONShared>>>
+    TaggedJSONShared& operator=(V&& val) { m_data = std::make_shared<M>(std::forward<V>(val)); markModified(); return *this; }
+
+    //! Mutable reference of the stored value, detaches first. The value counts as modified.
+    M& operator*() { return detach(); }
+
+    //! Immutable reference of the stored value, never detaches
+    const M& operator*() const { return *m_data; }
+
+    //! Can be used for accessing the members of the stored value
+    const M* operator->() const { return m_data.get(); }
+
+    /*!
+     * \brief detach Makes the stored value owned by this instance only, copies it if it's shared. The value counts as modified.
+     * \return Mutable reference of the stored value
+     */
+    M& detach()
+    {
+        markModified();
+        return ownValue();
+    }
+
+    //! Returns true if no other instance shares the stored value
+    bool isDetached() const { return m_data.use_count() == 1; }
+
+    //! Returns true if the other instance shares the same stored value
+    bool isSharedWith(const TaggedJSONShared& other) const { return m_data == other.m_data; }
+
+    /*!
+     * \brief assign In-place counterpart of the QJsonValue constructor
+     *
+     * A detached value is assigned in place (see TaggedObject::assignMember()), a shared one is replaced without copying it first.
+     * \param ref target JSON data
+     * \param checkValue If set to true, invalid conversions (missing value, wrong type etc.) will throw a runtime error.
+     */
+    void assign(const QJsonValue& ref, const bool checkValue = true)
+    {
+        if (isDetached())
+            TaggedObject::assignMember(detach(), ref, checkValue);
+        else {
+            m_data = std::make_shared<M>(ref, checkValue);
+            markModified();
+        }
+    }
+
+    //! Error-collecting validation of the stored type
+    static void validateJson(const QJsonValue& ref, TaggedObject::ValidationContext& context) { TaggedObject::validateMemberValue<M>(ref, context); }
+
+    //! Converts the stored value to JSON
+    QJsonValue toJsonValue() const { return QJsonValue(m_data->toJsonValue()); }
+
+
+    /*!
+     * \brief readJson Direct-binding counterpart of the QJsonValue constructor, detaches and reads the value in place.
+     * \param reader JSON reader positioned on the value of this member
+     * \param checkValue If set to true, missing members of tagged objects will throw a runtime error.
+     */
+    void readJson(TaggedObject::JsonReader& reader, const bool checkValue = true) { TaggedObject::readMember(ownValue(), reader, checkValue, false); }
+
+    /*!
+     * \brief replaceJson Counterpart of readJson() that resets the members that aren't in the text, a shared value is replaced without copying it first.
+     * \param reader JSON reader positioned on the value of this member
+     * \param checkValue If set to true, missing members of tagged objects will throw a runtime error.
+     */
+    void replaceJson(TaggedObject::JsonReader& reader, const bool checkValue = true)
+    {
+        if (!isDetached())
+            m_data = std::make_shared<M>();
+        TaggedObject::readMember(ownValue(), reader, checkValue, true);
+    }
+
+    //! Direct serialization of the stored value
+    void writeJson(TaggedObject::JsonWriter& writer) const { m_data->writeJson(writer); }
+
+    //! CBOR counterpart of readJson(), detaches and reads the value in place
+    template<typename Reader>
+    void readCbor(Reader& reader, const bool checkValue = true) { ownValue().readCbor(reader, checkValue); }
+
+    //! CBOR counterpart of writeJson()
+    template<typename Writer>
+    void writeCbor(Writer& writer) const { m_data->writeCbor(writer); }
+
+private:
+    std::shared_ptr<M> m_data;
+
+    //Detaches without counting as a modification, the readers use it (see TaggedObject::JsonObjectCache)
+    M& ownValue()
+    {
+        if (m_data.use_count() != 1)
+            m_data = std::make_shared<M>(std::as_const(*m_data));
+        else
+            std::atomic_thread_fence(std::memory_order_acquire); //Orders the writes after the reads of the copies that have released the value
+        return *m_data;
+    }
+
+    static const std::shared_ptr<M>& defaultData()
+    {
+        static const std::shared_ptr<M> data = std::make_shared<M>();
+        return data;
+    }
+};
+
+//! Implicitly shared array of tagged objects, copies of the objects that hold it share the elements
+template<typename T>
+using TaggedJSONSharedArray = TaggedJSONShared<TaggedJSONArray<T>>;
+
+#endif // TAGGEDJSONSHARED_H
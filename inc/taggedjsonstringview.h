@@ -0,0 +1,217 @@
+#ifndef TAGGEDJSONSTRINGVIEW_H
+#define TAGGEDJSONSTRINGVIEW_H
+#include <memory>
+#include <stdexcept>
+#include <ostream>
+#include <string_view>
+#include <QByteArray>
+#include <QJsonValue>
+#include <QString>
+#include "taggedjsonreader.h"
+#include "taggedjsonwriter.h"
+#include "taggedjsonforward.h"
+
+/*!
+ * \class TaggedJSONStringView
+ * \brief The TaggedJSONStringView class is the zero-copy variant of TaggedJSONString, it refers to the string in the JSON text instead of decoding it.
+ *
+ * In the direct-binding mode (fromJson() of the classes generated by the #TJO_DEFINE_JSON_TAGGED_OBJECT() macro) the member keeps the position of the
+ * string in the source text and decodes it only when it's asked for (toString(), toUtf8()). Comparisons with UTF-8 text and direct serialization
+ * (writeJson()) work on the source bytes, so the strings that are only compared or forwarded never allocate.\n
+ * Lifetime: if the reader has been constructed from a QByteArray (as in fromJson()), the member shares that QByteArray, which keeps the text alive
+ * without copying it. A QByteArray made by QByteArray::fromRawData() doesn't own its data, the memory it refers to has to outlive the member unless
+ * the reader has an owner for it. fromFile(), TaggedObject::JsonFileLoader and TaggedObject::JsonFileCache give the reader the TaggedObject::JsonFileData
+ * as the owner, so the members refer to the mapped file and keep it open and mapped, as a whole, until the last of them is destroyed. Readers over raw
+ * memory ranges give no such guarantee, the string content is copied then (still without decoding it).\n
+ * The QJsonValue constructor and the CBOR path store the decoded QString instead, there is no text to refer to.\n
+ * Strings that aren't valid UTF-8 are checked once when they are read and always go through the decoding, like the escaped ones, so their invalid
+ * sequences are replaced by U+FFFD in every output, the same as the QString of TaggedJSONString.
+ */
+class TaggedJSONStringView
+{
+public:
+    //! Default constructor, holds an empty string
+    explicit TaggedJSONStringView() {}
+
+    /*!
+     * \brief TaggedJSONStringView Constructor that stores the decoded string of the given JSON value
+     * \param val Target JSON value to be stored.
+     * \param checkValue If set to true, missing values will throw a runtime error.
+     */
+    explicit TaggedJSONStringView(const QJsonValue& val, const bool checkValue = true) : m_string(val.toString())
+    {
+        //Check if there is a valid data if it's intended
+        if (checkValue && val.isUndefined())
+            throw(std::runtime_error("Invalid data has been encountered while parsing the json data for TaggedJSONStringView"));
+    }
+
+    //! Implicit value constructor for the tagged object constructor
+    TaggedJSONStringView(const QString& val) : m_string(val) {}
+
+    //! Returns true if the member refers to the source text rather than holding a decoded string
+    bool isView() const { return m_isView; }
+
+    //! Returns true if the referenced text has escape sequences, which have to be decoded before the bytes can be used as they are
+    bool isEscaped() const { return m_isView && m_escaped; }
+
+    /*!
+     * \brief rawUtf8 Bytes of the string as they appear in the source text, escape sequences included
+     * \return The referenced bytes, empty if the member holds a decoded string
+     */
+    std::string_view rawUtf8() const
+    {
+        return m_isView ? std::string_view(m_source.constData() + m_offset, static_cast<std::size_t>(m_size)) : std::string_view();
+    }
+
+    //! Decodes the string, it allocates on every call
+    QString toString() const
+    {
+        if (!m_isView)
+            return m_string;
+        if (!m_escaped)
+            return QString::fromUtf8(m_source.constData() + m_offset, m_size);
+
+        //The quotes around the content are part of the source, the reader decodes the escape sequences
+        TaggedObject::JsonReader reader(m_source.constData() + m_offset - 1, m_size + 2);
+        return reader.readString();
+    }
+
+    //! Decoded string as UTF-8, it refers to the source without copying it if there is nothing to decode
+    QByteArray toUtf8() const
+    {
+        if (!m_isView)
+            return m_string.toUtf8();
+        if (isPlainUtf8())
+            return QByteArray::fromRawData(m_source.constData() + m_offset, m_size);
+        return toString().toUtf8();
+    }
+
+    //! Returns true if the string is empty
+    bool isEmpty() const { return m_isView ? m_size == 0 : m_string.isEmpty(); }
+
+    //! Compares with UTF-8 text, without decoding the referenced string if it has no escape sequences
+    bool operator==(const std::string_view utf8) const
+    {
+        if (isPlainUtf8())
+            return rawUtf8() == utf8;
+        const QByteArray decoded = toUtf8();
+        return std::string_view(decoded.constData(), static_cast<std::size_t>(decoded.size())) == utf8;
+    }
+    bool operator!=(const std::string_view utf8) const { return !(*this == utf8); }
+    bool operator==(const char* utf8) const { return *this == std::string_view(utf8); }
+    bool operator!=(const char* utf8) const { return !(*this == utf8); }
+    bool operator==(const QString& other) const { return toString() == other; }
+    bool operator!=(const QString& other) const { return !(*this == other); }
+    bool operator==(const TaggedJSONStringView& other) const
+    {
+        if (isPlainUtf8() && other.isPlainUtf8())
+            return rawUtf8() == other.rawUtf8();
+        return toString() == other.toString();
+    }
+    bool operator!=(const TaggedJSONStringView& other) const { return !(*this == other); }
+
+    //!\brief operator QString QString constructor variant for qDebug stream access.
+    operator QString() const { return toString(); }
+
+    QJsonValue toJsonValue() const { return toString(); }
+
+    //! Error-collecting validation, reports a missing value or a value that isn't a string
+    template<typename Context>
+    static void validateJson(const QJsonValue& val, Context& context) { TaggedObject::validateJsonValue<QString>(val, context); }
+
+    /*!
+     * \brief readJson Direct-binding counterpart of the QJsonValue constructor, refers to the string the reader is positioned on.
+     * \param reader JSON reader positioned on the value of this member
+     * \param checkValue Unused, the value exists if the reader is positioned on it. Kept for the uniform member interface.
+     */
+    void readJson(TaggedObject::JsonReader& reader, const bool checkValue = true)
+    {
+        Q_UNUSED(checkValue)
+        *this = TaggedJSONStringView();
+        if (reader.peek() != TaggedObject::JsonReader::Token::String) {
+            reader.skipValue();
+            return;
+        }
+
+        const char* data = nullptr;
+        qsizetype size = 0;
+        bool escaped = false;
+        if (!reader.readRawString(data, size, escaped))
+            return;
+
+        if (reader.source()) {
+            m_offset = data - reader.source()->constData();
+            m_source = *reader.source();
+            m_owner = reader.owner();
+        }
+        else {
+            //Nothing keeps the raw memory alive, the quoted text is copied
+            m_source = QByteArray(data - 1, size + 2);
+            m_offset = 1;
+        }
+        m_size = size;
+        m_escaped = escaped;
+        m_validUtf8 = TaggedObject::isValidUtf8(data, size);
+        m_isView = true;
+    }
+
+    /*!
+     * \brief writeJson Direct serialization counterpart of toJsonValue(), the referenced bytes are written without decoding them if possible.
+     * \param writer JSON writer positioned where the value of this member belongs
+     */
+    void writeJson(TaggedObject::JsonWriter& writer) const
+    {
+        if (isPlainUtf8())
+            writer.writeUtf8String(rawUtf8());
+        else
+            writer.writeString(toString());
+    }
+
+    /*!
+     * \brief readCbor CBOR counterpart of readJson(), the string is decoded as CBOR has no JSON text to refer to.
+     * \param reader CBOR reader positioned on the value of this member
+     * \param checkValue Unused, the value exists if the reader is positioned on it. Kept for the uniform member interface.
+     */
+    template<typename Reader>
+    void readCbor(Reader& reader, const bool checkValue = true)
+    {
+        Q_UNUSED(checkValue)
+        *this = TaggedJSONStringView();
+        TaggedObject::readCborString(reader, m_string);
+    }
+
+    /*!
+     * \brief writeCbor CBOR counterpart of writeJson()
+     * \param writer CBOR writer positioned where the value of this member belongs
+     */
+    template<typename Writer>
+    void writeCbor(Writer& writer) const { writer.append(toString()); }
+
+private:
+    //The referenced bytes can be used as they are, without escape sequences and invalid UTF-8
+    bool isPlainUtf8() const { return m_isView && !m_escaped && m_validUtf8; }
+
+    QByteArray m_source;
+    std::shared_ptr<const void> m_owner;
+    qsizetype m_offset = 0;
+    qsizetype m_size = 0;
+    bool m_escaped = false;
+    bool m_validUtf8 = true;
+    bool m_isView = false;
+    QString m_string;
+};
+
+/*!
+ * \brief operator << stdout implementation for the contained string.
+ * \param stream The std stream
+ * \param obj The class instance
+ * \return The output stream
+ */
+inline std::ostream& operator<< (std::ostream& stream, const TaggedJSONStringView& obj)
+{
+    const QByteArray text = obj.toUtf8();
+    stream.write(text.constData(), static_cast<std::streamsize>(text.size()));
+    return stream;
+}
+
+#endif // TAGGEDJSONSTRINGVIEW_H
@@ -0,0 +1,253 @@
+#ifndef TAGGEDJSONTHREADPOOL_H
+#define TAGGEDJSONTHREADPOOL_H
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <QtGlobal>
+#include "taggedjsonmemory.h"
+
+namespace TaggedObject {
+
+/*!
+ * \class WorkStealingPool
+ * \brief The WorkStealingPool class runs tasks on a fixed set of threads, each of them with its own task queue.
+ *
+ * Tasks submitted from outside of the pool are spread over the queues in turn, tasks submitted by a worker go to its own queue.
+ * A worker takes the newest task of its own queue first and steals the oldest task of another queue once its own queue runs dry,
+ * which keeps all cores busy even if the tasks have very different costs.\n
+ * The tasks run outside of any TaggedObject::MemoryResourceScope, also when a thread that is inside of a scope helps with runPendingTask(),
+ * so the objects a task builds never allocate from the scoped resource of another thread.\n
+ * Tasks mustn't throw, callers that need the exceptions have to capture them inside the task.
+ */
+class WorkStealingPool
+{
+public:
+    /*!
+     * \brief WorkStealingPool Starts the worker threads
+     * \param threadCount Number of the workers, 0 selects the number of the hardware threads
+     */
+    explicit WorkStealingPool(const int threadCount = 0)
+    {
+        const int count = threadCount > 0 ? threadCount : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+        m_queues.reserve(count);
+        for (int i = 0; i < count; ++i)
+            m_queues.push_back(std::make_unique<Queue>());
+        m_threads.reserve(count);
+        for (int i = 0; i < count; ++i)
+            m_threads.emplace_back([this, i] { workerLoop(i); });
+    }
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    //! Waits for the queued tasks and stops the workers
+    ~WorkStealingPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_sleepMutex);
+            m_stopping = true;
+        }
+        m_wakeUp.notify_all();
+        for (std::thread& thread : m_threads)
+            thread.join();
+    }
+
+    //! Shared pool that uses all of the hardware threads
+    static WorkStealingPool& global()
+    {
+        static WorkStealingPool pool;
+        return pool;
+    }
+
+    //! Number of the worker threads
+    int threadCount() const { return static_cast<int>(m_threads.size()); }
+
+    //! Returns true if the calling thread is one of the workers of this pool
+    bool isWorkerThread() const { return currentWorker().pool == this; }
+
+    /*!
+     * \brief submit Queues a task
+     * \param task The task to run, it mustn't throw
+     */
+    void submit(std::function<void()> task)
+    {
+        const Worker& worker = currentWorker();
+        const std::size_t index = worker.pool == this ? worker.index : m_nextQueue.fetch_add(1, std::memory_order_relaxed) % m_queues.size();
+        {
+            std::lock_guard<std::mutex> lock(m_sleepMutex);
+            ++m_pending;
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_queues[index]->mutex);
+            m_queues[index]->tasks.push_back(std::move(task));
+        }
+        m_wakeUp.notify_one();
+    }
+
+    /*!
+     * \brief runPendingTask Runs one of the queued tasks on the calling thread
+     *
+     * Threads that wait for the results of their own tasks call it to help instead of blocking, which also keeps nested parallel work from dead-locking the workers.
+     * \return false if there wasn't any queued task
+     */
+    bool runPendingTask()
+    {
+        const Worker& worker = currentWorker();
+        std::function<void()> task;
+        if (!takeTask(worker.pool == this ? worker.index : 0, task))
+            return false;
+        runTask(task);
+        return true;
+    }
+
+private:
+    struct Queue
+    {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    struct Worker
+    {
+        const WorkStealingPool* pool = nullptr;
+        std::size_t index = 0;
+    };
+
+    std::vector<std::unique_ptr<Queue>> m_queues;
+    std::vector<std::thread> m_threads;
+    std::atomic<std::size_t> m_nextQueue{0};
+    std::mutex m_sleepMutex;
+    std::condition_variable m_wakeUp;
+    std::size_t m_pending = 0;
+    bool m_stopping = false;
+
+    static Worker& currentWorker()
+    {
+        static thread_local Worker worker;
+        return worker;
+    }
+
+    bool takeTask(const std::size_t ownIndex, std::function<void()>& task)
+    {
+        //Newest task of the own queue first, then the oldest one of the others
+        for (std::size_t i = 0; i < m_queues.size(); ++i) {
+            Queue& queue = *m_queues[(ownIndex + i) % m_queues.size()];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (queue.tasks.empty())
+                continue;
+            if (i == 0) {
+                task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+            }
+            else {
+                task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+            }
+            std::lock_guard<std::mutex> sleepLock(m_sleepMutex);
+            --m_pending;
+            return true;
+        }
+        return false;
+    }
+
+    static void runTask(const std::function<void()>& task)
+    {
+        //The task may have been submitted by another thread, the scope of the running thread is restored after it
+        const MemoryResourceScope noScope(nullptr);
+        task();
+    }
+
+    void workerLoop(const std::size_t index)
+    {
+        currentWorker() = Worker{this, index};
+        std::function<void()> task;
+        while (true) {
+            if (takeTask(index, task)) {
+                runTask(task);
+                task = nullptr;
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(m_sleepMutex);
+            m_wakeUp.wait(lock, [this] { return m_pending > 0 || m_stopping; });
+            if (m_pending == 0 && m_stopping)
+                return;
+        }
+    }
+};
+
+/*!
+ * \brief parallelFor Calls the body for every index in [0, count) on the global WorkStealingPool
+ *
+ * The range is split into chunks of at least \a grain indices. The calling thread runs the queued tasks while it waits, so parallelFor can be nested.\n
+ * Exceptions are deterministic: if the body throws for several indices, the exception of the lowest index is rethrown, the same one a sequential loop would throw.
+ * Every index below it has been processed by then, the indices above it may or may not have been.
+ * \param count Number of the indices
+ * \param grain Minimum number of the indices per task
+ * \param body Callable that takes the index, it is called concurrently
+ */
+template<typename Body>
+void parallelFor(const qsizetype count, const qsizetype grain, const Body& body)
+{
+    WorkStealingPool& pool = WorkStealingPool::global();
+    const qsizetype chunkSize = std::max<qsizetype>({grain, qsizetype(1), count / (4 * pool.threadCount())});
+    const qsizetype chunkCount = (count + chunkSize - 1) / chunkSize;
+
+    std::mutex mutex;
+    std::condition_variable finished;
+    qsizetype remaining = chunkCount;
+    std::atomic<qsizetype> firstFailure{std::numeric_limits<qsizetype>::max()};
+    std::exception_ptr error;
+
+    for (qsizetype chunk = 0; chunk < chunkCount; ++chunk) {
+        pool.submit([&, chunk] {
+            const qsizetype end = std::min(count, (chunk + 1) * chunkSize);
+            for (qsizetype i = chunk * chunkSize; i < end && i < firstFailure.load(std::memory_order_relaxed); ++i) {
+                try {
+                    body(i);
+                }
+                catch (...) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (i < firstFailure.load(std::memory_order_relaxed)) {
+                        firstFailure.store(i, std::memory_order_relaxed);
+                        error = std::current_exception();
+                    }
+                    break;
+                }
+            }
+
+            //Notified under the lock, the waiting thread may release the state as soon as it sees the last chunk
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--remaining == 0)
+                finished.notify_all();
+        });
+    }
+
+    while (true) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (remaining == 0)
+                break;
+        }
+        if (!pool.runPendingTask()) {
+            std::unique_lock<std::mutex> lock(mutex);
+            finished.wait(lock, [&] { return remaining == 0; });
+            break;
+        }
+    }
+
+    if (error)
+        std::rethrow_exception(error);
+}
+
+}
+
+#endif // TAGGEDJSONTHREADPOOL_H
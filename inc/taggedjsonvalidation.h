@@ -0,0 +1,334 @@
+#ifndef TAGGEDJSONVALIDATION_H
+#define TAGGEDJSONVALIDATION_H
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <QByteArray>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonParseError>
+#include <QJsonValue>
+#include <QString>
+#include "taggedjsonnumber.h"
+#include "taggedjsonforward.h"
+#include "taggedjsonmembers.h"
+
+/*!
+ * Error-collecting validation of the QJsonObject based construction.\n
+ * The strict constructors (checkValues set) throw on the first missing member. The validation walks the whole object instead and collects an error
+ * with the JSON path of every missing member and every value of an unexpected type, without throwing. The generated classes use it in tryFrom() and
+ * tryFromJson(), which return a ValidationResult that holds either the object or the errors.\n
+ * The validation is opt-in, the translation units that call validateJson(), validate(), tryFrom() or tryFromJson() include this header.
+ */
+namespace TaggedObject {
+
+    /*!
+     * \class ValidationError
+     * \brief The ValidationError class describes a single problem of a JSON document.
+     */
+    struct ValidationError
+    {
+        enum class Kind
+        {
+            MissingField,     //!< The member has no value
+            TypeMismatch,     //!< The value has another type than the member, the strict constructors would fall back to the default value
+            MalformedDocument //!< The JSON text can't be parsed
+        };
+
+        Kind kind;
+        //! JSON path of the value, "$" is the document, for example "$.ships[1].id"
+        QString path;
+        //! Expected JSON type of the TypeMismatch errors ("integer", "string" etc.), empty otherwise
+        std::string_view expected;
+        //! Parser message of the MalformedDocument errors, empty otherwise
+        QString detail;
+
+        //! Human readable description, for example "$.ships[1].id: expected integer"
+        QString message() const
+        {
+            switch (kind) {
+            case Kind::MissingField:
+                return path + QStringLiteral(": missing");
+            case Kind::TypeMismatch:
+                return path + QStringLiteral(": expected ") + QString::fromLatin1(expected.data(), static_cast<qsizetype>(expected.size()));
+            case Kind::MalformedDocument:
+                break;
+            }
+            return path + QStringLiteral(": malformed JSON, ") + detail;
+        }
+    };
+
+    using ValidationErrors = std::vector<ValidationError>;
+
+    /*!
+     * \class ValidationContext
+     * \brief The ValidationContext class keeps the current JSON path and the errors of a validation.
+     *
+     * The path is kept as a stack of member names and array indices, the path string is built only if there is an error to report. The member names
+     * refer to static strings.
+     */
+    class ValidationContext
+    {
+    public:
+        //! Enters the member with the given name
+        void enter(const std::string_view key) { m_path.push_back(Segment{key, -1}); }
+
+        //! Enters the array element with the given index
+        void enter(const qsizetype index) { m_path.push_back(Segment{{}, index}); }
+
+        //! Leaves the innermost member or element
+        void leave() { m_path.pop_back(); }
+
+        //! Reports the current value as missing
+        void missing() { m_errors.push_back(ValidationError{ValidationError::Kind::MissingField, path(), {}, {}}); }
+
+        //! Reports the current value as having another type than the expected one
+        void mismatch(const std::string_view expected) { m_errors.push_back(ValidationError{ValidationError::Kind::TypeMismatch, path(), expected, {}}); }
+
+        //! Reports a JSON text that can't be parsed
+        void malformed(const QString& detail) { m_errors.push_back(ValidationError{ValidationError::Kind::MalformedDocument, path(), {}, detail}); }
+
+        bool hasErrors() const { return !m_errors.empty(); }
+        const ValidationErrors& errors() const { return m_errors; }
+        ValidationErrors takeErrors() { return std::move(m_errors); }
+
+        //! JSON path of the current value
+        QString path() const
+        {
+            QString ret = QStringLiteral("$");
+            for (const Segment& segment : m_path) {
+                if (segment.index < 0)
+                    ret += QStringLiteral(".") + QString::fromUtf8(segment.key.data(), static_cast<qsizetype>(segment.key.size()));
+                else
+                    ret += QStringLiteral("[") + QString::number(segment.index) + QStringLiteral("]");
+            }
+            return ret;
+        }
+
+    private:
+        struct Segment
+        {
+            std::string_view key;
+            qsizetype index;
+        };
+
+        std::vector<Segment> m_path;
+        ValidationErrors m_errors;
+    };
+
+    //! Name of the JSON type T is converted from, used in the TypeMismatch errors
+    template<typename T>
+    constexpr std::string_view jsonTypeName()
+    {
+        if constexpr (std::is_same_v<T, bool>)
+            return "boolean";
+        else if constexpr (std::is_integral_v<T>)
+            return "integer";
+        else if constexpr (std::is_floating_point_v<T>)
+            return "number";
+        else if constexpr (std::is_same_v<T, QJsonObject>)
+            return "object";
+        else if constexpr (std::is_same_v<T, QString>)
+            return "string";
+        else
+            return "value";
+    }
+
+    //! Validates a value that is converted into T, such as the value of a TaggedJSONObject
+    template<typename T>
+    void validateJsonValue(const QJsonValue& val, ValidationContext& context)
+    {
+        if (val.isUndefined())
+            context.missing();
+        else if (!matchesJsonType<T>(val))
+            context.mismatch(jsonTypeName<T>());
+    }
+
+    //! Validates an array whose elements are converted into T, an element of another type is reported with its index
+    template<typename T>
+    void validateJsonValueArray(const QJsonValue& val, ValidationContext& context)
+    {
+        if (val.isUndefined()) {
+            context.missing();
+            return;
+        }
+        if (!val.isArray()) {
+            context.mismatch("array");
+            return;
+        }
+        const QJsonArray arr = val.toArray();
+        for (qsizetype i = 0; i < arr.size(); ++i) {
+            if (!matchesJsonType<T>(arr.at(i))) {
+                context.enter(i);
+                context.mismatch(jsonTypeName<T>());
+                context.leave();
+            }
+        }
+    }
+
+    //! Validates an array of tagged objects, every element is validated by T
+    template<typename T>
+    void validateTaggedArray(const QJsonValue& val, ValidationContext& context)
+    {
+        if (val.isUndefined()) {
+            context.missing();
+            return;
+        }
+        if (!val.isArray()) {
+            context.mismatch("array");
+            return;
+        }
+        const QJsonArray arr = val.toArray();
+        for (qsizetype i = 0; i < arr.size(); ++i) {
+            context.enter(i);
+            T::validateJson(arr.at(i), context);
+            context.leave();
+        }
+    }
+
+    //! Detects the member types that validate their values
+    template<typename M, typename = void>
+    struct HasJsonValidation : std::false_type {};
+
+    template<typename M>
+    struct HasJsonValidation<M, std::void_t<decltype(M::validateJson(std::declval<const QJsonValue&>(), std::declval<ValidationContext&>()))>> : std::true_type {};
+
+    //! Validates a value of the member type M, the members without validation are only checked for presence
+    template<typename M>
+    void validateMemberValue(const QJsonValue& val, ValidationContext& context)
+    {
+        if constexpr (HasJsonValidation<M>::value)
+            M::validateJson(val, context);
+        else if (val.isUndefined())
+            context.missing();
+    }
+
+    //! Validates the value of a member under its name
+    template<typename M>
+    void validateMember(const QJsonObject& obj, const QString& key, const std::string_view name, ValidationContext& context)
+    {
+        context.enter(name);
+        validateMemberValue<M>(obj[key], context);
+        context.leave();
+    }
+
+    /*!
+     * \class ValidationResult
+     * \brief The ValidationResult class holds either a constructed object or the errors that have prevented its construction.
+     *
+     * It is the expected-style result of tryFrom() and tryFromJson() of the generated classes.
+     */
+    template<typename T>
+    class ValidationResult
+    {
+    public:
+        //! Successful result
+        ValidationResult(T value) : m_value(std::move(value)) {}
+
+        //! Failed result
+        ValidationResult(ValidationErrors errors) : m_errors(std::move(errors)) {}
+
+        //! Returns true if the object has been constructed
+        bool hasValue() const { return m_value.has_value(); }
+        explicit operator bool() const { return hasValue(); }
+
+        //! The constructed object, throws a runtime error with the first error if there isn't one
+        T& value()
+        {
+            throwIfFailed();
+            return *m_value;
+        }
+
+        const T& value() const
+        {
+            throwIfFailed();
+            return *m_value;
+        }
+
+        T& operator*() { return *m_value; }
+        const T& operator*() const { return *m_value; }
+        T* operator->() { return &*m_value; }
+        const T* operator->() const { return &*m_value; }
+
+        //! Every error of the document, empty if the object has been constructed
+        const ValidationErrors& errors() const { return m_errors; }
+
+    private:
+        std::optional<T> m_value;
+        ValidationErrors m_errors;
+
+        void throwIfFailed() const
+        {
+            if (!m_value)
+                throw(std::runtime_error("Invalid data has been encountered while parsing the json data: " + (m_errors.empty() ? QString() : m_errors.front().message()).toStdString()));
+        }
+    };
+
+    template<typename C, typename Indices>
+    struct ValidationMembersBase;
+
+    template<typename C, std::size_t... I>
+    struct ValidationMembersBase<C, std::index_sequence<I...>>
+    {
+        using Members = GeneratedMembers<C>;
+
+        static void validateJson(const QJsonValue& val, ValidationContext& context)
+        {
+            if (val.isUndefined()) {
+                context.missing();
+                return;
+            }
+            if (!val.isObject()) {
+                context.mismatch("object");
+                return;
+            }
+            const QJsonObject obj = val.toObject();
+            const auto& keys = fieldKeys<C>();
+            (validateMember<typename Members::template FieldType<I>>(obj, keys[I], Members::template field<I>().name, context), ...);
+        }
+
+        static ValidationErrors validate(const QJsonObject& obj)
+        {
+            ValidationContext context;
+            validateJson(obj, context);
+            return context.takeErrors();
+        }
+
+        static ValidationResult<C> tryFrom(const QJsonObject& obj)
+        {
+            ValidationErrors errors = validate(obj);
+            if (!errors.empty())
+                return ValidationResult<C>(std::move(errors));
+            return C(obj, false);
+        }
+
+        static ValidationResult<C> tryFromJson(const QByteArray& json)
+        {
+            QJsonParseError error;
+            const QJsonDocument document = QJsonDocument::fromJson(json, &error);
+            ValidationContext context;
+            if (error.error != QJsonParseError::NoError)
+                context.malformed(error.errorString() + QStringLiteral(" at offset ") + QString::number(error.offset));
+            else if (!document.isObject())
+                context.mismatch("object");
+            else
+                return tryFrom(document.object());
+            return context.takeErrors();
+        }
+    };
+
+    /*!
+     * \brief The ValidationMembers struct implements the validation methods of the tagged object C, which forwards validateJson(), validate(), tryFrom()
+     * and tryFromJson() to it
+     *
+     * The members are validated in declaration order, nested tagged objects and arrays of them are validated recursively.
+     */
+    template<typename C>
+    struct ValidationMembers : ValidationMembersBase<C, std::make_index_sequence<fieldCount<C>>> {};
+}
+
+#endif // TAGGEDJSONVALIDATION_H
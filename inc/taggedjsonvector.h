@@ -0,0 +1,273 @@
+#ifndef TAGGEDJSONVECTOR_H
+#define TAGGEDJSONVECTOR_H
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <QJsonArray>
+#include <QVector>
+#include "taggedjsonobject.h"
+#include "taggedjsonreader.h"
+#include "taggedjsonwriter.h"
+#include "taggedjsonforward.h"
+
+/*!
+ * \class TaggedJSONVector
+ * \brief The TaggedJSONVector class stores a JSON array of numbers or booleans in a contiguous std::vector.
+ *
+ * It is the contiguous storage mode of TaggedJSONArray<int>, TaggedJSONArray<double> and TaggedJSONArray<bool>. The elements are converted once,
+ * when the array is parsed, and are accessed directly afterwards instead of going through a QJsonValue on every access. data() and size() give
+ * span-like access to the elements for vectorized math (except for bool, which is stored by std::vector<bool>).\n
+ * A QJsonArray is only built when toJsonValue() is called. The element conversions are the same as the ones of TaggedJSONArray.\n
+ * Intended usage of this object is to use this class as member of the #TJO_DEFINE_JSON_TAGGED_OBJECT() macro in place of the arithmetic TaggedJSONArray
+ * types for large numeric payloads.
+ * \tparam T Arithmetic type of the elements
+ */
+template<typename T, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+class TaggedJSONVector
+{
+public:
+    //! Default constructor, which is useful if the parameters planned to be filled later
+    explicit TaggedJSONVector() {}
+
+    /*!
+     * \brief TaggedJSONVector constructor variant that takes QJsonValue input
+     *
+     * This constructor is intended for the #TJO_DEFINE_JSON_TAGGED_OBJECT() macro
+     * \param ref target JSON array data
+     * \param checkValue If set to true, invalid conversions (missing value, wrong type etc.) will throw a runtime error.
+     */
+    explicit TaggedJSONVector(const QJsonValue& ref, const bool checkValue = true)
+    {
+        //Check if there is a valid data if it's intended
+        if (checkValue && ref.isUndefined())
+            throw(std::runtime_error("Invalid data has been encountered while parsing the json data for TaggedJSONVector"));
+
+        const QJsonArray arr = ref.toArray();
+        m_vec.reserve(arr.size());
+        for (const QJsonValue& curVal : arr)
+            m_vec.push_back(dispatchValue(curVal));
+    }
+
+    /*!
+     * \brief assign In-place counterpart of the QJsonValue constructor, the stored vector keeps its capacity
+     * \param ref target JSON array data
+     * \param checkValue If set to true, invalid conversions (missing value, wrong type etc.) will throw a runtime error.
+     */
+    void assign(const QJsonValue& ref, const bool checkValue = true)
+    {
+        if (checkValue && ref.isUndefined())
+            throw(std::runtime_error("Invalid data has been encountered while parsing the json data for TaggedJSONVector"));
+
+        const QJsonArray arr = ref.toArray();
+        m_vec.clear();
+        m_vec.reserve(arr.size());
+        for (const QJsonValue& curVal : arr)
+            m_vec.push_back(dispatchValue(curVal));
+    }
+
+    //! Implicit value constructor for the tagged object constructor
+    template<typename V, typename = std::enable_if_t<std::is_convertible_v<V, std::vector<T>>>>
+    TaggedJSONVector(V&& val) : m_vec(std::forward<V>(val)) {};
+
+    //! Assignment operator to set the whole container data
+    template<typename V, typename = std::enable_if_t<std::is_convertible_v<V, std::vector<T>>>>
+    TaggedJSONVector& operator=(V&& val) { m_vec = std::forward<V>(val); return *this; };
+
+    bool operator!=(const std::vector<T>& other) const { return m_vec != other; };
+    bool operator==(const std::vector<T>& other) const { return m_vec == other; };
+
+    //! Mutable reference of the stored vector
+    std::vector<T>& operator*() { return m_vec; };
+
+    //! Immutable reference of the stored vector
+    const std::vector<T>& operator*() const { return m_vec; };
+
+    //! Can be used for accessing the std::vector operations on the encapsulated data
+    const std::vector<T>* operator->() const { return &m_vec; };
+
+    //! Mutable access operator
+    decltype(auto) operator[](const qsizetype i) { return m_vec[i]; };
+
+    //! Immutable access operator
+    decltype(auto) operator[](const qsizetype i) const { return m_vec[i]; };
+
+    //! Mutable access with bounds checking
+    decltype(auto) at(const qsizetype i) { return m_vec.at(i); };
+
+    //! Immutable access with bounds checking
+    decltype(auto) at(const qsizetype i) const { return m_vec.at(i); };
+
+    //! Pointer to the first element of the contiguous storage, not available for bool
+    template<typename S = T, typename = std::enable_if_t<!std::is_same_v<S, bool>>>
+    T* data() { return m_vec.data(); }
+
+    //! Pointer to the first element of the contiguous storage, not available for bool
+    template<typename S = T, typename = std::enable_if_t<!std::is_same_v<S, bool>>>
+    const T* data() const { return m_vec.data(); }
+
+    //! Number of the stored elements
+    qsizetype size() const { return static_cast<qsizetype>(m_vec.size()); }
+
+    //! Returns true if there aren't any elements
+    bool empty() const { return m_vec.empty(); }
+
+    auto begin() { return m_vec.begin(); }
+    auto end() { return m_vec.end(); }
+    auto begin() const { return m_vec.begin(); }
+    auto end() const { return m_vec.end(); }
+
+    //!\brief operator QString QString constructor variant for qDebug stream access.
+    operator QString() const {
+        QString ret;
+
+        for (const T curVal : m_vec)
+            ret.append(QString::number(curVal) + "\n");
+        return ret;
+    };
+
+    //! Copy of the stored elements, kept for interface compatibility with TaggedJSONArray. Prefer operator*() that doesn't copy.
+    std::vector<T> toStdVector() const { return m_vec; }
+
+    //! QVector copy of the stored elements
+    QVector<T> toQVector() const { return QVector<T>(m_vec.begin(), m_vec.end()); }
+
+    //! Error-collecting validation, reports a missing array and every element of another type
+    static void validateJson(const QJsonValue& ref, TaggedObject::ValidationContext& context) { TaggedObject::validateJsonValueArray<T>(ref, context); }
+
+    //! Builds the QJsonArray of the stored elements
+    QJsonValue toJsonValue() const
+    {
+        QJsonArray ret;
+        for (const T curVal : m_vec) {
+            if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>)
+                ret.append(TaggedObject::integralToJsonValue(curVal));
+            else
+                ret.append(QJsonValue(curVal));
+        }
+        return ret;
+    }
+
+    /*!
+     * \brief readJson Direct-binding counterpart of the QJsonValue constructor, converts the elements straight from the JSON text.
+     * \param reader JSON reader positioned on the value of this member
+     * \param checkValue Unused, the value exists if the reader is positioned on it. Kept for the uniform member interface.
+     */
+    void readJson(TaggedObject::JsonReader& reader, const bool checkValue = true)
+    {
+        Q_UNUSED(checkValue)
+        m_vec.clear();
+        if (!reader.beginArray()) {
+            reader.skipValue();
+            return;
+        }
+
+        //Element conversions are shared with TaggedJSONObject so both parse modes agree
+        TaggedJSONObject<T> element;
+        while (reader.nextElement()) {
+            element.readJson(reader);
+            m_vec.push_back(*element);
+        }
+    }
+
+    /*!
+     * \brief writeJson Direct serialization counterpart of toJsonValue(), writes the elements without building a QJsonArray.
+     * \param writer JSON writer positioned where the value of this member belongs
+     */
+    void writeJson(TaggedObject::JsonWriter& writer) const
+    {
+        writer.beginArray();
+        for (const T curVal : m_vec) {
+            if constexpr (std::is_same_v<T, bool>)
+                writer.writeBool(curVal);
+            else if constexpr (std::is_integral_v<T> && std::is_unsigned_v<T>)
+                writer.writeUnsignedInteger(curVal);
+            else if constexpr (std::is_integral_v<T>)
+                writer.writeInteger(curVal);
+            else
+                writer.writeDouble(curVal);
+        }
+        writer.endArray();
+    }
+
+    /*!
+     * \brief readCbor CBOR counterpart of readJson(), converts the elements straight from the CBOR data.
+     * \param reader CBOR reader positioned on the value of this member
+     * \param checkValue Unused, the value exists if the reader is positioned on it. Kept for the uniform member interface.
+     */
+    template<typename Reader>
+    void readCbor(Reader& reader, const bool checkValue = true)
+    {
+        Q_UNUSED(checkValue)
+        m_vec.clear();
+        if (!reader.isArray()) {
+            reader.next();
+            return;
+        }
+        if (reader.isLengthKnown())
+            m_vec.reserve(static_cast<std::size_t>(reader.length()));
+        if (!reader.enterContainer())
+            return;
+
+        TaggedJSONObject<T> element;
+        while (reader.hasNext()) {
+            element.readCbor(reader);
+            m_vec.push_back(*element);
+        }
+        if (!TaggedObject::hasCborError(reader))
+            reader.leaveContainer();
+    }
+
+    /*!
+     * \brief writeCbor CBOR counterpart of writeJson(), writes the elements without building a QJsonArray.
+     * \param writer CBOR writer positioned where the value of this member belongs
+     */
+    template<typename Writer>
+    void writeCbor(Writer& writer) const
+    {
+        writer.startArray(static_cast<quint64>(m_vec.size()));
+        for (const T curVal : m_vec) {
+            if constexpr (std::is_same_v<T, bool>)
+                writer.append(curVal);
+            else if constexpr (std::is_integral_v<T> && std::is_unsigned_v<T>)
+                writer.append(static_cast<quint64>(curVal));
+            else if constexpr (std::is_integral_v<T>)
+                writer.append(static_cast<qint64>(curVal));
+            else
+                writer.append(static_cast<double>(curVal));
+        }
+        writer.endArray();
+    }
+
+private:
+    std::vector<T> m_vec;
+
+    static T dispatchValue(const QJsonValue& ref) {
+        if constexpr (std::is_same_v<T, bool>)
+            return ref.toBool();
+        else if constexpr (std::is_integral_v<T>)
+            return TaggedObject::jsonValueToIntegral<T>(ref);
+        else
+            return ref.toDouble();
+    };
+};
+
+/*!
+ * \brief operator << stdout implementation for the contained object.
+ * \param stream The std stream
+ * \param obj The class instance
+ * \return The output stream
+ */
+template<typename T>
+std::ostream& operator<< (std::ostream& stream, const TaggedJSONVector<T>& obj)
+{
+    for (const T curVal : *obj)
+        stream << std::to_string(curVal) + "\n";
+    return stream;
+};
+
+using TaggedJSONBoolVector = TaggedJSONVector<bool>;
+using TaggedJSONIntVector = TaggedJSONVector<int>;
+using TaggedJSONInt64Vector = TaggedJSONVector<qint64>;
+using TaggedJSONDoubleVector = TaggedJSONVector<double>;
+
+#endif // TAGGEDJSONVECTOR_H
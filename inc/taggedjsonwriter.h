@@ -0,0 +1,381 @@
+#ifndef TAGGEDJSONWRITER_H
+#define TAGGEDJSONWRITER_H
+#include <cmath>
+#include <string_view>
+#include <QtGlobal>
+#include <QByteArray>
+#include <QString>
+#include <QLocale>
+#include <QJsonValue>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include "taggedjsonnumber.h"
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+#include <QCborValue>
+#endif
+
+namespace TaggedObject {
+
+/*!
+ * \class JsonWriter
+ * \brief The JsonWriter class emits UTF-8 JSON text straight into a byte array in a single pass.
+ *
+ * It is the counterpart of JsonReader for the serialization side (see toJson() on the classes generated by
+ * the #TJO_DEFINE_JSON_TAGGED_OBJECT() macro). Each TaggedJSONObject/TaggedJSONArray member writes its own value, so no QJsonObject
+ * or QJsonArray is built in between.\n
+ * The output is byte-identical to QJsonDocument::toJson() for the same data, in both compact and indented formats. This includes the
+ * number formatting, the string escaping and the trailing newline of the indented format. The writer doesn't sort the keys, callers
+ * have to emit them in the order QJsonObject would iterate them.\n
+ * The text is appended to the referenced buffer, which has to outlive the writer.
+ */
+class JsonWriter
+{
+public:
+    /*!
+     * \brief JsonWriter Constructor that appends to the given buffer
+     * \param out Buffer that receives the JSON text. Its existing content is kept.
+     * \param format Output format, same as the one of QJsonDocument::toJson()
+     */
+    explicit JsonWriter(QByteArray& out, const QJsonDocument::JsonFormat format=QJsonDocument::Indented)
+        : m_out(out), m_compact(format == QJsonDocument::Compact) {}
+
+    //! Opens an object as the next value
+    void beginObject() { beginContainer('{'); }
+
+    //! Closes the innermost object
+    void endObject() { endContainer('}'); }
+
+    //! Opens an array as the next value
+    void beginArray() { beginContainer('['); }
+
+    //! Closes the innermost array
+    void endArray() { endContainer(']'); }
+
+    /*!
+     * \brief key Sets the key of the next object member
+     *
+     * The key is only written together with its value, so a key followed by an undefined value is dropped the same way QJsonObject drops it.
+     * \param name The key, it has to stay valid until the value is written
+     */
+    void key(const QString& name) { m_pendingKey = &name; m_hasKey = true; }
+
+    /*!
+     * \brief key Sets the key of the next object member from a plain ASCII name that doesn't need escaping
+     * \param name The key, it has to stay valid until the value is written
+     */
+    void key(const std::string_view name) { m_pendingName = name; m_pendingKey = nullptr; m_hasKey = true; }
+
+    //! Writes a null value
+    void writeNull() { beforeValue(); m_out += "null"; }
+
+    //! Writes a boolean value
+    void writeBool(const bool value) { beforeValue(); m_out += value ? "true" : "false"; }
+
+    //! Writes an integer value the way QJsonValue stores integers
+    void writeInteger(const qint64 value)
+    {
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+        beforeValue();
+        appendJsonInteger(m_out, value);
+#else
+        writeDouble(double(value));
+#endif
+    }
+
+    /*!
+     * \brief writeUnsignedInteger Writes an unsigned integer value
+     *
+     * Values beyond the qint64 range are written with all of their digits, QJsonValue can only hold them as doubles.
+     * \param value The value to write
+     */
+    void writeUnsignedInteger(const quint64 value)
+    {
+        if (value <= static_cast<quint64>(std::numeric_limits<qint64>::max())) {
+            writeInteger(static_cast<qint64>(value));
+            return;
+        }
+        beforeValue();
+        appendJsonInteger(m_out, value);
+    }
+
+    //! Writes a floating point value, non-finite values are written as null
+    void writeDouble(const double value)
+    {
+        beforeValue();
+        appendDouble(value);
+    }
+
+    //! Writes an escaped string value
+    void writeString(const QString& value)
+    {
+        beforeValue();
+        appendString(value);
+    }
+
+    /*!
+     * \brief writeUtf8String Writes a string value that is already UTF-8 encoded, without converting it to UTF-16 first
+     *
+     * Quote, backslash and control characters are escaped, the other bytes are copied as they are, so the value has to be valid UTF-8.
+     * \param value UTF-8 encoded string
+     */
+    void writeUtf8String(const std::string_view value)
+    {
+        beforeValue();
+        m_out += '"';
+        auto it = value.begin();
+        while (it != value.end()) {
+            const auto run = it;
+            while (it != value.end() && static_cast<unsigned char>(*it) >= 0x20 && *it != '"' && *it != '\\')
+                ++it;
+            m_out.append(&*run, static_cast<qsizetype>(it - run));
+            if (it == value.end())
+                break;
+            appendEscapedAscii(static_cast<unsigned char>(*it++));
+        }
+        m_out += '"';
+    }
+
+    /*!
+     * \brief writeValue Writes an arbitrary JSON value
+     *
+     * An undefined value drops the pending key of an object member and is written as null inside an array, like QJsonDocument does.
+     * \param value The value to write
+     */
+    void writeValue(const QJsonValue& value)
+    {
+        switch (value.type()) {
+        case QJsonValue::Undefined:
+            if (m_hasKey)
+                m_hasKey = false;
+            else
+                writeNull();
+            break;
+        case QJsonValue::Bool:
+            writeBool(value.toBool());
+            break;
+        case QJsonValue::Double:
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+            //Qt 6 keeps integers apart from the doubles and formats them differently
+            if (QCborValue::fromJsonValue(value).isInteger()) {
+                writeInteger(value.toInteger());
+                break;
+            }
+#endif
+            writeDouble(value.toDouble());
+            break;
+        case QJsonValue::String:
+            writeString(value.toString());
+            break;
+        case QJsonValue::Array:
+            writeArray(value.toArray());
+            break;
+        case QJsonValue::Object:
+            writeObject(value.toObject());
+            break;
+        default:
+            writeNull();
+        }
+    }
+
+    //! Writes a QJsonObject, members are emitted in its own (sorted) order
+    void writeObject(const QJsonObject& object)
+    {
+        beginObject();
+        for (auto it = object.constBegin(); it != object.constEnd(); ++it) {
+            const QString name = it.key();
+            key(name);
+            writeValue(it.value());
+        }
+        endObject();
+    }
+
+    //! Writes a QJsonArray
+    void writeArray(const QJsonArray& array)
+    {
+        beginArray();
+        for (const QJsonValue& element : array)
+            writeValue(element);
+        endArray();
+    }
+
+    /*!
+     * \brief fragmentWriter Creates a writer for the next values of the current container that writes into a separate buffer
+     *
+     * It allows the values of a large array to be written concurrently. The fragments have to be joined in order with appendFragment().
+     * \param out Buffer of the fragment
+     * \param leading Has to be true only for the fragment that holds the first of the values written after this call
+     * \return The writer of the fragment
+     */
+    JsonWriter fragmentWriter(QByteArray& out, const bool leading) const
+    {
+        JsonWriter ret(out, m_compact ? QJsonDocument::Compact : QJsonDocument::Indented);
+        ret.m_depth = m_depth;
+        ret.m_first = m_first && leading;
+        return ret;
+    }
+
+    //! Appends a fragment that has been written by a fragmentWriter() of this writer
+    void appendFragment(const QByteArray& fragment)
+    {
+        if (fragment.isEmpty())
+            return;
+        m_out += fragment;
+        m_first = false;
+    }
+
+private:
+    QByteArray& m_out;
+    const bool m_compact;
+    int m_depth = 0;
+    bool m_first = true;
+    const QString* m_pendingKey = nullptr;
+    std::string_view m_pendingName;
+    bool m_hasKey = false;
+
+    void newLine()
+    {
+        if (!m_compact) {
+            m_out += '\n';
+            m_out.append(4 * m_depth, ' ');
+        }
+    }
+
+    //Separator, indentation and the pending key of the value that is about to be written
+    void beforeValue()
+    {
+        if (m_depth == 0)
+            return;
+
+        if (!m_first)
+            m_out += ',';
+        m_first = false;
+        newLine();
+
+        if (m_hasKey) {
+            m_out += '"';
+            if (m_pendingKey)
+                appendEscaped(*m_pendingKey);
+            else
+                m_out.append(m_pendingName.data(), static_cast<qsizetype>(m_pendingName.size()));
+            m_out += m_compact ? "\":" : "\": ";
+            m_hasKey = false;
+        }
+    }
+
+    void beginContainer(const char open)
+    {
+        beforeValue();
+        m_out += open;
+        ++m_depth;
+        m_first = true;
+    }
+
+    void endContainer(const char close)
+    {
+        --m_depth;
+        newLine();
+        m_out += close;
+        m_first = false;
+
+        //QJsonDocument terminates the indented document with a newline
+        if (m_depth == 0 && !m_compact)
+            m_out += '\n';
+    }
+
+    void appendDouble(const double value)
+    {
+        if (!std::isfinite(value)) {
+            m_out += "null";
+            return;
+        }
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+        appendJsonDouble(m_out, value);
+#else
+        const double absolute = std::abs(value);
+        m_out += QByteArray::number(value, absolute == static_cast<quint64>(absolute) ? 'f' : 'g', QLocale::FloatingPointShortest);
+#endif
+    }
+
+    void appendString(const QString& value)
+    {
+        m_out += '"';
+        appendEscaped(value);
+        m_out += '"';
+    }
+
+    static char hexDigit(const unsigned value) { return "0123456789abcdef"[value & 0xF]; }
+
+    //Escape sequence of a quote, a backslash or a control character
+    void appendEscapedAscii(const unsigned unit)
+    {
+        m_out += '\\';
+        switch (unit) {
+        case '"': m_out += '"'; break;
+        case '\\': m_out += '\\'; break;
+        case '\b': m_out += 'b'; break;
+        case '\f': m_out += 'f'; break;
+        case '\n': m_out += 'n'; break;
+        case '\r': m_out += 'r'; break;
+        case '\t': m_out += 't'; break;
+        default:
+            m_out += "u00";
+            m_out += hexDigit(unit >> 4);
+            m_out += hexDigit(unit);
+        }
+    }
+
+    //Same escaping rules as QJsonDocument: control characters, quote and backslash are escaped, the rest is written as UTF-8
+    void appendEscaped(const QString& value)
+    {
+        const auto* it = value.utf16();
+        const auto* const end = it + value.size();
+        while (it != end) {
+            //Plain ASCII runs are copied in one go
+            const auto* run = it;
+            while (it != end && *it < 0x80 && *it >= 0x20 && *it != '"' && *it != '\\')
+                ++it;
+            if (it != run) {
+                const qsizetype start = m_out.size();
+                m_out.resize(start + (it - run));
+                char* dest = m_out.data() + start;
+                for (; run != it; ++run)
+                    *dest++ = static_cast<char>(*run);
+            }
+            if (it == end)
+                break;
+
+            const unsigned unit = *it++;
+            if (unit < 0x80)
+                appendEscapedAscii(unit);
+            else if (unit < 0x800) {
+                m_out += static_cast<char>(0xC0 | (unit >> 6));
+                m_out += static_cast<char>(0x80 | (unit & 0x3F));
+            }
+            else if (unit >= 0xD800 && unit <= 0xDBFF && it != end && *it >= 0xDC00 && *it <= 0xDFFF) {
+                const unsigned codePoint = 0x10000 + ((unit - 0xD800) << 10) + (unsigned(*it++) - 0xDC00);
+                m_out += static_cast<char>(0xF0 | (codePoint >> 18));
+                m_out += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+                m_out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                m_out += static_cast<char>(0x80 | (codePoint & 0x3F));
+            }
+            else if (unit >= 0xD800 && unit <= 0xDFFF) {
+                //Lone surrogates can't be encoded as UTF-8, QJsonDocument escapes them
+                m_out += "\\u";
+                m_out += hexDigit(unit >> 12);
+                m_out += hexDigit(unit >> 8);
+                m_out += hexDigit(unit >> 4);
+                m_out += hexDigit(unit);
+            }
+            else {
+                m_out += static_cast<char>(0xE0 | (unit >> 12));
+                m_out += static_cast<char>(0x80 | ((unit >> 6) & 0x3F));
+                m_out += static_cast<char>(0x80 | (unit & 0x3F));
+            }
+        }
+    }
+};
+
+}
+
+#endif // TAGGEDJSONWRITER_H
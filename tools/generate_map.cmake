@@ -0,0 +1,140 @@
+# Generates inc/map.h, the MAP macros that the tagged object macros expand their members with.
+#
+# Usage: cmake [-DMAP_MAX_ARGUMENTS=<n>] [-DMAP_OUTPUT=<path>] -P tools/generate_map.cmake
+# The generate_map_h target of the project runs it with the defaults. Every step of the chain follows the same pattern, so raising the
+# limit only takes running the script with a larger MAP_MAX_ARGUMENTS. Compilers have limits of their own on the nesting of macro expansions,
+# the default of 1024 works with GCC and Clang.
+# The chain is emitted twice, the second one rescans every call that forwards __VA_ARGS__ for the traditional preprocessor of MSVC (see
+# MAP_TRADITIONAL_PREPROCESSOR in the generated file). Its rescans nest once per argument, which is why the conforming preprocessors don't use it.
+
+if(NOT DEFINED MAP_MAX_ARGUMENTS)
+  set(MAP_MAX_ARGUMENTS 1024)
+endif()
+if(NOT DEFINED MAP_OUTPUT)
+  get_filename_component(MAP_OUTPUT "${CMAKE_CURRENT_LIST_DIR}/../inc/map.h" ABSOLUTE)
+endif()
+
+set(content [=[
+/*
+ * Based on the MAP macro created by William Swanson in 2012 (https://github.com/swansontec/map-macro), which he dedicated to the public domain:
+ *
+ * I, William Swanson, dedicate this work to the public domain.
+ * I waive all rights to the work worldwide under copyright law,
+ * including all related and neighboring rights,
+ * to the extent allowed by law.
+ *
+ * You can copy, modify, distribute and perform the work,
+ * even for commercial purposes, all without asking permission.
+ */
+
+/*
+ * The end of the arguments is detected by peeking at the next argument the way the original does (MAP_GET_END, MAP_NEXT). The original EVAL based
+ * recursion rescans its whole output a fixed 365 times whatever the number of arguments is, which also caps the number of arguments. The arguments
+ * are walked by a chain of distinct macros (MAP_I0, MAP_I1, ...) instead, each step is expanded once as no macro of the chain is expanded inside
+ * itself, so the work is proportional to the number of arguments. The chain has MAP_MAX_ARGUMENTS steps, an argument beyond them ends up in a
+ * static_assert.
+ *
+ * This file is generated by tools/generate_map.cmake, change the script and run it (or the generate_map_h target) instead of editing the file.
+ */
+
+#ifndef MAP_H_INCLUDED
+#define MAP_H_INCLUDED
+
+]=])
+
+string(APPEND content "#define MAP_MAX_ARGUMENTS ${MAP_MAX_ARGUMENTS}\n")
+string(APPEND content [=[
+
+#define MAP_END(...)
+#define MAP_COMMA() ,
+#define MAP_NOTHING()
+
+#define MAP_GET_END2() 0, MAP_END
+#define MAP_GET_END1(...) MAP_GET_END2
+#define MAP_GET_END(...) MAP_GET_END1
+#define MAP_NEXT0(test, next, ...) next
+#define MAP_NEXT(peek, sep, next) MAP_NEXT1(MAP_GET_END peek, sep, next)
+
+#define MAP_CALL(f, i, x) f(x)
+#define MAP_CALL_INDEXED(f, i, x) f(i, x)
+
+/*
+ * The traditional preprocessor of MSVC passes the commas of __VA_ARGS__ and of expanded arguments on inside a single argument, so the steps would
+ * never see more than one argument. MAP_EXPAND rescans every call that takes them, which splits them again. /Zc:preprocessor selects the conforming
+ * preprocessor, defining MAP_TRADITIONAL_PREPROCESSOR selects the rescanning chain with any compiler.
+ */
+#if defined(_MSC_VER) && (!defined(_MSVC_TRADITIONAL) || _MSVC_TRADITIONAL) && !defined(MAP_TRADITIONAL_PREPROCESSOR)
+#define MAP_TRADITIONAL_PREPROCESSOR
+#endif
+
+]=])
+
+function(append_chain tailPrefix tailSuffix)
+  math(EXPR last "${MAP_MAX_ARGUMENTS} - 1")
+  string(APPEND content "//Step i calls m(f, i, x) for the argument x, inserts sep() if there is a next argument and continues with step i + 1\n")
+  foreach(i RANGE 0 ${last})
+    math(EXPR next "${i} + 1")
+    string(APPEND content "#define MAP_I${i}(m, f, sep, x, peek, ...) m(f, ${i}, x) ${tailPrefix}MAP_NEXT(peek, sep, MAP_I${next})(m, f, sep, peek, __VA_ARGS__)${tailSuffix}\n")
+  endforeach()
+  set(content "${content}" PARENT_SCOPE)
+endfunction()
+
+string(APPEND content "#ifdef MAP_TRADITIONAL_PREPROCESSOR\n")
+string(APPEND content [=[
+#define MAP_EXPAND(...) __VA_ARGS__
+#define MAP_NEXT1(test, sep, next) MAP_EXPAND(MAP_NEXT0(test, sep() next, 0))
+#define MAP_APPLY(m, f, sep, ...) MAP_EXPAND(MAP_I0(m, f, sep, __VA_ARGS__, ()()(), ()()(), ()()(), 0))
+
+]=])
+append_chain("MAP_EXPAND(" ")")
+string(APPEND content "\n#else\n")
+string(APPEND content [=[
+#define MAP_NEXT1(test, sep, next) MAP_NEXT0(test, sep() next, 0)
+#define MAP_APPLY(m, f, sep, ...) MAP_I0(m, f, sep, __VA_ARGS__, ()()(), ()()(), ()()(), 0)
+
+]=])
+append_chain("" "")
+string(APPEND content "\n#endif\n")
+
+string(APPEND content "
+/*
+ * There is no step for an argument beyond the limit, the call ends up in a static_assert that names it. The form depends on the separator, so it
+ * fits where the list is expanded: a declaration or a statement after MAP and MAP_INDEXED, an expression after MAP_LIST and MAP_LIST_INDEXED.
+ * A MAP_LIST in a parameter list has no valid form, the compiler reports a syntax error there and the static_assert of the other lists follows.
+ */
+#define MAP_LIMIT_MESSAGE \"map.h: MAP, MAP_LIST, MAP_INDEXED and MAP_LIST_INDEXED take at most MAP_MAX_ARGUMENTS (${MAP_MAX_ARGUMENTS}) arguments, see tools/generate_map.cmake\"
+#define MAP_LIMIT_MAP_NOTHING static_assert(MAP_MAX_ARGUMENTS < 0, MAP_LIMIT_MESSAGE);
+#define MAP_LIMIT_MAP_COMMA ([] { static_assert(MAP_MAX_ARGUMENTS < 0, MAP_LIMIT_MESSAGE); }(), 0)
+#define MAP_I${MAP_MAX_ARGUMENTS}(m, f, sep, x, peek, ...) MAP_LIMIT_##sep
+")
+
+string(APPEND content [=[
+
+/**
+ * Applies the function macro `f` to each of the remaining parameters.
+ */
+#define MAP(f, ...) MAP_APPLY(MAP_CALL, f, MAP_NOTHING, __VA_ARGS__)
+
+/**
+ * Applies the function macro `f` to each of the remaining parameters and
+ * inserts commas between the results.
+ */
+#define MAP_LIST(f, ...) MAP_APPLY(MAP_CALL, f, MAP_COMMA, __VA_ARGS__)
+
+/**
+ * Applies the function macro `f` to the zero-based index and each of the
+ * remaining parameters.
+ */
+#define MAP_INDEXED(f, ...) MAP_APPLY(MAP_CALL_INDEXED, f, MAP_NOTHING, __VA_ARGS__)
+
+/**
+ * Applies the function macro `f` to the zero-based index and each of the
+ * remaining parameters and inserts commas between the results.
+ */
+#define MAP_LIST_INDEXED(f, ...) MAP_APPLY(MAP_CALL_INDEXED, f, MAP_COMMA, __VA_ARGS__)
+
+#endif
+]=])
+
+file(WRITE "${MAP_OUTPUT}" "${content}")
+message(STATUS "Generated ${MAP_OUTPUT} with ${MAP_MAX_ARGUMENTS} steps")